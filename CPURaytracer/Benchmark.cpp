@@ -0,0 +1,461 @@
+#include "Precomp.h"
+#include "Raytracer.h"
+#include "Debug.h"
+#include "Timer.h"
+
+bool Raytracer::RunTraceBenchmark(FXMMATRIX cameraWorldTransform)
+{
+    // Number of random boxes (instances of a 10 triangle cube) added to the Cornell box for each run
+    static const int SceneBoxCounts[] = { 0, 100, 1000, 10000, 50000 };
+
+    // Brute force tracing is O(rays x triangles), so only trace a strided subset of
+    // the rays through it, keeping the total triangle tests per run around this many.
+    static const double MaxBruteForceTests = 2.0e8;
+
+    // Length of the visibility queries timed against OccludedRay. Short enough that
+    // a good share of them miss, like shadow rays towards a nearby light.
+    static const float OcclusionDist = 2.f;
+
+    struct BenchmarkRay
+    {
+        XMFLOAT3 Start;
+        XMFLOAT3 Dir;
+    };
+    std::vector<BenchmarkRay> rays;
+    std::vector<float> bvhDists;
+    std::vector<float> cameraDists;
+
+    wprintf(L"Trace benchmark: %dx%d primary rays + 1 diffuse bounce each, single thread\n", Width, Height);
+    wprintf(L"%10ls %10ls %8ls %6ls %10ls %14ls %14ls %9ls %15ls %14ls %14ls %11ls\n",
+        L"Triangles", L"Build(ms)", L"Nodes", L"Depth", L"Memory(KB)", L"Brute(Mray/s)", L"Bvh(Mray/s)", L"Speedup",
+        L"Occlude(Mray/s)", L"Camera(Mray/s)", L"Packet(Mray/s)", L"Mismatches");
+
+    for (int run = 0; run < (int)_countof(SceneBoxCounts); ++run)
+    {
+        // Same scene & rays every time the benchmark is run
+        srand(12345);
+
+        if (!GenerateTestScene(SceneBoxCounts[run]))
+        {
+            LogError(L"Failed to create benchmark scene.");
+            return false;
+        }
+
+        double buildStart = GetTimeInSeconds();
+        if (!BuildBvh())
+        {
+            LogError(L"Failed to build benchmark scene BVH.");
+            return false;
+        }
+        double buildTime = GetTimeInSeconds() - buildStart;
+
+        // Both levels of the acceleration structure, and the geometry they're built over
+        int numNodes = InstanceBvh.GetNumNodes();
+        int maxModelDepth = 0;
+        size_t memoryUsage = SceneData.GetMemoryUsage() + InstanceBvh.GetMemoryUsage() +
+            SceneData.GetNumInstances() * sizeof(XMFLOAT4X3) + NumTrianglePackets * sizeof(TrianglePacket);
+        for (int i = 0; i < SceneData.GetNumModels(); ++i)
+        {
+            numNodes += ModelBvhs[i].Hierarchy.GetNumNodes();
+            maxModelDepth = max(maxModelDepth, ModelBvhs[i].Hierarchy.GetDepth());
+            memoryUsage += ModelBvhs[i].Hierarchy.GetMemoryUsage();
+        }
+
+        // Gather rays up front: one primary ray per pixel, plus a diffuse bounce from wherever it lands.
+        // The bounce rays are incoherent, which is closer to what the path tracer generates.
+        rays.clear();
+        for (int y = 0; y < Height; ++y)
+        {
+            for (int x = 0; x < Width; ++x)
+            {
+                XMVECTOR dir = XMVectorScale(cameraWorldTransform.r[2], DistToProjPlane);
+                dir = XMVectorAdd(dir, XMVectorScale(cameraWorldTransform.r[0], (float)x - HalfWidth));
+                dir = XMVectorAdd(dir, XMVectorScale(cameraWorldTransform.r[1], HalfHeight - (float)y));
+                dir = XMVector3Normalize(dir);
+
+                BenchmarkRay ray;
+                XMStoreFloat3(&ray.Start, cameraWorldTransform.r[3]);
+                XMStoreFloat3(&ray.Dir, dir);
+                rays.push_back(ray);
+
+                RayIntersection intersection;
+                if (TraceRay(cameraWorldTransform.r[3], dir, &intersection))
+                {
+                    XMVECTOR normal = XMLoadFloat3(&intersection.Normal);
+                    XMVECTOR p = XMLoadFloat3(&intersection.Point) + normal * 0.001f;
+                    Sampler sampler(Sampler::Random, y * Width + x, 0, run);
+                    float u, v;
+                    sampler.Next2D(&u, &v);
+
+                    XMStoreFloat3(&ray.Start, p);
+                    XMStoreFloat3(&ray.Dir, PickVectorInHemisphere(normal, u, v));
+                    rays.push_back(ray);
+                }
+            }
+        }
+
+        int numRays = (int)rays.size();
+        bvhDists.resize(numRays);
+
+        RayIntersection intersection;
+        double bvhStart = GetTimeInSeconds();
+        for (int i = 0; i < numRays; ++i)
+        {
+            bool hit = TraceRay(XMLoadFloat3(&rays[i].Start), XMLoadFloat3(&rays[i].Dir), &intersection);
+            bvhDists[i] = hit ? intersection.Dist : -1.f;
+        }
+        double bvhTime = GetTimeInSeconds() - bvhStart;
+
+        // Any-hit queries must agree with the closest hit TraceRay found
+        int numMismatches = 0;
+        double occludedStart = GetTimeInSeconds();
+        for (int i = 0; i < numRays; ++i)
+        {
+            bool occluded = OccludedRay(XMLoadFloat3(&rays[i].Start), XMLoadFloat3(&rays[i].Dir), OcclusionDist);
+            if (occluded != (bvhDists[i] >= 0.f && bvhDists[i] < OcclusionDist))
+            {
+                ++numMismatches;
+            }
+        }
+        double occludedTime = GetTimeInSeconds() - occludedStart;
+
+        int stride = max(1, (int)(numRays * (double)GetNumTriangles() / MaxBruteForceTests));
+        int numBruteForceRays = 0;
+        double bruteForceStart = GetTimeInSeconds();
+        for (int i = 0; i < numRays; i += stride)
+        {
+            bool hit = TraceRayBruteForce(XMLoadFloat3(&rays[i].Start), XMLoadFloat3(&rays[i].Dir), &intersection);
+            float dist = hit ? intersection.Dist : -1.f;
+            if (fabsf(dist - bvhDists[i]) > 0.0001f)
+            {
+                ++numMismatches;
+            }
+            ++numBruteForceRays;
+        }
+        double bruteForceTime = GetTimeInSeconds() - bruteForceStart;
+
+        // Camera rays alone, one at a time and then in 2x2 packets as the renderer traces them. The
+        // packets must find the same hits.
+        int numCameraRays = Width * Height;
+        cameraDists.resize(numCameraRays);
+        double cameraStart = GetTimeInSeconds();
+        for (int y = 0; y < Height; ++y)
+        {
+            for (int x = 0; x < Width; ++x)
+            {
+                bool hit = TraceRay(cameraWorldTransform.r[3], GetCameraRayDir(cameraWorldTransform, x, y), &intersection);
+                cameraDists[y * Width + x] = hit ? intersection.Dist : -1.f;
+            }
+        }
+        double cameraTime = GetTimeInSeconds() - cameraStart;
+
+        double packetStart = GetTimeInSeconds();
+        for (int y = 0; y < Height; y += 2)
+        {
+            for (int x = 0; x < Width; x += 2)
+            {
+                XMVECTOR starts[RayPacketWidth], dirs[RayPacketWidth];
+                XMFLOAT4 maxDist(FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX);
+                for (int lane = 0; lane < RayPacketWidth; ++lane)
+                {
+                    int px = x + (lane & 1);
+                    int py = y + (lane >> 1);
+                    if (px >= Width || py >= Height)
+                    {
+                        (&maxDist.x)[lane] = -1.f;
+                    }
+                    starts[lane] = cameraWorldTransform.r[3];
+                    dirs[lane] = GetCameraRayDir(cameraWorldTransform, min(px, Width - 1), min(py, Height - 1));
+                }
+
+                RayPacket packet;
+                PrepareRayPacket(starts, dirs, XMLoadFloat4(&maxDist), &packet);
+                RayIntersection hits[RayPacketWidth];
+                int hitLanes = TraceRayPacket(packet, hits);
+
+                for (int lane = 0; lane < RayPacketWidth; ++lane)
+                {
+                    int px = x + (lane & 1);
+                    int py = y + (lane >> 1);
+                    if (px < Width && py < Height)
+                    {
+                        float dist = (hitLanes & (1 << lane)) ? hits[lane].Dist : -1.f;
+                        if (fabsf(dist - cameraDists[py * Width + px]) > 0.0001f)
+                        {
+                            ++numMismatches;
+                        }
+                    }
+                }
+            }
+        }
+        double packetTime = GetTimeInSeconds() - packetStart;
+
+        double bvhRate = numRays / bvhTime;
+        double bruteForceRate = numBruteForceRays / bruteForceTime;
+        double occludedRate = numRays / occludedTime;
+        double cameraRate = numCameraRays / cameraTime;
+        double packetRate = numCameraRays / packetTime;
+
+        // Mismatches are counted over the brute force subset, every occlusion query and every packet ray
+        wprintf(L"%10lld %10.1f %8d %6d %10.1f %14.4f %14.4f %8.1fx %15.4f %14.4f %14.4f %5d/%-5d\n",
+            (long long)GetNumTriangles(), buildTime * 1000.0, numNodes, InstanceBvh.GetDepth() + maxModelDepth,
+            memoryUsage / 1024.0, bruteForceRate / 1.0e6, bvhRate / 1.0e6, bvhRate / bruteForceRate, occludedRate / 1.0e6,
+            cameraRate / 1.0e6, packetRate / 1.0e6, numMismatches, numBruteForceRays + numRays + numCameraRays);
+        fflush(stdout);
+    }
+
+    // Put the regular scene back
+    return SetTestScene(0);
+}
+
+bool Raytracer::RunAnimationBenchmark(FXMMATRIX cameraWorldTransform, int numFrames)
+{
+    // Boxes (10 triangles each) in the animated model. They drift around the room at random
+    // velocities, bouncing off the walls, so they keep passing through each other's space,
+    // which is about the worst case for refitting.
+    static const int NumMovingBoxes = 100000;
+    static const float MinSpeed = 0.2f;     // Units per second. The room is 5 units across.
+    static const float MaxSpeed = 1.f;
+    static const float FrameTime = 1.f / 30.f;
+
+    struct UpdateMethod
+    {
+        const wchar_t* Name;
+        bool Refit;             // Otherwise the BVHs are built from scratch every frame
+        bool Restructure;
+    };
+    static const UpdateMethod Methods[] =
+    {
+        { L"Rebuild", false, false },
+        { L"Refit", true, false },
+        { L"Refit+treelets", true, true },
+    };
+
+    bool restructuringEnabled = BvhRestructuringEnabled;
+
+    for (int method = 0; method < (int)_countof(Methods); ++method)
+    {
+        // Same scene & motion for every method
+        srand(12345);
+        if (!GenerateTestScene(NumMovingBoxes, true) || !PrepareScene())
+        {
+            LogError(L"Failed to create animation benchmark scene.");
+            return false;
+        }
+
+        // The boxes are the last model, with their vertices stored box by box
+        int model = SceneData.GetNumModels() - 1;
+        int firstVertex = (int)SceneData.GetIndices()[SceneData.GetModel(model).FirstTriangle * 3];
+        int verticesPerBox = (SceneData.GetNumVertices() - firstVertex) / NumMovingBoxes;
+
+        std::vector<XMFLOAT3> centers(NumMovingBoxes);
+        std::vector<XMFLOAT3> velocities(NumMovingBoxes);
+        for (int box = 0; box < NumMovingBoxes; ++box)
+        {
+            XMVECTOR center = XMVectorZero();
+            for (int i = 0; i < verticesPerBox; ++i)
+            {
+                center += XMLoadFloat3(&SceneData.GetPositions()[firstVertex + box * verticesPerBox + i]);
+            }
+            XMStoreFloat3(&centers[box], center / (float)verticesPerBox);
+
+            XMVECTOR dir = XMVector3Normalize(XMVectorSet(rand() / (float)RAND_MAX - 0.5f, rand() / (float)RAND_MAX - 0.5f,
+                rand() / (float)RAND_MAX - 0.5f, 0.f));
+            XMStoreFloat3(&velocities[box], dir * (MinSpeed + (rand() / (float)RAND_MAX) * (MaxSpeed - MinSpeed)));
+        }
+
+        if (method == 0)
+        {
+            wprintf(L"Animation benchmark: %lld triangles (%d moving), %dx%d, 1 sample per pixel per frame, %d threads, %d frames\n",
+                (long long)GetNumTriangles(), SceneData.GetModel(model).NumTriangles, Width, Height, NumThreads, numFrames);
+            wprintf(L"%15ls %11ls %11ls %11ls %11ls %11ls %9ls %9ls\n",
+                L"Method", L"Update(ms)", L"Worst(ms)", L"Trace(ms)", L"Mray/s", L"SAH cost", L"Treelets", L"Rebuilds");
+        }
+
+        EnableBvhRestructuring(Methods[method].Restructure);
+        ResetThreadStats();
+
+        double updateTime = 0.0;
+        double worstUpdateTime = 0.0;
+        double traceTime = 0.0;
+        int numRestructured = 0;
+        int numRebuilds = 0;
+
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            // Move the boxes. This is the application's work, so it isn't timed.
+            for (int box = 0; box < NumMovingBoxes; ++box)
+            {
+                float* center = &centers[box].x;
+                float* velocity = &velocities[box].x;
+                float delta[3];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    // Keep the boxes (at most 0.1 across) inside the room
+                    float lower = (axis == 2 ? 0.f : -2.5f) + 0.05f;
+                    float upper = (axis == 2 ? 5.f : 2.5f) - 0.05f;
+                    float moved = center[axis] + velocity[axis] * FrameTime;
+                    if (moved < lower || moved > upper)
+                    {
+                        velocity[axis] = -velocity[axis];
+                        moved = min(max(moved, lower), upper);
+                    }
+                    delta[axis] = moved - center[axis];
+                    center[axis] = moved;
+                }
+
+                for (int i = firstVertex + box * verticesPerBox; i < firstVertex + (box + 1) * verticesPerBox; ++i)
+                {
+                    XMFLOAT3 position = SceneData.GetPositions()[i];
+                    position.x += delta[0];
+                    position.y += delta[1];
+                    position.z += delta[2];
+                    SceneData.SetPosition(i, position);
+                }
+            }
+
+            double updateStart = GetTimeInSeconds();
+            if (Methods[method].Refit)
+            {
+                ModelUpdateStats stats;
+                if (!UpdateModel(model, &stats))
+                {
+                    return false;
+                }
+                numRestructured += stats.NumRestructured;
+                numRebuilds += stats.Rebuilt ? 1 : 0;
+            }
+            else if (!BuildModelBvhs() || !UpdateInstances())
+            {
+                return false;
+            }
+            double frameUpdateTime = GetTimeInSeconds() - updateStart;
+            updateTime += frameUpdateTime;
+            worstUpdateTime = max(worstUpdateTime, frameUpdateTime);
+
+            // Motion invalidates what was accumulated, like a camera move in the interactive app
+            Clear();
+            double traceStart = GetTimeInSeconds();
+            RenderOffline(cameraWorldTransform, 1);
+            traceTime += GetTimeInSeconds() - traceStart;
+        }
+
+        int64_t numRays = 0;
+        for (int i = 0; i < NumThreads; ++i)
+        {
+            numRays += Stats[i].NumRays;
+        }
+
+        wprintf(L"%15ls %11.2f %11.2f %11.2f %11.2f %11.3f %9d %9d\n",
+            Methods[method].Name, updateTime * 1000.0 / numFrames, worstUpdateTime * 1000.0, traceTime * 1000.0 / numFrames,
+            numRays / traceTime / 1.0e6, ModelBvhs[model].Hierarchy.GetDegradation(), numRestructured, numRebuilds);
+        fflush(stdout);
+    }
+
+    EnableBvhRestructuring(restructuringEnabled);
+
+    // Put the regular scene back
+    return SetTestScene(0);
+}
+
+bool Raytracer::RunWavefrontBenchmark(FXMMATRIX cameraWorldTransform, int samplesPerPixel)
+{
+    // Number of random boxes added to the Cornell box for each scene
+    static const int SceneBoxCounts[] = { 0, 1000, 10000, 50000 };
+
+    struct Integrator
+    {
+        const wchar_t* Name;
+        bool Wavefront;
+        bool Sorting;
+        bool Packets;
+    };
+    static const Integrator Integrators[] =
+    {
+        { L"Depth first", false, false, false },
+        { L"Depth first+packets", false, false, true },
+        { L"Wavefront", true, false, false },
+        { L"Wavefront+sort", true, true, false },
+        { L"Wavefront+sort+packets", true, true, true },
+    };
+
+    bool wavefrontEnabled = WavefrontEnabled;
+    bool packetTracingEnabled = PacketTracingEnabled;
+    float convergenceThreshold = ConvergenceThreshold;
+
+    // Every pixel gets every sample, so the runs do exactly the same work
+    SetConvergenceThreshold(0.f);
+
+    int numPixels = Width * Height;
+    std::unique_ptr<XMFLOAT3[]> reference(new XMFLOAT3[numPixels]);
+    std::unique_ptr<XMFLOAT3[]> image(new XMFLOAT3[numPixels]);
+    if (!reference || !image)
+    {
+        LogError(L"Failed to allocate benchmark images.");
+        return false;
+    }
+
+    wprintf(L"Wavefront benchmark: %dx%d, %d samples per pixel, %d threads\n", Width, Height, samplesPerPixel, NumThreads);
+    wprintf(L"%10ls %24ls %12ls %10ls %9ls %12ls\n", L"Triangles", L"Integrator", L"Pass(ms)", L"Mray/s", L"Speedup", L"RMSE");
+
+    for (int run = 0; run < (int)_countof(SceneBoxCounts); ++run)
+    {
+        srand(12345);
+        if (!SetTestScene(SceneBoxCounts[run]))
+        {
+            LogError(L"Failed to create wavefront benchmark scene.");
+            return false;
+        }
+
+        double depthFirstRate = 0.0;
+        for (int i = 0; i < (int)_countof(Integrators); ++i)
+        {
+            EnableWavefront(Integrators[i].Wavefront);
+            WavefrontSortingEnabled = Integrators[i].Sorting;
+            EnablePacketTracing(Integrators[i].Packets);
+            Clear();
+            ResetThreadStats();
+
+            double startTime = GetTimeInSeconds();
+            RenderOffline(cameraWorldTransform, samplesPerPixel);
+            double elapsed = GetTimeInSeconds() - startTime;
+
+            int64_t numRays = 0;
+            for (int j = 0; j < NumThreads; ++j)
+            {
+                numRays += Stats[j].NumRays;
+            }
+            double rate = numRays / elapsed;
+
+            // Every integrator takes the same random numbers for the same paths, so should produce
+            // the same image as the first. Packets round slightly differently when moving rays into
+            // model space, which can send the odd path another way.
+            ResolveImage(i == 0 ? reference.get() : image.get());
+            double sumSq = 0.0;
+            if (i == 0)
+            {
+                depthFirstRate = rate;
+            }
+            else
+            {
+                for (int j = 0; j < numPixels; ++j)
+                {
+                    XMVECTOR diff = XMLoadFloat3(&image[j]) - XMLoadFloat3(&reference[j]);
+                    sumSq += XMVectorGetX(XMVector3LengthSq(diff));
+                }
+            }
+
+            wprintf(L"%10lld %24ls %12.2f %10.3f %8.2fx %12.6f\n", (long long)GetNumTriangles(), Integrators[i].Name,
+                elapsed * 1000.0 / samplesPerPixel, rate / 1.0e6, rate / depthFirstRate, sqrt(sumSq / (numPixels * 3.0)));
+            fflush(stdout);
+        }
+    }
+
+    EnableWavefront(wavefrontEnabled);
+    WavefrontSortingEnabled = true;
+    EnablePacketTracing(packetTracingEnabled);
+    SetConvergenceThreshold(convergenceThreshold);
+
+    // Put the regular scene back
+    return SetTestScene(0);
+}
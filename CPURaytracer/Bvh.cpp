@@ -0,0 +1,819 @@
+#include "Precomp.h"
+#include "Bvh.h"
+#include "Debug.h"
+
+static float SurfaceArea(FXMVECTOR boxMin, FXMVECTOR boxMax)
+{
+    XMVECTOR d = XMVectorSubtract(boxMax, boxMin);
+    float x = XMVectorGetX(d);
+    float y = XMVectorGetY(d);
+    float z = XMVectorGetZ(d);
+    return 2.f * (x * y + y * z + z * x);
+}
+
+static float NodeArea(const Bvh::Node& node)
+{
+    return SurfaceArea(XMLoadFloat3(&node.Min), XMLoadFloat3(&node.Max));
+}
+
+// Cost relative to an area, 0 for flat or empty boxes that have none
+static float CostPerArea(float cost, float area)
+{
+    return area > 0.f ? cost / area : 0.f;
+}
+
+static float Degradation(float cost, float buildCost)
+{
+    return buildCost > 0.f ? cost / buildCost : 1.f;
+}
+
+static int CeilLog2(int n)
+{
+    int log = 0;
+    while ((1 << log) < n)
+    {
+        ++log;
+    }
+    return log;
+}
+
+Bvh::Bvh()
+    : NumNodes(0)
+    , NumPrimIndices(0)
+    , LeafAlignment(1)
+    , TopCost(0.f)
+    , TopBuildCost(0.f)
+    , BuildCost(0.f)
+{
+}
+
+bool Bvh::Build(const Aabb* primBounds, int numPrims, int leafAlignment)
+{
+    assert(leafAlignment > 0);
+
+    Nodes.reset();
+    PrimIndices.reset();
+    NumNodes = 0;
+    NumPrimIndices = 0;
+    LeafAlignment = leafAlignment;
+    GroupRoots.clear();
+    TopNodes.clear();
+
+    if (numPrims <= 0)
+    {
+        return true;
+    }
+
+    // A binary tree with n leaves has at most 2n - 1 nodes
+    Nodes.reset(new Node[numPrims * 2 - 1]);
+    if (!Nodes)
+    {
+        LogError(L"Failed to allocate BVH nodes.");
+        return false;
+    }
+
+    PrimIndices.reset(new int[numPrims]);
+    if (!PrimIndices)
+    {
+        LogError(L"Failed to allocate BVH primitive indices.");
+        return false;
+    }
+
+    std::unique_ptr<XMFLOAT3[]> centroids(new XMFLOAT3[numPrims]);
+    if (!centroids)
+    {
+        LogError(L"Failed to allocate BVH centroids.");
+        return false;
+    }
+
+    for (int i = 0; i < numPrims; ++i)
+    {
+        PrimIndices[i] = i;
+        XMVECTOR center = (XMLoadFloat3(&primBounds[i].Min) + XMLoadFloat3(&primBounds[i].Max)) * 0.5f;
+        XMStoreFloat3(&centroids[i], center);
+    }
+
+    NumPrimIndices = numPrims;
+    BuildRecursive(primBounds, centroids.get(), 0, numPrims, 1);
+
+    if (LeafAlignment > 1 && !AlignLeaves())
+    {
+        return false;
+    }
+
+    return SplitIntoGroups();
+}
+
+bool Bvh::AlignLeaves()
+{
+    int paddedSize = 0;
+    for (int i = 0; i < NumNodes; ++i)
+    {
+        if (Nodes[i].Count > 0)
+        {
+            paddedSize += LeafBlocks(Nodes[i].Count) * LeafAlignment;
+        }
+    }
+
+    std::unique_ptr<int[]> padded(new int[paddedSize]);
+    if (!padded)
+    {
+        LogError(L"Failed to allocate aligned BVH primitive indices.");
+        return false;
+    }
+
+    int next = 0;
+    for (int i = 0; i < NumNodes; ++i)
+    {
+        Node& node = Nodes[i];
+        if (node.Count > 0)
+        {
+            int end = next + LeafBlocks(node.Count) * LeafAlignment;
+            for (int j = 0; j < node.Count; ++j)
+            {
+                padded[next + j] = PrimIndices[node.Offset + j];
+            }
+            for (int j = next + node.Count; j < end; ++j)
+            {
+                padded[j] = -1;
+            }
+            node.Offset = next;
+            next = end;
+        }
+    }
+
+    PrimIndices.swap(padded);
+    NumPrimIndices = paddedSize;
+    return true;
+}
+
+int Bvh::BuildRecursive(const Aabb* primBounds, const XMFLOAT3* centroids, int first, int count, int depth)
+{
+    int index = NumNodes++;
+    Node& node = Nodes[index];
+
+    // Compute bounds of the primitives, and of their centroids (used for binning)
+    XMVECTOR boundsMin = XMVectorReplicate(FLT_MAX);
+    XMVECTOR boundsMax = XMVectorReplicate(-FLT_MAX);
+    XMVECTOR centroidMin = boundsMin;
+    XMVECTOR centroidMax = boundsMax;
+    for (int i = first; i < first + count; ++i)
+    {
+        int prim = PrimIndices[i];
+        boundsMin = XMVectorMin(boundsMin, XMLoadFloat3(&primBounds[prim].Min));
+        boundsMax = XMVectorMax(boundsMax, XMLoadFloat3(&primBounds[prim].Max));
+        XMVECTOR centroid = XMLoadFloat3(&centroids[prim]);
+        centroidMin = XMVectorMin(centroidMin, centroid);
+        centroidMax = XMVectorMax(centroidMax, centroid);
+    }
+    XMStoreFloat3(&node.Min, boundsMin);
+    XMStoreFloat3(&node.Max, boundsMax);
+
+    node.Offset = first;
+    node.Count = count;
+
+    if (count == 1 || depth >= MaxDepth)
+    {
+        return index;
+    }
+
+    //
+    // Binned SAH. Primitives are dropped into NumBins buckets along each axis by their
+    // centroid, and each of the NumBins - 1 planes between buckets is evaluated as a
+    // candidate split. The cost of a split is the expected number of primitive tests
+    // (or aligned groups of them), weighted by the probability of a ray hitting each
+    // side (surface area ratio), plus one for visiting the node itself.
+    //
+    float nodeArea = SurfaceArea(boundsMin, boundsMax);
+    float invNodeArea = nodeArea > 0.f ? 1.f / nodeArea : 0.f;
+    float leafCost = (float)LeafBlocks(count);
+    int maxLeafSize = LeafAlignment > MaxLeafSize ? LeafAlignment : MaxLeafSize;
+    float bestCost = FLT_MAX;
+    int bestAxis = -1;
+    int bestSplit = 0;
+
+    XMFLOAT3 cMin, cMax;
+    XMStoreFloat3(&cMin, centroidMin);
+    XMStoreFloat3(&cMax, centroidMax);
+    const float* centroidMinAxis = &cMin.x;
+    const float* centroidMaxAxis = &cMax.x;
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float extent = centroidMaxAxis[axis] - centroidMinAxis[axis];
+        if (extent <= 0.f)
+        {
+            continue;
+        }
+
+        XMVECTOR binMin[NumBins];
+        XMVECTOR binMax[NumBins];
+        int binCount[NumBins] = {};
+        for (int b = 0; b < NumBins; ++b)
+        {
+            binMin[b] = XMVectorReplicate(FLT_MAX);
+            binMax[b] = XMVectorReplicate(-FLT_MAX);
+        }
+
+        float scale = NumBins / extent;
+        for (int i = first; i < first + count; ++i)
+        {
+            int prim = PrimIndices[i];
+            int b = min(NumBins - 1, (int)(((&centroids[prim].x)[axis] - centroidMinAxis[axis]) * scale));
+            ++binCount[b];
+            binMin[b] = XMVectorMin(binMin[b], XMLoadFloat3(&primBounds[prim].Min));
+            binMax[b] = XMVectorMax(binMax[b], XMLoadFloat3(&primBounds[prim].Max));
+        }
+
+        // Sweep from the right to get the area & count of everything right of each plane
+        float rightArea[NumBins];
+        int rightCount[NumBins];
+        XMVECTOR sweepMin = XMVectorReplicate(FLT_MAX);
+        XMVECTOR sweepMax = XMVectorReplicate(-FLT_MAX);
+        int sweepCount = 0;
+        for (int b = NumBins - 1; b > 0; --b)
+        {
+            sweepMin = XMVectorMin(sweepMin, binMin[b]);
+            sweepMax = XMVectorMax(sweepMax, binMax[b]);
+            sweepCount += binCount[b];
+            rightArea[b] = sweepCount > 0 ? SurfaceArea(sweepMin, sweepMax) : 0.f;
+            rightCount[b] = sweepCount;
+        }
+
+        // Then sweep from the left, evaluating each plane
+        sweepMin = XMVectorReplicate(FLT_MAX);
+        sweepMax = XMVectorReplicate(-FLT_MAX);
+        sweepCount = 0;
+        for (int b = 0; b < NumBins - 1; ++b)
+        {
+            sweepMin = XMVectorMin(sweepMin, binMin[b]);
+            sweepMax = XMVectorMax(sweepMax, binMax[b]);
+            sweepCount += binCount[b];
+            if (sweepCount == 0 || rightCount[b + 1] == 0)
+            {
+                continue;
+            }
+
+            float cost = 1.f + (SurfaceArea(sweepMin, sweepMax) * LeafBlocks(sweepCount) + rightArea[b + 1] * LeafBlocks(rightCount[b + 1])) * invNodeArea;
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = b;
+            }
+        }
+    }
+
+    int mid = first;
+    if (bestAxis >= 0)
+    {
+        if (bestCost >= leafCost && count <= maxLeafSize)
+        {
+            // Splitting isn't worth it
+            return index;
+        }
+
+        float minAxis = centroidMinAxis[bestAxis];
+        float scale = NumBins / (centroidMaxAxis[bestAxis] - minAxis);
+        int* split = std::partition(&PrimIndices[first], &PrimIndices[first] + count,
+            [=](int prim)
+            {
+                int b = min(NumBins - 1, (int)(((&centroids[prim].x)[bestAxis] - minAxis) * scale));
+                return b <= bestSplit;
+            });
+        mid = (int)(split - PrimIndices.get());
+    }
+    else if (count <= maxLeafSize)
+    {
+        // All centroids are coincident, and the leaf is small enough. Nothing to gain by splitting
+        return index;
+    }
+
+    if (mid == first || mid == first + count)
+    {
+        // Couldn't find a meaningful split, but there are too many primitives for one leaf.
+        // Fall back to splitting down the middle of the list.
+        mid = first + count / 2;
+    }
+
+    BuildRecursive(primBounds, centroids, first, mid - first, depth + 1);
+    int right = BuildRecursive(primBounds, centroids, mid, first + count - mid, depth + 1);
+
+    node.Offset = right;
+    node.Count = 0;
+    return index;
+}
+
+int Bvh::GetDepth() const
+{
+    // Groups cover every leaf, so the deepest of them is the deepest path
+    int depth = 0;
+    for (int g = 0; g < (int)GroupRoots.size(); ++g)
+    {
+        depth = max(depth, GroupDepths[g] + GroupHeights[g] - 1);
+    }
+    return depth;
+}
+
+int Bvh::GetSubtreeEnd(int node) const
+{
+    // Right children are stored after everything under their left siblings,
+    // so the subtree ends with the rightmost leaf under node
+    while (Nodes[node].Count == 0)
+    {
+        node = Nodes[node].Offset;
+    }
+    return node + 1;
+}
+
+float Bvh::GetNodeCost(const Node& node) const
+{
+    return NodeArea(node) * (node.Count > 0 ? LeafBlocks(node.Count) : 1);
+}
+
+// Set an interior node's box to enclose its children
+static void FitToChildren(Bvh::Node* nodes, int index)
+{
+    Bvh::Node& node = nodes[index];
+    const Bvh::Node& left = nodes[index + 1];
+    const Bvh::Node& right = nodes[node.Offset];
+    XMStoreFloat3(&node.Min, XMVectorMin(XMLoadFloat3(&left.Min), XMLoadFloat3(&right.Min)));
+    XMStoreFloat3(&node.Max, XMVectorMax(XMLoadFloat3(&left.Max), XMLoadFloat3(&right.Max)));
+}
+
+bool Bvh::SplitIntoGroups()
+{
+    // Start with the whole tree as one group, and keep replacing the largest group with
+    // its two children until there are enough groups, or they're all single leaves
+    std::vector<int> groupSizes;
+    GroupRoots.push_back(0);
+    groupSizes.push_back(NumNodes);
+    while ((int)GroupRoots.size() < NumRefitGroups)
+    {
+        int largest = 0;
+        for (int g = 1; g < (int)GroupRoots.size(); ++g)
+        {
+            if (groupSizes[g] > groupSizes[largest])
+            {
+                largest = g;
+            }
+        }
+
+        if (groupSizes[largest] == 1)
+        {
+            break;
+        }
+
+        int node = GroupRoots[largest];
+        int size = groupSizes[largest];
+        int right = Nodes[node].Offset;
+        TopNodes.push_back(node);
+        GroupRoots[largest] = node + 1;
+        groupSizes[largest] = right - (node + 1);
+        GroupRoots.push_back(right);
+        groupSizes.push_back(node + size - right);
+    }
+
+    // Parents are stored before their children, so going backwards refits bottom up
+    std::sort(TopNodes.begin(), TopNodes.end(), std::greater<int>());
+
+    int numGroups = (int)GroupRoots.size();
+    GroupDepths.resize(numGroups);
+    GroupHeights.resize(numGroups);
+    GroupCosts.resize(numGroups);
+    GroupBuildCosts.resize(numGroups);
+
+    if (!UpdateGroupDepths())
+    {
+        return false;
+    }
+
+    float cost = 0.f;
+    for (int g = 0; g < numGroups; ++g)
+    {
+        int root = GroupRoots[g];
+        int end = GetSubtreeEnd(root);
+        GroupCosts[g] = 0.f;
+        for (int i = root; i < end; ++i)
+        {
+            GroupCosts[g] += GetNodeCost(Nodes[i]);
+        }
+        GroupBuildCosts[g] = CostPerArea(GroupCosts[g], NodeArea(Nodes[root]));
+        cost += GroupCosts[g];
+    }
+
+    TopCost = 0.f;
+    for (int i = 0; i < (int)TopNodes.size(); ++i)
+    {
+        TopCost += NodeArea(Nodes[TopNodes[i]]);
+    }
+
+    float rootArea = NodeArea(Nodes[0]);
+    TopBuildCost = CostPerArea(TopCost, rootArea);
+    BuildCost = CostPerArea(cost + TopCost, rootArea);
+    return true;
+}
+
+bool Bvh::UpdateGroupDepths()
+{
+    std::unique_ptr<uint8_t[]> depths(new uint8_t[NumNodes]);
+    if (!depths)
+    {
+        LogError(L"Failed to allocate BVH node depths.");
+        return false;
+    }
+
+    depths[0] = 1;
+    for (int i = 0; i < NumNodes; ++i)
+    {
+        if (Nodes[i].Count == 0)
+        {
+            depths[i + 1] = (uint8_t)(depths[i] + 1);
+            depths[Nodes[i].Offset] = (uint8_t)(depths[i] + 1);
+        }
+    }
+
+    for (int g = 0; g < (int)GroupRoots.size(); ++g)
+    {
+        int root = GroupRoots[g];
+        int end = GetSubtreeEnd(root);
+        int deepest = 0;
+        for (int i = root; i < end; ++i)
+        {
+            deepest = max(deepest, (int)depths[i]);
+        }
+        GroupDepths[g] = depths[root];
+        GroupHeights[g] = deepest - depths[root] + 1;
+    }
+
+    return true;
+}
+
+void Bvh::RefitGroup(const Aabb* primBounds, int group)
+{
+    int root = GroupRoots[group];
+    float cost = 0.f;
+
+    // Children are stored after their parents, so going backwards updates them first
+    for (int i = GetSubtreeEnd(root) - 1; i >= root; --i)
+    {
+        Node& node = Nodes[i];
+        if (node.Count > 0)
+        {
+            XMVECTOR boundsMin = XMVectorReplicate(FLT_MAX);
+            XMVECTOR boundsMax = XMVectorReplicate(-FLT_MAX);
+            for (int j = node.Offset; j < node.Offset + node.Count; ++j)
+            {
+                int prim = PrimIndices[j];
+                boundsMin = XMVectorMin(boundsMin, XMLoadFloat3(&primBounds[prim].Min));
+                boundsMax = XMVectorMax(boundsMax, XMLoadFloat3(&primBounds[prim].Max));
+            }
+            XMStoreFloat3(&node.Min, boundsMin);
+            XMStoreFloat3(&node.Max, boundsMax);
+        }
+        else
+        {
+            FitToChildren(Nodes.get(), i);
+        }
+        cost += GetNodeCost(node);
+    }
+
+    GroupCosts[group] = cost;
+}
+
+void Bvh::RefitTop()
+{
+    TopCost = 0.f;
+    for (int i = 0; i < (int)TopNodes.size(); ++i)
+    {
+        FitToChildren(Nodes.get(), TopNodes[i]);
+        TopCost += NodeArea(Nodes[TopNodes[i]]);
+    }
+}
+
+float Bvh::GetDegradation() const
+{
+    if (NumNodes == 0)
+    {
+        return 1.f;
+    }
+
+    float cost = TopCost;
+    for (int g = 0; g < (int)GroupRoots.size(); ++g)
+    {
+        cost += GroupCosts[g];
+    }
+    return Degradation(CostPerArea(cost, NodeArea(Nodes[0])), BuildCost);
+}
+
+float Bvh::GetGroupDegradation(int group) const
+{
+    return Degradation(CostPerArea(GroupCosts[group], NodeArea(Nodes[GroupRoots[group]])), GroupBuildCosts[group]);
+}
+
+float Bvh::GetTopDegradation() const
+{
+    if (TopNodes.empty())
+    {
+        return 1.f;
+    }
+    return Degradation(CostPerArea(TopCost, NodeArea(Nodes[0])), TopBuildCost);
+}
+
+// A range of nodes being rebuilt over the subtrees (units) in it. The units are moved
+// into their new places whole, so only the nodes above them change.
+struct Bvh::Treelet
+{
+    std::vector<int> Units;         // Root of each unit
+    std::vector<float> Costs;       // Summed node costs of each unit
+    std::vector<int> NewRoots;      // Where each unit's root ended up
+    int MaxUnitDepth;               // Deepest units can go (counting the treelet's root as 1)
+
+    // Results: the nodes built above the units, their summed areas, and the deepest unit
+    std::vector<int> Interior;
+    float InteriorCost;
+    int Height;
+
+    // Scratch space for the build
+    std::unique_ptr<Node[]> Source;  // Copy of the nodes being rebuilt
+    int SourceBase;
+    std::vector<int> Sizes;
+    std::vector<XMFLOAT3> Centroids;
+    std::vector<float> Weights;
+    std::vector<int> Order;
+    int Next;
+};
+
+bool Bvh::RebuildTreelet(Treelet* treelet, int root, int end)
+{
+    treelet->Source.reset(new Node[end - root]);
+    if (!treelet->Source)
+    {
+        LogError(L"Failed to allocate BVH treelet.");
+        return false;
+    }
+    memcpy(treelet->Source.get(), &Nodes[root], (end - root) * sizeof(Node));
+    treelet->SourceBase = root;
+
+    // Units are weighted by their expected cost once a ray has reached them
+    int numUnits = (int)treelet->Units.size();
+    treelet->NewRoots.resize(numUnits);
+    treelet->Sizes.resize(numUnits);
+    treelet->Centroids.resize(numUnits);
+    treelet->Weights.resize(numUnits);
+    treelet->Order.resize(numUnits);
+    for (int u = 0; u < numUnits; ++u)
+    {
+        const Node& unit = Nodes[treelet->Units[u]];
+        treelet->Sizes[u] = GetSubtreeEnd(treelet->Units[u]) - treelet->Units[u];
+        XMStoreFloat3(&treelet->Centroids[u], (XMLoadFloat3(&unit.Min) + XMLoadFloat3(&unit.Max)) * 0.5f);
+        treelet->Weights[u] = max(1.f, CostPerArea(treelet->Costs[u], NodeArea(unit)));
+        treelet->Order[u] = u;
+    }
+
+    treelet->Interior.clear();
+    treelet->InteriorCost = 0.f;
+    treelet->Height = 0;
+    treelet->Next = root;
+    BuildTreeletRecursive(treelet, 0, numUnits, 1);
+    assert(treelet->Next == end);
+
+    treelet->Source.reset();
+    return true;
+}
+
+int Bvh::BuildTreeletRecursive(Treelet* treelet, int first, int count, int depth)
+{
+    int* order = treelet->Order.data();
+    const XMFLOAT3* centroids = treelet->Centroids.data();
+
+    if (count == 1)
+    {
+        // Move the unit here, adjusting the links inside of it
+        int unit = order[first];
+        int index = treelet->Next;
+        int shift = index - treelet->Units[unit];
+        const Node* source = &treelet->Source[treelet->Units[unit] - treelet->SourceBase];
+        for (int i = 0; i < treelet->Sizes[unit]; ++i)
+        {
+            Node node = source[i];
+            if (node.Count == 0)
+            {
+                node.Offset += shift;
+            }
+            Nodes[index + i] = node;
+        }
+
+        treelet->Next += treelet->Sizes[unit];
+        treelet->NewRoots[unit] = index;
+        treelet->Height = max(treelet->Height, depth);
+        return index;
+    }
+
+    int index = treelet->Next++;
+
+    XMVECTOR centroidMin = XMVectorReplicate(FLT_MAX);
+    XMVECTOR centroidMax = XMVectorReplicate(-FLT_MAX);
+    for (int i = first; i < first + count; ++i)
+    {
+        XMVECTOR centroid = XMLoadFloat3(&centroids[order[i]]);
+        centroidMin = XMVectorMin(centroidMin, centroid);
+        centroidMax = XMVectorMax(centroidMax, centroid);
+    }
+
+    XMFLOAT3 cMin, cMax;
+    XMStoreFloat3(&cMin, centroidMin);
+    XMStoreFloat3(&cMax, centroidMax);
+    const float* centroidMinAxis = &cMin.x;
+    const float* centroidMaxAxis = &cMax.x;
+
+    //
+    // Binned SAH, the same way as Build, except units are weighted by their cost per area
+    // rather than counted, and there are no leaves to stop at: the recursion always goes
+    // down to single units.
+    //
+    float bestCost = FLT_MAX;
+    int bestAxis = -1;
+    int bestSplit = 0;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float extent = centroidMaxAxis[axis] - centroidMinAxis[axis];
+        if (extent <= 0.f)
+        {
+            continue;
+        }
+
+        XMVECTOR binMin[NumBins];
+        XMVECTOR binMax[NumBins];
+        float binWeight[NumBins] = {};
+        int binCount[NumBins] = {};
+        for (int b = 0; b < NumBins; ++b)
+        {
+            binMin[b] = XMVectorReplicate(FLT_MAX);
+            binMax[b] = XMVectorReplicate(-FLT_MAX);
+        }
+
+        float scale = NumBins / extent;
+        for (int i = first; i < first + count; ++i)
+        {
+            int unit = order[i];
+            const Node& node = treelet->Source[treelet->Units[unit] - treelet->SourceBase];
+            int b = min(NumBins - 1, (int)(((&centroids[unit].x)[axis] - centroidMinAxis[axis]) * scale));
+            ++binCount[b];
+            binWeight[b] += treelet->Weights[unit];
+            binMin[b] = XMVectorMin(binMin[b], XMLoadFloat3(&node.Min));
+            binMax[b] = XMVectorMax(binMax[b], XMLoadFloat3(&node.Max));
+        }
+
+        float rightCost[NumBins];
+        int rightCount[NumBins];
+        XMVECTOR sweepMin = XMVectorReplicate(FLT_MAX);
+        XMVECTOR sweepMax = XMVectorReplicate(-FLT_MAX);
+        float sweepWeight = 0.f;
+        int sweepCount = 0;
+        for (int b = NumBins - 1; b > 0; --b)
+        {
+            sweepMin = XMVectorMin(sweepMin, binMin[b]);
+            sweepMax = XMVectorMax(sweepMax, binMax[b]);
+            sweepWeight += binWeight[b];
+            sweepCount += binCount[b];
+            rightCost[b] = sweepCount > 0 ? SurfaceArea(sweepMin, sweepMax) * sweepWeight : 0.f;
+            rightCount[b] = sweepCount;
+        }
+
+        sweepMin = XMVectorReplicate(FLT_MAX);
+        sweepMax = XMVectorReplicate(-FLT_MAX);
+        sweepWeight = 0.f;
+        sweepCount = 0;
+        for (int b = 0; b < NumBins - 1; ++b)
+        {
+            sweepMin = XMVectorMin(sweepMin, binMin[b]);
+            sweepMax = XMVectorMax(sweepMax, binMax[b]);
+            sweepWeight += binWeight[b];
+            sweepCount += binCount[b];
+            if (sweepCount == 0 || rightCount[b + 1] == 0)
+            {
+                continue;
+            }
+
+            float cost = SurfaceArea(sweepMin, sweepMax) * sweepWeight + rightCost[b + 1];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = b;
+            }
+        }
+    }
+
+    int mid = first;
+    if (bestAxis >= 0)
+    {
+        float minAxis = centroidMinAxis[bestAxis];
+        float scale = NumBins / (centroidMaxAxis[bestAxis] - minAxis);
+        int* split = std::partition(order + first, order + first + count,
+            [=](int unit)
+            {
+                int b = min(NumBins - 1, (int)(((&centroids[unit].x)[bestAxis] - minAxis) * scale));
+                return b <= bestSplit;
+            });
+        mid = (int)(split - order);
+    }
+
+    // Without a usable split, or if the SAH split is lopsided enough that the units on one
+    // side couldn't all be placed within MaxDepth, split at the median along the widest axis.
+    // That only needs log2(count) more levels, which the old structure had room for.
+    int largestSide = max(mid - first, first + count - mid);
+    if (mid == first || mid == first + count || depth + 1 + CeilLog2(largestSide) > treelet->MaxUnitDepth)
+    {
+        int axis = 0;
+        for (int a = 1; a < 3; ++a)
+        {
+            if (centroidMaxAxis[a] - centroidMinAxis[a] > centroidMaxAxis[axis] - centroidMinAxis[axis])
+            {
+                axis = a;
+            }
+        }
+
+        mid = first + count / 2;
+        std::nth_element(order + first, order + mid, order + first + count,
+            [=](int a, int b) { return (&centroids[a].x)[axis] < (&centroids[b].x)[axis]; });
+    }
+
+    BuildTreeletRecursive(treelet, first, mid - first, depth + 1);
+    int right = BuildTreeletRecursive(treelet, mid, first + count - mid, depth + 1);
+
+    Node& node = Nodes[index];
+    node.Offset = right;
+    node.Count = 0;
+    FitToChildren(Nodes.get(), index);
+
+    treelet->Interior.push_back(index);
+    treelet->InteriorCost += NodeArea(node);
+    return index;
+}
+
+bool Bvh::RestructureGroup(int group)
+{
+    int root = GroupRoots[group];
+    int end = GetSubtreeEnd(root);
+
+    Treelet treelet;
+    float leafCost = 0.f;
+    for (int i = root; i < end; ++i)
+    {
+        if (Nodes[i].Count > 0)
+        {
+            treelet.Units.push_back(i);
+            treelet.Costs.push_back(GetNodeCost(Nodes[i]));
+            leafCost += treelet.Costs.back();
+        }
+    }
+
+    // Two leaves can only be arranged one way
+    if (treelet.Units.size() < 3)
+    {
+        return true;
+    }
+
+    treelet.MaxUnitDepth = MaxDepth - GroupDepths[group] + 1;
+    if (!RebuildTreelet(&treelet, root, end))
+    {
+        return false;
+    }
+
+    GroupHeights[group] = treelet.Height;
+    GroupCosts[group] = treelet.InteriorCost + leafCost;
+    return true;
+}
+
+bool Bvh::RestructureTop()
+{
+    if (GroupRoots.size() < 3)
+    {
+        return true;
+    }
+
+    Treelet treelet;
+    treelet.Units = GroupRoots;
+    treelet.Costs = GroupCosts;
+
+    int tallestGroup = 0;
+    for (int g = 0; g < (int)GroupRoots.size(); ++g)
+    {
+        tallestGroup = max(tallestGroup, GroupHeights[g]);
+    }
+    treelet.MaxUnitDepth = MaxDepth - tallestGroup + 1;
+
+    if (!RebuildTreelet(&treelet, 0, NumNodes))
+    {
+        return false;
+    }
+
+    GroupRoots.swap(treelet.NewRoots);
+    TopNodes.swap(treelet.Interior);
+    std::sort(TopNodes.begin(), TopNodes.end(), std::greater<int>());
+    TopCost = treelet.InteriorCost;
+
+    return UpdateGroupDepths();
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+// Axis aligned bounding box
+struct Aabb
+{
+    XMFLOAT3 Min;
+    XMFLOAT3 Max;
+};
+
+/// Bounding volume hierarchy built using the surface area heuristic (SAH).
+/// The builder only sees primitive bounds, so the same hierarchy type can be
+/// used over triangles or anything else with an AABB. Nodes are stored in
+/// depth first order: the left child of an interior node immediately follows
+/// it, and the right child is found through Offset.
+///
+/// Leaves can optionally be aligned, so that each one starts on a multiple of
+/// leafAlignment entries in PrimIndices (padded with -1). This lets callers
+/// store primitives in fixed size SIMD groups per leaf.
+///
+/// When primitives move, the hierarchy can be refit instead of rebuilt, and the
+/// parts of it that refitting has made too loose can be restructured in place.
+class Bvh
+{
+public:
+    struct Node
+    {
+        XMFLOAT3 Min;
+        int Offset;     // Interior: index of right child. Leaf: first entry in PrimIndices
+        XMFLOAT3 Max;
+        int Count;      // Number of primitives in a leaf, 0 for interior nodes
+    };
+
+    Bvh();
+
+    // Build the hierarchy over numPrims primitives. Any previous contents are discarded.
+    bool Build(const Aabb* primBounds, int numPrims, int leafAlignment = 1);
+
+    const Node* GetNodes() const { return Nodes.get(); }
+    int GetNumNodes() const { return NumNodes; }
+
+    // Primitive indices in leaf order. Leaves reference ranges of this array.
+    // When leaves are aligned, padding entries between leaves are -1.
+    const int* GetPrimIndices() const { return PrimIndices.get(); }
+    int GetNumPrimIndices() const { return NumPrimIndices; }
+
+    // Deepest path from the root, useful for sizing traversal stacks
+    int GetDepth() const;
+
+    // Bytes used by the nodes & primitive indices
+    size_t GetMemoryUsage() const { return NumNodes * sizeof(Node) + NumPrimIndices * sizeof(int); }
+
+    //
+    // Refitting, for when primitives move. Node bounds are recomputed bottom up without
+    // changing the structure of the tree. That's much cheaper than building it again, but
+    // the tree gets worse the further the primitives move from where it was built. To refit
+    // on several threads, the tree is split into groups (subtrees, up to NumRefitGroups of
+    // them) which can be refit concurrently, followed by the few nodes above them.
+    //
+    int GetNumRefitGroups() const { return (int)GroupRoots.size(); }
+    void RefitGroup(const Aabb* primBounds, int group);
+    void RefitTop();
+
+    // SAH cost (nodes visited + primitive groups tested by a ray through the root) as of the
+    // last build, refit or restructure, over the cost when the tree was built. 1 for a fresh
+    // tree, growing as refitting loosens it. Also available for each group, and for the nodes
+    // above the groups.
+    float GetDegradation() const;
+    float GetGroupDegradation(int group) const;
+    float GetTopDegradation() const;
+
+    // Treelet rebuilds: rebuild the structure of part of the tree with SAH, over the leaves
+    // (or whole groups) already in it. Primitives stay in their leaves, so PrimIndices and
+    // anything stored in leaf order are unaffected. Groups can be restructured concurrently.
+    // RestructureTop rebuilds the nodes above the groups, moving the groups as they are.
+    bool RestructureGroup(int group);
+    bool RestructureTop();
+
+    // Max depth the builder will produce. Traversal stacks of this size never overflow.
+    static const int MaxDepth = 64;
+
+private:
+    // Don't allow copy
+    Bvh(const Bvh&);
+    Bvh& operator= (const Bvh&);
+
+    int BuildRecursive(const Aabb* primBounds, const XMFLOAT3* centroids, int first, int count, int depth);
+    bool AlignLeaves();
+
+    // One past the last node of the subtree at node, which is stored contiguously from it
+    int GetSubtreeEnd(int node) const;
+
+    // Area weighted SAH cost of visiting a node: 1, or the number of primitive groups in a leaf
+    float GetNodeCost(const Node& node) const;
+
+    // Split the tree into refit groups, and work out their depths & costs as built
+    bool SplitIntoGroups();
+    bool UpdateGroupDepths();
+
+    // Rebuild nodes [root, end) over the subtrees at treelet->Units
+    struct Treelet;
+    bool RebuildTreelet(Treelet* treelet, int root, int end);
+    int BuildTreeletRecursive(Treelet* treelet, int first, int count, int depth);
+
+    // Cost of intersecting count primitives in a leaf, in units of aligned groups
+    int LeafBlocks(int count) const { return (count + LeafAlignment - 1) / LeafAlignment; }
+
+private:
+    static const int NumBins = 16;
+    static const int MaxLeafSize = 8;
+    static const int NumRefitGroups = 256;
+
+    std::unique_ptr<Node[]> Nodes;
+    int NumNodes;
+    std::unique_ptr<int[]> PrimIndices;
+    int NumPrimIndices;
+    int LeafAlignment;
+
+    // Refit groups: the root of each, its depth and the height of the subtree under it, and
+    // its SAH cost (summed over its nodes, not normalized) now and, relative to its area,
+    // when the tree was built
+    std::vector<int> GroupRoots;
+    std::vector<int> GroupDepths;
+    std::vector<int> GroupHeights;
+    std::vector<float> GroupCosts;
+    std::vector<float> GroupBuildCosts;
+
+    // Nodes above the groups, children before parents, and their costs the same way
+    std::vector<int> TopNodes;
+    float TopCost;
+    float TopBuildCost;
+
+    // Whole tree's cost relative to the root's area, when built
+    float BuildCost;
+};
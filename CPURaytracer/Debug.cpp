@@ -9,10 +9,17 @@ void __cdecl _DebugWrite(const wchar_t* format, ...)
 
     va_list args;
     va_start(args, format);
+#if defined(_WIN32)
     vswprintf_s(message, format, args);
     va_end(args);
 
     OutputDebugString(message);
+#else
+    vswprintf(message, _countof(message), format, args);
+    va_end(args);
+
+    fputws(message, stderr);
+#endif
 }
 
 #endif
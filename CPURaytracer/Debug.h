@@ -3,8 +3,8 @@
 #if defined(_DEBUG)
 
 void __cdecl _DebugWrite(const wchar_t* format, ...);
-#define Log(format, ...) { _DebugWrite(format L"\n", __VA_ARGS__); }
-#define LogError(format, ...) { _DebugWrite(L"ERROR: " format L"\n", __VA_ARGS__); assert(false); }
+#define Log(format, ...) { _DebugWrite(format L"\n", ##__VA_ARGS__); }
+#define LogError(format, ...) { _DebugWrite(L"ERROR: " format L"\n", ##__VA_ARGS__); assert(false); }
 
 #else
 
@@ -0,0 +1,412 @@
+#include "Precomp.h"
+#include "Denoiser.h"
+#include "Debug.h"
+
+// How quickly taps are rejected as they get further from the center pixel in each guide. Tap
+// weights fall off as exp(-(the sum of the differences, scaled by these)).
+//  - Normals: by 1 - cos of the angle between them, so 10 degrees apart costs about 2.
+//  - Distances: relative to the center's distance, and to how far the tap is from the center,
+//    since a sloped surface changes distance steadily across the screen. 1% per pixel.
+//  - Colors: the luminance difference, in units of the center's noise (standard deviation).
+static const float NormalPhi = 128.f;
+static const float DistTolerance = 0.01f;
+static const float ColorPhi = 4.f;
+
+// Noise floor, so pixels that happen to have no variance (all their samples agree) still
+// blend with neighbors that are very nearly the same
+static const float MinColorSigma = 0.002f;
+
+// Lighting is divided by albedos clamped to at least this, so black surfaces don't divide by 0
+// (they're multiplied by the same after filtering, so their own color comes back unchanged)
+static const float MinAlbedo = 0.01f;
+
+// Misses are given this distance, to keep the distance test finite
+static const float MaxGuideDist = 1e6f;
+
+// The 3x3 kernel is the outer product of (1/4, 1/2, 1/4)
+static const float KernelWeights[3] = { 0.25f, 0.5f, 0.25f };
+
+// Luminance weights, as for the variance estimates the raytracer accumulates
+static const float LumR = 0.2126f;
+static const float LumG = 0.7152f;
+static const float LumB = 0.0722f;
+
+// Fields of the packed normals and albedos, and the scale bringing each back to [0, 1]
+static const XMVECTORU32 NormalMaskX = { 0x000003FF, 0x000003FF, 0x000003FF, 0x000003FF };
+static const XMVECTORU32 NormalMaskY = { 0x000FFC00, 0x000FFC00, 0x000FFC00, 0x000FFC00 };
+static const XMVECTORU32 NormalMaskZ = { 0x3FF00000, 0x3FF00000, 0x3FF00000, 0x3FF00000 };
+static const float NormalScale = 1.f / 1023.f;
+static const XMVECTORU32 AlbedoMaskR = { 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF };
+static const XMVECTORU32 AlbedoMaskG = { 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x0000FF00 };
+static const XMVECTORU32 AlbedoMaskB = { 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000 };
+static const float AlbedoScale = 1.f / 255.f;
+
+Denoiser::Denoiser()
+    : Width(0)
+    , Height(0)
+{
+}
+
+bool Denoiser::Initialize(int width, int height)
+{
+    Width = width;
+    Height = height;
+
+    int numPixels = width * height;
+    for (int i = 0; i < 2; ++i)
+    {
+        ColorPlanes& buffer = Buffers[i];
+        buffer.R.reset(new float[numPixels]);
+        buffer.Lum.reset(new float[numPixels]);
+        buffer.B.reset(new float[numPixels]);
+        buffer.Variance.reset(new float[numPixels]);
+        if (!buffer.R || !buffer.Lum || !buffer.B || !buffer.Variance)
+        {
+            LogError(L"Failed to allocate denoiser buffers.");
+            return false;
+        }
+    }
+
+    Normals.reset(new uint32_t[numPixels]);
+    Dists.reset(new float[numPixels]);
+    Albedos.reset(new uint32_t[numPixels]);
+    if (!Normals || !Dists || !Albedos)
+    {
+        LogError(L"Failed to allocate denoiser guides.");
+        return false;
+    }
+    memset(Normals.get(), 0, numPixels * sizeof(uint32_t));
+    memset(Albedos.get(), 0, numPixels * sizeof(uint32_t));
+    for (int i = 0; i < numPixels; ++i)
+    {
+        Dists[i] = MaxGuideDist;
+    }
+
+    return true;
+}
+
+static inline uint32_t QuantizeUnorm(float value, float maxValue)
+{
+    return (uint32_t)(min(max(value, 0.f), 1.f) * maxValue + 0.5f);
+}
+
+void Denoiser::SetGuide(int x, int y, FXMVECTOR normal, float dist, FXMVECTOR albedo)
+{
+    XMFLOAT3 n, a;
+    XMStoreFloat3(&n, XMVectorMultiplyAdd(normal, XMVectorReplicate(0.5f), XMVectorReplicate(0.5f)));
+    XMStoreFloat3(&a, albedo);
+
+    int index = y * Width + x;
+    Normals[index] = QuantizeUnorm(n.x, 1023.f) | (QuantizeUnorm(n.y, 1023.f) << 10) | (QuantizeUnorm(n.z, 1023.f) << 20);
+    Dists[index] = min(dist, MaxGuideDist);
+    Albedos[index] = QuantizeUnorm(a.x, 255.f) | (QuantizeUnorm(a.y, 255.f) << 8) | (QuantizeUnorm(a.z, 255.f) << 16);
+}
+
+// The 4 values of a row starting at x. Pixels past either end of the row repeat the one at the end.
+static inline XMVECTOR LoadRow(const float* row, int x, int width)
+{
+    if (x >= 0 && x + 4 <= width)
+    {
+        return XMLoadFloat4((const XMFLOAT4*)&row[x]);
+    }
+    return XMVectorSet(row[min(max(x, 0), width - 1)], row[min(max(x + 1, 0), width - 1)],
+        row[min(max(x + 2, 0), width - 1)], row[min(max(x + 3, 0), width - 1)]);
+}
+
+// Store the first count (up to 4) values of v to a row at x
+static inline void StoreRow(float* row, int x, int count, FXMVECTOR v)
+{
+    if (count >= 4)
+    {
+        XMStoreFloat4((XMFLOAT4*)&row[x], v);
+        return;
+    }
+
+    XMFLOAT4 values;
+    XMStoreFloat4(&values, v);
+    const float* value = &values.x;
+    for (int i = 0; i < count; ++i)
+    {
+        row[x + i] = value[i];
+    }
+}
+
+// exp(-x) for x >= 0, as (1 - x/16)^16, which falls off the same way and reaches 0 at 16
+// (where exp is already down to 1e-7). A few multiplies instead of a polynomial.
+static inline XMVECTOR ExpNegEst(FXMVECTOR x)
+{
+    XMVECTOR t = XMVectorMax(XMVectorNegativeMultiplySubtract(x, XMVectorReplicate(1.f / 16.f), XMVectorSplatOne()), XMVectorZero());
+    t = XMVectorMultiply(t, t);
+    t = XMVectorMultiply(t, t);
+    t = XMVectorMultiply(t, t);
+    return XMVectorMultiply(t, t);
+}
+
+// The 4 pixels of a tap, at the given indices. When they're next to each other in a row
+// (anywhere but the left and right edges of the image, where they're clamped), that's a
+// single vector load, and the other 3 indices aren't used.
+template <bool Contiguous>
+static inline XMVECTOR LoadTap(const float* plane, const int* indices);
+template <bool Contiguous>
+static inline XMVECTOR LoadTap(const uint32_t* plane, const int* indices);
+
+template <>
+inline XMVECTOR LoadTap<true>(const float* plane, const int* indices)
+{
+    return XMLoadFloat4((const XMFLOAT4*)&plane[indices[0]]);
+}
+
+template <>
+inline XMVECTOR LoadTap<false>(const float* plane, const int* indices)
+{
+    return XMVectorSet(plane[indices[0]], plane[indices[1]], plane[indices[2]], plane[indices[3]]);
+}
+
+template <>
+inline XMVECTOR LoadTap<true>(const uint32_t* plane, const int* indices)
+{
+    return XMLoadInt4(&plane[indices[0]]);
+}
+
+template <>
+inline XMVECTOR LoadTap<false>(const uint32_t* plane, const int* indices)
+{
+    return XMVectorSetInt(plane[indices[0]], plane[indices[1]], plane[indices[2]], plane[indices[3]]);
+}
+
+// Albedos of 4 pixels, as the factors lighting is divided by before filtering
+template <bool Contiguous>
+static inline void LoadAlbedos(const uint32_t* albedos, const int* indices, XMVECTOR* r, XMVECTOR* g, XMVECTOR* b)
+{
+    XMVECTOR packed = LoadTap<Contiguous>(albedos, indices);
+    XMVECTOR minAlbedo = XMVectorReplicate(MinAlbedo);
+    *r = XMVectorMax(XMVectorScale(XMConvertVectorIntToFloat(XMVectorAndInt(packed, AlbedoMaskR), 0), AlbedoScale), minAlbedo);
+    *g = XMVectorMax(XMVectorScale(XMConvertVectorIntToFloat(XMVectorAndInt(packed, AlbedoMaskG), 8), AlbedoScale), minAlbedo);
+    *b = XMVectorMax(XMVectorScale(XMConvertVectorIntToFloat(XMVectorAndInt(packed, AlbedoMaskB), 16), AlbedoScale), minAlbedo);
+}
+
+void Denoiser::LoadTile(const XMFLOAT4* accum, const float* accumLumSq, const RenderScheduler::Tile& tile)
+{
+    ColorPlanes& dest = Buffers[0];
+
+    for (int y = tile.MinY; y < tile.MaxY; ++y)
+    {
+        for (int x = tile.MinX; x < tile.MaxX; x += 4)
+        {
+            // Transposed to one channel per row, like the resolve
+            int count = min(tile.MaxX - x, 4);
+            int indices[4];
+            XMMATRIX pixels;
+            for (int i = 0; i < 4; ++i)
+            {
+                indices[i] = y * Width + x + min(i, count - 1);
+                pixels.r[i] = XMLoadFloat4(&accum[indices[i]]);
+            }
+            pixels = XMMatrixTranspose(pixels);
+
+            // Pixels without samples yet are black, with no noise
+            XMVECTOR n = pixels.r[3];
+            XMVECTOR invCount = XMVectorReciprocal(XMVectorMax(n, XMVectorSplatOne()));
+            XMVECTOR r = XMVectorMultiply(pixels.r[0], invCount);
+            XMVECTOR g = XMVectorMultiply(pixels.r[1], invCount);
+            XMVECTOR b = XMVectorMultiply(pixels.r[2], invCount);
+
+            // Variance of each pixel's average: the variance of its samples over the number of them,
+            // which works out as (mean square - squared mean) / (n - 1). With a single sample there's
+            // nothing to estimate the spread from, so the mean square stands in for it.
+            XMVECTOR lum = XMVectorMultiplyAdd(r, XMVectorReplicate(LumR),
+                XMVectorMultiplyAdd(g, XMVectorReplicate(LumG), XMVectorMultiply(b, XMVectorReplicate(LumB))));
+            XMVECTOR meanSq = XMVectorMultiply(LoadRow(&accumLumSq[y * Width], x, min(x + count, Width)), invCount);
+            XMVECTOR sampleVariance = XMVectorMax(XMVectorNegativeMultiplySubtract(lum, lum, meanSq), XMVectorZero());
+            XMVECTOR nMinusOne = XMVectorMax(XMVectorSubtract(n, XMVectorSplatOne()), XMVectorSplatOne());
+            XMVECTOR variance = XMVectorMultiply(sampleVariance, XMVectorReciprocal(nMinusOne));
+            variance = XMVectorSelect(variance, meanSq, XMVectorLessOrEqual(n, XMVectorSplatOne()));
+
+            // Filter the light arriving rather than the light reflected, so surface detail (which the
+            // guide has without any noise) isn't blurred along with the noise. The variance is scaled
+            // by the albedo's luminance, which is exact for white light and close enough for the rest.
+            XMVECTOR albedoR, albedoG, albedoB;
+            LoadAlbedos<false>(Albedos.get(), indices, &albedoR, &albedoG, &albedoB);
+            r = XMVectorDivide(r, albedoR);
+            g = XMVectorDivide(g, albedoG);
+            b = XMVectorDivide(b, albedoB);
+            XMVECTOR albedoLum = XMVectorMultiplyAdd(albedoR, XMVectorReplicate(LumR),
+                XMVectorMultiplyAdd(albedoG, XMVectorReplicate(LumG), XMVectorMultiply(albedoB, XMVectorReplicate(LumB))));
+            variance = XMVectorDivide(variance, XMVectorMultiply(albedoLum, albedoLum));
+            lum = XMVectorMultiplyAdd(r, XMVectorReplicate(LumR),
+                XMVectorMultiplyAdd(g, XMVectorReplicate(LumG), XMVectorMultiply(b, XMVectorReplicate(LumB))));
+
+            StoreRow(&dest.R[y * Width], x, count, r);
+            StoreRow(&dest.Lum[y * Width], x, count, lum);
+            StoreRow(&dest.B[y * Width], x, count, b);
+            StoreRow(&dest.Variance[y * Width], x, count, variance);
+        }
+    }
+}
+
+// Everything an iteration reads
+struct FilterSource
+{
+    const float* R;
+    const float* Lum;
+    const float* B;
+    const float* Variance;
+    const uint32_t* Normals;
+    const float* Dists;
+};
+
+// Filter 4 pixels, given the indices of the 3x3 taps around them (the center is tap 4). Split
+// out of FilterTile so the taps' loads are specialized for the inside of the image.
+template <bool Contiguous>
+static inline void FilterPixels(const FilterSource& src, const int (&taps)[9][4], int step,
+    XMVECTOR* outR, XMVECTOR* outLum, XMVECTOR* outB, XMVECTOR* outVariance)
+{
+    // The center pixels' guides. The normal is kept as the factors its dot product with
+    // a packed normal is made of, so taps only have to mask off their fields.
+    const int* center = taps[4];
+    XMVECTOR packedNormal = LoadTap<Contiguous>(src.Normals, center);
+    XMVECTOR nx = XMVectorMultiplyAdd(XMConvertVectorIntToFloat(XMVectorAndInt(packedNormal, NormalMaskX), 0),
+        XMVectorReplicate(2.f * NormalScale), XMVectorReplicate(-1.f));
+    XMVECTOR ny = XMVectorMultiplyAdd(XMConvertVectorIntToFloat(XMVectorAndInt(packedNormal, NormalMaskY), 10),
+        XMVectorReplicate(2.f * NormalScale), XMVectorReplicate(-1.f));
+    XMVECTOR nz = XMVectorMultiplyAdd(XMConvertVectorIntToFloat(XMVectorAndInt(packedNormal, NormalMaskZ), 20),
+        XMVectorReplicate(2.f * NormalScale), XMVectorReplicate(-1.f));
+    // cos = sum(n * (2 * packed * scale - 1)) = sum(n * 2 * scale * packed) - sum(n),
+    // and it's 1 - cos that's weighted, scaled by NormalPhi
+    XMVECTOR normalOffset = XMVectorScale(XMVectorAdd(XMVectorAdd(nx, ny), XMVectorAdd(nz, XMVectorSplatOne())), NormalPhi);
+    XMVECTOR normalX = XMVectorScale(nx, -2.f * NormalScale * NormalPhi);
+    XMVECTOR normalY = XMVectorScale(ny, -2.f * NormalScale * NormalPhi);
+    XMVECTOR normalZ = XMVectorScale(nz, -2.f * NormalScale * NormalPhi);
+
+    XMVECTOR dist = LoadTap<Contiguous>(src.Dists, center);
+    XMVECTOR distScale = XMVectorReciprocal(XMVectorScale(dist, DistTolerance * step));
+
+    XMVECTOR lum = LoadTap<Contiguous>(src.Lum, center);
+
+    // The center's noise, from its variance blurred with its neighbors'. Variance estimated
+    // from a few samples is itself very noisy, and a pixel that happens to get a low estimate
+    // would otherwise hardly be filtered.
+    XMVECTOR variance = XMVectorZero();
+    for (int i = 0; i < 9; ++i)
+    {
+        variance = XMVectorMultiplyAdd(LoadTap<Contiguous>(src.Variance, taps[i]),
+            XMVectorReplicate(KernelWeights[i / 3] * KernelWeights[i % 3]), variance);
+    }
+    XMVECTOR sigma = XMVectorMultiplyAdd(XMVectorSqrt(variance), XMVectorReplicate(ColorPhi), XMVectorReplicate(MinColorSigma));
+    XMVECTOR invSigma = XMVectorReciprocal(sigma);
+
+    XMVECTOR sumWeight = XMVectorZero();
+    XMVECTOR sumR = XMVectorZero();
+    XMVECTOR sumLum = XMVectorZero();
+    XMVECTOR sumB = XMVectorZero();
+    XMVECTOR sumVariance = XMVectorZero();
+    for (int i = 0; i < 9; ++i)
+    {
+        const int* tap = taps[i];
+
+        XMVECTOR tapNormal = LoadTap<Contiguous>(src.Normals, tap);
+        XMVECTOR error = normalOffset;
+        error = XMVectorMultiplyAdd(XMConvertVectorIntToFloat(XMVectorAndInt(tapNormal, NormalMaskX), 0), normalX, error);
+        error = XMVectorMultiplyAdd(XMConvertVectorIntToFloat(XMVectorAndInt(tapNormal, NormalMaskY), 10), normalY, error);
+        error = XMVectorMultiplyAdd(XMConvertVectorIntToFloat(XMVectorAndInt(tapNormal, NormalMaskZ), 20), normalZ, error);
+        error = XMVectorMax(error, XMVectorZero());
+
+        XMVECTOR distDiff = XMVectorAbs(XMVectorSubtract(LoadTap<Contiguous>(src.Dists, tap), dist));
+        error = XMVectorMultiplyAdd(distDiff, distScale, error);
+
+        XMVECTOR tapLum = LoadTap<Contiguous>(src.Lum, tap);
+        error = XMVectorMultiplyAdd(XMVectorAbs(XMVectorSubtract(tapLum, lum)), invSigma, error);
+
+        // The center tap always has most of its kernel weight, so the sum is never 0
+        XMVECTOR weight = XMVectorScale(ExpNegEst(error), KernelWeights[i / 3] * KernelWeights[i % 3]);
+        sumWeight = XMVectorAdd(sumWeight, weight);
+        sumR = XMVectorMultiplyAdd(LoadTap<Contiguous>(src.R, tap), weight, sumR);
+        sumLum = XMVectorMultiplyAdd(tapLum, weight, sumLum);
+        sumB = XMVectorMultiplyAdd(LoadTap<Contiguous>(src.B, tap), weight, sumB);
+
+        // Averaging independent pixels divides their variance by the sum of the squared weights
+        sumVariance = XMVectorMultiplyAdd(LoadTap<Contiguous>(src.Variance, tap), XMVectorMultiply(weight, weight), sumVariance);
+    }
+
+    XMVECTOR invWeight = XMVectorReciprocal(sumWeight);
+    *outR = XMVectorMultiply(sumR, invWeight);
+    *outLum = XMVectorMultiply(sumLum, invWeight);
+    *outB = XMVectorMultiply(sumB, invWeight);
+    *outVariance = XMVectorMultiply(sumVariance, XMVectorMultiply(invWeight, invWeight));
+}
+
+// Turn filtered lighting back into color, after the last iteration. Green comes back from the
+// luminance that was filtered in its place, and is written over it.
+template <bool Contiguous>
+static inline void Remodulate(const uint32_t* albedos, const int* indices, XMVECTOR* r, XMVECTOR* lumOrGreen, XMVECTOR* b)
+{
+    XMVECTOR albedoR, albedoG, albedoB;
+    LoadAlbedos<Contiguous>(albedos, indices, &albedoR, &albedoG, &albedoB);
+    XMVECTOR green = XMVectorScale(XMVectorNegativeMultiplySubtract(*b, XMVectorReplicate(LumB),
+        XMVectorNegativeMultiplySubtract(*r, XMVectorReplicate(LumR), *lumOrGreen)), 1.f / LumG);
+    *r = XMVectorMultiply(*r, albedoR);
+    *lumOrGreen = XMVectorMultiply(green, albedoG);
+    *b = XMVectorMultiply(*b, albedoB);
+}
+
+void Denoiser::FilterTile(int iteration, const RenderScheduler::Tile& tile)
+{
+    assert(iteration >= 0 && iteration < NumIterations);
+
+    const ColorPlanes& srcPlanes = Buffers[iteration & 1];
+    ColorPlanes& dest = Buffers[(iteration + 1) & 1];
+    int step = 1 << iteration;
+
+    FilterSource src;
+    src.R = srcPlanes.R.get();
+    src.Lum = srcPlanes.Lum.get();
+    src.B = srcPlanes.B.get();
+    src.Variance = srcPlanes.Variance.get();
+    src.Normals = Normals.get();
+    src.Dists = Dists.get();
+
+    for (int y = tile.MinY; y < tile.MaxY; ++y)
+    {
+        // Taps past the edges of the image are clamped to the edge
+        int rows[3] = { max(y - step, 0) * Width, y * Width, min(y + step, Height - 1) * Width };
+
+        for (int x = tile.MinX; x < tile.MaxX; x += 4)
+        {
+            int taps[9][4];
+            XMVECTOR r, lum, b, variance;
+            if (x - step >= 0 && x + step + 4 <= Width)
+            {
+                for (int i = 0; i < 9; ++i)
+                {
+                    taps[i][0] = rows[i / 3] + x + (i % 3 - 1) * step;
+                }
+                FilterPixels<true>(src, taps, step, &r, &lum, &b, &variance);
+                if (iteration == NumIterations - 1)
+                {
+                    Remodulate<true>(Albedos.get(), taps[4], &r, &lum, &b);
+                }
+            }
+            else
+            {
+                for (int i = 0; i < 9; ++i)
+                {
+                    for (int j = 0; j < 4; ++j)
+                    {
+                        taps[i][j] = rows[i / 3] + min(max(x + j + (i % 3 - 1) * step, 0), Width - 1);
+                    }
+                }
+                FilterPixels<false>(src, taps, step, &r, &lum, &b, &variance);
+                if (iteration == NumIterations - 1)
+                {
+                    Remodulate<false>(Albedos.get(), taps[4], &r, &lum, &b);
+                }
+            }
+
+            int count = min(tile.MaxX - x, 4);
+            StoreRow(&dest.R[rows[1]], x, count, r);
+            StoreRow(&dest.Lum[rows[1]], x, count, lum);
+            StoreRow(&dest.B[rows[1]], x, count, b);
+            StoreRow(&dest.Variance[rows[1]], x, count, variance);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "RenderScheduler.h"
+
+/// Edge-avoiding a-trous wavelet filter (Dammertz et al. 2010), to turn an image with only a few
+/// samples per pixel into a usable preview. Each iteration is a 3x3 blur with its taps spread
+/// 2^i pixels apart, so a handful of cheap iterations average over a wide area. Taps are weighted
+/// down where the surface seen differs from the center pixel's (normal or distance), or where the
+/// brightness differs by more than the pixel's noise accounts for, which keeps geometric edges and
+/// shadow boundaries from being smeared. The noise estimate is each pixel's variance, carried
+/// through the iterations as they reduce it (as in SVGF), so the test tightens as the image gets
+/// cleaner. Only the light arriving at surfaces is filtered: colors are divided by the albedo of
+/// the surface before filtering and multiplied back after, so texture detail stays sharp.
+///
+/// The guides (normal, distance, albedo) are written while tracing camera rays, with SetGuide.
+/// Everything else works on tiles, so it can be spread across the render threads, but each step
+/// reads neighbors from the step before, so a step must finish for the whole image before the
+/// next one starts. Colors are stored as a plane per channel and the guides are packed, so 4
+/// neighboring pixels are filtered at once and each tap reads as little memory as possible.
+class Denoiser
+{
+public:
+    // Taps are 1, 2, 4, 8 and 16 pixels apart, reaching 31 pixels out in all
+    static const int NumIterations = 5;
+
+    Denoiser();
+
+    bool Initialize(int width, int height);
+
+    // What the camera ray through pixel (x, y) hit first: the normal (unit length), the distance
+    // along the ray, and the surface's base color
+    void SetGuide(int x, int y, FXMVECTOR normal, float dist, FXMVECTOR albedo);
+
+    // Fill in the colors to filter, and their variance, from an accumulation buffer (RGB sums +
+    // sample count, with the sums of squared sample luminance alongside)
+    void LoadTile(const XMFLOAT4* accum, const float* accumLumSq, const RenderScheduler::Tile& tile);
+
+    // Run one iteration of the filter over a tile, for iteration in [0, NumIterations)
+    void FilterTile(int iteration, const RenderScheduler::Tile& tile);
+
+    // The filtered image after all of the iterations, as Width x Height planes of red, green & blue
+    const float* GetRed() const { return Buffers[NumIterations & 1].R.get(); }
+    const float* GetGreen() const { return Buffers[NumIterations & 1].Lum.get(); }
+    const float* GetBlue() const { return Buffers[NumIterations & 1].B.get(); }
+
+private:
+    // Don't allow copy
+    Denoiser(const Denoiser&);
+    Denoiser& operator= (const Denoiser&);
+
+    // Luminance is filtered in place of green. The filter is linear, so green comes back exactly
+    // from the other three, and the color test doesn't have to work out each tap's luminance.
+    struct ColorPlanes
+    {
+        std::unique_ptr<float[]> R;
+        std::unique_ptr<float[]> Lum;       // Green after the last iteration
+        std::unique_ptr<float[]> B;
+        std::unique_ptr<float[]> Variance;  // Of the luminance
+    };
+
+    int Width;
+    int Height;
+
+    // Iterations read one set and write the other
+    ColorPlanes Buffers[2];
+
+    // Normals (10 bits per axis) and albedos (8 bits per channel) are packed into 32 bits
+    std::unique_ptr<uint32_t[]> Normals;
+    std::unique_ptr<float[]> Dists;
+    std::unique_ptr<uint32_t[]> Albedos;
+};
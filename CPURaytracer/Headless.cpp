@@ -0,0 +1,514 @@
+#include "Precomp.h"
+#include "Headless.h"
+#include "Raytracer.h"
+#include "Timer.h"
+
+// Adaptive sampling error target for the convergence benchmark's adaptive run, when -threshold
+// doesn't give one
+static const float DefaultConvergenceThreshold = 0.02f;
+
+struct HeadlessOptions
+{
+    int Width;
+    int Height;
+    int SamplesPerPixel;
+    int NumThreads;         // 0 means one per core
+    int NumRandomBoxes;     // Extra boxes added to the Cornell box, to make the scene heavier
+    const char* Scene;      // Model file to render in the Cornell box instead of the boxes, or null
+    Sampler::Type SamplerType;
+    bool LightSampling;
+    int MaxBounces;
+    float ConvergenceThreshold; // Adaptive sampling error target, 0 to sample every pixel equally
+    bool Denoise;
+    bool PacketTracing;
+    bool Wavefront;
+    double ConvergenceTime; // If > 0, run the convergence benchmark with this much time per sampler
+    int ReferenceSamplesPerPixel;
+    int AnimationFrames;    // If > 0, run the animation benchmark for this many frames
+    int WavefrontSamplesPerPixel; // If > 0, run the wavefront benchmark with this many samples per pixel
+    bool TraceBenchmark;    // Run the BVH trace benchmark
+    const char* Output;
+};
+
+static void PrintUsage()
+{
+    printf("Usage: -headless [options]\n");
+    printf("  -width <pixels>     Image width (default 512)\n");
+    printf("  -height <pixels>    Image height (default 512)\n");
+    printf("  -spp <count>        Samples per pixel (default 64)\n");
+    printf("  -threads <count>    Render threads, 0 for one per core (default 0)\n");
+    printf("  -boxes <count>      Random boxes added to the test scene (default 0)\n");
+    printf("  -scene <file>       Model (.obj, .sdkmesh or .cmo) to render instead of the boxes\n");
+    printf("  -sampler <type>     random or sobol (default sobol)\n");
+    printf("  -nee <on|off>       Next event estimation (light sampling) (default on)\n");
+    printf("  -bounces <count>    Maximum bounces per path (default 8)\n");
+    printf("  -threshold <error>  Stop sampling tiles once their relative error is below this,\n");
+    printf("                      so -spp becomes a maximum. 0 gives every pixel the same\n");
+    printf("                      samples (default 0)\n");
+    printf("  -denoise <on|off>   Denoise the image before saving it (default off)\n");
+    printf("  -packets <on|off>   Trace camera & first shadow rays in 2x2 packets (default on)\n");
+    printf("  -wavefront <on|off> Trace all of the paths a bounce at a time, sorting the rays of\n");
+    printf("                      each bounce (default off)\n");
+    printf("  -out <file>         Output image, .pfm or .ppm (default render.pfm)\n");
+    printf("  -convergence <sec>  Instead of rendering an image, compare the error (RMSE against\n");
+    printf("                      a reference) each sampler, with and without light sampling,\n");
+    printf("                      reaches in the given time. The adaptive run uses -threshold,\n");
+    printf("                      or 0.02 if it isn't given\n");
+    printf("  -refspp <count>     Samples per pixel for the convergence reference (default 4096)\n");
+    printf("  -animation <frames> Instead of rendering an image, time BVH updates & tracing of a\n");
+    printf("                      1M triangle animated scene for each way of updating the BVH\n");
+    printf("  -wavefrontbench <spp> Instead of rendering an image, compare depth first and wavefront\n");
+    printf("                      path tracing throughput on scenes of increasing size\n");
+    printf("  -benchmark          Instead of rendering an image, time BVH builds and single thread\n");
+    printf("                      ray tracing on scenes of increasing size, at -width x -height rays\n");
+}
+
+static bool ParseOptions(int argc, char* argv[], HeadlessOptions* options)
+{
+    options->Width = 512;
+    options->Height = 512;
+    options->SamplesPerPixel = 64;
+    options->NumThreads = 0;
+    options->NumRandomBoxes = 0;
+    options->Scene = nullptr;
+    options->SamplerType = Sampler::Sobol;
+    options->LightSampling = true;
+    options->MaxBounces = 8;
+    options->ConvergenceThreshold = 0.f;
+    options->Denoise = false;
+    options->PacketTracing = true;
+    options->Wavefront = false;
+    options->ConvergenceTime = 0.0;
+    options->ReferenceSamplesPerPixel = 4096;
+    options->AnimationFrames = 0;
+    options->WavefrontSamplesPerPixel = 0;
+    options->TraceBenchmark = false;
+    options->Output = "render.pfm";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (strcmp(arg, "-headless") == 0)
+        {
+            continue;
+        }
+
+        // The only option without a value
+        if (strcmp(arg, "-benchmark") == 0)
+        {
+            options->TraceBenchmark = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+
+        const char* value = argv[++i];
+        if (strcmp(arg, "-width") == 0)
+        {
+            options->Width = atoi(value);
+        }
+        else if (strcmp(arg, "-height") == 0)
+        {
+            options->Height = atoi(value);
+        }
+        else if (strcmp(arg, "-spp") == 0)
+        {
+            options->SamplesPerPixel = atoi(value);
+        }
+        else if (strcmp(arg, "-threads") == 0)
+        {
+            options->NumThreads = atoi(value);
+        }
+        else if (strcmp(arg, "-boxes") == 0)
+        {
+            options->NumRandomBoxes = atoi(value);
+        }
+        else if (strcmp(arg, "-scene") == 0)
+        {
+            options->Scene = value;
+        }
+        else if (strcmp(arg, "-sampler") == 0)
+        {
+            if (strcmp(value, "random") == 0)
+            {
+                options->SamplerType = Sampler::Random;
+            }
+            else if (strcmp(value, "sobol") == 0)
+            {
+                options->SamplerType = Sampler::Sobol;
+            }
+            else
+            {
+                fprintf(stderr, "Unknown sampler %s\n", value);
+                return false;
+            }
+        }
+        else if (strcmp(arg, "-nee") == 0)
+        {
+            if (strcmp(value, "on") == 0)
+            {
+                options->LightSampling = true;
+            }
+            else if (strcmp(value, "off") == 0)
+            {
+                options->LightSampling = false;
+            }
+            else
+            {
+                fprintf(stderr, "Expected on or off for -nee\n");
+                return false;
+            }
+        }
+        else if (strcmp(arg, "-bounces") == 0)
+        {
+            options->MaxBounces = atoi(value);
+        }
+        else if (strcmp(arg, "-threshold") == 0)
+        {
+            options->ConvergenceThreshold = (float)atof(value);
+        }
+        else if (strcmp(arg, "-denoise") == 0)
+        {
+            if (strcmp(value, "on") == 0)
+            {
+                options->Denoise = true;
+            }
+            else if (strcmp(value, "off") == 0)
+            {
+                options->Denoise = false;
+            }
+            else
+            {
+                fprintf(stderr, "Expected on or off for -denoise\n");
+                return false;
+            }
+        }
+        else if (strcmp(arg, "-packets") == 0)
+        {
+            if (strcmp(value, "on") == 0)
+            {
+                options->PacketTracing = true;
+            }
+            else if (strcmp(value, "off") == 0)
+            {
+                options->PacketTracing = false;
+            }
+            else
+            {
+                fprintf(stderr, "Expected on or off for -packets\n");
+                return false;
+            }
+        }
+        else if (strcmp(arg, "-wavefront") == 0)
+        {
+            if (strcmp(value, "on") == 0)
+            {
+                options->Wavefront = true;
+            }
+            else if (strcmp(value, "off") == 0)
+            {
+                options->Wavefront = false;
+            }
+            else
+            {
+                fprintf(stderr, "Expected on or off for -wavefront\n");
+                return false;
+            }
+        }
+        else if (strcmp(arg, "-out") == 0)
+        {
+            options->Output = value;
+        }
+        else if (strcmp(arg, "-convergence") == 0)
+        {
+            options->ConvergenceTime = atof(value);
+        }
+        else if (strcmp(arg, "-refspp") == 0)
+        {
+            options->ReferenceSamplesPerPixel = atoi(value);
+        }
+        else if (strcmp(arg, "-animation") == 0)
+        {
+            options->AnimationFrames = atoi(value);
+        }
+        else if (strcmp(arg, "-wavefrontbench") == 0)
+        {
+            options->WavefrontSamplesPerPixel = atoi(value);
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options->Width <= 0 || options->Height <= 0 || options->SamplesPerPixel <= 0 ||
+        options->NumThreads < 0 || options->NumRandomBoxes < 0 || options->MaxBounces < 0 ||
+        options->ConvergenceThreshold < 0.f ||
+        options->ConvergenceTime < 0.0 || options->ReferenceSamplesPerPixel <= 0 || options->AnimationFrames < 0 ||
+        options->WavefrontSamplesPerPixel < 0)
+    {
+        fprintf(stderr, "Invalid option value\n");
+        return false;
+    }
+
+    const char* ext = strrchr(options->Output, '.');
+    if (!ext || (strcmp(ext, ".pfm") != 0 && strcmp(ext, ".ppm") != 0))
+    {
+        fprintf(stderr, "Output must be a .pfm or .ppm file\n");
+        return false;
+    }
+
+    return true;
+}
+
+static double ComputeRmse(const XMFLOAT3* image, const XMFLOAT3* reference, int numPixels)
+{
+    double sum = 0.0;
+    for (int i = 0; i < numPixels; ++i)
+    {
+        double r = image[i].x - reference[i].x;
+        double g = image[i].y - reference[i].y;
+        double b = image[i].z - reference[i].z;
+        sum += r * r + g * g + b * b;
+    }
+    return sqrt(sum / (numPixels * 3.0));
+}
+
+// Error relative to the reference's brightness, closer to how visible noise is. Also the
+// error adaptive sampling aims to even out, with the same floor for nearly black pixels.
+static double ComputeRelativeRmse(const XMFLOAT3* image, const XMFLOAT3* reference, int numPixels)
+{
+    static const double MinReference = 0.05;
+
+    double sum = 0.0;
+    for (int i = 0; i < numPixels; ++i)
+    {
+        const float* pixel = &image[i].x;
+        const float* referencePixel = &reference[i].x;
+        for (int c = 0; c < 3; ++c)
+        {
+            double diff = (pixel[c] - referencePixel[c]) / max(MinReference, (double)referencePixel[c]);
+            sum += diff * diff;
+        }
+    }
+    return sqrt(sum / (numPixels * 3.0));
+}
+
+// Render a high sample count reference, then give each sampler the same amount of
+// time and measure how close it gets. Lower RMSE at equal time is what we're after.
+// Both estimators converge to the same image, so the reference uses light sampling.
+// Adaptive sampling spends its samples unevenly, so instead of running for a fixed time
+// it gets the same total number of samples as the run before it (equal cost), or stops
+// early if every tile converges.
+static int64_t CountSamples(const Raytracer* raytracer)
+{
+    int64_t numSamples = 0;
+    for (int i = 0; i < raytracer->GetNumThreads(); ++i)
+    {
+        numSamples += raytracer->GetThreadStats(i).NumSamples;
+    }
+    return numSamples;
+}
+
+static int RunConvergenceBenchmark(Raytracer* raytracer, FXMMATRIX cameraWorldTransform, const HeadlessOptions& options)
+{
+    struct ConvergenceRun
+    {
+        const char* SamplerName;
+        Sampler::Type SamplerType;
+        bool LightSampling;
+        bool Adaptive;
+    };
+    static const ConvergenceRun Runs[] =
+    {
+        { "random", Sampler::Random, false, false },
+        { "sobol", Sampler::Sobol, false, false },
+        { "random", Sampler::Random, true, false },
+        { "sobol", Sampler::Sobol, true, false },
+        { "sobol", Sampler::Sobol, true, true },
+    };
+
+    int numPixels = options.Width * options.Height;
+    std::unique_ptr<XMFLOAT3[]> reference(new XMFLOAT3[numPixels]);
+    std::unique_ptr<XMFLOAT3[]> image(new XMFLOAT3[numPixels]);
+
+    // The reference uses independent random numbers from a different seed, so that
+    // its remaining error isn't correlated with any of the runs being measured
+    printf("Rendering reference at %d spp\n", options.ReferenceSamplesPerPixel);
+    fflush(stdout);
+
+    double startTime = GetTimeInSeconds();
+    raytracer->SetSamplerType(Sampler::Random);
+    raytracer->SetRandomSeed(0x5eed5eed);
+    raytracer->EnableLightSampling(true);
+    raytracer->SetConvergenceThreshold(0.f);
+    raytracer->Clear();
+    raytracer->RenderOffline(cameraWorldTransform, options.ReferenceSamplesPerPixel);
+    raytracer->ResolveImage(reference.get());
+    raytracer->SetRandomSeed(0);
+    printf("Reference took %.3f s\n", GetTimeInSeconds() - startTime);
+
+    printf("%8s %5s %9s %10s %10s %11s %12s %12s\n", "Sampler", "NEE", "Adaptive", "Time(s)", "Passes", "Samples(M)", "RMSE", "RelRMSE");
+    int64_t previousSamples = 0;
+    for (int i = 0; i < (int)_countof(Runs); ++i)
+    {
+        raytracer->SetSamplerType(Runs[i].SamplerType);
+        raytracer->EnableLightSampling(Runs[i].LightSampling);
+        float threshold = (options.ConvergenceThreshold > 0.f) ? options.ConvergenceThreshold : DefaultConvergenceThreshold;
+        raytracer->SetConvergenceThreshold(Runs[i].Adaptive ? threshold : 0.f);
+        raytracer->Clear();
+        raytracer->ResetThreadStats();
+
+        int samplesPerPixel = 0;
+        double elapsed = 0.0;
+        int64_t numSamples = 0;
+        startTime = GetTimeInSeconds();
+        for (;;)
+        {
+            if (Runs[i].Adaptive ? (numSamples >= previousSamples || raytracer->GetNumActiveTiles() == 0) :
+                (elapsed >= options.ConvergenceTime))
+            {
+                break;
+            }
+
+            raytracer->RenderOffline(cameraWorldTransform, 1);
+            ++samplesPerPixel;
+            elapsed = GetTimeInSeconds() - startTime;
+            numSamples = CountSamples(raytracer);
+        }
+        previousSamples = numSamples;
+
+        raytracer->ResolveImage(image.get());
+        printf("%8s %5s %9s %10.3f %10d %11.3f %12.6f %12.6f\n", Runs[i].SamplerName, Runs[i].LightSampling ? "on" : "off",
+            Runs[i].Adaptive ? "on" : "off", elapsed, samplesPerPixel, numSamples / 1.0e6,
+            ComputeRmse(image.get(), reference.get(), numPixels), ComputeRelativeRmse(image.get(), reference.get(), numPixels));
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+int RunHeadless(int argc, char* argv[])
+{
+    HeadlessOptions options;
+    if (!ParseOptions(argc, argv, &options))
+    {
+        PrintUsage();
+        return -1;
+    }
+
+    std::unique_ptr<Raytracer> raytracer(Raytracer::CreateHeadless(options.Width, options.Height, options.NumThreads));
+    if (!raytracer)
+    {
+        fprintf(stderr, "Failed to create raytracer\n");
+        return -2;
+    }
+
+    // Same scene every run, so results are comparable between builds
+    srand(12345);
+    if (options.Scene)
+    {
+        double startTime = GetTimeInSeconds();
+        if (!raytracer->LoadScene(options.Scene))
+        {
+            fprintf(stderr, "Failed to load %s\n", options.Scene);
+            return -2;
+        }
+
+        const Scene& scene = raytracer->GetScene();
+        printf("Loaded %s in %.3f s: %d triangles, %d vertices, %d meshes, %d materials, %.1f MB\n",
+            options.Scene, GetTimeInSeconds() - startTime, scene.GetNumTriangles(), scene.GetNumVertices(),
+            scene.GetNumMeshes(), scene.GetNumMaterials(), scene.GetMemoryUsage() / (1024.0 * 1024.0));
+    }
+    else if (options.NumRandomBoxes > 0 && !raytracer->SetTestScene(options.NumRandomBoxes))
+    {
+        fprintf(stderr, "Failed to create scene\n");
+        return -2;
+    }
+
+    raytracer->SetMaxBounces(options.MaxBounces);
+    raytracer->SetConvergenceThreshold(options.ConvergenceThreshold);
+    raytracer->SetFOV(XMConvertToRadians(60.f));
+    raytracer->EnablePacketTracing(options.PacketTracing);
+    raytracer->EnableWavefront(options.Wavefront);
+
+    // Same view as the interactive app: camera moved back along -Z, looking at the origin
+    XMMATRIX cameraWorldTransform = XMMatrixIdentity();
+    cameraWorldTransform.r[3] = XMVectorSet(0.001f, 0, -4.f, 1);
+
+    if (options.TraceBenchmark)
+    {
+        return raytracer->RunTraceBenchmark(cameraWorldTransform) ? 0 : -3;
+    }
+
+    if (options.ConvergenceTime > 0.0)
+    {
+        return RunConvergenceBenchmark(raytracer.get(), cameraWorldTransform, options);
+    }
+
+    if (options.AnimationFrames > 0)
+    {
+        raytracer->SetSamplerType(options.SamplerType);
+        raytracer->EnableLightSampling(options.LightSampling);
+        return raytracer->RunAnimationBenchmark(cameraWorldTransform, options.AnimationFrames) ? 0 : -3;
+    }
+
+    if (options.WavefrontSamplesPerPixel > 0)
+    {
+        raytracer->SetSamplerType(options.SamplerType);
+        raytracer->EnableLightSampling(options.LightSampling);
+        return raytracer->RunWavefrontBenchmark(cameraWorldTransform, options.WavefrontSamplesPerPixel) ? 0 : -3;
+    }
+
+    raytracer->SetSamplerType(options.SamplerType);
+    raytracer->EnableLightSampling(options.LightSampling);
+    raytracer->EnableDenoise(options.Denoise);
+
+    int numThreads = raytracer->GetNumThreads();
+    printf("Rendering %dx%d, %d spp, %d threads, %lld triangles\n",
+        options.Width, options.Height, options.SamplesPerPixel, numThreads, (long long)raytracer->GetNumTriangles());
+    fflush(stdout);
+
+    raytracer->Clear();
+    raytracer->ResetThreadStats();
+
+    double startTime = GetTimeInSeconds();
+    raytracer->RenderOffline(cameraWorldTransform, options.SamplesPerPixel);
+    double wallTime = GetTimeInSeconds() - startTime;
+
+    int64_t numRays = 0;
+    for (int i = 0; i < numThreads; ++i)
+    {
+        numRays += raytracer->GetThreadStats(i).NumRays;
+    }
+    int64_t numSamples = CountSamples(raytracer.get());
+
+    printf("Wall time:   %10.3f s\n", wallTime);
+    printf("Rays:        %10.3f M (%.3f Mrays/s)\n", numRays / 1.0e6, numRays / wallTime / 1.0e6);
+    printf("Samples:     %10.3f M (%.3f Msamples/s)\n", numSamples / 1.0e6, numSamples / wallTime / 1.0e6);
+    printf("Tile steals: %10lld\n", (long long)raytracer->GetNumTileSteals());
+    printf("Converged:   %10d / %d tiles (%.1f spp average)\n",
+        raytracer->GetNumConvergenceTiles() - raytracer->GetNumActiveTiles(), raytracer->GetNumConvergenceTiles(),
+        (double)numSamples / ((double)options.Width * options.Height));
+    printf("Thread utilization:\n");
+    for (int i = 0; i < numThreads; ++i)
+    {
+        const Raytracer::ThreadStats& stats = raytracer->GetThreadStats(i);
+        printf("  %3d: %6.1f%%  %10.3f Mrays\n", i, 100.0 * stats.BusyTime / wallTime, stats.NumRays / 1.0e6);
+    }
+    fflush(stdout);
+
+    if (!raytracer->SaveImage(options.Output))
+    {
+        fprintf(stderr, "Failed to write %s\n", options.Output);
+        return -3;
+    }
+
+    printf("Wrote %s\n", options.Output);
+    return 0;
+}
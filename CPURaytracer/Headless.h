@@ -0,0 +1,6 @@
+#pragma once
+
+// Offline render without a window. Renders the test scene at the requested resolution,
+// sample count and thread count, writes the image to disk and prints throughput
+// statistics to stdout. Returns the process exit code.
+int RunHeadless(int argc, char* argv[]);
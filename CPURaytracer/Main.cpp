@@ -1,14 +1,20 @@
 #include "Precomp.h"
 #include "Debug.h"
 #include "Raytracer.h"
+#include "Headless.h"
 #include <memory>
 
+#if defined(_WIN32)
+
 // Constants
 static const wchar_t ClassName[] = L"Raytracer Test Application";
 static const uint32_t ScreenWidth = 512;
 static const uint32_t ScreenHeight = 512;
 // Max FPS (expressed as 1/FPS). Prevent app from running faster than this, set to 0.f for no throttle
 static const float TargetFrameRate = 0.f;// 1.f / 60.f;
+// Frame time the raytracer adapts its render resolution and passes per frame to (see
+// Raytracer::SetTargetFrameTime). F toggles it off and on.
+static const float TargetFrameTime = 1.f / 30.f;
 
 // Application variables
 static HINSTANCE Instance;
@@ -17,11 +23,18 @@ static HWND Window;
 // Local methods
 static bool Initialize();
 static void Shutdown();
+static void AttachToParentConsole();
 static LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
 
 // Entry point
-int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
+int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR commandLine, int)
 {
+    if (strstr(commandLine, "-headless"))
+    {
+        AttachToParentConsole();
+        return RunHeadless(__argc, __argv);
+    }
+
     Instance = instance;
     if (!Initialize())
     {
@@ -36,6 +49,25 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
         return -2;
     }
 
+    raytracer->SetFOV(XMConvertToRadians(60.f));
+    raytracer->SetTargetFrameTime(TargetFrameTime);
+
+    // Camera at the origin, looking along Z
+    XMMATRIX cameraWorldTransform = XMMatrixIdentity();
+    // Move camera back along -Z so that it's looking at the origin
+    cameraWorldTransform.r[3] = XMVectorSet(0.001f, 0, -4.f, 1);
+
+    if (strstr(commandLine, "-benchmark"))
+    {
+        AttachToParentConsole();
+
+        bool succeeded = raytracer->RunTraceBenchmark(cameraWorldTransform);
+
+        raytracer.reset();
+        Shutdown();
+        return succeeded ? 0 : -3;
+    }
+
     ShowWindow(Window, SW_SHOW);
     UpdateWindow(Window);
 
@@ -45,13 +77,6 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
     LARGE_INTEGER frequency = {};
     QueryPerformanceFrequency(&frequency);
 
-    raytracer->SetFOV(XMConvertToRadians(60.f));
-
-    // Camera at the origin, looking along Z
-    XMMATRIX cameraWorldTransform = XMMatrixIdentity();
-    // Move camera back along -Z so that it's looking at the origin
-    cameraWorldTransform.r[3] = XMVectorSet(0.001f, 0, -4.f, 1);
-
     wchar_t caption[200] = {};
 
     // Main loop
@@ -94,49 +119,57 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
 
             if (GetAsyncKeyState(VK_SPACE) & 0x8000)
             {
-                raytracer->EnableBlur(!raytracer->IsBlurEnabled());
+                raytracer->EnableDenoise(!raytracer->IsDenoiseEnabled());
+            }
+
+            if (GetAsyncKeyState('R') & 0x8000)
+            {
+                raytracer->EnableReprojection(!raytracer->IsReprojectionEnabled());
             }
 
-            // Input
-            bool invalidate = false;
+            if (GetAsyncKeyState('F') & 0x8000)
+            {
+                raytracer->SetTargetFrameTime(raytracer->GetTargetFrameTime() > 0.0 ? 0.0 : TargetFrameTime);
+            }
+
+            if (GetAsyncKeyState('W') & 0x8000)
+            {
+                raytracer->EnableWavefront(!raytracer->IsWavefrontEnabled());
+            }
+
+            // Input. The raytracer notices the camera moving, and carries the image over to the new view.
             if (GetAsyncKeyState(VK_RIGHT) & 0x8000)
             {
                 cameraWorldTransform.r[3] = XMVectorAdd(cameraWorldTransform.r[3], XMVectorSet(0.125f, 0.f, 0.f, 0.f));
-                invalidate = true;
             }
             if (GetAsyncKeyState(VK_LEFT) & 0x8000)
             {
                 cameraWorldTransform.r[3] = XMVectorAdd(cameraWorldTransform.r[3], XMVectorSet(-0.125f, 0.f, 0.f, 0.f));
-                invalidate = true;
             }
             if (GetAsyncKeyState(VK_UP) & 0x8000)
             {
                 cameraWorldTransform.r[3] = XMVectorAdd(cameraWorldTransform.r[3], XMVectorSet(0.f, 0.f, 0.125f, 0.f));
-                invalidate = true;
             }
             if (GetAsyncKeyState(VK_DOWN) & 0x8000)
             {
                 cameraWorldTransform.r[3] = XMVectorAdd(cameraWorldTransform.r[3], XMVectorSet(0.f, 0.f, -0.125f, 0.f));
-                invalidate = true;
             }
 
-            if (invalidate)
-            {
-                raytracer->Clear();
-            }
             raytracer->Render(cameraWorldTransform);
 
             HDC hdc = GetDC(Window);
 
-            static const wchar_t InputText[] = L"Arrow Keys Move, Spacebar to toggle blur";
-            RECT rc = { 0, 0, 500, 50 };
+            static const wchar_t InputText[] = L"Arrow Keys Move, Spacebar to toggle denoising\nR to toggle reprojection, F to toggle frame time control\nW to toggle wavefront path tracing";
+            RECT rc = { 0, 0, 500, 75 };
             SetBkMode(hdc, TRANSPARENT);
             SetTextColor(hdc, RGB(255, 255, 255));
             DrawText(hdc, InputText, _countof(InputText), &rc, 0);
 
             ReleaseDC(Window, hdc);
 
-            swprintf_s(caption, L"CPU Raytracer: Resolution: %dx%d, Threads: %d, FPS: %3.2f", ScreenWidth, ScreenHeight, raytracer->GetNumThreads(), frameRate);
+            swprintf_s(caption, L"CPU Raytracer: Resolution: %dx%d (rendering %dx%d, %d passes/frame), Threads: %d, FPS: %3.2f",
+                ScreenWidth, ScreenHeight, raytracer->GetWidth(), raytracer->GetHeight(), raytracer->GetPassesPerFrame(),
+                raytracer->GetNumThreads(), frameRate);
             SetWindowText(Window, caption);
         }
     }
@@ -187,6 +220,17 @@ void Shutdown()
     Window = nullptr;
 }
 
+// Send output to the console we were launched from (if any)
+void AttachToParentConsole()
+{
+    if (AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* console = nullptr;
+        freopen_s(&console, "CONOUT$", "w", stdout);
+        freopen_s(&console, "CONOUT$", "w", stderr);
+    }
+}
+
 LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
     switch (msg)
@@ -198,3 +242,13 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 
     return DefWindowProc(hwnd, msg, wParam, lParam);
 }
+
+#else
+
+// Only headless rendering is available on other platforms
+int main(int argc, char* argv[])
+{
+    return RunHeadless(argc, argv);
+}
+
+#endif
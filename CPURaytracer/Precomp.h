@@ -1,25 +1,54 @@
 #pragma once
 
+#if defined(_WIN32)
 #include <Windows.h>
+#endif
 
 #include <stdio.h>
 #include <stdint.h>
 #include <stdarg.h>
+#include <wchar.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
 #include <assert.h>
 #include <math.h>
 #include <float.h>
 
 #include <memory>
+#include <string>
 #include <vector>
+#include <deque>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#if !defined(_WIN32)
+// Only headless (offline) rendering is supported on other platforms.
+// Fill in the few Windows helpers the renderer core relies on.
+#define __cdecl
+#define UNREFERENCED_PARAMETER(x) (void)(x)
+#define ZeroMemory(p, size) memset((void*)(p), 0, (size))
+#define _countof(a) (sizeof(a) / sizeof((a)[0]))
+#define _isnanf(x) isnan(x)
+using std::min;
+using std::max;
+#endif
 
 // Fast vector math with SSE support
 #include <DirectXMath.h>
 using namespace DirectX;
 
+#if defined(_WIN32)
 // RAII wrappers
 #include <wrl.h>
 using namespace Microsoft::WRL;
 using namespace Microsoft::WRL::Wrappers;
 
-// Image loading library
-#include <wincodec.h>
+// Image loading & mip generation
+#include "DirectXTex\DirectXTex.h"
+#endif
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "TrianglePacket.h"
+
+// Number of rays traced together as a packet: the camera rays of a 2x2 block of pixels, or the
+// shadow rays leaving the points they hit. Rays that start close together and head the same
+// way mostly visit the same BVH nodes, so testing a node against the whole packet at once
+// costs about the same as testing it against a single ray.
+static const int RayPacketWidth = 4;
+
+/// A packet of rays stored structure-of-arrays, one ray per lane. Rays only hit things closer
+/// than their lane of MaxDist. Lanes that aren't in use have a negative MaxDist, so they never
+/// hit anything, and traversal carries on as long as any lane could still hit.
+struct RayPacket
+{
+    XMVECTOR Start[3];      // x, y, z
+    XMVECTOR Dir[3];
+    XMVECTOR InvDir[3];
+    XMVECTOR MaxDist;
+};
+
+// Set up a packet from RayPacketWidth rays, given as a start and direction per ray
+inline void PrepareRayPacket(const XMVECTOR* starts, const XMVECTOR* dirs, FXMVECTOR maxDist, RayPacket* rays)
+{
+    XMMATRIX start, dir;
+    for (int i = 0; i < RayPacketWidth; ++i)
+    {
+        start.r[i] = starts[i];
+        dir.r[i] = dirs[i];
+    }
+    start = XMMatrixTranspose(start);
+    dir = XMMatrixTranspose(dir);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        rays->Start[i] = start.r[i];
+        rays->Dir[i] = dir.r[i];
+        rays->InvDir[i] = XMVectorReciprocal(dir.r[i]);
+    }
+    rays->MaxDist = maxDist;
+}
+
+// Bit i set for each lane i that's set in a comparison mask
+inline int GetRayPacketLanes(FXMVECTOR mask)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_movemask_ps(mask);
+#else
+    XMUINT4 lanes;
+    XMStoreUInt4(&lanes, mask);
+    return (lanes.x ? 1 : 0) | (lanes.y ? 2 : 0) | (lanes.z ? 4 : 0) | (lanes.w ? 8 : 0);
+#endif
+}
+
+// The same rays moved by an affine transform (such as into an instance's model space). The
+// directions aren't normalized afterwards, so distances along the rays stay the same.
+inline void TransformRayPacket(const RayPacket& rays, const XMFLOAT4X3& transform, RayPacket* result)
+{
+    const float(*m)[3] = transform.m;
+    for (int i = 0; i < 3; ++i)
+    {
+        XMVECTOR mx = XMVectorReplicate(m[0][i]);
+        XMVECTOR my = XMVectorReplicate(m[1][i]);
+        XMVECTOR mz = XMVectorReplicate(m[2][i]);
+        result->Start[i] = XMVectorMultiplyAdd(rays.Start[0], mx, XMVectorMultiplyAdd(rays.Start[1], my,
+            XMVectorMultiplyAdd(rays.Start[2], mz, XMVectorReplicate(m[3][i]))));
+        result->Dir[i] = XMVectorMultiplyAdd(rays.Dir[0], mx, XMVectorMultiplyAdd(rays.Dir[1], my,
+            XMVectorMultiply(rays.Dir[2], mz)));
+        result->InvDir[i] = XMVectorReciprocal(result->Dir[i]);
+    }
+    result->MaxDist = rays.MaxDist;
+}
+
+//
+// Moller-Trumbore, every ray of a packet against one triangle (lane) of a triangle packet. Like
+// the single ray test, only the front face is hit. Returns the mask of rays that hit it closer
+// than maxDist, with the distances and barycentrics (weights of the 2nd & 3rd vertex) of all lanes.
+//
+inline XMVECTOR RayPacketTriangleHits(const RayPacket& rays, const TrianglePacket& packet, int lane, FXMVECTOR maxDist,
+    XMVECTOR* dist, XMVECTOR* u, XMVECTOR* v)
+{
+    XMVECTOR e1x = XMVectorReplicate(packet.Edge1[0][lane]);
+    XMVECTOR e1y = XMVectorReplicate(packet.Edge1[1][lane]);
+    XMVECTOR e1z = XMVectorReplicate(packet.Edge1[2][lane]);
+    XMVECTOR e2x = XMVectorReplicate(packet.Edge2[0][lane]);
+    XMVECTOR e2y = XMVectorReplicate(packet.Edge2[1][lane]);
+    XMVECTOR e2z = XMVectorReplicate(packet.Edge2[2][lane]);
+
+    // p = dir x e2
+    XMVECTOR px = rays.Dir[1] * e2z - rays.Dir[2] * e2y;
+    XMVECTOR py = rays.Dir[2] * e2x - rays.Dir[0] * e2z;
+    XMVECTOR pz = rays.Dir[0] * e2y - rays.Dir[1] * e2x;
+
+    // det > 0 means the ray is heading into the front face
+    XMVECTOR det = e1x * px + e1y * py + e1z * pz;
+    XMVECTOR invDet = XMVectorReciprocal(det);
+
+    // t = start - v0
+    XMVECTOR tx = rays.Start[0] - XMVectorReplicate(packet.V0[0][lane]);
+    XMVECTOR ty = rays.Start[1] - XMVectorReplicate(packet.V0[1][lane]);
+    XMVECTOR tz = rays.Start[2] - XMVectorReplicate(packet.V0[2][lane]);
+
+    *u = (tx * px + ty * py + tz * pz) * invDet;
+
+    // q = t x e1
+    XMVECTOR qx = ty * e1z - tz * e1y;
+    XMVECTOR qy = tz * e1x - tx * e1z;
+    XMVECTOR qz = tx * e1y - ty * e1x;
+
+    *v = (rays.Dir[0] * qx + rays.Dir[1] * qy + rays.Dir[2] * qz) * invDet;
+    *dist = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+
+    XMVECTOR zero = XMVectorZero();
+    XMVECTOR mask = XMVectorGreater(det, zero);
+    mask = XMVectorAndInt(mask, XMVectorGreaterOrEqual(*u, zero));
+    mask = XMVectorAndInt(mask, XMVectorGreaterOrEqual(*v, zero));
+    mask = XMVectorAndInt(mask, XMVectorLessOrEqual(*u + *v, XMVectorSplatOne()));
+    mask = XMVectorAndInt(mask, XMVectorGreater(*dist, zero));
+    return XMVectorAndInt(mask, XMVectorLess(*dist, maxDist));
+}
+
+// Test the rays of a packet against every triangle of a triangle packet. The rays that hit one
+// closer than their lane of nearest have nearest, u & v updated, and the triangle's index put in
+// their lane of triangles (as an int). Returns the mask of rays that were updated.
+inline XMVECTOR IntersectRayPacketTriangles(const RayPacket& rays, const TrianglePacket& packet,
+    XMVECTOR* nearest, XMVECTOR* u, XMVECTOR* v, XMVECTOR* triangles)
+{
+    XMVECTOR updated = XMVectorFalseInt();
+    for (int lane = 0; lane < TrianglePacketWidth; ++lane)
+    {
+        // Unused lanes are degenerate and can't be hit, so there's no need to test them
+        if (packet.Triangle[lane] < 0)
+        {
+            continue;
+        }
+
+        XMVECTOR dist, hitU, hitV;
+        XMVECTOR hits = RayPacketTriangleHits(rays, packet, lane, *nearest, &dist, &hitU, &hitV);
+        *nearest = XMVectorSelect(*nearest, dist, hits);
+        *u = XMVectorSelect(*u, hitU, hits);
+        *v = XMVectorSelect(*v, hitV, hits);
+        *triangles = XMVectorSelect(*triangles, XMVectorReplicateInt((uint32_t)packet.Triangle[lane]), hits);
+        updated = XMVectorOrInt(updated, hits);
+    }
+    return updated;
+}
+
+// Mask of the rays of a packet that hit any triangle of a triangle packet closer than their lane of maxDist
+inline XMVECTOR OccludeRayPacketTriangles(const RayPacket& rays, const TrianglePacket& packet, FXMVECTOR maxDist)
+{
+    XMVECTOR occluded = XMVectorFalseInt();
+    for (int lane = 0; lane < TrianglePacketWidth; ++lane)
+    {
+        if (packet.Triangle[lane] < 0)
+        {
+            continue;
+        }
+
+        XMVECTOR dist, u, v;
+        occluded = XMVectorOrInt(occluded, RayPacketTriangleHits(rays, packet, lane, maxDist, &dist, &u, &v));
+    }
+    return occluded;
+}
@@ -1,7 +1,11 @@
 #include "Precomp.h"
 #include "Raytracer.h"
 #include "Debug.h"
+#include "Timer.h"
+#include "Resolve.h"
+#include "SceneLoader.h"
 #include <time.h>
+#include <fstream>
 
 #if defined (_DEBUG)
 //#define DISABLE_MULTITHREADED_RENDERING
@@ -9,11 +13,37 @@
 
 //#define USE_SINGLE_BOX
 
+#if defined(_WIN32)
 Raytracer* Raytracer::Create(HWND window)
 {
+    assert(window);
+
+    srand((int)time(nullptr));
+
+    RECT clientRect = {};
+    GetClientRect(window, &clientRect);
+
+    Raytracer* raytracer = new Raytracer(clientRect.right - clientRect.left, clientRect.bottom - clientRect.top, 0);
+    if (raytracer)
+    {
+        raytracer->Window = window;
+        if (!raytracer->Initialize())
+        {
+            delete raytracer;
+            raytracer = nullptr;
+        }
+    }
+    return raytracer;
+}
+#endif
+
+Raytracer* Raytracer::CreateHeadless(int width, int height, int numThreads)
+{
+    assert(width > 0 && height > 0);
+
     srand((int)time(nullptr));
 
-    Raytracer* raytracer = new Raytracer(window);
+    Raytracer* raytracer = new Raytracer(width, height, numThreads);
     if (raytracer)
     {
         if (!raytracer->Initialize())
@@ -25,46 +55,64 @@ Raytracer* Raytracer::Create(HWND window)
     return raytracer;
 }
 
-Raytracer::Raytracer(HWND hwnd)
-    : Window(hwnd)
+// Relative brightness of a linear RGB color
+static float Luminance(FXMVECTOR color)
+{
+    return XMVectorGetX(XMVector3Dot(color, XMVectorSet(0.2126f, 0.7152f, 0.0722f, 0.f)));
+}
+
+Raytracer::Raytracer(int width, int height, int numThreads)
+#if defined(_WIN32)
+    : Window(nullptr)
     , BackBufferDC(nullptr)
     , Pixels(nullptr)
+    , DisplayWidth(width)
+#else
+    : DisplayWidth(width)
+#endif
+    , DisplayHeight(height)
+    , Width(width)
+    , Height(height)
+    , PassIndex(0)
+    , ReprojectionEnabled(true)
     , hFov(0.f)
     , DistToProjPlane(0.f)
-    , NumVertices(0)
-    , NumTriangles(0)
-    , NumRenderJobs(0)
-    , NumThreads(0)
+    , NumEmissiveTriangles(0)
+    , NumTrianglePackets(0)
+    , BvhRestructuringEnabled(true)
     , NumTextures(0)
-    , BlurEnabled(true)
+    , NumThreads(numThreads)
+    , SamplerType(Sampler::Sobol)
+    , RandomSeed(0)
+    , LightSamplingEnabled(true)
+    , MaxBounces(8)
+    , ConvergenceThreshold(0.02f)
+    , NumConvergenceTilesX(0)
+    , NumConvergenceTilesY(0)
+    , DenoiseEnabled(true)
+    , PacketTracingEnabled(true)
+    , WavefrontEnabled(false)
+    , WavefrontSortingEnabled(true)
+    , SortOrigin(0.f, 0.f, 0.f)
+    , SortScale(0.f, 0.f, 0.f)
+#if defined(_WIN32)
+    , TargetFrameTime(0.0)
+    , PassesPerFrame(1)
+    , RenderScaleStep(RenderScaleSteps)
+    , FramesSinceRescale(0)
+    , SampleCost(0.0)
+    , PresentCost(0.0)
+#endif
 {
-    assert(Window);
-
-    RECT clientRect = {};
-    GetClientRect(Window, &clientRect);
-
-    Width = clientRect.right - clientRect.left;
-    Height = clientRect.bottom - clientRect.top;
     HalfWidth = Width * 0.5f;
     HalfHeight = Height * 0.5f;
 }
 
 Raytracer::~Raytracer()
 {
-    if (ShutdownEvent.IsValid())
-    {
-        SetEvent(ShutdownEvent.Get());
-        WaitForMultipleObjects(NumThreads, Threads.get(), TRUE, INFINITE);
-    }
-
-    for (int i = 0; i < NumThreads; ++i)
-    {
-        if (Threads[i])
-        {
-            CloseHandle(Threads[i]);
-        }
-    }
+    Scheduler.Shutdown();
 
+#if defined(_WIN32)
     Pixels = nullptr;
 
     if (BackBufferDC)
@@ -72,6 +120,7 @@ Raytracer::~Raytracer()
         DeleteDC(BackBufferDC);
         BackBufferDC = nullptr;
     }
+#endif
 }
 
 void Raytracer::SetFOV(float horizFovRadians)
@@ -86,695 +135,3101 @@ void Raytracer::Clear()
 {
     // Clear out the buffer
     ZeroMemory(Accum.get(), Width * Height * sizeof(XMFLOAT4));
+    ZeroMemory(AccumLumSq.get(), Width * Height * sizeof(float));
+    PassIndex = 0;
+
+    for (int i = 0; i < NumConvergenceTilesX * NumConvergenceTilesY; ++i)
+    {
+        TileErrors[i] = FLT_MAX;
+    }
+    MarkAllTilesDirty();
 }
 
-bool Raytracer::Render(FXMMATRIX cameraWorldTransform)
+void Raytracer::EnableDenoise(bool enabled)
 {
-    int numJobs = 0;
-    for (int y = 0; y < Height; y += TileSize)
+    if (enabled != DenoiseEnabled)
     {
-        for (int x = 0; x < Width; x += TileSize)
-        {
-            XMStoreFloat4x4(&RenderJobs[numJobs].CameraWorld, cameraWorldTransform);
-            RenderJobs[numJobs].minX = x;
-            RenderJobs[numJobs].maxX = x + TileSize;
-            RenderJobs[numJobs].minY = y;
-            RenderJobs[numJobs].maxY = y + TileSize;
-            ++numJobs;
-        }
+        DenoiseEnabled = enabled;
+        MarkAllTilesDirty();
     }
-    NumRenderJobs = numJobs;
-    SetEvent(StartEvent.Get());
-    WaitForSingleObject(FinishEvent.Get(), INFINITE);
-    ResetEvent(StartEvent.Get());
-
-    return Present();
 }
 
-bool Raytracer::Initialize()
+void Raytracer::MarkAllTilesDirty()
 {
-    //
-    // Create the back buffer & pixel memory
-    //
-    BITMAPINFO bmi = {};
-    HBITMAP bitmap = nullptr;
-
-    HDC hdc = GetDC(Window);
-    if (!hdc)
+    for (int i = 0; i < NumConvergenceTilesX * NumConvergenceTilesY; ++i)
     {
-        LogError(L"Failed to obtain window DC.");
-        return false;
+        TileDirty[i] = true;
     }
+}
 
-    BackBufferDC = CreateCompatibleDC(hdc);
-    if (!BackBufferDC)
+int Raytracer::GetNumActiveTiles() const
+{
+    int numActive = 0;
+    for (int i = 0; i < NumConvergenceTilesX * NumConvergenceTilesY; ++i)
     {
-        LogError(L"Failed to create compatible DC.");
-        ReleaseDC(Window, hdc);
-        return false;
+        if (ConvergenceThreshold <= 0.f || TileErrors[i] >= ConvergenceThreshold)
+        {
+            ++numActive;
+        }
     }
+    return numActive;
+}
 
-    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
-    bmi.bmiHeader.biWidth = Width;
-    bmi.bmiHeader.biHeight = -Height;
-    bmi.bmiHeader.biPlanes = 1;
-    bmi.bmiHeader.biBitCount = 32;
-    bmi.bmiHeader.biCompression = BI_RGB;
+bool Raytracer::SetTestScene(int numRandomBoxes)
+{
+    return GenerateTestScene(numRandomBoxes) && PrepareScene();
+}
 
-    bitmap = CreateDIBSection(BackBufferDC, &bmi, DIB_RGB_COLORS, (PVOID*)&Pixels, nullptr, 0);
-    if (!bitmap)
+bool Raytracer::LoadScene(const char* filename)
+{
+    SceneData.Clear();
+    AddTestRoom();
+
+    int firstVertex = SceneData.GetNumVertices();
+    int firstTriangle = SceneData.GetNumTriangles();
+    if (!LoadSceneFile(filename, &SceneData) || SceneData.GetNumTriangles() == firstTriangle)
     {
-        LogError(L"Failed to create DIB section.");
-        ReleaseDC(Window, hdc);
+        // Don't leave a half loaded scene behind
+        SetTestScene(0);
         return false;
     }
 
-    // Select the bitmap (this takes a reference on it)
-    SelectObject(BackBufferDC, bitmap);
+    // Place the model scaled uniformly to fit a 3 unit cube, standing on the middle of the floor
+    const XMFLOAT3* positions = SceneData.GetPositions();
+    XMVECTOR minCorner = XMLoadFloat3(&positions[firstVertex]);
+    XMVECTOR maxCorner = minCorner;
+    for (int i = firstVertex + 1; i < SceneData.GetNumVertices(); ++i)
+    {
+        XMVECTOR position = XMLoadFloat3(&positions[i]);
+        minCorner = XMVectorMin(minCorner, position);
+        maxCorner = XMVectorMax(maxCorner, position);
+    }
 
-    // Delete the object (the DC still has a reference)
-    DeleteObject(bitmap);
+    XMVECTOR size = maxCorner - minCorner;
+    float largest = max(XMVectorGetX(size), max(XMVectorGetY(size), XMVectorGetZ(size)));
+    float scale = largest > 0.f ? 3.f / largest : 1.f;
+    XMVECTOR center = (minCorner + maxCorner) * 0.5f;
+    XMVECTOR offset = XMVectorSet(-XMVectorGetX(center), -XMVectorGetY(minCorner), -XMVectorGetZ(center), 0.f) * scale;
 
-    ReleaseDC(Window, hdc);
+    int model = SceneData.AddModel(firstTriangle, SceneData.GetNumTriangles() - firstTriangle);
+    SceneData.AddInstance(model, XMMatrixScaling(scale, scale, scale) *
+        XMMatrixTranslationFromVector(offset + XMVectorSet(0.f, -2.5f, 2.5f, 0.f)));
 
-    // Create accum buffer
-    Accum.reset(new XMFLOAT4[Width * Height]);
-    if (!Accum)
+    return PrepareScene();
+}
+
+#if defined(_WIN32)
+bool Raytracer::Render(FXMMATRIX cameraWorldTransform)
+{
+    int64_t numSamples = 0;
+    for (int i = 0; i < NumThreads; ++i)
     {
-        LogError(L"Failed to allocate accumulation buffer.");
-        return false;
+        numSamples -= Stats[i].NumSamples;
     }
-    Clear();
+    double startTime = GetTimeInSeconds();
 
-    if (!GenerateTestScene())
+    for (int i = 0; i < PassesPerFrame; ++i)
     {
-        LogError(L"Failed to create test scene.");
-        return false;
+        RenderPass(cameraWorldTransform);
     }
 
-    //
-    // Create render threads
-    //
-
-    RenderJobs.reset(new RenderRequest[(Width / TileSize) * (Height / TileSize)]);
-    if (!RenderJobs)
+    double traceEndTime = GetTimeInSeconds();
+    if (!Present())
     {
-        LogError(L"Failed to allocate render job list.");
         return false;
     }
+    double presentTime = GetTimeInSeconds() - traceEndTime;
 
-    StartEvent.Attach(CreateEvent(nullptr, TRUE, FALSE, nullptr));
-    if (!StartEvent.IsValid())
+    for (int i = 0; i < NumThreads; ++i)
     {
-        LogError(L"Failed to create start event.");
-        return false;
+        numSamples += Stats[i].NumSamples;
     }
+    return UpdateFrameBudget(traceEndTime - startTime, numSamples, presentTime);
+}
 
-    FinishEvent.Attach(CreateEvent(nullptr, FALSE, FALSE, nullptr));
-    if (!FinishEvent.IsValid())
+bool Raytracer::UpdateFrameBudget(double traceTime, int64_t numSamples, double presentTime)
+{
+    // Estimates are smoothed over several frames, so one slow frame doesn't send the resolution down
+    static const double Smoothing = 0.2;
+    // The resolution only goes up when it would leave this much of the budget in use, so it
+    // doesn't flip back and forth between two steps that are both close to the budget
+    static const double RaiseMargin = 0.8;
+    // Frames to measure at a new resolution before changing it again
+    static const int RescaleDelay = 8;
+
+    int step = RenderScaleSteps;
+    PassesPerFrame = 1;
+
+    if (TargetFrameTime > 0.0)
     {
-        LogError(L"Failed to create finish event.");
-        return false;
+        if (numSamples > 0)
+        {
+            double cost = traceTime / (double)numSamples;
+            SampleCost = SampleCost > 0.0 ? SampleCost + (cost - SampleCost) * Smoothing : cost;
+        }
+        PresentCost = PresentCost > 0.0 ? PresentCost + (presentTime - PresentCost) * Smoothing : presentTime;
+
+        // Nothing has been traced yet to go by
+        if (SampleCost <= 0.0)
+        {
+            return true;
+        }
+
+        // What's left of the frame for tracing, planning for the worst case of every pixel getting
+        // a sample each pass (the image converging, or reprojection keeping it, only makes it quicker).
+        // Presenting can take most of a tight budget itself, but tracing still gets some of it.
+        double traceBudget = max(TargetFrameTime - PresentCost, TargetFrameTime * 0.25);
+        double displayPassCost = SampleCost * DisplayWidth * DisplayHeight;
+
+        // Pixels go with the square of the scale, so this is the largest step a pass fits at
+        auto fitScaleStep = [displayPassCost](double budget)
+        {
+            int fit = (int)(sqrt(budget / displayPassCost) * RenderScaleSteps);
+            return min(max(fit, (int)MinRenderScaleStep), (int)RenderScaleSteps);
+        };
+
+        step = RenderScaleStep;
+        if (++FramesSinceRescale >= RescaleDelay)
+        {
+            int fit = fitScaleStep(traceBudget);
+            int fitWithMargin = fitScaleStep(traceBudget * RaiseMargin);
+            if (fit < step)
+            {
+                step = fit;
+            }
+            else if (fitWithMargin > step)
+            {
+                step = fitWithMargin;
+            }
+        }
+
+        if (step == RenderScaleSteps)
+        {
+            PassesPerFrame = min(max((int)(traceBudget / displayPassCost), 1), (int)MaxPassesPerFrame);
+        }
     }
 
-    ShutdownEvent.Attach(CreateEvent(nullptr, TRUE, FALSE, nullptr));
-    if (!ShutdownEvent.IsValid())
+    if (step == RenderScaleStep)
     {
-        LogError(L"Failed to create shutdown event.");
-        return false;
+        return true;
     }
 
-    // Determine how many processors/cores the machine has
-#if !defined(DISABLE_MULTITHREADED_RENDERING)
-    // Since our rendering doesn't stall on I/O other than memory loads, more
-    // threads than cores won't help.
-    NumThreads = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
-#else
-    NumThreads = 1;
+    RenderScaleStep = step;
+    FramesSinceRescale = 0;
+    return SetRenderResolution(max(DisplayWidth * step / RenderScaleSteps, 1), max(DisplayHeight * step / RenderScaleSteps, 1));
+}
 #endif
 
-    Threads.reset(new HANDLE[NumThreads]);
-    if (!Threads)
+void Raytracer::RenderOffline(FXMMATRIX cameraWorldTransform, int samplesPerPixel)
+{
+    for (int i = 0; i < samplesPerPixel; ++i)
     {
-        LogError(L"Failed to allocate thread list.");
-        return false;
+        RenderPass(cameraWorldTransform);
     }
+}
 
+void Raytracer::ResetThreadStats()
+{
     for (int i = 0; i < NumThreads; ++i)
     {
-        Threads[i] = CreateThread(nullptr, 0, RenderThreadProc, this, 0, nullptr);
-        if (!Threads[i])
+        Stats[i].NumRays = 0;
+        Stats[i].NumSamples = 0;
+        Stats[i].BusyTime = 0.0;
+    }
+}
+
+void Raytracer::RenderPass(FXMMATRIX cameraWorldTransform)
+{
+    // If the camera has moved since the last pass, what's been accumulated so far is for another view
+    XMFLOAT4X4 camera;
+    XMStoreFloat4x4(&camera, cameraWorldTransform);
+    if (PassIndex > 0 && memcmp(&camera, &PassCameraWorld, sizeof(camera)) != 0)
+    {
+        if (ReprojectionEnabled)
         {
-            LogError(L"Failed to create thread.");
-            return false;
+            Reproject(cameraWorldTransform);
+        }
+        else
+        {
+            Clear();
         }
     }
+    PassCameraWorld = camera;
 
-    return true;
-}
+    RenderScheduler::TileFunc processTile = [this](int thread, const RenderScheduler::Tile& tile) { ProcessTile(thread, tile); };
 
-bool Raytracer::Present()
-{
-    // Resolve Accum buffer
-    for (int y = 0; y < Height; ++y)
+    if (ConvergenceThreshold <= 0.f)
     {
-        for (int x = 0; x < Width; ++x)
+        if (WavefrontEnabled)
         {
-            int i = y * Width + x;
-            XMVECTOR color = XMLoadFloat4(&Accum[i]) / max(Accum[i].w, 1.f);
+            RenderScheduler::Tile image = { 0, 0, Width, Height };
+            RenderWavefront(&image, 1);
+        }
+        else
+        {
+            Scheduler.Run(Width, Height, processTile);
+        }
+        MarkAllTilesDirty();
+        ++PassIndex;
+        return;
+    }
 
-            if (BlurEnabled)
+    // Only send rays to the tiles that haven't converged yet. Tiles drop out for good once
+    // they do (until the camera moves), so pixels still being sampled have had a sample in
+    // nearly every pass so far, and PassIndex stays a good sample index for them.
+    ActiveTiles.clear();
+    for (int ty = 0; ty < NumConvergenceTilesY; ++ty)
+    {
+        for (int tx = 0; tx < NumConvergenceTilesX; ++tx)
+        {
+            if (TileErrors[ty * NumConvergenceTilesX + tx] >= ConvergenceThreshold)
             {
-                int iRight = y * Width + min(x + 1, Width - 1);
-                int iBottom = min(y + 1, Height - 1) * Width + x;
-                int iRightBottom = min(y + 1, Height - 1) * Width + min(x + 1, Width - 1);
-                XMVECTOR right = XMLoadFloat4(&Accum[iRight]) / max(Accum[iRight].w, 1.f);
-                XMVECTOR bottom = XMLoadFloat4(&Accum[iBottom]) / max(Accum[iBottom].w, 1.f);
-                XMVECTOR rightBottom = XMLoadFloat4(&Accum[iRightBottom]) / max(Accum[iRightBottom].w, 1.f);
-                color = (color + right + bottom + rightBottom) * 0.25f;
+                TileDirty[ty * NumConvergenceTilesX + tx] = true;
+                RenderScheduler::Tile tile;
+                tile.MinX = tx * ConvergenceTileSize;
+                tile.MinY = ty * ConvergenceTileSize;
+                tile.MaxX = min(tile.MinX + ConvergenceTileSize, Width);
+                tile.MaxY = min(tile.MinY + ConvergenceTileSize, Height);
+                ActiveTiles.push_back(tile);
             }
-
-            Pixels[i] = ConvertColorToUint(color);
         }
     }
 
-    HDC hdc = GetDC(Window);
-    if (!hdc)
+    if (ActiveTiles.empty())
     {
-        LogError(L"Failed to get DC.");
-        return false;
+        return;
     }
 
-    RECT clientRect = {};
-    GetClientRect(Window, &clientRect);
-
-    int winWidth = clientRect.right - clientRect.left;
-    int winHeight = clientRect.bottom - clientRect.top;
-
-    // If the window has changed to a different size, use a stretch blt
-    if (winWidth != Width || winHeight != Height)
+    if (WavefrontEnabled)
     {
-        if (!StretchBlt(hdc, 0, 0, winWidth, winHeight, BackBufferDC, 0, 0, Width, Height, SRCCOPY))
-        {
-            LogError(L"Failed to blt render target to display.");
-            ReleaseDC(Window, hdc);
-            return false;
-        }
+        RenderWavefront(ActiveTiles.data(), (int)ActiveTiles.size());
     }
     else
     {
-        if (!BitBlt(hdc, 0, 0, Width, Height, BackBufferDC, 0, 0, SRCCOPY))
-        {
-            LogError(L"Failed to blt render target to display.");
-            ReleaseDC(Window, hdc);
-            return false;
-        }
+        Scheduler.Run(ActiveTiles.data(), (int)ActiveTiles.size(), processTile);
     }
+    ++PassIndex;
 
-    ReleaseDC(Window, hdc);
-    return true;
-}
-
-static int AddQuad(
-    FXMVECTOR a, FXMVECTOR b,
-    FXMVECTOR c, FXMVECTOR d,
-    XMFLOAT3* vertices, XMFLOAT2* texCoords)
-{
-    XMStoreFloat3(&vertices[0], a);
-    XMStoreFloat3(&vertices[1], b);
-    XMStoreFloat3(&vertices[2], c);
-    XMStoreFloat3(&vertices[3], a);
-    XMStoreFloat3(&vertices[4], c);
-    XMStoreFloat3(&vertices[5], d);
-
-    texCoords[0] = XMFLOAT2(0, 0);
-    texCoords[1] = XMFLOAT2(1, 0);
-    texCoords[2] = XMFLOAT2(1, 1);
-    texCoords[3] = XMFLOAT2(0, 0);
-    texCoords[4] = XMFLOAT2(1, 1);
-    texCoords[5] = XMFLOAT2(0, 1);
-
-    return 6;
+    UpdateTileErrors();
 }
 
-// Expressed as a point and 3 scaled vectors defining spans from that point.
-static int AddCube(
-    FXMVECTOR p, FXMVECTOR u,
-    FXMVECTOR v, FXMVECTOR w,
-    XMFLOAT3* vertices, XMFLOAT2* texCoords)
+void Raytracer::UpdateTileErrors()
 {
-    int numVertices = 0;
+    // Relative error is measured against the pixel's brightness, but never against less than
+    // this, so that nearly black pixels don't need huge numbers of samples to converge
+    static const float MinReferenceLuminance = 0.05f;
 
-    // Front
-    numVertices += AddQuad(p, p + u, p + u + v, p + v, vertices + numVertices, texCoords + numVertices);
-
-    // Back
-    numVertices += AddQuad(p + u + w, p + w, p + w + v, p + u + v + w, vertices + numVertices, texCoords + numVertices);
-
-    // Right
-    numVertices += AddQuad(p + u, p + u + w, p + u + w + v, p + u + v, vertices + numVertices, texCoords + numVertices);
+    if (PassIndex < (uint32_t)MinAdaptiveSamples)
+    {
+        return;
+    }
 
-    // Left
-    numVertices += AddQuad(p + w, p, p + v, p + w + v, vertices + numVertices, texCoords + numVertices);
+    for (size_t i = 0; i < ActiveTiles.size(); ++i)
+    {
+        const RenderScheduler::Tile& tile = ActiveTiles[i];
 
-    // Top
-    numVertices += AddQuad(p, p + w, p + w + u, p + u, vertices + numVertices, texCoords + numVertices);
+        // Mean over the tile's pixels of the squared relative standard error of each pixel's average.
+        // Reprojection can leave pixels with too little history to judge yet, keeping the tile going.
+        float sum = 0.f;
+        bool enoughSamples = true;
+        for (int y = tile.MinY; y < tile.MaxY && enoughSamples; ++y)
+        {
+            for (int x = tile.MinX; x < tile.MaxX; ++x)
+            {
+                const XMFLOAT4& accum = Accum[y * Width + x];
+                float n = accum.w;
+                if (n < (float)MinAdaptiveSamples)
+                {
+                    enoughSamples = false;
+                    break;
+                }
 
-    // Bottom (leave off since they're never visible in our test scene)
-    //numVertices += AddQuad(p + v, p + v + u, p + v + u + w, p + v + w, vertices + numVertices, texCoords + numVertices);
+                float mean = Luminance(XMLoadFloat4(&accum)) / n;
+                float variance = max(0.f, (AccumLumSq[y * Width + x] - mean * mean * n) / (n - 1.f));
+                float reference = max(mean, MinReferenceLuminance);
+                sum += variance / (n * reference * reference);
+            }
+        }
 
-    return numVertices;
+        int numPixels = (tile.MaxX - tile.MinX) * (tile.MaxY - tile.MinY);
+        TileErrors[(tile.MinY / ConvergenceTileSize) * NumConvergenceTilesX + tile.MinX / ConvergenceTileSize] =
+            enoughSamples ? sqrtf(sum / numPixels) : FLT_MAX;
+    }
 }
 
-bool Raytracer::GenerateTestScene()
+bool Raytracer::Initialize()
 {
-    // Load sample texture
-    NumTextures = 1;
-    Textures.reset(new Texture[NumTextures]);
-    if (!Textures)
+#if defined(_WIN32)
+    if (Window && !CreateBackBuffer())
     {
-        LogError(L"Failed to allocate textures.");
         return false;
     }
+#endif
 
-    HRESULT hr = CoInitialize(nullptr);
-    if (FAILED(hr))
+    if (!SetRenderResolution(Width, Height))
     {
-        LogError(L"Failed to init COM.");
         return false;
     }
 
-    ComPtr<IWICImagingFactory> factory;
-    hr = CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_SERVER, IID_PPV_ARGS(&factory));
-    if (FAILED(hr))
+    if (!GenerateTestScene())
     {
-        CoUninitialize();
-        LogError(L"Failed to create WIC imaging factory.");
+        LogError(L"Failed to create test scene.");
         return false;
     }
 
-    ComPtr<IWICBitmapDecoder> decoder;
-    hr = factory->CreateDecoderFromFilename(L"brick.jpg", nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder);
-    if (FAILED(hr))
+    if (!PrepareScene())
     {
-        CoUninitialize();
-        LogError(L"Failed to create WIC decoder.");
         return false;
     }
 
-    ComPtr<IWICBitmapFrameDecode> sourceBitmap;
-    hr = decoder->GetFrame(0, &sourceBitmap);
-    if (FAILED(hr))
+    //
+    // Create render threads
+    //
+
+    // Determine how many processors/cores the machine has, unless told how many threads to use
+    if (NumThreads <= 0)
     {
-        CoUninitialize();
-        LogError(L"Failed to get WIC frame.");
-        return false;
+#if defined(DISABLE_MULTITHREADED_RENDERING)
+        NumThreads = 1;
+#elif defined(_WIN32)
+        // Since our rendering doesn't stall on I/O other than memory loads, more
+        // threads than cores won't help.
+        NumThreads = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+#else
+        NumThreads = max(1, (int)std::thread::hardware_concurrency());
+#endif
     }
 
-    ComPtr<IWICBitmapSource> destBitmap;
-    hr = WICConvertBitmapSource(GUID_WICPixelFormat32bppRGBA, sourceBitmap.Get(), &destBitmap);
-    if (FAILED(hr))
+    Stats.reset(new ThreadStats[NumThreads]);
+    if (!Stats)
     {
-        CoUninitialize();
-        LogError(L"Failed to convert bitmap.");
+        LogError(L"Failed to allocate thread stats.");
         return false;
     }
+    ResetThreadStats();
 
-    UINT width, height;
-    destBitmap->GetSize(&width, &height);
-    Textures[0].Width = width;
-    Textures[0].Height = height;
-    Textures[0].Pixels.reset(new uint32_t[width * height]);
-    if (!Textures[0].Pixels)
+    if (!Scheduler.Start(NumThreads))
     {
-        CoUninitialize();
-        LogError(L"Failed to allocate texture.");
+        LogError(L"Failed to start render threads.");
         return false;
     }
 
-    hr = destBitmap->CopyPixels(nullptr, width * sizeof(uint32_t), width * height * sizeof(uint32_t), (BYTE*)Textures[0].Pixels.get());
-    if (FAILED(hr))
+    return true;
+}
+
+bool Raytracer::SetRenderResolution(int width, int height)
+{
+    assert(width > 0 && height > 0);
+
+    Width = width;
+    Height = height;
+    HalfWidth = Width * 0.5f;
+    HalfHeight = Height * 0.5f;
+    if (hFov > 0.f)
     {
-        CoUninitialize();
-        LogError(L"Failed to extract image.");
+        SetFOV(hFov);
+    }
+
+    // Create accum buffer
+    Accum.reset(new XMFLOAT4[Width * Height]);
+    AccumLumSq.reset(new float[Width * Height]);
+    if (!Accum || !AccumLumSq)
+    {
+        LogError(L"Failed to allocate accumulation buffer.");
         return false;
     }
 
-    CoUninitialize();
+    // And a second one to reproject into, along with the surfaces seen by each
+    Surfaces.reset(new PixelSurface[Width * Height]);
+    ReprojectedAccum.reset(new XMFLOAT4[Width * Height]);
+    ReprojectedLumSq.reset(new float[Width * Height]);
+    ReprojectedSurfaces.reset(new PixelSurface[Width * Height]);
+    if (!Surfaces || !ReprojectedAccum || !ReprojectedLumSq || !ReprojectedSurfaces)
+    {
+        LogError(L"Failed to allocate reprojection buffers.");
+        return false;
+    }
 
-    //
-    // Create Cornell box test scene. 6 walls (6 verts each), 2 cubes (30 verts each)
-    //
+    if (!ImageDenoiser.Initialize(Width, Height))
+    {
+        return false;
+    }
 
-#if defined(USE_SINGLE_BOX)
-    NumVertices = 72;
-#else
-    NumVertices = 102;
+#if defined(_WIN32)
+    // Below the display size, the image is resolved here and then scaled up into the back buffer
+    RenderPixels.reset();
+    if (Width != DisplayWidth || Height != DisplayHeight)
+    {
+        RenderPixels.reset(new uint32_t[Width * Height]);
+        if (!RenderPixels)
+        {
+            LogError(L"Failed to allocate render resolution pixels.");
+            return false;
+        }
+    }
 #endif
-    NumTriangles = NumVertices / 3;
 
-    Vertices.reset(new XMFLOAT3[NumVertices]);
-    if (!Vertices)
+    NumConvergenceTilesX = (Width + ConvergenceTileSize - 1) / ConvergenceTileSize;
+    NumConvergenceTilesY = (Height + ConvergenceTileSize - 1) / ConvergenceTileSize;
+    TileErrors.reset(new float[NumConvergenceTilesX * NumConvergenceTilesY]);
+    TileDirty.reset(new bool[NumConvergenceTilesX * NumConvergenceTilesY]);
+    if (!TileErrors || !TileDirty)
+    {
+        LogError(L"Failed to allocate tile state.");
+        return false;
+    }
+    Clear();
+
+    return true;
+}
+
+#if defined(_WIN32)
+bool Raytracer::CreateBackBuffer()
+{
+    //
+    // Create the back buffer & pixel memory
+    //
+    BITMAPINFO bmi = {};
+    HBITMAP bitmap = nullptr;
+
+    HDC hdc = GetDC(Window);
+    if (!hdc)
+    {
+        LogError(L"Failed to obtain window DC.");
+        return false;
+    }
+
+    BackBufferDC = CreateCompatibleDC(hdc);
+    if (!BackBufferDC)
+    {
+        LogError(L"Failed to create compatible DC.");
+        ReleaseDC(Window, hdc);
+        return false;
+    }
+
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = DisplayWidth;
+    bmi.bmiHeader.biHeight = -DisplayHeight;
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+
+    bitmap = CreateDIBSection(BackBufferDC, &bmi, DIB_RGB_COLORS, (PVOID*)&Pixels, nullptr, 0);
+    if (!bitmap)
+    {
+        LogError(L"Failed to create DIB section.");
+        ReleaseDC(Window, hdc);
+        return false;
+    }
+
+    // Select the bitmap (this takes a reference on it)
+    SelectObject(BackBufferDC, bitmap);
+
+    // Delete the object (the DC still has a reference)
+    DeleteObject(bitmap);
+
+    ReleaseDC(Window, hdc);
+    return true;
+}
+
+bool Raytracer::Present()
+{
+    // Below the display size, the image is resolved at render resolution and then scaled up
+    uint32_t* pixels = RenderPixels ? RenderPixels.get() : Pixels;
+    bool anyResolved = false;
+
+    if (DenoiseEnabled)
+    {
+        // Filtered pixels are blended from neighbors up to 31 pixels away, in several passes over
+        // the whole image, so if anything has changed the whole image is filtered again
+        bool anyDirty = false;
+        for (int i = 0; i < NumConvergenceTilesX * NumConvergenceTilesY; ++i)
+        {
+            anyDirty = anyDirty || TileDirty[i];
+            TileDirty[i] = false;
+        }
+
+        if (anyDirty)
+        {
+            DenoiseImage();
+            Scheduler.Run(Width, Height, [this, pixels](int thread, const RenderScheduler::Tile& tile)
+            {
+                UNREFERENCED_PARAMETER(thread);
+                ResolvePlanesTile(ImageDenoiser.GetRed(), ImageDenoiser.GetGreen(), ImageDenoiser.GetBlue(), Width,
+                    tile.MinX, tile.MinY, tile.MaxX, tile.MaxY, pixels);
+            });
+            anyResolved = true;
+        }
+    }
+    else
+    {
+        // Resolve the Accum buffer tiles that changed since the last present, on the render threads
+        ResolveTiles.clear();
+        for (int ty = 0; ty < NumConvergenceTilesY; ++ty)
+        {
+            for (int tx = 0; tx < NumConvergenceTilesX; ++tx)
+            {
+                if (!TileDirty[ty * NumConvergenceTilesX + tx])
+                {
+                    continue;
+                }
+
+                // Resolving is quick, so merge runs of dirty tiles to keep the scheduling overhead down
+                int minX = tx * ConvergenceTileSize;
+                int maxX = min(minX + ConvergenceTileSize, Width);
+                if (!ResolveTiles.empty() && ResolveTiles.back().MaxX == minX && ResolveTiles.back().MinY == ty * ConvergenceTileSize &&
+                    maxX - ResolveTiles.back().MinX <= RenderScheduler::MaxTileSize)
+                {
+                    ResolveTiles.back().MaxX = maxX;
+                    continue;
+                }
+
+                RenderScheduler::Tile tile;
+                tile.MinX = minX;
+                tile.MinY = ty * ConvergenceTileSize;
+                tile.MaxX = maxX;
+                tile.MaxY = min(tile.MinY + ConvergenceTileSize, Height);
+                ResolveTiles.push_back(tile);
+            }
+        }
+
+        for (int i = 0; i < NumConvergenceTilesX * NumConvergenceTilesY; ++i)
+        {
+            TileDirty[i] = false;
+        }
+
+        Scheduler.Run(ResolveTiles.data(), (int)ResolveTiles.size(), [this, pixels](int thread, const RenderScheduler::Tile& tile)
+        {
+            UNREFERENCED_PARAMETER(thread);
+            ResolveTile(Accum.get(), Width, tile.MinX, tile.MinY, tile.MaxX, tile.MaxY, pixels);
+        });
+        anyResolved = !ResolveTiles.empty();
+    }
+
+    // Bilinear filtering blends each display pixel from several render pixels, so it's simplest to
+    // scale the whole image again when any of it changed. It's cheap next to tracing.
+    if (RenderPixels && anyResolved)
+    {
+        Scheduler.Run(DisplayWidth, DisplayHeight, [this](int thread, const RenderScheduler::Tile& tile)
+        {
+            UNREFERENCED_PARAMETER(thread);
+            UpscaleTile(RenderPixels.get(), Width, Height, Pixels, DisplayWidth, DisplayHeight,
+                tile.MinX, tile.MinY, tile.MaxX, tile.MaxY);
+        });
+    }
+
+    HDC hdc = GetDC(Window);
+    if (!hdc)
+    {
+        LogError(L"Failed to get DC.");
+        return false;
+    }
+
+    RECT clientRect = {};
+    GetClientRect(Window, &clientRect);
+
+    int winWidth = clientRect.right - clientRect.left;
+    int winHeight = clientRect.bottom - clientRect.top;
+
+    // If the window has changed to a different size, use a stretch blt
+    if (winWidth != DisplayWidth || winHeight != DisplayHeight)
+    {
+        if (!StretchBlt(hdc, 0, 0, winWidth, winHeight, BackBufferDC, 0, 0, DisplayWidth, DisplayHeight, SRCCOPY))
+        {
+            LogError(L"Failed to blt render target to display.");
+            ReleaseDC(Window, hdc);
+            return false;
+        }
+    }
+    else
+    {
+        if (!BitBlt(hdc, 0, 0, DisplayWidth, DisplayHeight, BackBufferDC, 0, 0, SRCCOPY))
+        {
+            LogError(L"Failed to blt render target to display.");
+            ReleaseDC(Window, hdc);
+            return false;
+        }
+    }
+
+    ReleaseDC(Window, hdc);
+    return true;
+}
+#endif
+
+void Raytracer::DenoiseImage()
+{
+    Scheduler.Run(Width, Height, [this](int thread, const RenderScheduler::Tile& tile)
+    {
+        UNREFERENCED_PARAMETER(thread);
+        ImageDenoiser.LoadTile(Accum.get(), AccumLumSq.get(), tile);
+    });
+
+    // Each iteration reads neighbors from the one before, so they can't overlap
+    for (int i = 0; i < Denoiser::NumIterations; ++i)
+    {
+        Scheduler.Run(Width, Height, [this, i](int thread, const RenderScheduler::Tile& tile)
+        {
+            UNREFERENCED_PARAMETER(thread);
+            ImageDenoiser.FilterTile(i, tile);
+        });
+    }
+}
+
+void Raytracer::ResolveImage(XMFLOAT3* pixels) const
+{
+    for (int i = 0; i < Width * Height; ++i)
+    {
+        XMStoreFloat3(&pixels[i], XMLoadFloat4(&Accum[i]) / max(Accum[i].w, 1.f));
+    }
+}
+
+bool Raytracer::SaveImage(const char* filename)
+{
+    bool isPfm = HasExtension(filename, ".pfm");
+    if (!isPfm && !HasExtension(filename, ".ppm"))
+    {
+        LogError(L"Unsupported image format. Use .pfm or .ppm.");
+        return false;
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        LogError(L"Failed to open image file for writing.");
+        return false;
+    }
+
+    if (isPfm)
+    {
+        std::unique_ptr<XMFLOAT3[]> pixels(new XMFLOAT3[Width * Height]);
+        if (!pixels)
+        {
+            LogError(L"Failed to allocate image.");
+            return false;
+        }
+        if (DenoiseEnabled)
+        {
+            DenoiseImage();
+            for (int i = 0; i < Width * Height; ++i)
+            {
+                pixels[i] = XMFLOAT3(ImageDenoiser.GetRed()[i], ImageDenoiser.GetGreen()[i], ImageDenoiser.GetBlue()[i]);
+            }
+        }
+        else
+        {
+            ResolveImage(pixels.get());
+        }
+
+        // Negative scale means little endian. Rows are stored bottom to top.
+        file << "PF\n" << Width << " " << Height << "\n-1.0\n";
+        for (int y = Height - 1; y >= 0; --y)
+        {
+            file.write((const char*)&pixels[y * Width], Width * sizeof(XMFLOAT3));
+        }
+    }
+    else
+    {
+        // Same tonemapped sRGB colors as the window shows
+        std::unique_ptr<uint32_t[]> pixels(new uint32_t[Width * Height]);
+        std::unique_ptr<uint8_t[]> row(new uint8_t[Width * 3]);
+        if (!pixels || !row)
+        {
+            LogError(L"Failed to allocate image.");
+            return false;
+        }
+        if (DenoiseEnabled)
+        {
+            DenoiseImage();
+            ResolvePlanesTile(ImageDenoiser.GetRed(), ImageDenoiser.GetGreen(), ImageDenoiser.GetBlue(), Width,
+                0, 0, Width, Height, pixels.get());
+        }
+        else
+        {
+            ResolveTile(Accum.get(), Width, 0, 0, Width, Height, pixels.get());
+        }
+
+        file << "P6\n" << Width << " " << Height << "\n255\n";
+        for (int y = 0; y < Height; ++y)
+        {
+            for (int x = 0; x < Width; ++x)
+            {
+                uint32_t color = pixels[y * Width + x];
+                row[x * 3] = (uint8_t)(color >> 16);
+                row[x * 3 + 1] = (uint8_t)(color >> 8);
+                row[x * 3 + 2] = (uint8_t)color;
+            }
+            file.write((const char*)row.get(), Width * 3);
+        }
+    }
+
+    if (!file)
+    {
+        LogError(L"Failed to write image file.");
+        return false;
+    }
+    return true;
+}
+
+static void AddQuad(
+    FXMVECTOR a, FXMVECTOR b,
+    FXMVECTOR c, FXMVECTOR d,
+    Scene* scene)
+{
+    XMFLOAT3 corners[4];
+    XMStoreFloat3(&corners[0], a);
+    XMStoreFloat3(&corners[1], b);
+    XMStoreFloat3(&corners[2], c);
+    XMStoreFloat3(&corners[3], d);
+
+    uint32_t first = (uint32_t)scene->AddVertex(corners[0], XMFLOAT2(0, 0));
+    scene->AddVertex(corners[1], XMFLOAT2(1, 0));
+    scene->AddVertex(corners[2], XMFLOAT2(1, 1));
+    scene->AddVertex(corners[3], XMFLOAT2(0, 1));
+
+    scene->AddTriangle(first, first + 1, first + 2);
+    scene->AddTriangle(first, first + 2, first + 3);
+}
+
+// Expressed as a point and 3 scaled vectors defining spans from that point.
+static void AddCube(
+    FXMVECTOR p, FXMVECTOR u,
+    FXMVECTOR v, FXMVECTOR w,
+    Scene* scene)
+{
+    // Front
+    AddQuad(p, p + u, p + u + v, p + v, scene);
+
+    // Back
+    AddQuad(p + u + w, p + w, p + w + v, p + u + v + w, scene);
+
+    // Right
+    AddQuad(p + u, p + u + w, p + u + w + v, p + u + v, scene);
+
+    // Left
+    AddQuad(p + w, p, p + v, p + w + v, scene);
+
+    // Top
+    AddQuad(p, p + w, p + w + u, p + u, scene);
+
+    // Bottom (leave off since they're never visible in our test scene)
+    //AddQuad(p + v, p + v + u, p + v + u + w, p + v + w, scene);
+}
+
+#if defined(_WIN32)
+bool Raytracer::LoadTexture(const char* filename, Texture* texture)
+{
+    wchar_t wideFilename[MAX_PATH];
+    if (!MultiByteToWideChar(CP_ACP, 0, filename, -1, wideFilename, _countof(wideFilename)))
+    {
+        return false;
+    }
+
+    TexMetadata metadata;
+    std::unique_ptr<ScratchImage> image(new ScratchImage);
+    HRESULT hr = LoadFromWICFile(wideFilename, WIC_FLAGS_NONE, &metadata, *image);
+    if (FAILED(hr))
+    {
+        return false;
+    }
+
+    // Same byte order as the back buffer: blue in the low byte, red in bits 16-23
+    if (metadata.format != DXGI_FORMAT_B8G8R8A8_UNORM)
+    {
+        std::unique_ptr<ScratchImage> converted(new ScratchImage);
+        hr = Convert(*image->GetImage(0, 0, 0), DXGI_FORMAT_B8G8R8A8_UNORM, TEX_FILTER_DEFAULT, 0.5f, *converted);
+        if (FAILED(hr))
+        {
+            return false;
+        }
+        image.swap(converted);
+    }
+
+    // Full mip chain. Textures tile, so filtering wraps around the edges.
+    std::unique_ptr<ScratchImage> mipChain(new ScratchImage);
+    hr = GenerateMipMaps(*image->GetImage(0, 0, 0), TEX_FILTER_DEFAULT | TEX_FILTER_WRAP | TEX_FILTER_FORCE_NON_WIC, 0, *mipChain);
+    if (FAILED(hr))
+    {
+        return false;
+    }
+
+    const TexMetadata& mipMetadata = mipChain->GetMetadata();
+    if (!texture->Initialize((int)mipMetadata.width, (int)mipMetadata.height, (int)mipMetadata.mipLevels))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < texture->GetNumLevels(); ++i)
+    {
+        const Image* level = mipChain->GetImage(i, 0, 0);
+        texture->SetLevel(i, level->pixels, level->rowPitch);
+    }
+    return true;
+}
+#endif
+
+bool Raytracer::BuildMaterials()
+{
+    NumTextures = SceneData.GetNumTextures();
+    Textures.reset(new Texture[NumTextures]);
+    if (!Textures)
+    {
+        LogError(L"Failed to allocate textures.");
+        return false;
+    }
+
+#if defined(_WIN32)
+    // Textures that can't be loaded are left empty, and the materials using them
+    // fall back to their plain color
+    if (NumTextures > 0)
+    {
+        HRESULT hr = CoInitialize(nullptr);
+        if (FAILED(hr))
+        {
+            LogError(L"Failed to init COM.");
+            return false;
+        }
+
+        for (int i = 0; i < NumTextures; ++i)
+        {
+            if (!LoadTexture(SceneData.GetTextureName(i), &Textures[i]))
+            {
+                Log(L"Failed to load texture.");
+            }
+        }
+
+        CoUninitialize();
+    }
+#else
+    // DirectXTex (and WIC under it) isn't available, so headless builds on other platforms go without textures
+#endif
+
+    SurfaceProps.reset(new SurfaceProp[SceneData.GetNumMaterials()]);
+    if (!SurfaceProps)
+    {
+        LogError(L"Failed to create surface properties for scene.");
+        return false;
+    }
+
+    for (int i = 0; i < SceneData.GetNumMaterials(); ++i)
+    {
+        const Scene::Material& material = SceneData.GetMaterial(i);
+        SurfaceProps[i].Color = material.Color;
+        SurfaceProps[i].Emission = material.Emission;
+        SurfaceProps[i].Texture = (material.Texture >= 0 && Textures[material.Texture].IsValid()) ? material.Texture : -1;
+        SurfaceProps[i].LightPdf = 0.f;
+    }
+
+    return true;
+}
+
+bool Raytracer::PrepareScene()
+{
+    if (!BuildMaterials())
+    {
+        LogError(L"Failed to create scene materials.");
+        return false;
+    }
+
+    if (!BuildBvh())
+    {
+        LogError(L"Failed to build scene BVH.");
+        return false;
+    }
+
+    if (!BuildLightCdf())
+    {
+        LogError(L"Failed to build light sampling table.");
+        return false;
+    }
+
+    return true;
+}
+
+// Transform placing the unit cube model as the box AddCube(p, u, v, w) would create.
+// The model hangs down from its origin, like the test scene's boxes (whose v spans
+// downwards), so that their transforms don't mirror it.
+static XMMATRIX BoxTransform(FXMVECTOR p, FXMVECTOR u, FXMVECTOR v, FXMVECTOR w)
+{
+    XMMATRIX transform;
+    transform.r[0] = XMVectorSetW(u, 0.f);
+    transform.r[1] = XMVectorSetW(-v, 0.f);
+    transform.r[2] = XMVectorSetW(w, 0.f);
+    transform.r[3] = XMVectorSetW(p, 1.f);
+    return transform;
+}
+
+void Raytracer::AddTestRoom()
+{
+    int firstTriangle = SceneData.GetNumTriangles();
+
+    int red = SceneData.AddMaterial(XMFLOAT3(1.f, 0.f, 0.f), XMFLOAT3(0.f, 0.f, 0.f));
+    int green = SceneData.AddMaterial(XMFLOAT3(0.f, 1.f, 0.f), XMFLOAT3(0.f, 0.f, 0.f));
+    int white = SceneData.AddMaterial(XMFLOAT3(1.f, 1.f, 1.f), XMFLOAT3(0.f, 0.f, 0.f));
+    int light = SceneData.AddMaterial(XMFLOAT3(1.f, 1.f, 1.f), XMFLOAT3(8.f, 6.688f, 5.312f)); // warm room light
+
+    // left red wall
+    SceneData.SetMaterial(red);
+    AddQuad(XMVectorSet(-2.5f, 2.5f, 0.f, 1.f), XMVectorSet(-2.5f, 2.5f, 5.f, 1.f),
+        XMVectorSet(-2.5f, -2.5f, 5.f, 1.f), XMVectorSet(-2.5f, -2.5f, 0.f, 1.f),
+        &SceneData);
+
+    // right green wall
+    SceneData.SetMaterial(green);
+    AddQuad(XMVectorSet(2.5f, 2.5f, 5.f, 1.f), XMVectorSet(2.5f, 2.5f, 0.f, 1.f),
+        XMVectorSet(2.5f, -2.5f, 0.f, 1.f), XMVectorSet(2.5f, -2.5f, 5.f, 1.f),
+        &SceneData);
+
+    // back white wall
+    SceneData.SetMaterial(white);
+    AddQuad(XMVectorSet(-2.5f, 2.5f, 5.f, 1.f), XMVectorSet(2.5f, 2.5f, 5.f, 1.f),
+        XMVectorSet(2.5f, -2.5f, 5.f, 1.f), XMVectorSet(-2.5f, -2.5f, 5.f, 1.f),
+        &SceneData);
+
+    // front white wall
+    AddQuad(XMVectorSet(2.5f, 2.5f, 0.f, 1.f), XMVectorSet(-2.5f, 2.5f, 0.f, 1.f),
+        XMVectorSet(-2.5f, -2.5f, 0.f, 1.f), XMVectorSet(2.5f, -2.5f, 0.f, 1.f),
+        &SceneData);
+
+    // bottom white floor
+    AddQuad(XMVectorSet(-2.5f, -2.5f, 5.f, 1.f), XMVectorSet(2.5f, -2.5f, 5.f, 1.f),
+        XMVectorSet(2.5f, -2.5f, 0.f, 1.f), XMVectorSet(-2.5f, -2.5f, 0.f, 1.f),
+        &SceneData);
+
+    // top white ceiling
+    AddQuad(XMVectorSet(-2.5f, 2.5f, 0.f, 1.f), XMVectorSet(2.5f, 2.5f, 0.f, 1.f),
+        XMVectorSet(2.5f, 2.5f, 5.f, 1.f), XMVectorSet(-2.5f, 2.5f, 5.f, 1.f),
+        &SceneData);
+
+    // top ceiling light
+    SceneData.SetMaterial(light);
+    AddQuad(XMVectorSet(-0.75f, 2.495f, 1.75f, 1.f), XMVectorSet(0.75f, 2.495f, 1.75f, 1.f),
+        XMVectorSet(0.75f, 2.495f, 3.25f, 1.f), XMVectorSet(-0.75f, 2.495f, 3.25f, 1.f),
+        &SceneData);
+
+    int room = SceneData.AddModel(firstTriangle, SceneData.GetNumTriangles() - firstTriangle);
+    SceneData.AddInstance(room, XMMatrixIdentity());
+}
+
+bool Raytracer::GenerateTestScene(int numRandomBoxes, bool mergeBoxes)
+{
+    //
+    // Create Cornell box test scene. 7 quads for the room, and every box is an
+    // instance of one cube (5 quads).
+    //
+
+    SceneData.Clear();
+
+    // Sample texture (texture 0), not used by default
+    SceneData.AddTexture("brick.jpg");
+
+    AddTestRoom();
+
+    int white = SceneData.AddMaterial(XMFLOAT3(1.f, 1.f, 1.f), XMFLOAT3(0.f, 0.f, 0.f));
+    //int white = SceneData.AddMaterial(XMFLOAT3(1.f, 1.f, 1.f), XMFLOAT3(0.f, 0.f, 0.f), 0);
+    SceneData.SetMaterial(white);
+
+    int firstCubeTriangle = SceneData.GetNumTriangles();
+    AddCube(XMVectorSet(0.f, 0.f, 0.f, 1.f), XMVectorSet(1.f, 0.f, 0.f, 0.f),
+        XMVectorSet(0.f, -1.f, 0.f, 0.f), XMVectorSet(0.f, 0.f, 1.f, 0.f),
+        &SceneData);
+    int cube = SceneData.AddModel(firstCubeTriangle, SceneData.GetNumTriangles() - firstCubeTriangle);
+
+#if defined (USE_SINGLE_BOX)
+
+    // tall box in the back, rotated facing 1, 0, -1
+    SceneData.AddInstance(cube, BoxTransform(XMVectorSet(0.f, -1.f, 1.f, 1.f), XMVectorSet(1.f, 0.f, 1.f, 1.f),
+        XMVectorSet(0.f, -1.5f, 0.f, 1.f), XMVectorSet(-1.f, 0.f, 1.f, 1.f)));
+
+#else
+
+    // tall box in the back, rotated facing 1, 0, -1
+    SceneData.AddInstance(cube, BoxTransform(XMVectorSet(-1.2f, 0.5f, 2.25f, 1.f), XMVectorSet(1.5f, 0.f, 0.8f, 1.f),
+        XMVectorSet(0.f, -3.f, 0.f, 1.f), XMVectorSet(-0.8f, 0.f, 1.5f, 1.f)));
+
+    // small box in the front, rotated facing -1, 0, 1
+    SceneData.AddInstance(cube, BoxTransform(XMVectorSet(-0.5f, -1.0f, 1.f, 1.f), XMVectorSet(1.5f, 0.f, -0.8f, 1.f),
+        XMVectorSet(0.f, -1.5f, 0.f, 1.f), XMVectorSet(0.8f, 0.f, 1.5f, 1.f)));
+
+#endif
+
+    // Small randomly sized boxes scattered through the room, for stress testing. Each
+    // has its own color, which overrides the cube's material. Merged boxes share one.
+    int firstMergedTriangle = SceneData.GetNumTriangles();
+    if (mergeBoxes)
+    {
+        SceneData.SetMaterial(SceneData.AddMaterial(XMFLOAT3(0.9f, 0.8f, 0.6f), XMFLOAT3(0.f, 0.f, 0.f)));
+    }
+
+    for (int box = 0; box < numRandomBoxes; ++box)
+    {
+        float size = 0.02f + (rand() / (float)RAND_MAX) * 0.08f;
+        XMVECTOR p = XMVectorSet(
+            (rand() / (float)RAND_MAX) * (5.f - size) - 2.5f,
+            (rand() / (float)RAND_MAX) * (5.f - size) - 2.5f + size,
+            (rand() / (float)RAND_MAX) * (5.f - size),
+            1.f);
+
+        if (mergeBoxes)
+        {
+            AddCube(p, XMVectorSet(size, 0.f, 0.f, 0.f), XMVectorSet(0.f, -size, 0.f, 0.f), XMVectorSet(0.f, 0.f, size, 0.f),
+                &SceneData);
+            continue;
+        }
+
+        XMFLOAT3 color(0.5f + (rand() / (float)RAND_MAX) * 0.5f, 0.5f + (rand() / (float)RAND_MAX) * 0.5f, 0.5f + (rand() / (float)RAND_MAX) * 0.5f);
+        int material = SceneData.AddMaterial(color, XMFLOAT3(0.f, 0.f, 0.f));
+
+        SceneData.AddInstance(cube, BoxTransform(p, XMVectorSet(size, 0.f, 0.f, 0.f),
+            XMVectorSet(0.f, -size, 0.f, 0.f), XMVectorSet(0.f, 0.f, size, 0.f)), material);
+    }
+
+    if (mergeBoxes && numRandomBoxes > 0)
+    {
+        int boxes = SceneData.AddModel(firstMergedTriangle, SceneData.GetNumTriangles() - firstMergedTriangle);
+        SceneData.AddInstance(boxes, XMMatrixIdentity());
+    }
+
+    return true;
+}
+
+void Raytracer::ProcessTile(int thread, const RenderScheduler::Tile& tile)
+{
+    double startTime = GetTimeInSeconds();
+
+    // Count locally, so threads aren't contending over neighboring stats while tracing
+    ThreadStats tileStats = {};
+
+    XMMATRIX cameraWorldTransform = XMLoadFloat4x4(&PassCameraWorld);
+
+    if (PacketTracingEnabled)
+    {
+        ProcessTilePackets(tile, cameraWorldTransform, &tileStats);
+    }
+    else
+    {
+        for (int y = tile.MinY; y < tile.MaxY; ++y)
+        {
+            for (int x = tile.MinX; x < tile.MaxX; ++x)
+            {
+                XMVECTOR dir = GetCameraRayDir(cameraWorldTransform, x, y);
+
+                ++tileStats.NumSamples;
+                ++tileStats.NumRays;
+
+                Sampler sampler(SamplerType, y * Width + x, PassIndex, RandomSeed);
+
+                XMVECTOR newSample = XMVectorZero();
+                RayIntersection intersection;
+                bool hit = TraceRay(cameraWorldTransform.r[3], dir, &intersection);
+                if (hit)
+                {
+                    newSample = ComputeRadiance(dir, intersection, &sampler, &tileStats);
+                }
+                StoreSurface(x, y, dir, hit ? &intersection : nullptr, &Surfaces[y * Width + x]);
+                AccumulateSample(x, y, newSample);
+            }
+        }
+    }
+
+    ThreadStats& stats = Stats[thread];
+    stats.NumRays += tileStats.NumRays;
+    stats.NumSamples += tileStats.NumSamples;
+    stats.BusyTime += GetTimeInSeconds() - startTime;
+}
+
+void Raytracer::ProcessTilePackets(const RenderScheduler::Tile& tile, FXMMATRIX cameraWorldTransform, ThreadStats* stats)
+{
+    bool sampleLights = LightSamplingEnabled && NumEmissiveTriangles > 0;
+
+    for (int y = tile.MinY; y < tile.MaxY; y += 2)
+    {
+        for (int x = tile.MinX; x < tile.MaxX; x += 2)
+        {
+            // Lanes are the pixels of the 2x2 block in row order. Any past the edge of the tile are
+            // left out, and given a neighbor's coordinates so they have something to compute.
+            int pixelX[RayPacketWidth], pixelY[RayPacketWidth];
+            XMVECTOR starts[RayPacketWidth], dirs[RayPacketWidth];
+            XMFLOAT4 maxDist(FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX);
+            int used = 0;
+            for (int lane = 0; lane < RayPacketWidth; ++lane)
+            {
+                pixelX[lane] = x + (lane & 1);
+                pixelY[lane] = y + (lane >> 1);
+                if (pixelX[lane] < tile.MaxX && pixelY[lane] < tile.MaxY)
+                {
+                    used |= 1 << lane;
+                }
+                else
+                {
+                    (&maxDist.x)[lane] = -1.f;
+                    pixelX[lane] = min(pixelX[lane], tile.MaxX - 1);
+                    pixelY[lane] = min(pixelY[lane], tile.MaxY - 1);
+                }
+                starts[lane] = cameraWorldTransform.r[3];
+                dirs[lane] = GetCameraRayDir(cameraWorldTransform, pixelX[lane], pixelY[lane]);
+            }
+
+            RayPacket rays;
+            PrepareRayPacket(starts, dirs, XMLoadFloat4(&maxDist), &rays);
+            RayIntersection hits[RayPacketWidth];
+            int hitLanes = TraceRayPacket(rays, hits);
+
+            Sampler samplers[RayPacketWidth] =
+            {
+                Sampler(SamplerType, pixelY[0] * Width + pixelX[0], PassIndex, RandomSeed),
+                Sampler(SamplerType, pixelY[1] * Width + pixelX[1], PassIndex, RandomSeed),
+                Sampler(SamplerType, pixelY[2] * Width + pixelX[2], PassIndex, RandomSeed),
+                Sampler(SamplerType, pixelY[3] * Width + pixelX[3], PassIndex, RandomSeed),
+            };
+
+            // Light sampling is the first thing a path takes random numbers for, so it can be done
+            // here for the whole block, tracing the shadow rays as a packet, and each path carries
+            // on from it exactly as it would have on its own
+            XMVECTOR directLight[RayPacketWidth];
+            if (sampleLights)
+            {
+                LightSample lightSamples[RayPacketWidth];
+                XMVECTOR shadowStarts[RayPacketWidth], shadowDirs[RayPacketWidth];
+                XMFLOAT4 shadowDist(-1.f, -1.f, -1.f, -1.f);
+                for (int lane = 0; lane < RayPacketWidth; ++lane)
+                {
+                    directLight[lane] = XMVectorZero();
+                    shadowStarts[lane] = XMVectorZero();
+                    shadowDirs[lane] = dirs[lane];
+                    if (!(used & hitLanes & (1 << lane)))
+                    {
+                        continue;
+                    }
+
+                    const RayIntersection& hit = hits[lane];
+                    XMVECTOR normal = XMLoadFloat3(&hit.Normal);
+                    XMVECTOR p = XMLoadFloat3(&hit.Point) + normal * 0.001f;
+                    XMVECTOR baseColor = GetBaseColor(hit, dirs[lane], hit.Dist / DistToProjPlane);
+                    if (PickLightSample(p, normal, baseColor, &samplers[lane], &lightSamples[lane]))
+                    {
+                        shadowStarts[lane] = p;
+                        shadowDirs[lane] = XMLoadFloat3(&lightSamples[lane].Dir);
+                        (&shadowDist.x)[lane] = lightSamples[lane].Dist;
+                        ++stats->NumRays;
+                    }
+                }
+
+                RayPacket shadowRays;
+                PrepareRayPacket(shadowStarts, shadowDirs, XMLoadFloat4(&shadowDist), &shadowRays);
+                int lit = GetRayPacketLanes(XMVectorGreaterOrEqual(shadowRays.MaxDist, XMVectorZero())) & ~OccludedRayPacket(shadowRays);
+                for (int lane = 0; lane < RayPacketWidth; ++lane)
+                {
+                    if (lit & (1 << lane))
+                    {
+                        directLight[lane] = XMLoadFloat3(&lightSamples[lane].Radiance);
+                    }
+                }
+            }
+
+            for (int lane = 0; lane < RayPacketWidth; ++lane)
+            {
+                if (!(used & (1 << lane)))
+                {
+                    continue;
+                }
+
+                ++stats->NumSamples;
+                ++stats->NumRays;
+
+                bool hit = (hitLanes & (1 << lane)) != 0;
+                XMVECTOR newSample = XMVectorZero();
+                if (hit)
+                {
+                    newSample = ComputeRadiance(dirs[lane], hits[lane], &samplers[lane], stats, sampleLights ? &directLight[lane] : nullptr);
+                }
+                StoreSurface(pixelX[lane], pixelY[lane], dirs[lane], hit ? &hits[lane] : nullptr, &Surfaces[pixelY[lane] * Width + pixelX[lane]]);
+                AccumulateSample(pixelX[lane], pixelY[lane], newSample);
+            }
+        }
+    }
+}
+
+void Raytracer::AccumulateSample(int x, int y, FXMVECTOR sample)
+{
+    // Black samples count towards the average too, or the estimate is biased bright
+    XMVECTOR newSample = XMVectorSetW(sample, 1.f);
+    XMVECTOR curSample = XMLoadFloat4(&Accum[y * Width + x]);
+    XMStoreFloat4(&Accum[y * Width + x], curSample + newSample);
+
+    float luminance = Luminance(newSample);
+    AccumLumSq[y * Width + x] += luminance * luminance;
+}
+
+XMVECTOR Raytracer::GetCameraRayDir(FXMMATRIX cameraWorldTransform, int x, int y) const
+{
+    XMVECTOR dir = XMVectorScale(cameraWorldTransform.r[2], DistToProjPlane);
+    dir = XMVectorAdd(dir, XMVectorScale(cameraWorldTransform.r[0], (float)x - HalfWidth));
+    dir = XMVectorAdd(dir, XMVectorScale(cameraWorldTransform.r[1], HalfHeight - (float)y));
+    return XMVector3Normalize(dir);
+}
+
+void Raytracer::StoreSurface(int x, int y, FXMVECTOR dir, const RayIntersection* hit, PixelSurface* surface)
+{
+    if (hit)
+    {
+        surface->Point = hit->Point;
+        surface->Instance = hit->Instance;
+        surface->Normal = hit->Normal;
+        surface->Material = hit->Material;
+        surface->Dist = hit->Dist;
+
+        // Camera rays are a pixel wide at the projection plane (see ComputeRadiance)
+        XMVECTOR albedo = GetBaseColor(*hit, dir, hit->Dist / DistToProjPlane);
+        ImageDenoiser.SetGuide(x, y, XMLoadFloat3(&hit->Normal), hit->Dist, albedo);
+    }
+    else
+    {
+        surface->Point = XMFLOAT3(0.f, 0.f, 0.f);
+        surface->Instance = -1;
+        surface->Normal = XMFLOAT3(0.f, 0.f, 0.f);
+        surface->Material = -1;
+        surface->Dist = FLT_MAX;
+
+        // Misses all look the same to the denoiser: black, infinitely far, and facing the camera
+        ImageDenoiser.SetGuide(x, y, -dir, FLT_MAX, XMVectorZero());
+    }
+}
+
+// History carried over by reprojection counts as at most this many samples. Reprojected colors
+// are blurred a little (they're interpolated from the old pixels), and it's also a little off
+// wherever the match isn't perfect, so capping it lets new samples take over. While the camera
+// keeps moving, this works out as a running average over the last few dozen frames.
+static const float MaxReprojectedSamples = 32.f;
+
+// Surfaces seen by old and new pixels match if they're on the same instance with the same material
+// (a light and the ceiling around it are very different), facing about the same way, and in the
+// same plane to within this fraction of the distance from the camera
+static const float ReprojectionNormalTolerance = 0.9f;
+static const float ReprojectionPlaneTolerance = 0.01f;
+
+bool Raytracer::IsSameSurface(const PixelSurface& current, const PixelSurface& previous)
+{
+    if (current.Instance != previous.Instance || current.Material != previous.Material)
+    {
+        return false;
+    }
+    if (current.Instance < 0)
+    {
+        // Both missed everything
+        return true;
+    }
+
+    XMVECTOR normal = XMLoadFloat3(&current.Normal);
+    XMVECTOR offset = XMLoadFloat3(&previous.Point) - XMLoadFloat3(&current.Point);
+    float planeDist = fabsf(XMVectorGetX(XMVector3Dot(offset, normal)));
+    float cosine = XMVectorGetX(XMVector3Dot(normal, XMLoadFloat3(&previous.Normal)));
+    return cosine > ReprojectionNormalTolerance && planeDist < ReprojectionPlaneTolerance * current.Dist;
+}
+
+void Raytracer::Reproject(FXMMATRIX cameraWorldTransform)
+{
+    XMFLOAT4X4 camera;
+    XMStoreFloat4x4(&camera, cameraWorldTransform);
+    Scheduler.Run(Width, Height, [this, &camera](int thread, const RenderScheduler::Tile& tile)
+    {
+        ReprojectTile(thread, tile, XMLoadFloat4x4(&camera));
+    });
+
+    Accum.swap(ReprojectedAccum);
+    AccumLumSq.swap(ReprojectedLumSq);
+    Surfaces.swap(ReprojectedSurfaces);
+
+    // Everything has moved, so every tile needs looking at again
+    for (int i = 0; i < NumConvergenceTilesX * NumConvergenceTilesY; ++i)
+    {
+        TileErrors[i] = FLT_MAX;
+    }
+    MarkAllTilesDirty();
+}
+
+void Raytracer::ReprojectTile(int thread, const RenderScheduler::Tile& tile, FXMMATRIX cameraWorldTransform)
+{
+    double startTime = GetTimeInSeconds();
+
+    XMMATRIX previousCamera = XMLoadFloat4x4(&PassCameraWorld);
+    int64_t numRays = 0;
+
+    for (int y = tile.MinY; y < tile.MaxY; ++y)
+    {
+        for (int x = tile.MinX; x < tile.MaxX; ++x)
+        {
+            // Find what the pixel sees now
+            XMVECTOR dir = GetCameraRayDir(cameraWorldTransform, x, y);
+            RayIntersection intersection;
+            bool hit = TraceRay(cameraWorldTransform.r[3], dir, &intersection);
+            ++numRays;
+
+            PixelSurface& surface = ReprojectedSurfaces[y * Width + x];
+            StoreSurface(x, y, dir, hit ? &intersection : nullptr, &surface);
+
+            // And where that was in the previous view. Misses are projected as points at infinity.
+            XMVECTOR offset = hit ? XMLoadFloat3(&surface.Point) - previousCamera.r[3] : dir;
+            float depth = XMVectorGetX(XMVector3Dot(offset, previousCamera.r[2]));
+            float prevX = XMVectorGetX(XMVector3Dot(offset, previousCamera.r[0])) / depth * DistToProjPlane + HalfWidth;
+            float prevY = HalfHeight - XMVectorGetX(XMVector3Dot(offset, previousCamera.r[1])) / depth * DistToProjPlane;
+
+            // Blend the previous averages of the 4 pixels around it, leaving out the ones that saw
+            // something else. Averages are blended rather than sums, so every pixel counts the same.
+            XMVECTOR color = XMVectorZero();
+            float count = 0.f;
+            float lumSq = 0.f;
+            float totalWeight = 0.f;
+            if (depth > 0.f && prevX > -1.f && prevX < (float)Width && prevY > -1.f && prevY < (float)Height)
+            {
+                float fx = floorf(prevX);
+                float fy = floorf(prevY);
+                float tx = prevX - fx;
+                float ty = prevY - fy;
+                for (int i = 0; i < 4; ++i)
+                {
+                    int px = (int)fx + (i & 1);
+                    int py = (int)fy + (i >> 1);
+                    if (px < 0 || px >= Width || py < 0 || py >= Height)
+                    {
+                        continue;
+                    }
+
+                    int index = py * Width + px;
+                    float n = Accum[index].w;
+                    if (n <= 0.f || !IsSameSurface(surface, Surfaces[index]))
+                    {
+                        continue;
+                    }
+
+                    float weight = ((i & 1) ? tx : 1.f - tx) * ((i >> 1) ? ty : 1.f - ty);
+                    color += XMLoadFloat4(&Accum[index]) * (weight / n);
+                    count += weight * n;
+                    lumSq += weight * AccumLumSq[index] / n;
+                    totalWeight += weight;
+                }
+            }
+
+            // Pixels that didn't find a match (disocclusions, or new at the edge of the view) start over
+            XMFLOAT4& accum = ReprojectedAccum[y * Width + x];
+            float& accumLumSq = ReprojectedLumSq[y * Width + x];
+            if (totalWeight > 0.f)
+            {
+                float n = min(count / totalWeight, MaxReprojectedSamples);
+                XMStoreFloat4(&accum, XMVectorSetW(color * (n / totalWeight), n));
+                accumLumSq = lumSq * (n / totalWeight);
+            }
+            else
+            {
+                accum = XMFLOAT4(0.f, 0.f, 0.f, 0.f);
+                accumLumSq = 0.f;
+            }
+        }
+    }
+
+    ThreadStats& stats = Stats[thread];
+    stats.NumRays += numRays;
+    stats.BusyTime += GetTimeInSeconds() - startTime;
+}
+
+XMVECTOR Raytracer::PickVectorInHemisphere(FXMVECTOR normal, float u, float v)
+{
+    // TODO: Use BRDF to drive distribution
+    XMVECTOR tangent = XMVector3Cross(normal, XMVectorSet(0, 1, 0, 0));
+    if (XMVectorGetX(XMVector3LengthEst(tangent)) < 0.0001f)
+    {
+        tangent = XMVector3Cross(normal, XMVectorSet(1, 0, 0, 0));
+    }
+    tangent = XMVector3Normalize(tangent);
+    XMVECTOR bitangent = XMVector3Cross(tangent, normal);
+
+    // Uniform point on the unit disk, projected up onto the hemisphere
+    float r = sqrtf(u);
+    float phi = XM_2PI * v;
+    XMVECTOR newDir = (normal * sqrtf(max(0.f, 1.f - u))) + (tangent * (r * cosf(phi))) + (bitangent * (r * sinf(phi)));
+
+    return XMVector3Normalize(newDir);
+}
+
+// Power heuristic weight for a sample taken with density pdf, when the other
+// sampling strategy would have picked the same direction with density otherPdf
+static float PowerHeuristic(float pdf, float otherPdf)
+{
+    float a = pdf * pdf;
+    float b = otherPdf * otherPdf;
+    return a / (a + b);
+}
+
+// Angle (in radians) ray cones spread at after a diffuse bounce. A diffuse bounce could go
+// anywhere in the hemisphere, so this is a heuristic rather than the real spread: a few
+// degrees lets textures seen indirectly read smaller mips, without visibly blurring them
+// (they're averaged over many paths anyway).
+static const float DiffuseConeSpread = 0.05f;
+
+// Cones hitting at more of a grazing angle than this are treated as hitting at this angle,
+// so their footprints stay finite
+static const float MinConeCosine = 0.05f;
+
+XMVECTOR Raytracer::SampleSurfaceTexture(const Texture& texture, const RayIntersection& hit, FXMVECTOR dir, float coneWidth)
+{
+    const uint32_t* indices = &SceneData.GetIndices()[hit.Triangle * 3];
+    const XMFLOAT2* texCoords = SceneData.GetTexCoords();
+    XMVECTOR t0 = XMLoadFloat2(&texCoords[indices[0]]);
+    XMVECTOR t1 = XMLoadFloat2(&texCoords[indices[1]]);
+    XMVECTOR t2 = XMLoadFloat2(&texCoords[indices[2]]);
+    XMVECTOR uv = t0 * hit.wA + t1 * hit.wB + t2 * hit.wC;
+
+    // Texels per unit of world space area on the triangle, from the ratio of its area in
+    // texture space (scaled to texels) and world space
+    XMVECTOR a, b, c;
+    GetInstanceTriangle(hit.Instance, hit.Triangle, &a, &b, &c);
+    float worldArea = XMVectorGetX(XMVector3Length(XMVector3Cross(b - a, c - a)));
+    XMVECTOR uvEdge1 = t1 - t0;
+    XMVECTOR uvEdge2 = t2 - t0;
+    float uvArea = fabsf(XMVectorGetX(uvEdge1) * XMVectorGetY(uvEdge2) - XMVectorGetY(uvEdge1) * XMVectorGetX(uvEdge2));
+    float texelArea = uvArea * (float)texture.GetWidth() * (float)texture.GetHeight();
+
+    // The cone's footprint stretches out as the surface tilts away from it. The level of detail
+    // is log2 of the footprint's width in texels: 0.5 * log2 of its area.
+    float cosine = max(fabsf(XMVectorGetX(XMVector3Dot(dir, XMLoadFloat3(&hit.Normal)))), MinConeCosine);
+    float footprintWidth = coneWidth / cosine;
+    float lod = 0.5f * log2f(texelArea * footprintWidth * footprintWidth / worldArea);
+
+    return texture.Sample(XMVectorGetX(uv), XMVectorGetY(uv), lod);
+}
+
+XMVECTOR Raytracer::GetBaseColor(const RayIntersection& hit, FXMVECTOR dir, float coneWidth)
+{
+    const SurfaceProp& props = SurfaceProps[hit.Material];
+    if (props.Texture >= 0)
+    {
+        return SampleSurfaceTexture(Textures[props.Texture], hit, dir, coneWidth);
+    }
+    return XMLoadFloat3(&props.Color);
+}
+
+XMVECTOR Raytracer::ComputeRadiance(FXMVECTOR cameraDir, const RayIntersection& cameraHit, Sampler* sampler, ThreadStats* stats,
+    const XMVECTOR* cameraDirectLight)
+{
+    // Follow a single path through the scene. throughput is the fraction of light
+    // arriving at the current point that makes it back along the path to the camera.
+    XMVECTOR radiance = XMVectorZero();
+    XMVECTOR throughput = XMVectorSplatOne();
+    XMVECTOR dir = cameraDir;
+    RayIntersection intersection = cameraHit;
+    float dirPdf = 0.f;     // Density the bounce that got here was sampled with. 0 for the camera ray.
+
+    // The path's footprint, as a cone around it for picking texture detail: as wide as a pixel
+    // from the camera, widening with distance, and much faster after diffuse bounces
+    float coneWidth = 0.f;
+    float coneSpread = 1.f / DistToProjPlane;
+
+    for (int depth = 0; ; ++depth)
+    {
+        coneWidth += coneSpread * intersection.Dist;
+        radiance += throughput * GetEmission(intersection, dir, dirPdf);
+
+        if (depth == MaxBounces)
+        {
+            break;
+        }
+
+        XMVECTOR baseColor = GetBaseColor(intersection, dir, coneWidth);
+
+        // Basic info about the point we're shading
+        XMVECTOR p = XMLoadFloat3(&intersection.Point);
+        XMVECTOR normal = XMLoadFloat3(&intersection.Normal);
+
+        // Move p out slight from surface to avoid self-intersection
+        p += normal * 0.001f;
+
+        if (depth == 0 && cameraDirectLight)
+        {
+            radiance += *cameraDirectLight;
+        }
+        else if (LightSamplingEnabled && NumEmissiveTriangles > 0)
+        {
+            radiance += throughput * SampleDirectLighting(p, normal, baseColor, sampler, stats);
+        }
+
+        // The diffuse BRDF (baseColor / pi) times nDotL, over the cosine weighted
+        // density (nDotL / pi) the bounce is picked with, is just baseColor
+        throughput *= baseColor;
+
+        if (!SurvivesRoulette(depth, &throughput, sampler))
+        {
+            break;
+        }
+
+        // Pick a random direction to bounce and continue the path from whatever it hits
+        float u, v;
+        sampler->Next2D(&u, &v);
+        XMVECTOR newDir = PickVectorInHemisphere(normal, u, v);
+
+        ++stats->NumRays;
+
+        if (!TraceRay(p, newDir, &intersection))
+        {
+            break;
+        }
+
+        dirPdf = XMVectorGetX(XMVector3Dot(newDir, normal)) / XM_PI;
+        dir = newDir;
+        coneSpread = max(coneSpread, DiffuseConeSpread);
+    }
+
+    return radiance;
+}
+
+XMVECTOR Raytracer::GetEmission(const RayIntersection& hit, FXMVECTOR dir, float dirPdf)
+{
+    const SurfaceProp& props = SurfaceProps[hit.Material];
+    XMVECTOR emission = XMLoadFloat3(&props.Emission);
+
+    // A bounce that hits a light could also have been found by light sampling at the previous
+    // point. Both estimates are kept, weighted towards whichever was more likely to pick it.
+    if (dirPdf > 0.f && props.LightPdf > 0.f && LightSamplingEnabled)
+    {
+        float cosLight = XMVectorGetX(XMVector3Dot(-dir, XMLoadFloat3(&hit.Normal)));
+        float lightPdf = props.LightPdf * hit.Dist * hit.Dist / cosLight;
+        emission *= PowerHeuristic(dirPdf, lightPdf);
+    }
+    return emission;
+}
+
+bool Raytracer::SurvivesRoulette(int depth, XMVECTOR* throughput, Sampler* sampler)
+{
+    // Past the first few bounces, randomly end paths that can't contribute much any more.
+    // Survivors are scaled up to make up for the ones that were cut, so nothing is lost on average.
+    if (depth + 1 < RouletteStartDepth)
+    {
+        return true;
+    }
+
+    XMVECTOR t = *throughput;
+    float survival = min(XMVectorGetX(XMVectorMax(t, XMVectorMax(XMVectorSplatY(t), XMVectorSplatZ(t)))), 0.95f);
+    if (sampler->Next1D() >= survival)
+    {
+        return false;
+    }
+    *throughput = t / survival;
+    return true;
+}
+
+XMVECTOR Raytracer::SampleDirectLighting(FXMVECTOR p, FXMVECTOR normal, FXMVECTOR baseColor, Sampler* sampler, ThreadStats* stats)
+{
+    LightSample sample;
+    if (!PickLightSample(p, normal, baseColor, sampler, &sample))
+    {
+        return XMVectorZero();
+    }
+
+    ++stats->NumRays;
+    if (OccludedRay(p, XMLoadFloat3(&sample.Dir), sample.Dist))
+    {
+        return XMVectorZero();
+    }
+    return XMLoadFloat3(&sample.Radiance);
+}
+
+bool Raytracer::PickLightSample(FXMVECTOR p, FXMVECTOR normal, FXMVECTOR baseColor, Sampler* sampler, LightSample* sample)
+{
+    float u, v;
+    sampler->Next2D(&u, &v);
+
+    // Pick a triangle with u, then stretch the part of u inside the triangle's
+    // slot of the CDF back out to [0, 1) so it can be reused for the point
+    const float* cdf = EmissiveCdf.get();
+    int index = (int)(std::upper_bound(cdf, cdf + NumEmissiveTriangles, u) - cdf);
+    index = min(index, NumEmissiveTriangles - 1);
+    float slotStart = index > 0 ? cdf[index - 1] : 0.f;
+    u = min((u - slotStart) / (cdf[index] - slotStart), 0.99999994f);
+
+    // Uniformly distributed point on the triangle
+    XMVECTOR a, b, c;
+    GetInstanceTriangle(EmissiveInstances[index], EmissiveTriangles[index], &a, &b, &c);
+    float su = sqrtf(u);
+    XMVECTOR lightPoint = a * (1.f - su) + b * (su * (1.f - v)) + c * (su * v);
+    XMVECTOR lightNormal = XMVector3Normalize(XMVector3Cross(b - a, c - a));
+
+    XMVECTOR toLight = lightPoint - p;
+    float distSq = XMVectorGetX(XMVector3LengthSq(toLight));
+    float dist = sqrtf(distSq);
+    XMVECTOR lightDir = toLight / dist;
+
+    // Lights only emit from their front face
+    float cosSurface = XMVectorGetX(XMVector3Dot(normal, lightDir));
+    float cosLight = -XMVectorGetX(XMVector3Dot(lightNormal, lightDir));
+    if (cosSurface <= 0.f || cosLight <= 0.f)
+    {
+        return false;
+    }
+
+    const SurfaceProp& props = SurfaceProps[EmissiveMaterials[index]];
+    float lightPdf = props.LightPdf * distSq / cosLight;
+    float bsdfPdf = cosSurface / XM_PI;
+
+    // Stop just short of the light, so it can't shadow itself
+    XMStoreFloat3(&sample->Dir, lightDir);
+    sample->Dist = dist - 0.001f;
+    XMStoreFloat3(&sample->Radiance,
+        XMLoadFloat3(&props.Emission) * baseColor * (cosSurface / (XM_PI * lightPdf) * PowerHeuristic(lightPdf, bsdfPdf)));
+    return true;
+}
+
+// Paths of a wavefront are handed out to the render threads this many at a time
+static const int WavefrontChunkSize = 256;
+
+// Rays are sorted on a key made of the octant of their direction (the top 3 bits), then the cell
+// their origin is in, of a grid over the scene's bounds with 2^RayKeyOriginBits cells per axis.
+// Cells are numbered along a Morton curve, so that rays from cells next to each other mostly end
+// up next to each other too.
+static const int RayKeyOriginBits = 9;
+static const int RayKeyBits = 3 + 3 * RayKeyOriginBits;
+
+// Keys are radix sorted this many bits per pass. Each pass counts keys per bucket over chunks of
+// the queue in parallel, then has each chunk scatter its own keys.
+static const int RadixBits = 10;
+static const int NumRadixBuckets = 1 << RadixBits;
+static const int RadixChunkSize = 16384;
+
+// Spread the low 10 bits of x out to every third bit, for interleaving into a Morton code
+static uint32_t SpreadBits3(uint32_t x)
+{
+    x &= 0x3ff;
+    x = (x | (x << 16)) & 0x030000ff;
+    x = (x | (x << 8)) & 0x0300f00f;
+    x = (x | (x << 4)) & 0x030c30c3;
+    x = (x | (x << 2)) & 0x09249249;
+    return x;
+}
+
+void Raytracer::RenderWavefront(const RenderScheduler::Tile* tiles, int numTiles)
+{
+    // Pixels tile by tile, so that neighboring camera rays stay together in the queue
+    WavefrontPixels.clear();
+    for (int i = 0; i < numTiles; ++i)
+    {
+        for (int y = tiles[i].MinY; y < tiles[i].MaxY; ++y)
+        {
+            for (int x = tiles[i].MinX; x < tiles[i].MaxX; ++x)
+            {
+                WavefrontPixels.push_back(y * Width + x);
+            }
+        }
+    }
+
+    // The grid ray origins are sorted on covers the whole scene
+    if (InstanceBvh.GetNumNodes() > 0)
+    {
+        const Bvh::Node& root = InstanceBvh.GetNodes()[0];
+        XMVECTOR sceneMin = XMLoadFloat3(&root.Min);
+        XMVECTOR extent = XMVectorMax(XMLoadFloat3(&root.Max) - sceneMin, XMVectorReplicate(0.0001f));
+        XMStoreFloat3(&SortOrigin, sceneMin);
+        XMStoreFloat3(&SortScale, XMVectorReplicate((float)(1 << RayKeyOriginBits)) / extent);
+    }
+
+    XMMATRIX cameraWorldTransform = XMLoadFloat4x4(&PassCameraWorld);
+    XMFLOAT3 cameraPosition;
+    XMStoreFloat3(&cameraPosition, cameraWorldTransform.r[3]);
+
+    int numPixels = (int)WavefrontPixels.size();
+    for (int batchStart = 0; batchStart < numPixels; batchStart += MaxWavefrontPaths)
+    {
+        int numPaths = min(numPixels - batchStart, (int)MaxWavefrontPaths);
+        WavefrontPaths.resize(numPaths);
+        WavefrontSamplers.resize(numPaths, Sampler(SamplerType, 0, 0, 0));
+        ActivePaths.resize(numPaths);
+        ExtendRays.resize(numPaths);
+
+        // Start every path with its camera ray. They're in a coherent order already, so aren't sorted.
+        RunWavefrontStage(numPaths, [&](int first, int end, ThreadStats* stats)
+        {
+            for (int i = first; i < end; ++i)
+            {
+                int pixel = WavefrontPixels[batchStart + i];
+                WavefrontPath& path = WavefrontPaths[i];
+                path.Start = cameraPosition;
+                path.Pixel = pixel;
+                XMStoreFloat3(&path.Dir, GetCameraRayDir(cameraWorldTransform, pixel % Width, pixel / Width));
+                path.DirPdf = 0.f;
+                path.Throughput = XMFLOAT3(1.f, 1.f, 1.f);
+                path.ConeWidth = 0.f;
+                path.Radiance = XMFLOAT3(0.f, 0.f, 0.f);
+                path.ConeSpread = 1.f / DistToProjPlane;
+                WavefrontSamplers[i] = Sampler(SamplerType, pixel, PassIndex, RandomSeed);
+                ActivePaths[i] = i;
+
+                WavefrontRay& ray = ExtendRays[i];
+                ray.Start = path.Start;
+                ray.Path = i;
+                ray.Dir = path.Dir;
+                ray.MaxDist = FLT_MAX;
+                ++stats->NumSamples;
+            }
+        });
+
+        for (int depth = 0; !ActivePaths.empty(); ++depth)
+        {
+            ExtendWavefront(ExtendRays);
+            ShadeWavefront(ActivePaths, depth);
+
+            // Queue up the rays for the next stages, from the paths in order
+            ShadowRays.clear();
+            ExtendRays.clear();
+            NextActivePaths.clear();
+            for (int i = 0; i < (int)ActivePaths.size(); ++i)
+            {
+                int index = ActivePaths[i];
+                const WavefrontPath& path = WavefrontPaths[index];
+                WavefrontRay ray;
+                ray.Start = path.Start;
+                ray.Path = index;
+                if (path.ShadowDist >= 0.f)
+                {
+                    ray.Dir = path.ShadowDir;
+                    ray.MaxDist = path.ShadowDist;
+                    ShadowRays.push_back(ray);
+                }
+                if (PathContinues[i])
+                {
+                    ray.Dir = path.Dir;
+                    ray.MaxDist = FLT_MAX;
+                    ExtendRays.push_back(ray);
+                    NextActivePaths.push_back(index);
+                }
+            }
+            ActivePaths.swap(NextActivePaths);
+
+            if (WavefrontSortingEnabled)
+            {
+                SortWavefrontRays(&ShadowRays);
+                SortWavefrontRays(&ExtendRays);
+            }
+            TraceWavefrontShadows(ShadowRays);
+        }
+
+        // Every path has ended, so the pixels have their samples
+        RunWavefrontStage(numPaths, [&](int first, int end, ThreadStats* stats)
+        {
+            UNREFERENCED_PARAMETER(stats);
+            for (int i = first; i < end; ++i)
+            {
+                const WavefrontPath& path = WavefrontPaths[i];
+                AccumulateSample(path.Pixel % Width, path.Pixel / Width, XMLoadFloat3(&path.Radiance));
+            }
+        });
+    }
+}
+
+void Raytracer::LoadWavefrontRayPacket(const WavefrontRay* rays, int first, int end, RayPacket* packet)
+{
+    // Past the end, lanes repeat the last ray, and are left out
+    XMVECTOR starts[RayPacketWidth], dirs[RayPacketWidth];
+    XMFLOAT4 maxDist;
+    for (int lane = 0; lane < RayPacketWidth; ++lane)
+    {
+        const WavefrontRay& ray = rays[min(first + lane, end - 1)];
+        starts[lane] = XMLoadFloat3(&ray.Start);
+        dirs[lane] = XMLoadFloat3(&ray.Dir);
+        (&maxDist.x)[lane] = first + lane < end ? ray.MaxDist : -1.f;
+    }
+    PrepareRayPacket(starts, dirs, XMLoadFloat4(&maxDist), packet);
+}
+
+void Raytracer::ExtendWavefront(const std::vector<WavefrontRay>& rays)
+{
+    RunWavefrontStage((int)rays.size(), [&](int first, int end, ThreadStats* stats)
+    {
+        stats->NumRays += end - first;
+
+        if (!PacketTracingEnabled)
+        {
+            for (int i = first; i < end; ++i)
+            {
+                RayIntersection& hit = WavefrontPaths[rays[i].Path].Hit;
+                if (!TraceRay(XMLoadFloat3(&rays[i].Start), XMLoadFloat3(&rays[i].Dir), &hit))
+                {
+                    hit.Instance = -1;
+                }
+            }
+            return;
+        }
+
+        // Rays next to each other in the queue are traced together
+        for (int i = first; i < end; i += RayPacketWidth)
+        {
+            RayPacket packet;
+            LoadWavefrontRayPacket(rays.data(), i, end, &packet);
+            RayIntersection hits[RayPacketWidth];
+            int hitLanes = TraceRayPacket(packet, hits);
+
+            for (int lane = 0; lane < RayPacketWidth && i + lane < end; ++lane)
+            {
+                RayIntersection& hit = WavefrontPaths[rays[i + lane].Path].Hit;
+                if (hitLanes & (1 << lane))
+                {
+                    hit = hits[lane];
+                }
+                else
+                {
+                    hit.Instance = -1;
+                }
+            }
+        }
+    });
+}
+
+void Raytracer::ShadeWavefront(const std::vector<int>& paths, int depth)
+{
+    PathContinues.resize(paths.size());
+    bool sampleLights = LightSamplingEnabled && NumEmissiveTriangles > 0;
+
+    RunWavefrontStage((int)paths.size(), [&](int first, int end, ThreadStats* stats)
+    {
+        UNREFERENCED_PARAMETER(stats);
+        for (int i = first; i < end; ++i)
+        {
+            WavefrontPath& path = WavefrontPaths[paths[i]];
+            Sampler* sampler = &WavefrontSamplers[paths[i]];
+            const RayIntersection& hit = path.Hit;
+            XMVECTOR dir = XMLoadFloat3(&path.Dir);
+            path.ShadowDist = -1.f;
+            PathContinues[i] = 0;
+
+            if (depth == 0)
+            {
+                StoreSurface(path.Pixel % Width, path.Pixel / Width, dir, hit.Instance >= 0 ? &hit : nullptr, &Surfaces[path.Pixel]);
+            }
+
+            if (hit.Instance < 0)
+            {
+                continue;
+            }
+
+            // A bounce of ComputeRadiance, taking random numbers in the same order, with the
+            // shadow ray and the next bounce set up to be traced by the next stages
+            XMVECTOR throughput = XMLoadFloat3(&path.Throughput);
+            path.ConeWidth += path.ConeSpread * hit.Dist;
+            XMStoreFloat3(&path.Radiance, XMLoadFloat3(&path.Radiance) + throughput * GetEmission(hit, dir, path.DirPdf));
+
+            if (depth == MaxBounces)
+            {
+                continue;
+            }
+
+            XMVECTOR baseColor = GetBaseColor(hit, dir, path.ConeWidth);
+            XMVECTOR normal = XMLoadFloat3(&hit.Normal);
+            XMVECTOR p = XMLoadFloat3(&hit.Point) + normal * 0.001f;
+            XMStoreFloat3(&path.Start, p);
+
+            LightSample lightSample;
+            if (sampleLights && PickLightSample(p, normal, baseColor, sampler, &lightSample))
+            {
+                path.ShadowDir = lightSample.Dir;
+                path.ShadowDist = lightSample.Dist;
+                XMStoreFloat3(&path.ShadowRadiance, throughput * XMLoadFloat3(&lightSample.Radiance));
+            }
+
+            throughput *= baseColor;
+            if (!SurvivesRoulette(depth, &throughput, sampler))
+            {
+                continue;
+            }
+
+            float u, v;
+            sampler->Next2D(&u, &v);
+            XMVECTOR newDir = PickVectorInHemisphere(normal, u, v);
+
+            XMStoreFloat3(&path.Throughput, throughput);
+            XMStoreFloat3(&path.Dir, newDir);
+            path.DirPdf = XMVectorGetX(XMVector3Dot(newDir, normal)) / XM_PI;
+            path.ConeSpread = max(path.ConeSpread, DiffuseConeSpread);
+            PathContinues[i] = 1;
+        }
+    });
+}
+
+void Raytracer::TraceWavefrontShadows(const std::vector<WavefrontRay>& rays)
+{
+    RunWavefrontStage((int)rays.size(), [&](int first, int end, ThreadStats* stats)
+    {
+        stats->NumRays += end - first;
+
+        if (!PacketTracingEnabled)
+        {
+            for (int i = first; i < end; ++i)
+            {
+                if (!OccludedRay(XMLoadFloat3(&rays[i].Start), XMLoadFloat3(&rays[i].Dir), rays[i].MaxDist))
+                {
+                    WavefrontPath& path = WavefrontPaths[rays[i].Path];
+                    XMStoreFloat3(&path.Radiance, XMLoadFloat3(&path.Radiance) + XMLoadFloat3(&path.ShadowRadiance));
+                }
+            }
+            return;
+        }
+
+        for (int i = first; i < end; i += RayPacketWidth)
+        {
+            RayPacket packet;
+            LoadWavefrontRayPacket(rays.data(), i, end, &packet);
+            int occluded = OccludedRayPacket(packet);
+
+            for (int lane = 0; lane < RayPacketWidth && i + lane < end; ++lane)
+            {
+                if (!(occluded & (1 << lane)))
+                {
+                    WavefrontPath& path = WavefrontPaths[rays[i + lane].Path];
+                    XMStoreFloat3(&path.Radiance, XMLoadFloat3(&path.Radiance) + XMLoadFloat3(&path.ShadowRadiance));
+                }
+            }
+        }
+    });
+}
+
+void Raytracer::SortWavefrontRays(std::vector<WavefrontRay>* rays)
+{
+    int count = (int)rays->size();
+    if (count <= 1)
+    {
+        return;
+    }
+
+    SortKeys[0].resize(count);
+    SortKeys[1].resize(count);
+    SortScratch.resize(count);
+
+    XMVECTOR origin = XMLoadFloat3(&SortOrigin);
+    XMVECTOR scale = XMLoadFloat3(&SortScale);
+    XMVECTOR maxCell = XMVectorReplicate((float)((1 << RayKeyOriginBits) - 1));
+    ParallelFor(count, WavefrontChunkSize, [&](int first, int end)
+    {
+        for (int i = first; i < end; ++i)
+        {
+            const WavefrontRay& ray = (*rays)[i];
+            uint32_t octant = (ray.Dir.x < 0.f ? 1 : 0) | (ray.Dir.y < 0.f ? 2 : 0) | (ray.Dir.z < 0.f ? 4 : 0);
+
+            XMFLOAT3 cell;
+            XMStoreFloat3(&cell, XMVectorClamp((XMLoadFloat3(&ray.Start) - origin) * scale, XMVectorZero(), maxCell));
+            SortKeys[0][i] = (octant << (3 * RayKeyOriginBits)) | SpreadBits3((uint32_t)cell.x) |
+                (SpreadBits3((uint32_t)cell.y) << 1) | (SpreadBits3((uint32_t)cell.z) << 2);
+        }
+    });
+
+    // Least significant digit first. Each pass is stable, so the order from earlier passes is
+    // kept within each bucket.
+    int numChunks = (count + RadixChunkSize - 1) / RadixChunkSize;
+    SortCounts.resize(numChunks * NumRadixBuckets);
+
+    uint32_t* keys = SortKeys[0].data();
+    uint32_t* sortedKeys = SortKeys[1].data();
+    WavefrontRay* values = rays->data();
+    WavefrontRay* sortedValues = SortScratch.data();
+    for (int shift = 0; shift < RayKeyBits; shift += RadixBits)
+    {
+        ParallelFor(count, RadixChunkSize, [&](int first, int end)
+        {
+            for (int chunkStart = first; chunkStart < end; chunkStart += RadixChunkSize)
+            {
+                int* counts = &SortCounts[chunkStart / RadixChunkSize * NumRadixBuckets];
+                memset(counts, 0, NumRadixBuckets * sizeof(int));
+                int chunkEnd = min(chunkStart + RadixChunkSize, end);
+                for (int i = chunkStart; i < chunkEnd; ++i)
+                {
+                    ++counts[(keys[i] >> shift) & (NumRadixBuckets - 1)];
+                }
+            }
+        });
+
+        // Where each chunk's keys go: the buckets in order, and each bucket split between the
+        // chunks in order
+        int offset = 0;
+        for (int bucket = 0; bucket < NumRadixBuckets; ++bucket)
+        {
+            for (int chunk = 0; chunk < numChunks; ++chunk)
+            {
+                int numKeys = SortCounts[chunk * NumRadixBuckets + bucket];
+                SortCounts[chunk * NumRadixBuckets + bucket] = offset;
+                offset += numKeys;
+            }
+        }
+
+        ParallelFor(count, RadixChunkSize, [&](int first, int end)
+        {
+            for (int chunkStart = first; chunkStart < end; chunkStart += RadixChunkSize)
+            {
+                int* offsets = &SortCounts[chunkStart / RadixChunkSize * NumRadixBuckets];
+                int chunkEnd = min(chunkStart + RadixChunkSize, end);
+                for (int i = chunkStart; i < chunkEnd; ++i)
+                {
+                    int dest = offsets[(keys[i] >> shift) & (NumRadixBuckets - 1)]++;
+                    sortedKeys[dest] = keys[i];
+                    sortedValues[dest] = values[i];
+                }
+            }
+        });
+
+        std::swap(keys, sortedKeys);
+        std::swap(values, sortedValues);
+    }
+
+    if (values != rays->data())
+    {
+        rays->swap(SortScratch);
+    }
+}
+
+void Raytracer::RunWavefrontStage(int count, const std::function<void (int first, int end, ThreadStats* stats)>& func)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Chunks are scheduled like the pixels of a one pixel high image, as with ParallelFor
+    int numChunks = (count + WavefrontChunkSize - 1) / WavefrontChunkSize;
+    Scheduler.Run(numChunks, 1, [&](int thread, const RenderScheduler::Tile& tile)
+    {
+        double startTime = GetTimeInSeconds();
+
+        ThreadStats chunkStats = {};
+        func(tile.MinX * WavefrontChunkSize, min(tile.MaxX * WavefrontChunkSize, count), &chunkStats);
+
+        ThreadStats& stats = Stats[thread];
+        stats.NumRays += chunkStats.NumRays;
+        stats.NumSamples += chunkStats.NumSamples;
+        stats.BusyTime += GetTimeInSeconds() - startTime;
+    });
+}
+
+bool Raytracer::BuildBvh()
+{
+    return BuildModelBvhs() && BuildInstanceBvh();
+}
+
+bool Raytracer::BuildModelBvhs()
+{
+    int numModels = SceneData.GetNumModels();
+    ModelBvhs.reset(new ModelBvh[numModels]);
+    if (!ModelBvhs)
+    {
+        LogError(L"Failed to allocate model BVHs.");
+        return false;
+    }
+
+    int maxTriangles = 0;
+    for (int m = 0; m < numModels; ++m)
+    {
+        maxTriangles = max(maxTriangles, SceneData.GetModel(m).NumTriangles);
+    }
+
+    std::unique_ptr<Aabb[]> bounds(new Aabb[maxTriangles]);
+    if (!bounds)
+    {
+        LogError(L"Failed to allocate triangle bounds.");
+        return false;
+    }
+
+    NumTrianglePackets = 0;
+    for (int m = 0; m < numModels; ++m)
+    {
+        const Scene::Model& model = SceneData.GetModel(m);
+        for (int i = 0; i < model.NumTriangles; ++i)
+        {
+            XMVECTOR a, b, c;
+            SceneData.GetTriangle(model.FirstTriangle + i, &a, &b, &c);
+            XMStoreFloat3(&bounds[i].Min, XMVectorMin(a, XMVectorMin(b, c)));
+            XMStoreFloat3(&bounds[i].Max, XMVectorMax(a, XMVectorMax(b, c)));
+        }
+
+        if (!ModelBvhs[m].Hierarchy.Build(bounds.get(), model.NumTriangles, TrianglePacketWidth))
+        {
+            return false;
+        }
+
+        ModelBvhs[m].FirstPacket = NumTrianglePackets;
+        NumTrianglePackets += ModelBvhs[m].Hierarchy.GetNumPrimIndices() / TrianglePacketWidth;
+    }
+
+    // Copy the triangles into packets, in leaf order. Padding entries become empty lanes.
+    TrianglePackets.reset(new TrianglePacket[NumTrianglePackets]);
+    if (!TrianglePackets)
+    {
+        LogError(L"Failed to allocate triangle packets.");
+        return false;
+    }
+
+    for (int m = 0; m < numModels; ++m)
+    {
+        FillTrianglePackets(m, 0, ModelBvhs[m].Hierarchy.GetNumPrimIndices() / TrianglePacketWidth);
+    }
+
+    return true;
+}
+
+void Raytracer::FillTrianglePackets(int model, int first, int end)
+{
+    int firstTriangle = SceneData.GetModel(model).FirstTriangle;
+    const int* triangles = ModelBvhs[model].Hierarchy.GetPrimIndices();
+    TrianglePacket* packets = &TrianglePackets[ModelBvhs[model].FirstPacket];
+
+    for (int i = first; i < end; ++i)
+    {
+        for (int lane = 0; lane < TrianglePacketWidth; ++lane)
+        {
+            int triangle = triangles[i * TrianglePacketWidth + lane];
+            if (triangle < 0)
+            {
+                ClearTrianglePacketLane(&packets[i], lane);
+                continue;
+            }
+
+            XMVECTOR a, b, c;
+            SceneData.GetTriangle(firstTriangle + triangle, &a, &b, &c);
+            SetTrianglePacketLane(&packets[i], lane, a, b, c, firstTriangle + triangle);
+        }
+    }
+}
+
+bool Raytracer::BuildInstanceBvh()
+{
+    int numInstances = SceneData.GetNumInstances();
+    std::unique_ptr<Aabb[]> bounds(new Aabb[numInstances]);
+    WorldToModel.reset(new XMFLOAT4X3[numInstances]);
+    if (!bounds || !WorldToModel)
+    {
+        LogError(L"Failed to allocate instance data.");
+        return false;
+    }
+
+    for (int i = 0; i < numInstances; ++i)
+    {
+        const Scene::Instance& instance = SceneData.GetInstance(i);
+        XMMATRIX transform = XMLoadFloat4x3(&instance.Transform);
+        XMStoreFloat4x3(&WorldToModel[i], XMMatrixInverse(nullptr, transform));
+
+        // World space box around the corners of the model's box. Empty models just get
+        // a point at their origin, there's nothing in them to hit.
+        const Bvh::Node* root = ModelBvhs[instance.Model].Hierarchy.GetNodes();
+        if (!root)
+        {
+            XMStoreFloat3(&bounds[i].Min, transform.r[3]);
+            XMStoreFloat3(&bounds[i].Max, transform.r[3]);
+            continue;
+        }
+
+        XMVECTOR modelMin = XMLoadFloat3(&root->Min);
+        XMVECTOR modelMax = XMLoadFloat3(&root->Max);
+        XMVECTOR worldMin = XMVectorReplicate(FLT_MAX);
+        XMVECTOR worldMax = XMVectorReplicate(-FLT_MAX);
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            XMVECTOR p = XMVectorSelect(modelMin, modelMax, XMVectorSelectControl(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1, 0));
+            p = XMVector3Transform(p, transform);
+            worldMin = XMVectorMin(worldMin, p);
+            worldMax = XMVectorMax(worldMax, p);
+        }
+        XMStoreFloat3(&bounds[i].Min, worldMin);
+        XMStoreFloat3(&bounds[i].Max, worldMax);
+    }
+
+    return InstanceBvh.Build(bounds.get(), numInstances);
+}
+
+bool Raytracer::UpdateInstances()
+{
+    // Light sampling works in world space, so it has to follow the lights around
+    if (!BuildInstanceBvh())
+    {
+        LogError(L"Failed to build instance BVH.");
+        return false;
+    }
+
+    if (!BuildLightCdf())
+    {
+        LogError(L"Failed to build light sampling table.");
+        return false;
+    }
+
+    return true;
+}
+
+// Quality monitor for UpdateModel. Parts of a refit BVH whose SAH cost has grown past this
+// much of their cost as built are restructured...
+static const float BvhRestructureThreshold = 1.15f;
+// ...and if the whole tree is still past this afterwards, it's rebuilt
+static const float BvhRebuildThreshold = 1.3f;
+
+// Triangles handled at a time by each render thread while updating a model
+static const int RefitChunkSize = 4096;
+
+bool Raytracer::UpdateModel(int model, ModelUpdateStats* stats)
+{
+    int firstTriangle = SceneData.GetModel(model).FirstTriangle;
+    int numTriangles = SceneData.GetModel(model).NumTriangles;
+    Bvh& hierarchy = ModelBvhs[model].Hierarchy;
+
+    RefitBounds.resize(numTriangles);
+    Aabb* bounds = RefitBounds.data();
+    ParallelFor(numTriangles, RefitChunkSize, [&](int first, int end)
+    {
+        for (int i = first; i < end; ++i)
+        {
+            XMVECTOR a, b, c;
+            SceneData.GetTriangle(firstTriangle + i, &a, &b, &c);
+            XMStoreFloat3(&bounds[i].Min, XMVectorMin(a, XMVectorMin(b, c)));
+            XMStoreFloat3(&bounds[i].Max, XMVectorMax(a, XMVectorMax(b, c)));
+        }
+    });
+
+    ParallelFor(hierarchy.GetNumPrimIndices() / TrianglePacketWidth, RefitChunkSize / TrianglePacketWidth, [&](int first, int end)
+    {
+        FillTrianglePackets(model, first, end);
+    });
+
+    // Groups are independent, and vary in size, so they're handed out one at a time
+    ParallelFor(hierarchy.GetNumRefitGroups(), 1, [&](int first, int end)
+    {
+        for (int group = first; group < end; ++group)
+        {
+            hierarchy.RefitGroup(bounds, group);
+        }
+    });
+    hierarchy.RefitTop();
+
+    ModelUpdateStats updateStats = {};
+    updateStats.Degradation = hierarchy.GetDegradation();
+
+    if (BvhRestructuringEnabled && updateStats.Degradation > BvhRestructureThreshold)
+    {
+        std::atomic<int> numRestructured(0);
+        std::atomic<bool> failed(false);
+        ParallelFor(hierarchy.GetNumRefitGroups(), 1, [&](int first, int end)
+        {
+            for (int group = first; group < end; ++group)
+            {
+                if (hierarchy.GetGroupDegradation(group) > BvhRestructureThreshold)
+                {
+                    if (!hierarchy.RestructureGroup(group))
+                    {
+                        failed = true;
+                    }
+                    ++numRestructured;
+                }
+            }
+        });
+
+        if (!failed && hierarchy.GetTopDegradation() > BvhRestructureThreshold)
+        {
+            if (!hierarchy.RestructureTop())
+            {
+                failed = true;
+            }
+            ++numRestructured;
+        }
+
+        if (failed)
+        {
+            LogError(L"Failed to restructure BVH.");
+            return false;
+        }
+        updateStats.NumRestructured = numRestructured;
+
+        // Treelets keep primitives in the leaves they started in, so once those have
+        // spread out, only starting over helps
+        if (hierarchy.GetDegradation() > BvhRebuildThreshold)
+        {
+            if (!RebuildModelBvh(model, bounds))
+            {
+                return false;
+            }
+            updateStats.Rebuilt = true;
+        }
+    }
+
+    if (stats)
     {
-        LogError(L"Failed to allocate vertices for scene.");
-        return false;
+        *stats = updateStats;
     }
 
-    TexCoords.reset(new XMFLOAT2[NumVertices]);
-    if (!TexCoords)
+    return UpdateInstances();
+}
+
+bool Raytracer::RebuildModelBvh(int model, const Aabb* triangleBounds)
+{
+    Bvh& hierarchy = ModelBvhs[model].Hierarchy;
+    int oldNumPackets = hierarchy.GetNumPrimIndices() / TrianglePacketWidth;
+    if (!hierarchy.Build(triangleBounds, SceneData.GetModel(model).NumTriangles, TrianglePacketWidth))
     {
-        LogError(L"Failed to allocate texture coords for scene.");
+        LogError(L"Failed to rebuild model BVH.");
         return false;
     }
 
-    SurfaceProps.reset(new SurfaceProp[NumTriangles]);
-    if (!SurfaceProps)
+    // Leaves are padded to whole packets, so the number of packets can change.
+    // Packets are stored in model order, so make room by moving the later models'.
+    int numPackets = hierarchy.GetNumPrimIndices() / TrianglePacketWidth;
+    if (numPackets != oldNumPackets)
     {
-        LogError(L"Failed to create surface properties for scene.");
-        return false;
+        int firstPacket = ModelBvhs[model].FirstPacket;
+        int newNumTrianglePackets = NumTrianglePackets - oldNumPackets + numPackets;
+        std::unique_ptr<TrianglePacket[]> packets(new TrianglePacket[newNumTrianglePackets]);
+        if (!packets)
+        {
+            LogError(L"Failed to allocate triangle packets.");
+            return false;
+        }
+
+        memcpy(&packets[0], &TrianglePackets[0], firstPacket * sizeof(TrianglePacket));
+        memcpy(&packets[firstPacket + numPackets], &TrianglePackets[firstPacket + oldNumPackets],
+            (NumTrianglePackets - firstPacket - oldNumPackets) * sizeof(TrianglePacket));
+        for (int m = model + 1; m < SceneData.GetNumModels(); ++m)
+        {
+            ModelBvhs[m].FirstPacket += numPackets - oldNumPackets;
+        }
+
+        TrianglePackets.swap(packets);
+        NumTrianglePackets = newNumTrianglePackets;
     }
-    for (int i = 0; i < NumTriangles; ++i)
+
+    ParallelFor(numPackets, RefitChunkSize / TrianglePacketWidth, [&](int first, int end)
     {
-        SurfaceProps[i].Texture = -1;
-        SurfaceProps[i].Emission = XMFLOAT3(0.f, 0.f, 0.f);
-    }
+        FillTrianglePackets(model, first, end);
+    });
+    return true;
+}
 
-    int numVerts = 0;
-    int numTris = 0;
+void Raytracer::ParallelFor(int count, int chunkSize, const std::function<void (int first, int end)>& func)
+{
+    // Chunks are scheduled like the pixels of a one pixel high image
+    int numChunks = (count + chunkSize - 1) / chunkSize;
+    Scheduler.Run(numChunks, 1, [&](int thread, const RenderScheduler::Tile& tile)
+    {
+        UNREFERENCED_PARAMETER(thread);
+        func(tile.MinX * chunkSize, min(tile.MaxX * chunkSize, count));
+    });
+}
 
-    // left red wall
-    numVerts += AddQuad(XMVectorSet(-2.5f, 2.5f, 0.f, 1.f), XMVectorSet(-2.5f, 2.5f, 5.f, 1.f),
-        XMVectorSet(-2.5f, -2.5f, 5.f, 1.f), XMVectorSet(-2.5f, -2.5f, 0.f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+void Raytracer::GetInstanceTriangle(int instance, int triangle, XMVECTOR* a, XMVECTOR* b, XMVECTOR* c) const
+{
+    XMMATRIX transform = XMLoadFloat4x3(&SceneData.GetInstance(instance).Transform);
+    SceneData.GetTriangle(triangle, a, b, c);
+    *a = XMVector3Transform(*a, transform);
+    *b = XMVector3Transform(*b, transform);
+    *c = XMVector3Transform(*c, transform);
+}
 
-    for (int i = 0; i < 2; ++i)
-    {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 0.f, 0.f);
-        ++numTris;
-    }
+// Slab test of a ray against a node's box. On a hit, dist receives the distance
+// along the ray where it enters the box (0 if the ray starts inside of it).
+static bool RayAabbIntersect(FXMVECTOR start, FXMVECTOR invDir, const Bvh::Node& node, float maxDist, float* dist)
+{
+    XMVECTOR t0 = XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&node.Min), start), invDir);
+    XMVECTOR t1 = XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&node.Max), start), invDir);
+    XMVECTOR tNear = XMVectorMin(t0, t1);
+    XMVECTOR tFar = XMVectorMax(t0, t1);
 
-    // right green wall
-    numVerts += AddQuad(XMVectorSet(2.5f, 2.5f, 5.f, 1.f), XMVectorSet(2.5f, 2.5f, 0.f, 1.f),
-        XMVectorSet(2.5f, -2.5f, 0.f, 1.f), XMVectorSet(2.5f, -2.5f, 5.f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+    float enter = max(max(XMVectorGetX(tNear), XMVectorGetY(tNear)), max(XMVectorGetZ(tNear), 0.f));
+    float exit = min(min(XMVectorGetX(tFar), XMVectorGetY(tFar)), min(XMVectorGetZ(tFar), maxDist));
 
-    for (int i = 0; i < 2; ++i)
-    {
-        SurfaceProps[numTris].Color = XMFLOAT3(0.f, 1.f, 0.f);
-        ++numTris;
-    }
+    *dist = enter;
+    return enter <= exit;
+}
 
-    // back white wall
-    numVerts += AddQuad(XMVectorSet(-2.5f, 2.5f, 5.f, 1.f), XMVectorSet(2.5f, 2.5f, 5.f, 1.f),
-        XMVectorSet(2.5f, -2.5f, 5.f, 1.f), XMVectorSet(-2.5f, -2.5f, 5.f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+// Closest hit traversal, shared by both levels of the acceleration structure. testLeaf(node)
+// tests the primitives of a leaf, lowering *nearest when it finds a closer hit, which culls
+// the parts of the tree that are further away.
+template <class LeafTest>
+static void TraverseNearest(const Bvh::Node* nodes, FXMVECTOR start, FXMVECTOR dir, float* nearest, LeafTest testLeaf)
+{
+    XMVECTOR invDir = XMVectorReciprocal(dir);
+    float dist = 0.f;
 
-    for (int i = 0; i < 2; ++i)
+    if (!nodes || !RayAabbIntersect(start, invDir, nodes[0], *nearest, &dist))
     {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 1.f, 1.f);
-        ++numTris;
+        return;
     }
 
-    // front white wall
-    numVerts += AddQuad(XMVectorSet(2.5f, 2.5f, 0.f, 1.f), XMVectorSet(-2.5f, 2.5f, 0.f, 1.f),
-        XMVectorSet(-2.5f, -2.5f, 0.f, 1.f), XMVectorSet(2.5f, -2.5f, 0.f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+    // Nodes we've deferred visiting, along with the distance the ray enters them.
+    // At most one node is pushed per level, so the max depth bounds the size.
+    struct StackEntry
+    {
+        int Node;
+        float Dist;
+    };
+    StackEntry stack[Bvh::MaxDepth];
+    int stackSize = 0;
+    int current = 0;
 
-    for (int i = 0; i < 2; ++i)
+    for (;;)
     {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 1.f, 1.f);
-        ++numTris;
-    }
+        const Bvh::Node& node = nodes[current];
+        if (node.Count > 0)
+        {
+            testLeaf(node);
+        }
+        else
+        {
+            // Visit the nearer child first, so that hits found there can cull the farther one
+            int left = current + 1;
+            int right = node.Offset;
+            float leftDist, rightDist;
+            bool hitLeft = RayAabbIntersect(start, invDir, nodes[left], *nearest, &leftDist);
+            bool hitRight = RayAabbIntersect(start, invDir, nodes[right], *nearest, &rightDist);
+
+            if (hitLeft && hitRight)
+            {
+                if (rightDist < leftDist)
+                {
+                    std::swap(left, right);
+                    std::swap(leftDist, rightDist);
+                }
+                stack[stackSize].Node = right;
+                stack[stackSize].Dist = rightDist;
+                ++stackSize;
+                current = left;
+                continue;
+            }
+            else if (hitLeft)
+            {
+                current = left;
+                continue;
+            }
+            else if (hitRight)
+            {
+                current = right;
+                continue;
+            }
+        }
 
-    // bottom white floor
-    numVerts += AddQuad(XMVectorSet(-2.5f, -2.5f, 5.f, 1.f), XMVectorSet(2.5f, -2.5f, 5.f, 1.f),
-        XMVectorSet(2.5f, -2.5f, 0.f, 1.f), XMVectorSet(-2.5f, -2.5f, 0.f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+        // Pop the next node, skipping any that start beyond the nearest hit so far
+        while (stackSize > 0 && stack[stackSize - 1].Dist > *nearest)
+        {
+            --stackSize;
+        }
 
-    for (int i = 0; i < 2; ++i)
-    {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 1.f, 1.f);
-        ++numTris;
+        if (stackSize == 0)
+        {
+            return;
+        }
+
+        current = stack[--stackSize].Node;
     }
+}
 
-    // top white ceiling
-    numVerts += AddQuad(XMVectorSet(-2.5f, 2.5f, 0.f, 1.f), XMVectorSet(2.5f, 2.5f, 0.f, 1.f),
-        XMVectorSet(2.5f, 2.5f, 5.f, 1.f), XMVectorSet(-2.5f, 2.5f, 5.f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+// Any hit traversal, shared by both levels of the acceleration structure. testLeaf(node)
+// returns true if anything in the leaf is hit closer than maxDist, which ends the search.
+template <class LeafTest>
+static bool TraverseAny(const Bvh::Node* nodes, FXMVECTOR start, FXMVECTOR dir, float maxDist, LeafTest testLeaf)
+{
+    XMVECTOR invDir = XMVectorReciprocal(dir);
+    float dist = 0.f;
 
-    for (int i = 0; i < 2; ++i)
+    if (!nodes || !RayAabbIntersect(start, invDir, nodes[0], maxDist, &dist))
     {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 1.f, 1.f);
-        ++numTris;
+        return false;
     }
 
-    // top ceiling light
-    numVerts += AddQuad(XMVectorSet(-0.75f, 2.495f, 1.75f, 1.f), XMVectorSet(0.75f, 2.495f, 1.75f, 1.f),
-        XMVectorSet(0.75f, 2.495f, 3.25f, 1.f), XMVectorSet(-0.75f, 2.495f, 3.25f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+    // Any hit ends the search, so there's nothing to gain from visiting the nearer
+    // child first or remembering where the ray enters deferred nodes. Children are
+    // simply visited in tree order, which keeps the stack to plain node indices.
+    int stack[Bvh::MaxDepth];
+    int stackSize = 0;
+    int current = 0;
 
-    for (int i = 0; i < 2; ++i)
+    for (;;)
     {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 1.f, 1.f);
-        SurfaceProps[numTris].Emission = XMFLOAT3(1.f, 0.836f, 0.664f); // warm room light
-        ++numTris;
-    }
+        const Bvh::Node& node = nodes[current];
+        if (node.Count > 0)
+        {
+            if (testLeaf(node))
+            {
+                return true;
+            }
+        }
+        else
+        {
+            int left = current + 1;
+            int right = node.Offset;
+            bool hitLeft = RayAabbIntersect(start, invDir, nodes[left], maxDist, &dist);
+            bool hitRight = RayAabbIntersect(start, invDir, nodes[right], maxDist, &dist);
 
-#if defined (USE_SINGLE_BOX)
+            if (hitLeft && hitRight)
+            {
+                stack[stackSize++] = right;
+                current = left;
+                continue;
+            }
+            else if (hitLeft)
+            {
+                current = left;
+                continue;
+            }
+            else if (hitRight)
+            {
+                current = right;
+                continue;
+            }
+        }
 
-    // tall box in the back, rotated facing 1, 0, -1
-    numVerts += AddCube(XMVectorSet(0.f, -1.f, 1.f, 1.f), XMVectorSet(1.f, 0.f, 1.f, 1.f),
-        XMVectorSet(0.f, -1.5f, 0.f, 1.f), XMVectorSet(-1.f, 0.f, 1.f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+        if (stackSize == 0)
+        {
+            return false;
+        }
 
-    for (int i = 0; i < 10; ++i)
-    {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 1.f, 1.f);
-        ++numTris;
+        current = stack[--stackSize];
     }
+}
 
-#else
+// Slab test of every ray of a packet against a node's box, for hits closer than each ray's lane
+// of maxDist. Returns the mask of rays that hit it, with the distance each enters it in dist.
+static XMVECTOR RayPacketAabbIntersect(const RayPacket& rays, const Bvh::Node& node, FXMVECTOR maxDist, XMVECTOR* dist)
+{
+    XMVECTOR enter = XMVectorZero();
+    XMVECTOR exit = maxDist;
+    for (int i = 0; i < 3; ++i)
+    {
+        XMVECTOR t0 = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate((&node.Min.x)[i]), rays.Start[i]), rays.InvDir[i]);
+        XMVECTOR t1 = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate((&node.Max.x)[i]), rays.Start[i]), rays.InvDir[i]);
+        enter = XMVectorMax(enter, XMVectorMin(t0, t1));
+        exit = XMVectorMin(exit, XMVectorMax(t0, t1));
+    }
 
-    // tall box in the back, rotated facing 1, 0, -1
-    numVerts += AddCube(XMVectorSet(-1.2f, 0.5f, 2.25f, 1.f), XMVectorSet(1.5f, 0.f, 0.8f, 1.f),
-        XMVectorSet(0.f, -3.f, 0.f, 1.f), XMVectorSet(-0.8f, 0.f, 1.5f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+    *dist = enter;
+    return XMVectorLessOrEqual(enter, exit);
+}
 
-    for (int i = 0; i < 10; ++i)
+// TraverseNearest for a packet of rays. A node is visited if any of the rays hit it, and the
+// rays that didn't are carried along, since testing them costs nothing extra. testLeaf(node)
+// lowers the lanes of *nearest that find closer hits.
+template <class LeafTest>
+static void TraversePacketNearest(const Bvh::Node* nodes, const RayPacket& rays, XMVECTOR* nearest, LeafTest testLeaf)
+{
+    XMVECTOR dist;
+    if (!nodes || GetRayPacketLanes(RayPacketAabbIntersect(rays, nodes[0], *nearest, &dist)) == 0)
     {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 1.f, 1.f);
-        //SurfaceProps[numTris].Texture = 0;
-        ++numTris;
+        return;
     }
 
-    // small box in the front, rotated facing -1, 0, 1
-    numVerts += AddCube(XMVectorSet(-0.5f, -1.0f, 1.f, 1.f), XMVectorSet(1.5f, 0.f, -0.8f, 1.f),
-        XMVectorSet(0.f, -1.5f, 0.f, 1.f), XMVectorSet(0.8f, 0.f, 1.5f, 1.f),
-        &Vertices[numVerts], &TexCoords[numVerts]);
+    // Deferred nodes, with the distance each ray enters them (FLT_MAX for rays that miss them)
+    struct StackEntry
+    {
+        XMVECTOR Dist;
+        int Node;
+    };
+    StackEntry stack[Bvh::MaxDepth];
+    int stackSize = 0;
+    int current = 0;
+    XMVECTOR miss = XMVectorReplicate(FLT_MAX);
 
-    for (int i = 0; i < 10; ++i)
+    for (;;)
     {
-        SurfaceProps[numTris].Color = XMFLOAT3(1.f, 1.f, 1.f);
-        ++numTris;
-    }
+        const Bvh::Node& node = nodes[current];
+        if (node.Count > 0)
+        {
+            testLeaf(node);
+        }
+        else
+        {
+            // Visit the child that the packet reaches first, so hits found there can cull the other one
+            int left = current + 1;
+            int right = node.Offset;
+            XMVECTOR leftDist, rightDist;
+            XMVECTOR hitLeft = RayPacketAabbIntersect(rays, nodes[left], *nearest, &leftDist);
+            XMVECTOR hitRight = RayPacketAabbIntersect(rays, nodes[right], *nearest, &rightDist);
+            leftDist = XMVectorSelect(miss, leftDist, hitLeft);
+            rightDist = XMVectorSelect(miss, rightDist, hitRight);
+            int leftLanes = GetRayPacketLanes(hitLeft);
+            int rightLanes = GetRayPacketLanes(hitRight);
+
+            if (leftLanes && rightLanes)
+            {
+                XMFLOAT4 l, r;
+                XMStoreFloat4(&l, leftDist);
+                XMStoreFloat4(&r, rightDist);
+                if (min(min(r.x, r.y), min(r.z, r.w)) < min(min(l.x, l.y), min(l.z, l.w)))
+                {
+                    std::swap(left, right);
+                    std::swap(leftDist, rightDist);
+                }
+                stack[stackSize].Node = right;
+                stack[stackSize].Dist = rightDist;
+                ++stackSize;
+                current = left;
+                continue;
+            }
+            else if (leftLanes)
+            {
+                current = left;
+                continue;
+            }
+            else if (rightLanes)
+            {
+                current = right;
+                continue;
+            }
+        }
 
-#endif
+        // Pop the next node, skipping any that every ray has found a nearer hit than
+        while (stackSize > 0 && GetRayPacketLanes(XMVectorLessOrEqual(stack[stackSize - 1].Dist, *nearest)) == 0)
+        {
+            --stackSize;
+        }
 
-    assert(numVerts == NumVertices);
-    assert(numTris == NumTriangles);
+        if (stackSize == 0)
+        {
+            return;
+        }
 
-    return true;
+        current = stack[--stackSize].Node;
+    }
 }
 
-DWORD CALLBACK Raytracer::RenderThreadProc(PVOID data)
+// TraverseAny for a packet of rays. testLeaf(node) sets the lanes of *maxDist to -1 for the rays
+// it finds a hit for, which takes them out of the rest of the search, and returns true when no
+// lanes are left.
+template <class LeafTest>
+static void TraversePacketAny(const Bvh::Node* nodes, const RayPacket& rays, XMVECTOR* maxDist, LeafTest testLeaf)
 {
-    Raytracer* This = (Raytracer*)data;
+    XMVECTOR dist;
+    if (!nodes || GetRayPacketLanes(RayPacketAabbIntersect(rays, nodes[0], *maxDist, &dist)) == 0)
+    {
+        return;
+    }
+
+    int stack[Bvh::MaxDepth];
+    int stackSize = 0;
+    int current = 0;
 
-    HANDLE handles[] = { This->ShutdownEvent.Get(), This->StartEvent.Get() };
     for (;;)
     {
-        if (WaitForMultipleObjects(_countof(handles), handles, FALSE, INFINITE) == WAIT_OBJECT_0)
+        const Bvh::Node& node = nodes[current];
+        if (node.Count > 0)
         {
-            // shutdown
-            break;
+            if (testLeaf(node))
+            {
+                return;
+            }
         }
-
-        // Grab a tile
-        long jobIndex = InterlockedDecrement(&This->NumRenderJobs);
-        if (jobIndex < 0)
+        else
         {
-            // All the jobs are gone, nothing to do
-            continue;
-        }
+            int left = current + 1;
+            int right = node.Offset;
+            bool hitLeft = GetRayPacketLanes(RayPacketAabbIntersect(rays, nodes[left], *maxDist, &dist)) != 0;
+            bool hitRight = GetRayPacketLanes(RayPacketAabbIntersect(rays, nodes[right], *maxDist, &dist)) != 0;
 
-        This->ProcessRenderJob(jobIndex);
+            if (hitLeft && hitRight)
+            {
+                stack[stackSize++] = right;
+                current = left;
+                continue;
+            }
+            else if (hitLeft)
+            {
+                current = left;
+                continue;
+            }
+            else if (hitRight)
+            {
+                current = right;
+                continue;
+            }
+        }
 
-        if (jobIndex == 0)
+        if (stackSize == 0)
         {
-            // Was the last job, signal finish
-            SetEvent(This->FinishEvent.Get());
+            return;
         }
-    }
 
-    return 0;
+        current = stack[--stackSize];
+    }
 }
 
-void Raytracer::ProcessRenderJob(long index)
+bool Raytracer::BuildLightCdf()
 {
-    RenderRequest& request = RenderJobs[index];
+    // Lights are sampled in world space, so emissive triangles are gathered per instance.
+    // Materials are per mesh (or instance), so they're emissive in whole runs of triangles.
+    // The first pass counts them, the second fills in the table.
+    float totalPower = 0.f;
+    int numEmissive = 0;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        numEmissive = 0;
 
-    int endX = min(request.maxX, Width);
-    int endY = min(request.maxY, Height);
+        auto addRun = [&](int instance, int firstTriangle, int numTriangles, int material)
+        {
+            float luminance = Luminance(XMLoadFloat3(&SurfaceProps[material].Emission));
+            if (luminance <= 0.f)
+            {
+                return;
+            }
 
-    XMMATRIX cameraWorldTransform = XMLoadFloat4x4(&request.CameraWorld);
+            if (pass == 0)
+            {
+                numEmissive += numTriangles;
+                return;
+            }
 
-    for (int y = request.minY; y < endY; ++y)
-    {
-        for (int x = request.minX; x < endX; ++x)
+            // Pick triangles in proportion to the power they emit (area x brightness)
+            for (int i = firstTriangle; i < firstTriangle + numTriangles; ++i)
+            {
+                XMVECTOR a, b, c;
+                GetInstanceTriangle(instance, i, &a, &b, &c);
+                float area = 0.5f * XMVectorGetX(XMVector3Length(XMVector3Cross(b - a, c - a)));
+
+                totalPower += area * luminance;
+                EmissiveInstances[numEmissive] = instance;
+                EmissiveTriangles[numEmissive] = i;
+                EmissiveMaterials[numEmissive] = material;
+                EmissiveCdf[numEmissive] = totalPower;
+                ++numEmissive;
+            }
+        };
+
+        for (int i = 0; i < SceneData.GetNumInstances(); ++i)
         {
-            // Compute ray direction
-            XMVECTOR dir = XMVectorScale(cameraWorldTransform.r[2], DistToProjPlane);
-            dir = XMVectorAdd(dir, XMVectorScale(cameraWorldTransform.r[0], (float)x - HalfWidth));
-            dir = XMVectorAdd(dir, XMVectorScale(cameraWorldTransform.r[1], HalfHeight - (float)y));
-            dir = XMVector3Normalize(dir);
+            const Scene::Instance& instance = SceneData.GetInstance(i);
+            const Scene::Model& model = SceneData.GetModel(instance.Model);
+            if (model.NumTriangles == 0)
+            {
+                continue;
+            }
 
-            RayIntersection intersection;
-            if (TraceRay(cameraWorldTransform.r[3], dir, &intersection))
+            if (instance.Material >= 0)
+            {
+                addRun(i, model.FirstTriangle, model.NumTriangles, instance.Material);
+                continue;
+            }
+
+            // Meshes overlapping the model's triangles
+            int end = model.FirstTriangle + model.NumTriangles;
+            for (int m = SceneData.GetTriangleMesh(model.FirstTriangle); m < SceneData.GetNumMeshes(); ++m)
             {
-                XMVECTOR newSample = ComputeRadiance(dir, intersection);
-                if (XMVectorGetX(XMVector3LengthEst(newSample)) > 0.0001f)
+                const Scene::Mesh& mesh = SceneData.GetMesh(m);
+                if (mesh.FirstTriangle >= end)
                 {
-                    newSample = XMVectorSetW(newSample, 1.f);
-                    XMVECTOR curSample = XMLoadFloat4(&Accum[y * Width + x]);
-                    XMStoreFloat4(&Accum[y * Width + x], curSample + newSample);
+                    break;
                 }
+
+                int first = max(mesh.FirstTriangle, model.FirstTriangle);
+                int last = min(mesh.FirstTriangle + mesh.NumTriangles, end);
+                addRun(i, first, last - first, mesh.Material);
+            }
+        }
+
+        if (pass == 0)
+        {
+            NumEmissiveTriangles = numEmissive;
+            EmissiveInstances.reset(new int[NumEmissiveTriangles]);
+            EmissiveTriangles.reset(new int[NumEmissiveTriangles]);
+            EmissiveMaterials.reset(new int[NumEmissiveTriangles]);
+            EmissiveCdf.reset(new float[NumEmissiveTriangles]);
+            if (!EmissiveInstances || !EmissiveTriangles || !EmissiveMaterials || !EmissiveCdf)
+            {
+                LogError(L"Failed to allocate light sampling table.");
+                return false;
             }
         }
     }
-}
 
-// Get random normalized float [-1, 1]
-static float randf()
-{
-    return (float)rand() / (float)RAND_MAX * 2.f - 1.f;
-}
+    for (int i = 0; i < SceneData.GetNumMaterials(); ++i)
+    {
+        SurfaceProps[i].LightPdf = 0.f;
+    }
 
-XMVECTOR Raytracer::PickRandomVectorInHemisphere(FXMVECTOR normal)
-{
-    // TODO: Use BRDF to drive distribution
-    XMVECTOR tangent = XMVector3Cross(normal, XMVectorSet(0, 1, 0, 0));
-    if (XMVectorGetX(XMVector3LengthEst(tangent)) < 0.0001f)
+    if (totalPower <= 0.f)
     {
-        tangent = XMVector3Cross(normal, XMVectorSet(1, 0, 0, 0));
+        // Only degenerate lights, nothing to sample
+        NumEmissiveTriangles = 0;
+        return true;
     }
-    XMVECTOR bitangent = XMVector3Cross(tangent, normal);
-    XMVECTOR newDir = (normal * fabsf(randf())) + (tangent * randf() * randf()) + (bitangent * randf() * randf());
 
-    return XMVector3Normalize(newDir);
+    for (int i = 0; i < NumEmissiveTriangles; ++i)
+    {
+        EmissiveCdf[i] /= totalPower;
+    }
+    EmissiveCdf[NumEmissiveTriangles - 1] = 1.f;
+
+    // Chance of picking a triangle (area x luminance / totalPower), spread over its area
+    for (int i = 0; i < SceneData.GetNumMaterials(); ++i)
+    {
+        SurfaceProp& props = SurfaceProps[i];
+        props.LightPdf = Luminance(XMLoadFloat3(&props.Emission)) / totalPower;
+    }
+
+    return true;
 }
 
-XMVECTOR Raytracer::ComputeRadiance(FXMVECTOR dir, const RayIntersection& intersection, int depth)
+int Raytracer::IntersectModel(int model, FXMVECTOR start, FXMVECTOR dir, float* nearest, float* u, float* v)
 {
-    if (depth == NumBounces)
+    const ModelBvh& modelBvh = ModelBvhs[model];
+
+    TrianglePacketRay ray;
+    PrepareTrianglePacketRay(start, dir, &ray);
+
+    int nearestTriangle = -1;
+    TraverseNearest(modelBvh.Hierarchy.GetNodes(), start, dir, nearest, [&](const Bvh::Node& node)
     {
-        return XMVectorZero();
-    }
+        const TrianglePacket* packet = &TrianglePackets[modelBvh.FirstPacket + node.Offset / TrianglePacketWidth];
+        const TrianglePacket* end = packet + (node.Count + TrianglePacketWidth - 1) / TrianglePacketWidth;
+        for (; packet < end; ++packet)
+        {
+            int lane = IntersectTrianglePacket(ray, *packet, nearest, u, v);
+            if (lane >= 0)
+            {
+                nearestTriangle = packet->Triangle[lane];
+            }
+        }
+    });
+
+    return nearestTriangle;
+}
 
-    // dir is useful for computing specular or other view dependent factors. Not currently used
-    UNREFERENCED_PARAMETER(dir);
+bool Raytracer::OccludeModel(int model, FXMVECTOR start, FXMVECTOR dir, float maxDist)
+{
+    const ModelBvh& modelBvh = ModelBvhs[model];
 
-    // Compute base color
-    const SurfaceProp& props = SurfaceProps[intersection.StartIndex / 3];
-    XMVECTOR baseColor = XMLoadFloat3(&props.Color);
+    TrianglePacketRay ray;
+    PrepareTrianglePacketRay(start, dir, &ray);
 
-    if (props.Texture >= 0)
+    return TraverseAny(modelBvh.Hierarchy.GetNodes(), start, dir, maxDist, [&](const Bvh::Node& node)
     {
-        XMVECTOR t0 = XMLoadFloat2(&TexCoords[intersection.StartIndex]) * intersection.wA;
-        XMVECTOR t1 = XMLoadFloat2(&TexCoords[intersection.StartIndex + 1]) * intersection.wB;
-        XMVECTOR t2 = XMLoadFloat2(&TexCoords[intersection.StartIndex + 2]) * intersection.wC;
-        XMVECTOR texCoords = t0 + t1 + t2;
+        const TrianglePacket* packet = &TrianglePackets[modelBvh.FirstPacket + node.Offset / TrianglePacketWidth];
+        const TrianglePacket* end = packet + (node.Count + TrianglePacketWidth - 1) / TrianglePacketWidth;
+        for (; packet < end; ++packet)
+        {
+            if (OccludeTrianglePacket(ray, *packet, maxDist))
+            {
+                return true;
+            }
+        }
+        return false;
+    });
+}
 
-        Texture& tex = Textures[props.Texture];
-        uint32_t sample = tex.Pixels[(int)(XMVectorGetY(texCoords) * tex.Height) * tex.Width + (int)(XMVectorGetX(texCoords) * tex.Width)];
+bool Raytracer::TraceRay(FXMVECTOR start, FXMVECTOR dir, RayIntersection* intersection)
+{
+    // Only the nearest triangle & its barycentrics are tracked during traversal.
+    // The rest of the hit information is computed once at the end.
+    float nearest = FLT_MAX;
+    int nearestInstance = -1;
+    int nearestTriangle = -1;
+    float u = 0.f, v = 0.f;
+
+    // The model space ray isn't normalized, so that distances along it are the same as
+    // in world space, and hits from different instances can be compared directly
+    const int* instances = InstanceBvh.GetPrimIndices();
+    TraverseNearest(InstanceBvh.GetNodes(), start, dir, &nearest, [&](const Bvh::Node& node)
+    {
+        for (int i = node.Offset; i < node.Offset + node.Count; ++i)
+        {
+            int instance = instances[i];
+            XMMATRIX worldToModel = XMLoadFloat4x3(&WorldToModel[instance]);
+            int triangle = IntersectModel(SceneData.GetInstance(instance).Model,
+                XMVector3Transform(start, worldToModel), XMVector3TransformNormal(dir, worldToModel), &nearest, &u, &v);
+            if (triangle >= 0)
+            {
+                nearestInstance = instance;
+                nearestTriangle = triangle;
+            }
+        }
+    });
 
-        baseColor = XMVectorSet(((sample >> 16) & 0xFF) / 255.f, ((sample >> 8) & 0xFF) / 255.f, (sample & 0xFF) / 255.f, 0.f);
+    if (nearestTriangle < 0)
+    {
+        return false;
     }
 
-    // Basic info about the point we're shading
-    XMVECTOR p = XMLoadFloat3(&intersection.Point);
-    XMVECTOR normal = XMLoadFloat3(&intersection.Normal);
+    ComputeIntersection(start, dir, nearest, nearestInstance, nearestTriangle, u, v, intersection);
+    return true;
+}
 
-    // Move p out slight from surface to avoid self-intersection
-    p += normal * 0.001f;
+void Raytracer::ComputeIntersection(FXMVECTOR start, FXMVECTOR dir, float dist, int instance, int triangle, float u, float v,
+    RayIntersection* intersection)
+{
+    XMVECTOR a, b, c;
+    GetInstanceTriangle(instance, triangle, &a, &b, &c);
+
+    int material = SceneData.GetInstance(instance).Material;
+
+    intersection->Dist = dist;
+    XMStoreFloat3(&intersection->Point, XMVectorAdd(start, XMVectorScale(dir, dist)));
+    XMStoreFloat3(&intersection->Normal, XMVector3Normalize(XMVector3Cross(XMVectorSubtract(b, a), XMVectorSubtract(c, a))));
+    intersection->Instance = instance;
+    intersection->Triangle = triangle;
+    intersection->Material = material >= 0 ? material : SceneData.GetTriangleMaterial(triangle);
+    intersection->wA = 1.f - u - v;
+    intersection->wB = u;
+    intersection->wC = v;
+}
 
-    XMVECTOR emission = XMLoadFloat3(&props.Emission);
+bool Raytracer::OccludedRay(FXMVECTOR start, FXMVECTOR dir, float maxDist)
+{
+    const int* instances = InstanceBvh.GetPrimIndices();
+    return TraverseAny(InstanceBvh.GetNodes(), start, dir, maxDist, [&](const Bvh::Node& node)
+    {
+        for (int i = node.Offset; i < node.Offset + node.Count; ++i)
+        {
+            int instance = instances[i];
+            XMMATRIX worldToModel = XMLoadFloat4x3(&WorldToModel[instance]);
+            if (OccludeModel(SceneData.GetInstance(instance).Model,
+                XMVector3Transform(start, worldToModel), XMVector3TransformNormal(dir, worldToModel), maxDist))
+            {
+                return true;
+            }
+        }
+        return false;
+    });
+}
 
-    // Try up to 4 times to see if we can get a valid sample
-    int numTries = 4;
+XMVECTOR Raytracer::IntersectModelPacket(int model, const RayPacket& rays, XMVECTOR* nearest, XMVECTOR* u, XMVECTOR* v, XMVECTOR* triangles)
+{
+    const ModelBvh& modelBvh = ModelBvhs[model];
 
-    // If surface has emission (gives off light), then no need to try multiple times
-    if (XMVectorGetX(XMVector3LengthEst(emission)) > 0.0001f)
+    XMVECTOR updated = XMVectorFalseInt();
+    TraversePacketNearest(modelBvh.Hierarchy.GetNodes(), rays, nearest, [&](const Bvh::Node& node)
     {
-        numTries = 1;
-    }
+        const TrianglePacket* packet = &TrianglePackets[modelBvh.FirstPacket + node.Offset / TrianglePacketWidth];
+        const TrianglePacket* end = packet + (node.Count + TrianglePacketWidth - 1) / TrianglePacketWidth;
+        for (; packet < end; ++packet)
+        {
+            updated = XMVectorOrInt(updated, IntersectRayPacketTriangles(rays, *packet, nearest, u, v, triangles));
+        }
+    });
 
-    for (int i = 0; i < numTries; ++i)
-    {
-        // Pick a random direction to bounce and compute contribution from that direction
-        XMVECTOR newDir = PickRandomVectorInHemisphere(normal);
+    return updated;
+}
+
+void Raytracer::OccludeModelPacket(int model, const RayPacket& rays, XMVECTOR* maxDist)
+{
+    const ModelBvh& modelBvh = ModelBvhs[model];
 
-        RayIntersection test;
-        if (TraceRay(p, newDir, &test))
+    XMVECTOR occludedDist = XMVectorReplicate(-1.f);
+    TraversePacketAny(modelBvh.Hierarchy.GetNodes(), rays, maxDist, [&](const Bvh::Node& node)
+    {
+        const TrianglePacket* packet = &TrianglePackets[modelBvh.FirstPacket + node.Offset / TrianglePacketWidth];
+        const TrianglePacket* end = packet + (node.Count + TrianglePacketWidth - 1) / TrianglePacketWidth;
+        for (; packet < end; ++packet)
         {
-            XMVECTOR radiance = ComputeRadiance(newDir, test, depth + 1);
-            radiance = radiance * XMVectorGetX(XMVector3Dot(-newDir, XMLoadFloat3(&test.Normal)));
+            *maxDist = XMVectorSelect(*maxDist, occludedDist, OccludeRayPacketTriangles(rays, *packet, *maxDist));
+            if (GetRayPacketLanes(XMVectorGreaterOrEqual(*maxDist, XMVectorZero())) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    });
+}
 
-            float nDotL = XMVectorGetX(XMVector3Dot(newDir, normal));
-            return emission + baseColor * (radiance * nDotL);
+int Raytracer::TraceRayPacket(const RayPacket& rays, RayIntersection* intersections)
+{
+    // As with TraceRay, only the nearest triangles & their barycentrics are tracked during
+    // traversal. Instances & triangles are kept as ints in the lanes, -1 for no hit yet.
+    XMVECTOR nearest = rays.MaxDist;
+    XMVECTOR u = XMVectorZero();
+    XMVECTOR v = XMVectorZero();
+    XMVECTOR nearestInstances = XMVectorTrueInt();
+    XMVECTOR nearestTriangles = XMVectorTrueInt();
+
+    const int* instances = InstanceBvh.GetPrimIndices();
+    TraversePacketNearest(InstanceBvh.GetNodes(), rays, &nearest, [&](const Bvh::Node& node)
+    {
+        for (int i = node.Offset; i < node.Offset + node.Count; ++i)
+        {
+            int instance = instances[i];
+            RayPacket modelRays;
+            TransformRayPacket(rays, WorldToModel[instance], &modelRays);
+            XMVECTOR updated = IntersectModelPacket(SceneData.GetInstance(instance).Model, modelRays, &nearest, &u, &v, &nearestTriangles);
+            nearestInstances = XMVectorSelect(nearestInstances, XMVectorReplicateInt((uint32_t)instance), updated);
         }
+    });
+
+    XMFLOAT4 dists, us, vs;
+    int hitInstances[RayPacketWidth], hitTriangles[RayPacketWidth];
+    XMStoreFloat4(&dists, nearest);
+    XMStoreFloat4(&us, u);
+    XMStoreFloat4(&vs, v);
+    XMStoreInt4((uint32_t*)hitInstances, nearestInstances);
+    XMStoreInt4((uint32_t*)hitTriangles, nearestTriangles);
+
+    // Back to a ray per row, for filling in the hits
+    XMMATRIX starts, dirs;
+    for (int i = 0; i < 3; ++i)
+    {
+        starts.r[i] = rays.Start[i];
+        dirs.r[i] = rays.Dir[i];
     }
+    starts.r[3] = XMVectorZero();
+    dirs.r[3] = XMVectorZero();
+    starts = XMMatrixTranspose(starts);
+    dirs = XMMatrixTranspose(dirs);
 
-    return emission;
+    int hits = 0;
+    for (int lane = 0; lane < RayPacketWidth; ++lane)
+    {
+        if (hitInstances[lane] >= 0)
+        {
+            ComputeIntersection(starts.r[lane], dirs.r[lane], (&dists.x)[lane], hitInstances[lane], hitTriangles[lane],
+                (&us.x)[lane], (&vs.x)[lane], &intersections[lane]);
+            hits |= 1 << lane;
+        }
+    }
+    return hits;
 }
 
-uint32_t Raytracer::ConvertColorToUint(FXMVECTOR color)
+int Raytracer::OccludedRayPacket(const RayPacket& rays)
 {
-    return 0xFF000000 |
-        (min(255, (int)(XMVectorGetX(color) * 255.0f)) << 16) |
-        (min(255, (int)(XMVectorGetY(color) * 255.0f)) << 8) |
-        min(255, (int)(XMVectorGetZ(color) * 255.0f));
-}
+    XMVECTOR maxDist = rays.MaxDist;
+
+    const int* instances = InstanceBvh.GetPrimIndices();
+    TraversePacketAny(InstanceBvh.GetNodes(), rays, &maxDist, [&](const Bvh::Node& node)
+    {
+        for (int i = node.Offset; i < node.Offset + node.Count; ++i)
+        {
+            int instance = instances[i];
+            RayPacket modelRays;
+            TransformRayPacket(rays, WorldToModel[instance], &modelRays);
+            OccludeModelPacket(SceneData.GetInstance(instance).Model, modelRays, &maxDist);
+            if (GetRayPacketLanes(XMVectorGreaterOrEqual(maxDist, XMVectorZero())) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    });
 
+    // The rays that were in use, and aren't any more
+    XMVECTOR zero = XMVectorZero();
+    return GetRayPacketLanes(XMVectorAndInt(XMVectorGreaterOrEqual(rays.MaxDist, zero), XMVectorLess(maxDist, zero)));
+}
 
-bool Raytracer::TraceRay(FXMVECTOR start, FXMVECTOR dir, RayIntersection* intersection)
+bool Raytracer::TraceRayBruteForce(FXMVECTOR start, FXMVECTOR dir, RayIntersection* intersection)
 {
-    // TODO: Accelerate with some sort of spatial data structure (eg. kd tree)
     bool hitSomething = false;
-    int numTriangles = NumVertices / 3;
     float nearest = FLT_MAX;
     RayIntersection test;
 
-    for (int i = 0; i < numTriangles; ++i)
+    for (int i = 0; i < SceneData.GetNumInstances(); ++i)
     {
-        if (RayTriangleIntersect(start, dir, i * 3, &test))
+        const Scene::Model& model = SceneData.GetModel(SceneData.GetInstance(i).Model);
+        for (int j = model.FirstTriangle; j < model.FirstTriangle + model.NumTriangles; ++j)
         {
-            if (test.Dist < nearest)
+            if (RayTriangleIntersect(start, dir, i, j, &test))
             {
-                nearest = test.Dist;
-                *intersection = test;
+                if (test.Dist < nearest)
+                {
+                    nearest = test.Dist;
+                    *intersection = test;
+                }
+                hitSomething = true;
             }
-            hitSomething = true;
         }
     }
 
     return hitSomething;
 }
 
-bool Raytracer::RayTriangleIntersect(FXMVECTOR start, FXMVECTOR dir, int startVertex, RayIntersection* intersection)
+bool Raytracer::RayTriangleIntersect(FXMVECTOR start, FXMVECTOR dir, int instance, int triangle, RayIntersection* intersection)
 {
-    XMVECTOR a = XMLoadFloat3(&Vertices[startVertex]);
-    XMVECTOR b = XMLoadFloat3(&Vertices[startVertex + 1]);
-    XMVECTOR c = XMLoadFloat3(&Vertices[startVertex + 2]);
+    XMVECTOR a, b, c;
+    GetInstanceTriangle(instance, triangle, &a, &b, &c);
     XMVECTOR ab = XMVectorSubtract(b, a);
     XMVECTOR ac = XMVectorSubtract(c, a);
 
@@ -838,7 +3293,13 @@ bool Raytracer::RayTriangleIntersect(FXMVECTOR start, FXMVECTOR dir, int startVe
     intersection->Dist = hyp;
     XMStoreFloat3(&intersection->Point, p);
     XMStoreFloat3(&intersection->Normal, XMVector3Normalize(n));
-    intersection->StartIndex = startVertex;
+    intersection->Instance = instance;
+    intersection->Triangle = triangle;
+    intersection->Material = SceneData.GetInstance(instance).Material;
+    if (intersection->Material < 0)
+    {
+        intersection->Material = SceneData.GetTriangleMaterial(triangle);
+    }
     intersection->wA = XMVectorGetX(XMVector3Length(wA)) * invNLen;
     intersection->wB = XMVectorGetX(XMVector3Length(wB)) * invNLen;
     intersection->wC = XMVectorGetX(XMVector3Length(wC)) * invNLen;
@@ -1,39 +1,292 @@
 #pragma once
 
+#include "Bvh.h"
+#include "Denoiser.h"
+#include "RayPacket.h"
+#include "RenderScheduler.h"
+#include "Sampler.h"
+#include "Scene.h"
+#include "Texture.h"
+
 /// Currently implemented as a CPU ray tracer. May shuffle things around later
 /// to allow alternate implementations, like GPU or Compute.
 /// Creates and maintains all rendering resources required internally.
 class Raytracer
 {
 public:
+#if defined(_WIN32)
     static Raytracer* Create(HWND window);
+#endif
+
+    // Create a raytracer without a window, for offline rendering. Results are read
+    // back with SaveImage. numThreads <= 0 uses one render thread per core.
+    static Raytracer* CreateHeadless(int width, int height, int numThreads = 0);
+
     ~Raytracer();
 
+    // Resolution the image is rendered at. Lower than the window's when the frame time controller
+    // (see SetTargetFrameTime) has scaled it down.
+    int GetWidth() const { return Width; }
+    int GetHeight() const { return Height; }
+
+    // Size of the image presented to the window (or saved, when headless)
+    int GetDisplayWidth() const { return DisplayWidth; }
+    int GetDisplayHeight() const { return DisplayHeight; }
+
     int GetNumThreads() const { return NumThreads; }
 
     void SetFOV(float horizFovRadians);
 
-    bool IsBlurEnabled() const { return BlurEnabled; }
-    void EnableBlur(bool enabled) { BlurEnabled = enabled; }
+    // How random numbers for paths are generated. Sobol by default.
+    Sampler::Type GetSamplerType() const { return SamplerType; }
+    void SetSamplerType(Sampler::Type type) { SamplerType = type; }
+
+    // Changes the sequence of random numbers used by all pixels
+    void SetRandomSeed(uint32_t seed) { RandomSeed = seed; }
+
+    // Next event estimation: sample a point on an emissive triangle at every bounce and
+    // cast a shadow ray to it, instead of relying on bounces to find the lights by chance.
+    // On by default.
+    bool IsLightSamplingEnabled() const { return LightSamplingEnabled; }
+    void EnableLightSampling(bool enabled) { LightSamplingEnabled = enabled; }
+
+    // Longest path allowed, in bounces after the camera ray hits. Most paths are ended
+    // well before this by Russian roulette, so it's mainly a safety limit. 8 by default.
+    int GetMaxBounces() const { return MaxBounces; }
+    void SetMaxBounces(int maxBounces) { MaxBounces = maxBounces; }
+
+    // Adaptive sampling: tiles stop getting new samples once their estimated relative error
+    // (RMS over the tile's pixels) drops below the threshold. 0 samples every pixel every pass.
+    float GetConvergenceThreshold() const { return ConvergenceThreshold; }
+    void SetConvergenceThreshold(float threshold) { ConvergenceThreshold = threshold; }
+
+    // Tiles still being sampled, out of the total. Everything is active again after Clear.
+    int GetNumActiveTiles() const;
+    int GetNumConvergenceTiles() const { return NumConvergenceTilesX * NumConvergenceTilesY; }
+
+    // Temporal reprojection. When the camera moves between passes, the image accumulated so far
+    // is carried over to the new view instead of being thrown away: each pixel takes the history
+    // of wherever the surface it now sees was seen before, and pixels showing something that
+    // wasn't visible (or that doesn't match) start over. On by default. When off, moving the
+    // camera clears the image.
+    bool IsReprojectionEnabled() const { return ReprojectionEnabled; }
+    void EnableReprojection(bool enabled) { ReprojectionEnabled = enabled; }
+
+    // Filter the image before it's shown (or saved), for a clean enough preview from only a few
+    // samples per pixel. An edge-avoiding a-trous filter (see Denoiser), guided by the normal,
+    // distance and albedo of what each pixel sees. It blurs away some detail, and makes the image
+    // slightly biased, so it's best left off for final renders. On by default.
+    bool IsDenoiseEnabled() const { return DenoiseEnabled; }
+    void EnableDenoise(bool enabled);
+
+    // Trace camera rays in packets of 2x2 pixels, along with the shadow rays from what they hit.
+    // Bounces past the first hit are too incoherent for packets to pay off, so they're still traced
+    // one ray at a time, except by the wavefront, which sorts them into coherent packets first.
+    // The image is the same either way. On by default.
+    bool IsPacketTracingEnabled() const { return PacketTracingEnabled; }
+    void EnablePacketTracing(bool enabled) { PacketTracingEnabled = enabled; }
+
+    // Wavefront path tracing. Rather than following each pixel's path to its end before starting
+    // the next, a pass moves all of the paths on a bounce at a time: every path's ray is traced,
+    // then every hit is shaded (picking the next bounce and the light to sample), then every shadow
+    // ray is traced, each stage as one batch spread across the render threads. Before they're traced,
+    // rays are sorted by direction and origin, so that rays traced one after another take much the
+    // same path through the BVH (and can be traced as packets). The image is the same as tracing
+    // depth first. Off by default.
+    bool IsWavefrontEnabled() const { return WavefrontEnabled; }
+    void EnableWavefront(bool enabled) { WavefrontEnabled = enabled; }
 
     void Clear();
+
+    // Replace the scene with the test scene plus numRandomBoxes randomly placed boxes
+    bool SetTestScene(int numRandomBoxes);
+
+    // Replace the scene with a model file (.obj, .sdkmesh or .cmo, see LoadSceneFile). The
+    // camera is fixed on the test room, so the model is scaled to stand inside of it, lit
+    // by the room's light along with any emissive materials of its own.
+    bool LoadScene(const char* filename);
+
+    const Scene& GetScene() const { return SceneData; }
+
+    // Triangles rendered, counting each instance of a model separately
+    int64_t GetNumTriangles() const { return SceneData.GetNumInstancedTriangles(); }
+
+    // Move an instance of the scene. Takes effect when UpdateInstances is called, which only
+    // rebuilds the instance level of the acceleration structure, not the models' BVHs.
+    void SetInstanceTransform(int instance, FXMMATRIX transform) { SceneData.SetInstanceTransform(instance, transform); }
+    bool UpdateInstances();
+
+    // Move a vertex of the scene. Takes effect when UpdateModel is called for the model using it.
+    void SetVertexPosition(int vertex, const XMFLOAT3& position) { SceneData.SetPosition(vertex, position); }
+
+    // Bring a model up to date after its vertices moved, then UpdateInstances (its bounds have
+    // changed too). The model's BVH is refit on the render threads, keeping its structure.
+    // Refitting loosens the tree as things move around, so its SAH cost is monitored: the parts
+    // that have degraded too far are restructured (treelet rebuilds over their existing leaves),
+    // and if that isn't enough to recover, the model's BVH is rebuilt from scratch.
+    struct ModelUpdateStats
+    {
+        float Degradation;      // SAH cost after refitting, over the cost when the BVH was built
+        int NumRestructured;    // Treelets rebuilt
+        bool Rebuilt;           // Whether the BVH was rebuilt from scratch
+    };
+    bool UpdateModel(int model, ModelUpdateStats* stats = nullptr);
+
+    // Restructuring & rebuilding BVHs that UpdateModel has degraded. On by default. When
+    // off, models are only ever refit.
+    bool IsBvhRestructuringEnabled() const { return BvhRestructuringEnabled; }
+    void EnableBvhRestructuring(bool enabled) { BvhRestructuringEnabled = enabled; }
+
+#if defined(_WIN32)
+    // Add one sample per pixel (or more, see SetTargetFrameTime) and present the result to the window
     bool Render(FXMMATRIX cameraWorldTransform);
 
+    // Frame time controller. With a target set, Render times the work it does each frame and
+    // adapts it to fit: while a pass over every pixel at full resolution takes less than the
+    // target, it renders as many passes per frame as fit, and when a single pass takes longer,
+    // it renders at a lower resolution and scales the image up to the window. The resolution
+    // only changes when the estimate moves by a whole step, and changing it restarts the image.
+    // 0 (the default) renders one pass per frame at full resolution.
+    double GetTargetFrameTime() const { return TargetFrameTime; }
+    void SetTargetFrameTime(double seconds) { TargetFrameTime = seconds; }
+
+    // What the frame time controller has settled on
+    int GetPassesPerFrame() const { return PassesPerFrame; }
+#endif
+
+    // Add samplesPerPixel samples to every pixel of the accumulation buffer, without presenting
+    void RenderOffline(FXMMATRIX cameraWorldTransform, int samplesPerPixel);
+
+    // Write the resolved accumulation buffer to disk, denoised if denoising is enabled. The
+    // format is chosen from the extension: .pfm (32 bit float RGB) or .ppm (8 bit RGB).
+    bool SaveImage(const char* filename);
+
+    // Average of the samples accumulated so far, Width x Height pixels
+    void ResolveImage(XMFLOAT3* pixels) const;
+
+    // Work done by each render thread, accumulated until reset
+    struct ThreadStats
+    {
+        int64_t NumRays;        // Rays traced
+        int64_t NumSamples;     // Pixel samples computed
+        double BusyTime;        // Seconds spent rendering (as opposed to waiting for work)
+    };
+
+    const ThreadStats& GetThreadStats(int thread) const { return Stats[thread]; }
+    int64_t GetNumTileSteals() const { return Scheduler.GetNumSteals(); }
+    void ResetThreadStats();
+
+    // Measure single threaded trace throughput (rays/sec) with and without the BVH
+    // on test scenes of increasing size. Results are written to stdout.
+    bool RunTraceBenchmark(FXMMATRIX cameraWorldTransform);
+
+    // Animate a ~1M triangle scene for numFrames frames with each way of keeping its BVH up to
+    // date (rebuilding, refitting, and refitting with restructuring), rendering a sample per
+    // pixel each frame. The update and trace times per frame are written to stdout.
+    bool RunAnimationBenchmark(FXMMATRIX cameraWorldTransform, int numFrames);
+
+    // Render samplesPerPixel passes over test scenes of increasing size, depth first and as a
+    // wavefront (with and without sorting and packets), on all of the render threads. Throughput,
+    // and how far each image is from the depth first one, are written to stdout.
+    bool RunWavefrontBenchmark(FXMMATRIX cameraWorldTransform, int samplesPerPixel);
+
 private:
-    Raytracer(HWND hwnd);
+    Raytracer(int width, int height, int numThreads);
 
     // Don't allow copy
     Raytracer(const Raytracer&);
     Raytracer& operator= (const Raytracer&);
 
     bool Initialize();
+
+    // Change the resolution the image is rendered at, reallocating everything kept per pixel.
+    // The image is cleared.
+    bool SetRenderResolution(int width, int height);
+
+#if defined(_WIN32)
+    bool CreateBackBuffer();
     bool Present();
 
-    static DWORD CALLBACK RenderThreadProc(PVOID data);
-    void ProcessRenderJob(long index);
+    // Pick the passes per frame and render resolution for the next frame, from how long the
+    // last one took: tracing numSamples pixel samples, then presenting
+    bool UpdateFrameBudget(double traceTime, int64_t numSamples, double presentTime);
+#endif
+
+#if defined(_WIN32)
+    // Decode an image file and generate its mips with DirectXTex. False if it can't be read.
+    static bool LoadTexture(const char* filename, Texture* texture);
+#endif
 
-    // Create a test scene
-    bool GenerateTestScene();
+    // What each pixel's camera ray hit first, kept for reprojecting the image when the camera moves
+    struct PixelSurface
+    {
+        XMFLOAT3 Point;
+        int Instance;       // -1 if the ray missed everything
+        XMFLOAT3 Normal;
+        int Material;
+        float Dist;
+    };
+
+    // Render one sample for every pixel, split into tiles across the render threads
+    void RenderPass(FXMMATRIX cameraWorldTransform);
+    void ProcessTile(int thread, const RenderScheduler::Tile& tile);
+    // Sample the pixels of a tile in 2x2 blocks, tracing each block's camera & shadow rays as packets
+    void ProcessTilePackets(const RenderScheduler::Tile& tile, FXMMATRIX cameraWorldTransform, ThreadStats* stats);
+    // Add a sample to pixel (x, y) of the accumulation buffer
+    void AccumulateSample(int x, int y, FXMVECTOR sample);
+
+    // Run the denoiser over the accumulated image, on the render threads
+    void DenoiseImage();
+
+    // Normalized direction of the camera ray through pixel (x, y)
+    XMVECTOR GetCameraRayDir(FXMMATRIX cameraWorldTransform, int x, int y) const;
+
+    // Move the accumulated image from the camera of the last pass (PassCameraWorld) to a new one
+    void Reproject(FXMMATRIX cameraWorldTransform);
+    void ReprojectTile(int thread, const RenderScheduler::Tile& tile, FXMMATRIX cameraWorldTransform);
+    // Whether a pixel of the previous view saw the same surface as one of the new view
+    static bool IsSameSurface(const PixelSurface& current, const PixelSurface& previous);
+
+    // Re-estimate the error of the tiles sampled in the last pass
+    void UpdateTileErrors();
+    void MarkAllTilesDirty();
+
+    // Create a test scene. Extra randomly placed boxes can be added to stress the tracer.
+    // Boxes are instances of a single cube model, unless mergeBoxes is set. Then the random
+    // boxes are all put in one model (the last one), so they can be animated by moving their
+    // vertices: every box has the same number of vertices, stored contiguously.
+    bool GenerateTestScene(int numRandomBoxes = 0, bool mergeBoxes = false);
+    // Walls and light of the Cornell box, without anything in it, as one instanced model
+    void AddTestRoom();
+
+    // Everything rendering needs from the scene: materials, BVH and light sampling table
+    bool PrepareScene();
+
+    // Surface properties for each scene material, loading the textures they use
+    bool BuildMaterials();
+
+    // Build the acceleration structure over the current scene: a BVH for each model, the
+    // SIMD triangle packets their leaves reference, and the instance BVH over them
+    bool BuildBvh();
+    bool BuildModelBvhs();
+    bool BuildInstanceBvh();
+
+    // Copy packets [first, end) of a model's triangles in from the scene, in leaf order
+    void FillTrianglePackets(int model, int first, int end);
+
+    // Build one model's BVH again, over its triangles' current bounds, moving the other
+    // models' packets if its number of packets changes
+    bool RebuildModelBvh(int model, const Aabb* triangleBounds);
+
+    // Call func(first, end) over ranges covering [0, count), chunkSize at a time, spread
+    // across the render threads. Blocks until done.
+    void ParallelFor(int count, int chunkSize, const std::function<void (int first, int end)>& func);
+
+    // Corners of a triangle of an instance, in world space
+    void GetInstanceTriangle(int instance, int triangle, XMVECTOR* a, XMVECTOR* b, XMVECTOR* c) const;
+
+    // Build the table light sampling picks emissive triangles from, weighted by emitted power
+    bool BuildLightCdf();
 
     //
     // Tracing
@@ -44,29 +297,148 @@ private:
         XMFLOAT3 Point;         // Point on triangle
         XMFLOAT3 Normal;        // Normal at contact
         float wA, wB, wC;       // Barycentric weights, used for interpolating
-        int StartIndex;         // Start index of the triangle it hit
+        int Instance;           // Instance it hit
+        int Triangle;           // Index of the (model's) triangle it hit
+        int Material;           // Material at the hit, from the instance or the triangle's mesh
     };
 
     // Trace a ray through the scene until it hits something. Return information about what it hit.
     bool TraceRay(FXMVECTOR start, FXMVECTOR dir, RayIntersection* intersection);
-    bool RayTriangleIntersect(FXMVECTOR start, FXMVECTOR dir, int startVertex, RayIntersection* intersection);
+    // Visibility only: true if anything is hit closer than maxDist. Stops at the first hit found
+    // and computes no hit information, so it's much cheaper than TraceRay for shadow/occlusion tests.
+    bool OccludedRay(FXMVECTOR start, FXMVECTOR dir, float maxDist);
+    // TraceRay and OccludedRay for a packet of rays at once. Return the mask of lanes that hit
+    // something (bit i for lane i), with what they hit in intersections[i].
+    int TraceRayPacket(const RayPacket& rays, RayIntersection* intersections);
+    int OccludedRayPacket(const RayPacket& rays);
+    // Fill in an intersection from what traversal finds: the distance along the ray, the triangle
+    // (of an instance) that was hit, and the barycentrics of the hit
+    void ComputeIntersection(FXMVECTOR start, FXMVECTOR dir, float dist, int instance, int triangle, float u, float v,
+        RayIntersection* intersection);
+    // Reference version of TraceRay that tests every triangle. Used to validate & benchmark the BVH.
+    bool TraceRayBruteForce(FXMVECTOR start, FXMVECTOR dir, RayIntersection* intersection);
+    bool RayTriangleIntersect(FXMVECTOR start, FXMVECTOR dir, int instance, int triangle, RayIntersection* intersection);
+    // Record what the camera ray through pixel (x, y), going along dir, hit (or a miss if hit is
+    // null) for reprojection, and as the denoiser's guide
+    void StoreSurface(int x, int y, FXMVECTOR dir, const RayIntersection* hit, PixelSurface* surface);
+
+    // Trace a ray, in model space, through one model's BVH. Returns the triangle hit closer
+    // than *nearest (updating nearest, u & v), or -1 if there wasn't one. Rays don't need to
+    // be normalized, and distances are measured in multiples of dir.
+    int IntersectModel(int model, FXMVECTOR start, FXMVECTOR dir, float* nearest, float* u, float* v);
+    bool OccludeModel(int model, FXMVECTOR start, FXMVECTOR dir, float maxDist);
+    // The same for a packet of rays. Lanes that hit a nearer triangle are updated as with TraceRayPacket's
+    // traversal (nearest, u, v and the triangle index as an int), and their mask is returned.
+    // OccludeModelPacket sets the maxDist of lanes that hit something to -1.
+    XMVECTOR IntersectModelPacket(int model, const RayPacket& rays, XMVECTOR* nearest, XMVECTOR* u, XMVECTOR* v, XMVECTOR* triangles);
+    void OccludeModelPacket(int model, const RayPacket& rays, XMVECTOR* maxDist);
+
+    // Light arriving back along a camera ray, from a path traced on from the point it hit. When the
+    // light sampled directly at the camera hit has already been worked out (with packets), it's
+    // passed in cameraDirectLight, and the path takes over from there.
+    XMVECTOR ComputeRadiance(FXMVECTOR cameraDir, const RayIntersection& cameraHit, Sampler* sampler, ThreadStats* stats,
+        const XMVECTOR* cameraDirectLight = nullptr);
+    // Diffuse color of the surface at a hit, from its material's color or texture, filtered over
+    // the footprint of a ray cone coneWidth wide (see SampleSurfaceTexture)
+    XMVECTOR GetBaseColor(const RayIntersection& hit, FXMVECTOR dir, float coneWidth);
+    // Color of a texture at a hit, filtered over the footprint of a ray cone coneWidth wide
+    // (in world units) where it reaches the hit, coming in along dir
+    XMVECTOR SampleSurfaceTexture(const Texture& texture, const RayIntersection& hit, FXMVECTOR dir, float coneWidth);
+    // Light arriving at p directly from a randomly picked point on an emissive triangle, reflected
+    // off a diffuse surface. Already weighted for combining with bounces that hit lights.
+    XMVECTOR SampleDirectLighting(FXMVECTOR p, FXMVECTOR normal, FXMVECTOR baseColor, Sampler* sampler, ThreadStats* stats);
+    // The part of SampleDirectLighting before the shadow ray: pick the point on a light, and work out
+    // what it adds if nothing is in the way. False if it can't add anything (the light faces away).
+    struct LightSample
+    {
+        XMFLOAT3 Dir;           // Normalized, from p to the light
+        float Dist;             // Length of the shadow ray
+        XMFLOAT3 Radiance;      // Light reflected towards the path if the shadow ray isn't blocked
+    };
+    bool PickLightSample(FXMVECTOR p, FXMVECTOR normal, FXMVECTOR baseColor, Sampler* sampler, LightSample* sample);
+    // Light emitted back along dir by the surface at a hit. When the ray was a bounce picked with
+    // density dirPdf (0 for camera rays), it's weighted against light sampling having found it.
+    XMVECTOR GetEmission(const RayIntersection& hit, FXMVECTOR dir, float dirPdf);
+    // Russian roulette, past the first few bounces: false to end the path at this depth, otherwise
+    // throughput is scaled up to make up for the paths that were ended
+    bool SurvivesRoulette(int depth, XMVECTOR* throughput, Sampler* sampler);
+    // Cosine weighted direction around normal, from a 2D sample in [0, 1)^2
+    XMVECTOR PickVectorInHemisphere(FXMVECTOR normal, float u, float v);
 
-    // Compute shading for a given point
-    XMVECTOR ComputeRadiance(FXMVECTOR dir, const RayIntersection& intersection, int depth = 0);
-    XMVECTOR PickRandomVectorInHemisphere(FXMVECTOR normal);
-    uint32_t ConvertColorToUint(FXMVECTOR color);
+    //
+    // Wavefront path tracing (see EnableWavefront)
+    //
+
+    // A path in flight, between stages
+    struct WavefrontPath
+    {
+        XMFLOAT3 Start;             // Of the next bounce, and of the shadow ray
+        int Pixel;                  // y * Width + x
+        XMFLOAT3 Dir;
+        float DirPdf;               // As in ComputeRadiance
+        XMFLOAT3 Throughput;
+        float ConeWidth;
+        XMFLOAT3 Radiance;
+        float ConeSpread;
+        XMFLOAT3 ShadowDir;
+        float ShadowDist;           // -1 if there's no shadow ray to trace
+        XMFLOAT3 ShadowRadiance;    // Added to Radiance if the shadow ray isn't blocked
+        RayIntersection Hit;        // What the ray hit. Instance is -1 if it missed.
+    };
+
+    // A ray queued for tracing. Rays are copied out of their paths into queues, so that tracing
+    // and sorting them reads memory in order.
+    struct WavefrontRay
+    {
+        XMFLOAT3 Start;
+        int Path;                   // Index into WavefrontPaths
+        XMFLOAT3 Dir;
+        float MaxDist;
+    };
+
+    // Render one sample for every pixel of the tiles, MaxWavefrontPaths paths at a time
+    void RenderWavefront(const RenderScheduler::Tile* tiles, int numTiles);
+    // The stages. Extending traces each ray to fill in its path's Hit. Shading works through the
+    // paths still going, in order, setting up their shadow rays and next bounces, and sets
+    // PathContinues for each that hasn't ended. Shadow rays that aren't blocked add their light.
+    void ExtendWavefront(const std::vector<WavefrontRay>& rays);
+    void ShadeWavefront(const std::vector<int>& paths, int depth);
+    void TraceWavefrontShadows(const std::vector<WavefrontRay>& rays);
+    // Reorder a queue of rays so that rays leaving from near each other in the same direction
+    // (octant) are next to each other
+    void SortWavefrontRays(std::vector<WavefrontRay>* rays);
+    // Set up a packet from the RayPacketWidth rays of a queue from first on, leaving out any past end
+    static void LoadWavefrontRayPacket(const WavefrontRay* rays, int first, int end, RayPacket* packet);
+    // Call func(first, end, stats) over ranges covering [0, count) across the render threads, with
+    // the thread's stats for counting the work done
+    void RunWavefrontStage(int count, const std::function<void (int first, int end, ThreadStats* stats)>& func);
 
 private:
-    static const int NumBounces = 3;
-    static const int TileSize = 4;
+    // Paths are cut short by Russian roulette from this many bounces on
+    static const int RouletteStartDepth = 3;
 
     // Basic rendering/buffer
-    HWND Window;
+#if defined(_WIN32)
+    HWND Window;        // null when running headless
     HDC BackBufferDC;
+    uint32_t* Pixels;   // DisplayWidth x DisplayHeight
+    std::unique_ptr<uint32_t[]> RenderPixels;   // Resolved at render resolution, when it's lower
+#endif
+    int DisplayWidth;
+    int DisplayHeight;
     int Width;
     int Height;
-    uint32_t* Pixels;
     std::unique_ptr<XMFLOAT4[]> Accum; // RGB + numSamples
+    std::unique_ptr<float[]> AccumLumSq; // Sum of squared sample luminance, for estimating variance
+    uint32_t PassIndex;                 // Passes accumulated since last Clear. Used as the sample index.
+
+    std::unique_ptr<PixelSurface[]> Surfaces;
+
+    // Reprojection writes the new view's buffers here, then swaps them with the current ones
+    bool ReprojectionEnabled;
+    std::unique_ptr<XMFLOAT4[]> ReprojectedAccum;
+    std::unique_ptr<float[]> ReprojectedLumSq;
+    std::unique_ptr<PixelSurface[]> ReprojectedSurfaces;
 
     // For computing eye rays
     float HalfWidth;
@@ -74,46 +446,113 @@ private:
     float hFov;
     float DistToProjPlane;
 
-    // Simple scene as triangles for testing currently
-    std::unique_ptr<XMFLOAT3[]> Vertices;
-    std::unique_ptr<XMFLOAT2[]> TexCoords;
-    int NumVertices; // Must be multiple of 3
-    int NumTriangles;
+    // Scene geometry, as indexed meshes
+    Scene SceneData;
 
-    // Triangle-wide properties
+    // Material properties, one per scene material
     struct SurfaceProp
     {
         XMFLOAT3 Color;
         XMFLOAT3 Emission;
-        int Texture; // -1 means no texture
+        int Texture; // Index into Textures, -1 means no texture
+        float LightPdf; // Density (per unit area) of light sampling picking a point on a triangle with this material. 0 if not emissive.
     };
     std::unique_ptr<SurfaceProp[]> SurfaceProps;
 
-    struct Texture
+    // Emissive triangles (by instance & triangle index) and their materials, and the running
+    // total of their share of the emitted power. The last entry of EmissiveCdf is 1.
+    std::unique_ptr<int[]> EmissiveInstances;
+    std::unique_ptr<int[]> EmissiveTriangles;
+    std::unique_ptr<int[]> EmissiveMaterials;
+    std::unique_ptr<float[]> EmissiveCdf;
+    int NumEmissiveTriangles;
+
+    // Two level acceleration structure. Each model has a BVH over its triangles, in model
+    // space, built once. The instance BVH is over the world space bounds of the instances,
+    // and rays are moved into model space at its leaves to carry on into the model's BVH.
+    // Model BVH leaves are aligned to the packet width, so leaf triangles are found at
+    // TrianglePackets[FirstPacket + node.Offset / TrianglePacketWidth].
+    struct ModelBvh
     {
-        int Width;
-        int Height;
-        std::unique_ptr<uint32_t[]> Pixels;
+        Bvh Hierarchy;
+        int FirstPacket;
     };
+    std::unique_ptr<ModelBvh[]> ModelBvhs;
+    std::unique_ptr<TrianglePacket[]> TrianglePackets;  // For all of the models
+    int NumTrianglePackets;
+    Bvh InstanceBvh;
+    std::unique_ptr<XMFLOAT4X3[]> WorldToModel;         // Inverse instance transforms
+
+    // Refitting models' BVHs
+    bool BvhRestructuringEnabled;
+    std::vector<Aabb> RefitBounds;                      // Scratch space for triangle bounds
+
     std::unique_ptr<Texture[]> Textures;
     int NumTextures;
 
     // Multithreading
-    struct RenderRequest
-    {
-        XMFLOAT4X4 CameraWorld;
-        int minX, maxX;
-        int minY, maxY;
-    };
-
-    Event StartEvent;
-    Event FinishEvent;
-    Event ShutdownEvent;
-    std::unique_ptr<HANDLE[]> Threads;
+    RenderScheduler Scheduler;
     int NumThreads;
-    std::unique_ptr<RenderRequest[]> RenderJobs;
-    volatile long NumRenderJobs;
+    XMFLOAT4X4 PassCameraWorld;     // Camera for the pass currently being rendered
+    std::unique_ptr<ThreadStats[]> Stats;
+
+    // Sampling
+    Sampler::Type SamplerType;
+    uint32_t RandomSeed;
+    bool LightSamplingEnabled;
+    int MaxBounces;
+
+    // Adaptive sampling. The image is split into square tiles, each with an estimate of its
+    // relative error. FLT_MAX until a tile has enough samples to tell.
+    static const int ConvergenceTileSize = 16;
+    static const int MinAdaptiveSamples = 16;
+    float ConvergenceThreshold;
+    int NumConvergenceTilesX;
+    int NumConvergenceTilesY;
+    std::unique_ptr<float[]> TileErrors;
+    std::vector<RenderScheduler::Tile> ActiveTiles;
+
+    // Convergence tiles that have new samples (or need resolving again for some other
+    // reason) since the last Present, which only resolves those
+    std::unique_ptr<bool[]> TileDirty;
+    std::vector<RenderScheduler::Tile> ResolveTiles;
+
+    // Denoising
+    bool DenoiseEnabled;
+    Denoiser ImageDenoiser;
+
+    bool PacketTracingEnabled;
+
+    // Wavefront path tracing. ActivePaths holds the indices of the paths that haven't ended, in
+    // order, and the queues hold their rays to trace next, in the order they're traced.
+    static const int MaxWavefrontPaths = 1 << 18;
+    bool WavefrontEnabled;
+    bool WavefrontSortingEnabled;   // Only turned off to benchmark it
+    std::vector<int> WavefrontPixels;
+    std::vector<WavefrontPath> WavefrontPaths;
+    std::vector<Sampler> WavefrontSamplers;
+    std::vector<int> ActivePaths;
+    std::vector<int> NextActivePaths;
+    std::vector<uint8_t> PathContinues;     // Per entry of ActivePaths
+    std::vector<WavefrontRay> ExtendRays;
+    std::vector<WavefrontRay> ShadowRays;
+    XMFLOAT3 SortOrigin;            // Ray origins are quantized over the scene's bounds for sorting
+    XMFLOAT3 SortScale;
+    std::vector<uint32_t> SortKeys[2];
+    std::vector<WavefrontRay> SortScratch;
+    std::vector<int> SortCounts;
 
-    // Blur
-    bool BlurEnabled;
+#if defined(_WIN32)
+    // Frame time control. The render resolution is the display size scaled by
+    // RenderScaleStep / RenderScaleSteps.
+    static const int RenderScaleSteps = 8;
+    static const int MinRenderScaleStep = 2;
+    static const int MaxPassesPerFrame = 16;
+    double TargetFrameTime;
+    int PassesPerFrame;
+    int RenderScaleStep;
+    int FramesSinceRescale;
+    double SampleCost;      // Smoothed estimate of the seconds each pixel sample adds to a frame
+    double PresentCost;     // And of the seconds spent presenting a frame
+#endif
 };
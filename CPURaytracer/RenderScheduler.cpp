@@ -0,0 +1,312 @@
+#include "Precomp.h"
+#include "RenderScheduler.h"
+#include "Debug.h"
+
+static RenderScheduler::Tile MakeTile(int minX, int minY, int maxX, int maxY)
+{
+    RenderScheduler::Tile tile;
+    tile.MinX = minX;
+    tile.MinY = minY;
+    tile.MaxX = maxX;
+    tile.MaxY = maxY;
+    return tile;
+}
+
+RenderScheduler::RenderScheduler()
+    : ProcessTile(nullptr)
+    , NumWorkers(0)
+    , ShuttingDown(false)
+    , NumSleeping(0)
+    , NumQueuedTiles(0)
+    , NumRemainingPixels(0)
+    , NumSteals(0)
+{
+}
+
+RenderScheduler::~RenderScheduler()
+{
+    Shutdown();
+}
+
+bool RenderScheduler::Start(int numWorkers)
+{
+    assert(numWorkers > 0);
+    assert(!Threads);
+
+    NumWorkers = numWorkers;
+
+    Workers.reset(new Worker[NumWorkers]);
+    if (!Workers)
+    {
+        LogError(L"Failed to allocate scheduler workers.");
+        return false;
+    }
+
+    for (int i = 0; i < NumWorkers; ++i)
+    {
+        Workers[i].NumTiles = 0;
+        Workers[i].RandomState = 0x9E3779B9u * (uint32_t)(i + 1);
+    }
+
+    Threads.reset(new std::thread[NumWorkers]);
+    if (!Threads)
+    {
+        LogError(L"Failed to allocate thread list.");
+        return false;
+    }
+
+    for (int i = 0; i < NumWorkers; ++i)
+    {
+        Threads[i] = std::thread(&RenderScheduler::WorkerThreadProc, this, i);
+    }
+
+    return true;
+}
+
+void RenderScheduler::Shutdown()
+{
+    if (!Threads)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(WorkLock);
+        ShuttingDown = true;
+    }
+    WorkCondition.notify_all();
+
+    for (int i = 0; i < NumWorkers; ++i)
+    {
+        if (Threads[i].joinable())
+        {
+            Threads[i].join();
+        }
+    }
+
+    Threads.reset();
+}
+
+void RenderScheduler::Run(int width, int height, const TileFunc& processTile)
+{
+    assert(Threads);
+
+    if (width <= 0 || height <= 0)
+    {
+        return;
+    }
+
+    // Use the largest tiles that still give every worker a few to start with
+    int tileSize = MaxTileSize;
+    for (;;)
+    {
+        int numTiles = ((width + tileSize - 1) / tileSize) * ((height + tileSize - 1) / tileSize);
+        if (tileSize <= MinTileSize || numTiles >= NumWorkers * 4)
+        {
+            break;
+        }
+        tileSize /= 2;
+    }
+
+    int tilesX = (width + tileSize - 1) / tileSize;
+    int tilesY = (height + tileSize - 1) / tileSize;
+    int numTiles = tilesX * tilesY;
+
+    Tiles.clear();
+    for (int i = 0; i < numTiles; ++i)
+    {
+        int x = (i % tilesX) * tileSize;
+        int y = (i / tilesX) * tileSize;
+        Tiles.push_back(MakeTile(x, y, min(x + tileSize, width), min(y + tileSize, height)));
+    }
+
+    Run(Tiles.data(), numTiles, processTile);
+}
+
+void RenderScheduler::Run(const Tile* tiles, int numTiles, const TileFunc& processTile)
+{
+    assert(Threads);
+
+    if (numTiles <= 0)
+    {
+        return;
+    }
+
+    int64_t numPixels = 0;
+    for (int i = 0; i < numTiles; ++i)
+    {
+        numPixels += (int64_t)(tiles[i].MaxX - tiles[i].MinX) * (tiles[i].MaxY - tiles[i].MinY);
+    }
+    NumRemainingPixels = numPixels;
+
+    // Workers only call this while there are tiles queued, and the previous Run
+    // didn't return until all its calls were finished, so it's safe to swap here
+    ProcessTile = &processTile;
+
+    // Hand each worker a contiguous run of tiles. Neighboring tiles tend to touch
+    // the same parts of the scene, so this keeps each thread's working set smaller.
+    for (int i = 0; i < numTiles; ++i)
+    {
+        int worker = (int)((int64_t)i * NumWorkers / numTiles);
+        PushTile(worker, tiles[i]);
+    }
+
+    std::unique_lock<std::mutex> lock(WorkLock);
+    WorkCondition.notify_all();
+    FinishCondition.wait(lock, [this]() { return NumRemainingPixels == 0; });
+}
+
+void RenderScheduler::WorkerThreadProc(int worker)
+{
+    for (;;)
+    {
+        {
+            // Sleep until there's something to do. NumSleeping is raised before checking
+            // for tiles, so a worker queueing tiles either sees us and wakes us, or we see its tiles.
+            std::unique_lock<std::mutex> lock(WorkLock);
+            ++NumSleeping;
+            WorkCondition.wait(lock, [this]() { return ShuttingDown || NumQueuedTiles > 0; });
+            --NumSleeping;
+
+            if (ShuttingDown)
+            {
+                break;
+            }
+        }
+
+        Tile tile;
+        while (GetTile(worker, &tile) || StealTile(worker, &tile))
+        {
+            SplitTile(worker, &tile);
+            (*ProcessTile)(worker, tile);
+
+            int64_t numPixels = (int64_t)(tile.MaxX - tile.MinX) * (tile.MaxY - tile.MinY);
+            if ((NumRemainingPixels -= numPixels) == 0)
+            {
+                // Was the last tile of the frame, signal finish
+                std::lock_guard<std::mutex> lock(WorkLock);
+                FinishCondition.notify_one();
+            }
+        }
+    }
+}
+
+bool RenderScheduler::GetTile(int worker, Tile* tile)
+{
+    Worker& self = Workers[worker];
+    if (self.NumTiles == 0)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(self.Lock);
+    if (self.Tiles.empty())
+    {
+        return false;
+    }
+
+    *tile = self.Tiles.front();
+    self.Tiles.pop_front();
+    --self.NumTiles;
+    --NumQueuedTiles;
+    return true;
+}
+
+bool RenderScheduler::StealTile(int worker, Tile* tile)
+{
+    Worker& self = Workers[worker];
+
+    // Start looking at a random worker, so thieves don't all pile onto the same victim
+    uint32_t random = self.RandomState;
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    self.RandomState = random;
+
+    int start = (int)(random % (uint32_t)NumWorkers);
+    for (int i = 0; i < NumWorkers; ++i)
+    {
+        int victim = (start + i) % NumWorkers;
+        Worker& other = Workers[victim];
+        if (victim == worker || other.NumTiles == 0)
+        {
+            continue;
+        }
+
+        // Take from the back, the opposite end from where the owner is working
+        std::lock_guard<std::mutex> lock(other.Lock);
+        if (other.Tiles.empty())
+        {
+            continue;
+        }
+
+        *tile = other.Tiles.back();
+        other.Tiles.pop_back();
+        --other.NumTiles;
+        --NumQueuedTiles;
+        ++NumSteals;
+        return true;
+    }
+
+    return false;
+}
+
+void RenderScheduler::PushTile(int worker, const Tile& tile)
+{
+    Worker& self = Workers[worker];
+
+    std::lock_guard<std::mutex> lock(self.Lock);
+    self.Tiles.push_back(tile);
+    ++self.NumTiles;
+    ++NumQueuedTiles;
+}
+
+void RenderScheduler::SplitTile(int worker, Tile* tile)
+{
+    // Only split once this worker has run dry. Until then, there's enough work
+    // around that keeping tiles large (and cheap to schedule) is the better deal.
+    if (Workers[worker].NumTiles > 0)
+    {
+        return;
+    }
+
+    int width = tile->MaxX - tile->MinX;
+    int height = tile->MaxY - tile->MinY;
+    int midX = width > MinTileSize ? tile->MinX + width / 2 : tile->MaxX;
+    int midY = height > MinTileSize ? tile->MinY + height / 2 : tile->MaxY;
+    if (midX == tile->MaxX && midY == tile->MaxY)
+    {
+        return;
+    }
+
+    // Keep the top left piece, and queue the rest where they can be stolen
+    int numPieces = 0;
+    if (midX < tile->MaxX)
+    {
+        PushTile(worker, MakeTile(midX, tile->MinY, tile->MaxX, midY));
+        ++numPieces;
+    }
+    if (midY < tile->MaxY)
+    {
+        PushTile(worker, MakeTile(tile->MinX, midY, midX, tile->MaxY));
+        ++numPieces;
+    }
+    if (midX < tile->MaxX && midY < tile->MaxY)
+    {
+        PushTile(worker, MakeTile(midX, midY, tile->MaxX, tile->MaxY));
+        ++numPieces;
+    }
+
+    tile->MaxX = midX;
+    tile->MaxY = midY;
+
+    // Wake up to one idle worker per new piece
+    if (NumSleeping > 0)
+    {
+        std::lock_guard<std::mutex> lock(WorkLock);
+        for (int i = 0; i < numPieces; ++i)
+        {
+            WorkCondition.notify_one();
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+/// Spreads the tiles of an image across a pool of worker threads.
+/// Each worker has its own deque of tiles, seeded with a contiguous block of
+/// large tiles. Workers take from the front of their own deque and, once it's
+/// empty, steal from the back of someone else's. When a worker picks up its last
+/// tile it splits it into quadrants so the tail end of the frame balances out.
+/// Workers with nothing to do sleep until more tiles are queued.
+class RenderScheduler
+{
+public:
+    struct Tile
+    {
+        int MinX, MinY;
+        int MaxX, MaxY;     // Exclusive
+    };
+
+    // Called on a worker thread for each tile. worker is in [0, numWorkers).
+    typedef std::function<void (int worker, const Tile& tile)> TileFunc;
+
+    RenderScheduler();
+    ~RenderScheduler();
+
+    bool Start(int numWorkers);
+    void Shutdown();
+
+    int GetNumWorkers() const { return NumWorkers; }
+
+    // Call processTile on tiles covering every pixel of a width x height image exactly once.
+    // Blocks until done.
+    void Run(int width, int height, const TileFunc& processTile);
+
+    // Same, but covering just the pixels of the given (non overlapping) tiles
+    void Run(const Tile* tiles, int numTiles, const TileFunc& processTile);
+
+    // Number of tiles taken from another worker's deque, since Start
+    int64_t GetNumSteals() const { return NumSteals; }
+
+    // Smallest tile that will be split further, and the largest tile handed out
+    static const int MinTileSize = 8;
+    static const int MaxTileSize = 64;
+
+private:
+    // Don't allow copy
+    RenderScheduler(const RenderScheduler&);
+    RenderScheduler& operator= (const RenderScheduler&);
+
+    struct Worker
+    {
+        std::mutex Lock;
+        std::deque<Tile> Tiles;
+        std::atomic<int> NumTiles;  // Readable without the lock, so thieves can skip empty deques
+        uint32_t RandomState;       // For picking steal victims
+    };
+
+    void WorkerThreadProc(int worker);
+    bool GetTile(int worker, Tile* tile);
+    bool StealTile(int worker, Tile* tile);
+    void PushTile(int worker, const Tile& tile);
+    void SplitTile(int worker, Tile* tile);
+
+private:
+    const TileFunc* ProcessTile;   // For the Run in progress
+    std::vector<Tile> Tiles;    // Scratch space for building a frame's tiles
+    std::unique_ptr<Worker[]> Workers;
+    std::unique_ptr<std::thread[]> Threads;
+    int NumWorkers;
+
+    // Sleeping workers wait on WorkCondition until tiles are queued. The worker that
+    // finishes the last pixel of a frame signals FinishCondition.
+    std::mutex WorkLock;
+    std::condition_variable WorkCondition;
+    std::condition_variable FinishCondition;
+    bool ShuttingDown;
+    std::atomic<int> NumSleeping;
+    std::atomic<int> NumQueuedTiles;
+    std::atomic<int64_t> NumRemainingPixels;
+    std::atomic<int64_t> NumSteals;
+};
@@ -0,0 +1,211 @@
+#include "Precomp.h"
+#include "Resolve.h"
+
+// Averages of the 4 pixels of a row starting at x, as SoA: r, g and b each hold
+// one channel of the 4 pixels. Pixels past the end of the row repeat the last one.
+static inline void LoadAverages(const XMFLOAT4* row, int x, int width, XMVECTOR* r, XMVECTOR* g, XMVECTOR* b)
+{
+    XMMATRIX pixels;
+    if (x + 4 <= width)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            pixels.r[i] = XMLoadFloat4(&row[x + i]);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            pixels.r[i] = XMLoadFloat4(&row[min(x + i, width - 1)]);
+        }
+    }
+
+    pixels = XMMatrixTranspose(pixels);
+
+    // Pixels without samples yet stay black. The estimate is plenty for 8 bit output.
+    XMVECTOR invCount = XMVectorReciprocalEst(XMVectorMax(pixels.r[3], XMVectorSplatOne()));
+    *r = XMVectorMultiply(pixels.r[0], invCount);
+    *g = XMVectorMultiply(pixels.r[1], invCount);
+    *b = XMVectorMultiply(pixels.r[2], invCount);
+}
+
+// Square root from the reciprocal square root estimate. Good to about 12 bits, and much
+// faster than a full square root. x must be positive.
+static inline XMVECTOR SqrtEst(FXMVECTOR x)
+{
+    return XMVectorMultiply(x, XMVectorReciprocalSqrtEst(x));
+}
+
+// Linear to sRGB curve for values in [0, 1]. The power segment is fit with square roots,
+// which are much cheaper than pow and within an 8 bit step of the real curve.
+static inline XMVECTOR LinearToSrgb(FXMVECTOR c)
+{
+    // Below the power segment, the value doesn't matter (the linear segment is picked), but keep it finite
+    XMVECTOR s1 = SqrtEst(XMVectorMax(c, XMVectorReplicate(0.0001f)));
+    XMVECTOR s2 = SqrtEst(s1);
+    XMVECTOR s3 = SqrtEst(s2);
+    XMVECTOR curve = XMVectorMultiply(s1, XMVectorReplicate(0.585122381f));
+    curve = XMVectorMultiplyAdd(s2, XMVectorReplicate(0.783140355f), curve);
+    curve = XMVectorMultiplyAdd(s3, XMVectorReplicate(-0.368262736f), curve);
+
+    XMVECTOR linear = XMVectorMultiply(c, XMVectorReplicate(12.92f));
+    return XMVectorSelect(curve, linear, XMVectorLess(c, XMVectorReplicate(0.0031308f)));
+}
+
+// Tonemap and sRGB encode one channel of 4 pixels, as whole numbers in [0, 255]
+static inline XMVECTOR EncodeChannel(FXMVECTOR c)
+{
+    // Reinhard, to bring unbounded radiance (the light itself is well above 1) into [0, 1)
+    XMVECTOR mapped = XMVectorMultiply(c, XMVectorReciprocalEst(XMVectorAdd(c, XMVectorSplatOne())));
+    XMVECTOR encoded = XMVectorSaturate(LinearToSrgb(mapped));
+    return XMVectorTruncate(XMVectorMultiplyAdd(encoded, XMVectorReplicate(255.f), XMVectorReplicate(0.5f)));
+}
+
+// Encode 4 pixels and store the first count of them (up to 4) to a row of pixels at x
+static inline void StorePixels(FXMVECTOR r, FXMVECTOR g, FXMVECTOR b, uint32_t* row, int x, int count)
+{
+    static const XMVECTORU32 Alpha = { 0xFF000000, 0xFF000000, 0xFF000000, 0xFF000000 };
+
+    // Channels are whole numbers up to 255, so packing them with float math is exact
+    XMVECTOR packed = XMVectorMultiply(EncodeChannel(r), XMVectorReplicate(65536.f));
+    packed = XMVectorMultiplyAdd(EncodeChannel(g), XMVectorReplicate(256.f), packed);
+    packed = XMVectorAdd(EncodeChannel(b), packed);
+    XMVECTOR colors = XMVectorOrInt(XMConvertVectorFloatToUInt(packed, 0), Alpha);
+
+    if (count >= 4)
+    {
+        XMStoreInt4(&row[x], colors);
+    }
+    else
+    {
+        uint32_t lastColors[4];
+        XMStoreInt4(lastColors, colors);
+        for (int i = 0; i < count; ++i)
+        {
+            row[x + i] = lastColors[i];
+        }
+    }
+}
+
+void ResolveTile(const XMFLOAT4* accum, int width, int minX, int minY, int maxX, int maxY, uint32_t* pixels)
+{
+    for (int y = minY; y < maxY; ++y)
+    {
+        const XMFLOAT4* row = &accum[y * width];
+        for (int x = minX; x < maxX; x += 4)
+        {
+            XMVECTOR r, g, b;
+            LoadAverages(row, x, width, &r, &g, &b);
+            StorePixels(r, g, b, &pixels[y * width], x, maxX - x);
+        }
+    }
+}
+
+void ResolvePlanesTile(const float* r, const float* g, const float* b, int width,
+    int minX, int minY, int maxX, int maxY, uint32_t* pixels)
+{
+    for (int y = minY; y < maxY; ++y)
+    {
+        int row = y * width;
+        for (int x = minX; x < maxX; x += 4)
+        {
+            if (x + 4 <= width)
+            {
+                StorePixels(XMLoadFloat4((const XMFLOAT4*)&r[row + x]), XMLoadFloat4((const XMFLOAT4*)&g[row + x]),
+                    XMLoadFloat4((const XMFLOAT4*)&b[row + x]), &pixels[row], x, maxX - x);
+                continue;
+            }
+
+            // The end of a row, where a whole vector would read past the planes
+            XMFLOAT4 lastR(0.f, 0.f, 0.f, 0.f);
+            XMFLOAT4 lastG(0.f, 0.f, 0.f, 0.f);
+            XMFLOAT4 lastB(0.f, 0.f, 0.f, 0.f);
+            for (int i = 0; i < width - x; ++i)
+            {
+                (&lastR.x)[i] = r[row + x + i];
+                (&lastG.x)[i] = g[row + x + i];
+                (&lastB.x)[i] = b[row + x + i];
+            }
+            StorePixels(XMLoadFloat4(&lastR), XMLoadFloat4(&lastG), XMLoadFloat4(&lastB), &pixels[row], x, maxX - x);
+        }
+    }
+}
+
+// One channel of 4 packed colors, as floats in [0, 255]
+static inline XMVECTOR UnpackChannel(FXMVECTOR colors, int shift)
+{
+    return XMConvertVectorIntToFloat(XMVectorAndInt(colors, XMVectorReplicateInt(0xFFu << shift)), shift);
+}
+
+// Bilinear blend of one channel of 4 pixels from the 4 texels around each
+static inline XMVECTOR BlendChannel(FXMVECTOR c00, FXMVECTOR c10, FXMVECTOR c01, GXMVECTOR c11,
+    int shift, HXMVECTOR tx, HXMVECTOR ty)
+{
+    XMVECTOR top = XMVectorLerpV(UnpackChannel(c00, shift), UnpackChannel(c10, shift), tx);
+    XMVECTOR bottom = XMVectorLerpV(UnpackChannel(c01, shift), UnpackChannel(c11, shift), tx);
+    return XMVectorLerpV(top, bottom, ty);
+}
+
+void UpscaleTile(const uint32_t* src, int width, int height, uint32_t* dest, int destWidth, int destHeight,
+    int minX, int minY, int maxX, int maxY)
+{
+    static const XMVECTORU32 Alpha = { 0xFF000000, 0xFF000000, 0xFF000000, 0xFF000000 };
+
+    float scaleX = (float)width / (float)destWidth;
+    float scaleY = (float)height / (float)destHeight;
+    XMVECTOR lastX = XMVectorReplicate((float)(width - 1));
+
+    for (int y = minY; y < maxY; ++y)
+    {
+        // Source texel centers are at half texels. Past the edges, the edge texels are repeated.
+        float sy = min(max(((float)y + 0.5f) * scaleY - 0.5f, 0.f), (float)(height - 1));
+        int y0 = (int)sy;
+        int y1 = min(y0 + 1, height - 1);
+        XMVECTOR ty = XMVectorReplicate(sy - (float)y0);
+        const uint32_t* row0 = &src[y0 * width];
+        const uint32_t* row1 = &src[y1 * width];
+
+        for (int x = minX; x < maxX; x += 4)
+        {
+            XMVECTOR sx = XMVectorAdd(XMVectorReplicate((float)x), XMVectorSet(0.5f, 1.5f, 2.5f, 3.5f));
+            sx = XMVectorClamp(XMVectorSubtract(XMVectorMultiply(sx, XMVectorReplicate(scaleX)), XMVectorReplicate(0.5f)),
+                XMVectorZero(), lastX);
+            XMVECTOR fx = XMVectorFloor(sx);
+            XMVECTOR tx = XMVectorSubtract(sx, fx);
+
+            uint32_t x0[4], x1[4];
+            XMStoreInt4(x0, XMConvertVectorFloatToUInt(fx, 0));
+            XMStoreInt4(x1, XMConvertVectorFloatToUInt(XMVectorMin(XMVectorAdd(fx, XMVectorSplatOne()), lastX), 0));
+
+            XMVECTOR c00 = XMVectorSetInt(row0[x0[0]], row0[x0[1]], row0[x0[2]], row0[x0[3]]);
+            XMVECTOR c10 = XMVectorSetInt(row0[x1[0]], row0[x1[1]], row0[x1[2]], row0[x1[3]]);
+            XMVECTOR c01 = XMVectorSetInt(row1[x0[0]], row1[x0[1]], row1[x0[2]], row1[x0[3]]);
+            XMVECTOR c11 = XMVectorSetInt(row1[x1[0]], row1[x1[1]], row1[x1[2]], row1[x1[3]]);
+
+            // Channels stay whole numbers up to 255 after rounding, so packing them with float math is exact
+            XMVECTOR half = XMVectorReplicate(0.5f);
+            XMVECTOR packed = XMVectorMultiply(XMVectorTruncate(XMVectorAdd(BlendChannel(c00, c10, c01, c11, 16, tx, ty), half)),
+                XMVectorReplicate(65536.f));
+            packed = XMVectorMultiplyAdd(XMVectorTruncate(XMVectorAdd(BlendChannel(c00, c10, c01, c11, 8, tx, ty), half)),
+                XMVectorReplicate(256.f), packed);
+            packed = XMVectorAdd(XMVectorTruncate(XMVectorAdd(BlendChannel(c00, c10, c01, c11, 0, tx, ty), half)), packed);
+            XMVECTOR colors = XMVectorOrInt(XMConvertVectorFloatToUInt(packed, 0), Alpha);
+
+            uint32_t* row = &dest[y * destWidth];
+            if (x + 4 <= maxX)
+            {
+                XMStoreInt4(&row[x], colors);
+            }
+            else
+            {
+                uint32_t lastColors[4];
+                XMStoreInt4(lastColors, colors);
+                for (int i = 0; i < maxX - x; ++i)
+                {
+                    row[x + i] = lastColors[i];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+// Turn the pixels [minX, maxX) x [minY, maxY) of an accumulation buffer (RGB sums + sample
+// count) into displayable 0xAARRGGBB colors: average the samples, tonemap, sRGB encode and pack.
+// pixels is width x height, like accum. Works on 4 pixels at a time, and only touches the given
+// rectangle, so separate tiles can be resolved on separate threads.
+void ResolveTile(const XMFLOAT4* accum, int width, int minX, int minY, int maxX, int maxY, uint32_t* pixels);
+
+// The same for an image that's already averaged (the denoiser's output), stored as separate
+// width x height planes of red, green and blue
+void ResolvePlanesTile(const float* r, const float* g, const float* b, int width,
+    int minX, int minY, int maxX, int maxY, uint32_t* pixels);
+
+// Scale a width x height image of packed colors to destWidth x destHeight with bilinear filtering,
+// writing the pixels [minX, maxX) x [minY, maxY) of dest. For showing an image rendered at a lower
+// resolution in the window. Works on 4 pixels at a time, like the resolves.
+void UpscaleTile(const uint32_t* src, int width, int height, uint32_t* dest, int destWidth, int destHeight,
+    int minX, int minY, int maxX, int maxY);
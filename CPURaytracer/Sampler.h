@@ -0,0 +1,145 @@
+#pragma once
+
+// Integer hash with good avalanche, used to derive seeds
+inline uint32_t HashUint(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+inline uint32_t ReverseBits(uint32_t x)
+{
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+    x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+// Map 32 random bits to a float in [0, 1)
+inline float UintToUnitFloat(uint32_t x)
+{
+    return (x >> 8) * (1.f / 16777216.f);
+}
+
+/// PCG32 (XSH RR) random number generator. Small, fast, and statistically
+/// solid. Each instance is independent, so every thread (or pixel) can own one.
+class Pcg32
+{
+public:
+    Pcg32(uint64_t seed, uint64_t stream)
+        : State(0)
+        , Increment((stream << 1) | 1)
+    {
+        NextUint();
+        State += seed;
+        NextUint();
+    }
+
+    uint32_t NextUint()
+    {
+        uint64_t old = State;
+        State = old * 6364136223846793005ull + Increment;
+        uint32_t xorShifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+        uint32_t rotate = (uint32_t)(old >> 59);
+        return (xorShifted >> rotate) | (xorShifted << ((32 - rotate) & 31));
+    }
+
+    // Uniform in [0, 1)
+    float NextFloat() { return UintToUnitFloat(NextUint()); }
+
+private:
+    uint64_t State;
+    uint64_t Increment;
+};
+
+/// Random numbers for a single sample of a single pixel. Seeded from the pixel
+/// and sample index, so the image doesn't depend on which thread rendered what.
+///
+/// With the Sobol type, 2D samples come from a 2D Sobol sequence indexed by the
+/// sample number, with hash based Owen scrambling (Burley 2020). Each dimension
+/// pair is shuffled and scrambled independently, so there's no limit on the number
+/// of dimensions. Successive samples of a pixel then stratify each bounce nicely,
+/// instead of clumping like independent random numbers do.
+class Sampler
+{
+public:
+    enum Type
+    {
+        Random,
+        Sobol
+    };
+
+    Sampler(Type type, uint32_t pixel, uint32_t sampleIndex, uint32_t seed)
+        : SamplerType(type)
+        , Rng(((uint64_t)sampleIndex << 32) | pixel, HashUint(pixel ^ HashUint(seed)))
+        , PixelSeed(HashUint(pixel + HashUint(seed)))
+        , SampleIndex(sampleIndex)
+        , Dimension(0)
+    {
+    }
+
+    // Uniform in [0, 1). Always independent random numbers.
+    float Next1D() { return Rng.NextFloat(); }
+
+    // Next pair of dimensions, uniform in [0, 1)^2
+    void Next2D(float* u, float* v)
+    {
+        if (SamplerType == Random)
+        {
+            *u = Rng.NextFloat();
+            *v = Rng.NextFloat();
+            return;
+        }
+
+        uint32_t dimensionSeed = HashUint(PixelSeed + Dimension);
+        ++Dimension;
+
+        uint32_t index = NestedUniformScramble(SampleIndex, dimensionSeed);
+        *u = UintToUnitFloat(NestedUniformScramble(ReverseBits(index), HashUint(dimensionSeed ^ 0xa511e9b3u)));
+        *v = UintToUnitFloat(NestedUniformScramble(SobolDimension1(index), HashUint(dimensionSeed ^ 0x63d83595u)));
+    }
+
+private:
+    // Second dimension of the Sobol sequence (the first is just the reversed bits of the index)
+    static uint32_t SobolDimension1(uint32_t index)
+    {
+        uint32_t result = 0;
+        for (uint32_t v = 1u << 31; index != 0; index >>= 1, v ^= v >> 1)
+        {
+            if (index & 1)
+            {
+                result ^= v;
+            }
+        }
+        return result;
+    }
+
+    // Laine-Karras style hash, which only lets bits affect bits above them
+    static uint32_t LaineKarrasPermutation(uint32_t x, uint32_t seed)
+    {
+        x += seed;
+        x ^= x * 0x6c50b47cu;
+        x ^= x * 0xb82f1e52u;
+        x ^= x * 0xc7afe638u;
+        x ^= x * 0x8d22f6e6u;
+        return x;
+    }
+
+    // Owen scrambling: randomly flips subtrees of the binary digits, from the top down
+    static uint32_t NestedUniformScramble(uint32_t x, uint32_t seed)
+    {
+        return ReverseBits(LaineKarrasPermutation(ReverseBits(x), seed));
+    }
+
+private:
+    Type SamplerType;
+    Pcg32 Rng;
+    uint32_t PixelSeed;
+    uint32_t SampleIndex;
+    uint32_t Dimension;
+};
@@ -0,0 +1,248 @@
+#include "Precomp.h"
+#include "Scene.h"
+#include "Debug.h"
+
+Scene::Scene()
+{
+}
+
+void Scene::Clear()
+{
+    Positions.clear();
+    TexCoords.clear();
+    Indices.clear();
+    Meshes.clear();
+    Materials.clear();
+    TextureNames.clear();
+    Models.clear();
+    Instances.clear();
+}
+
+void Scene::Reserve(int numVertices, int numTriangles)
+{
+    Positions.reserve(numVertices);
+    TexCoords.reserve(numVertices);
+    Indices.reserve((size_t)numTriangles * 3);
+}
+
+void Scene::ShrinkToFit()
+{
+    Positions.shrink_to_fit();
+    TexCoords.shrink_to_fit();
+    Indices.shrink_to_fit();
+    Meshes.shrink_to_fit();
+}
+
+int Scene::AddMaterial(const XMFLOAT3& color, const XMFLOAT3& emission, int texture)
+{
+    Material material;
+    material.Color = color;
+    material.Emission = emission;
+    material.Texture = texture;
+    Materials.push_back(material);
+    return (int)Materials.size() - 1;
+}
+
+int Scene::AddTexture(const char* filename)
+{
+    for (int i = 0; i < (int)TextureNames.size(); ++i)
+    {
+        if (TextureNames[i] == filename)
+        {
+            return i;
+        }
+    }
+
+    TextureNames.push_back(filename);
+    return (int)TextureNames.size() - 1;
+}
+
+void Scene::SetMaterial(int material)
+{
+    assert(material >= 0 && material < (int)Materials.size());
+
+    if (!Meshes.empty())
+    {
+        Mesh& last = Meshes.back();
+        if (last.Material == material)
+        {
+            return;
+        }
+
+        // Nothing was added with the previous material, so just replace it
+        if (last.NumTriangles == 0)
+        {
+            last.Material = material;
+            return;
+        }
+    }
+
+    Mesh mesh;
+    mesh.FirstTriangle = GetNumTriangles();
+    mesh.NumTriangles = 0;
+    mesh.Material = material;
+    Meshes.push_back(mesh);
+}
+
+int Scene::AddVertex(const XMFLOAT3& position, const XMFLOAT2& texCoord)
+{
+    Positions.push_back(position);
+    TexCoords.push_back(texCoord);
+    return (int)Positions.size() - 1;
+}
+
+void Scene::AddTriangle(uint32_t a, uint32_t b, uint32_t c)
+{
+    assert(!Meshes.empty());
+    assert(a < Positions.size() && b < Positions.size() && c < Positions.size());
+
+    Indices.push_back(a);
+    Indices.push_back(b);
+    Indices.push_back(c);
+    ++Meshes.back().NumTriangles;
+}
+
+// Mix the bits of a vertex into a hash. Identical vertices have identical bits,
+// which is all welding needs (-0 and 0 aren't merged, but that's harmless).
+static uint32_t HashVertex(const XMFLOAT3& position, const XMFLOAT2& texCoord)
+{
+    uint32_t words[5];
+    memcpy(&words[0], &position, sizeof(position));
+    memcpy(&words[3], &texCoord, sizeof(texCoord));
+
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < 5; ++i)
+    {
+        hash = (hash ^ words[i]) * 16777619u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+bool Scene::WeldVertices(int firstVertex, int firstTriangle)
+{
+    int numVertices = GetNumVertices() - firstVertex;
+    if (numVertices <= 0)
+    {
+        return true;
+    }
+
+    // Open addressing table of unique vertices (relative to firstVertex), at most half full
+    uint32_t tableSize = 1;
+    while (tableSize < (uint32_t)numVertices * 2)
+    {
+        tableSize *= 2;
+    }
+
+    std::unique_ptr<int[]> table(new int[tableSize]);
+    std::unique_ptr<uint32_t[]> remap(new uint32_t[numVertices]);
+    if (!table || !remap)
+    {
+        LogError(L"Failed to allocate vertex welding tables.");
+        return false;
+    }
+    for (uint32_t i = 0; i < tableSize; ++i)
+    {
+        table[i] = -1;
+    }
+
+    // Unique vertices are packed down in place, in the order they're first seen
+    int numUnique = 0;
+    for (int i = 0; i < numVertices; ++i)
+    {
+        XMFLOAT3 position = Positions[firstVertex + i];
+        XMFLOAT2 texCoord = TexCoords[firstVertex + i];
+
+        for (uint32_t slot = HashVertex(position, texCoord) & (tableSize - 1); ; slot = (slot + 1) & (tableSize - 1))
+        {
+            int existing = table[slot];
+            if (existing < 0)
+            {
+                table[slot] = numUnique;
+                Positions[firstVertex + numUnique] = position;
+                TexCoords[firstVertex + numUnique] = texCoord;
+                remap[i] = firstVertex + numUnique;
+                ++numUnique;
+                break;
+            }
+
+            if (memcmp(&Positions[firstVertex + existing], &position, sizeof(position)) == 0 &&
+                memcmp(&TexCoords[firstVertex + existing], &texCoord, sizeof(texCoord)) == 0)
+            {
+                remap[i] = firstVertex + existing;
+                break;
+            }
+        }
+    }
+
+    for (size_t i = (size_t)firstTriangle * 3; i < Indices.size(); ++i)
+    {
+        if (Indices[i] >= (uint32_t)firstVertex)
+        {
+            Indices[i] = remap[Indices[i] - firstVertex];
+        }
+    }
+
+    Positions.resize(firstVertex + numUnique);
+    TexCoords.resize(firstVertex + numUnique);
+    return true;
+}
+
+int Scene::AddModel(int firstTriangle, int numTriangles)
+{
+    assert(firstTriangle >= 0 && numTriangles >= 0 && firstTriangle + numTriangles <= GetNumTriangles());
+
+    Model model;
+    model.FirstTriangle = firstTriangle;
+    model.NumTriangles = numTriangles;
+    Models.push_back(model);
+    return (int)Models.size() - 1;
+}
+
+int Scene::AddInstance(int model, FXMMATRIX transform, int material)
+{
+    assert(model >= 0 && model < (int)Models.size());
+    assert(material < (int)Materials.size());
+
+    Instance instance;
+    XMStoreFloat4x3(&instance.Transform, transform);
+    instance.Model = model;
+    instance.Material = material;
+    Instances.push_back(instance);
+    return (int)Instances.size() - 1;
+}
+
+void Scene::SetInstanceTransform(int instance, FXMMATRIX transform)
+{
+    XMStoreFloat4x3(&Instances[instance].Transform, transform);
+}
+
+int Scene::GetTriangleMesh(int triangle) const
+{
+    assert(triangle >= 0 && triangle < GetNumTriangles());
+
+    // The triangle's mesh is the last one starting at or before it
+    auto mesh = std::upper_bound(Meshes.begin(), Meshes.end(), triangle,
+        [](int t, const Mesh& m) { return t < m.FirstTriangle; });
+    return (int)(mesh - Meshes.begin()) - 1;
+}
+
+int64_t Scene::GetNumInstancedTriangles() const
+{
+    int64_t numTriangles = 0;
+    for (size_t i = 0; i < Instances.size(); ++i)
+    {
+        numTriangles += Models[Instances[i].Model].NumTriangles;
+    }
+    return numTriangles;
+}
+
+size_t Scene::GetMemoryUsage() const
+{
+    return Positions.capacity() * sizeof(XMFLOAT3) +
+        TexCoords.capacity() * sizeof(XMFLOAT2) +
+        Indices.capacity() * sizeof(uint32_t) +
+        Meshes.capacity() * sizeof(Mesh) +
+        Materials.capacity() * sizeof(Material) +
+        Models.capacity() * sizeof(Model) +
+        Instances.capacity() * sizeof(Instance);
+}
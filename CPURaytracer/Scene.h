@@ -0,0 +1,129 @@
+#pragma once
+
+/// Scene geometry as indexed triangle meshes. Each vertex is stored once and shared,
+/// through 32 bit indices, by every triangle that uses it. Triangles are grouped into
+/// meshes: consecutive runs of triangles that use the same material. Materials are
+/// only referenced per mesh, so there's no per triangle data besides the indices.
+///
+/// Geometry isn't rendered directly. Ranges of triangles are made into models, and
+/// models are placed in the world by instances, each with its own transform. A model
+/// can be instanced any number of times while its triangles are only stored once.
+class Scene
+{
+public:
+    struct Material
+    {
+        XMFLOAT3 Color;
+        XMFLOAT3 Emission;
+        int Texture;            // Index into the texture file names, -1 for none
+    };
+
+    struct Mesh
+    {
+        int FirstTriangle;
+        int NumTriangles;
+        int Material;
+    };
+
+    // Triangles in their own model space, for instancing
+    struct Model
+    {
+        int FirstTriangle;
+        int NumTriangles;
+    };
+
+    struct Instance
+    {
+        XMFLOAT4X3 Transform;   // Model to world, 3x4 affine (the rows are the x, y & z axes, then the translation)
+        int Model;
+        int Material;           // Used for all of the model's triangles when >= 0, instead of their own materials
+    };
+
+    Scene();
+
+    void Clear();
+
+    // Make room up front when the final sizes are known (or can be estimated), so that
+    // loading large scenes doesn't keep regrowing the arrays. Sizes are totals, not extra.
+    void Reserve(int numVertices, int numTriangles);
+
+    // Release spare capacity left over from reserving or welding
+    void ShrinkToFit();
+
+    int AddMaterial(const XMFLOAT3& color, const XMFLOAT3& emission, int texture = -1);
+
+    // Texture file names are only recorded, not loaded. Adding the same name twice
+    // returns the existing index.
+    int AddTexture(const char* filename);
+
+    // Triangles added from here on use material
+    void SetMaterial(int material);
+
+    int AddVertex(const XMFLOAT3& position, const XMFLOAT2& texCoord);
+    void AddTriangle(uint32_t a, uint32_t b, uint32_t c);
+
+    // Merge vertices from firstVertex on that have identical positions and texture
+    // coordinates, and point the triangles from firstTriangle on at the merged ones.
+    bool WeldVertices(int firstVertex, int firstTriangle);
+
+    int AddModel(int firstTriangle, int numTriangles);
+
+    // Place a model in the world. Transforms must be affine and shouldn't mirror, or the
+    // model is turned inside out (only front faces are hit, and mirroring flips them).
+    int AddInstance(int model, FXMMATRIX transform, int material = -1);
+    void SetInstanceTransform(int instance, FXMMATRIX transform);
+
+    // Move a vertex, for animating models
+    void SetPosition(int vertex, const XMFLOAT3& position) { Positions[vertex] = position; }
+
+    int GetNumVertices() const { return (int)Positions.size(); }
+    int GetNumTriangles() const { return (int)Indices.size() / 3; }
+    int GetNumMeshes() const { return (int)Meshes.size(); }
+    int GetNumMaterials() const { return (int)Materials.size(); }
+    int GetNumTextures() const { return (int)TextureNames.size(); }
+    int GetNumModels() const { return (int)Models.size(); }
+    int GetNumInstances() const { return (int)Instances.size(); }
+
+    const XMFLOAT3* GetPositions() const { return Positions.data(); }
+    const XMFLOAT2* GetTexCoords() const { return TexCoords.data(); }
+    const uint32_t* GetIndices() const { return Indices.data(); }
+    const Mesh& GetMesh(int mesh) const { return Meshes[mesh]; }
+    const Material& GetMaterial(int material) const { return Materials[material]; }
+    const char* GetTextureName(int texture) const { return TextureNames[texture].c_str(); }
+    const Model& GetModel(int model) const { return Models[model]; }
+    const Instance& GetInstance(int instance) const { return Instances[instance]; }
+
+    // Corners of a triangle
+    void GetTriangle(int triangle, XMVECTOR* a, XMVECTOR* b, XMVECTOR* c) const
+    {
+        const uint32_t* indices = &Indices[triangle * 3];
+        *a = XMLoadFloat3(&Positions[indices[0]]);
+        *b = XMLoadFloat3(&Positions[indices[1]]);
+        *c = XMLoadFloat3(&Positions[indices[2]]);
+    }
+
+    // Mesh a triangle belongs to, and its material
+    int GetTriangleMesh(int triangle) const;
+    int GetTriangleMaterial(int triangle) const { return Meshes[GetTriangleMesh(triangle)].Material; }
+
+    // Triangles drawn by all of the instances together
+    int64_t GetNumInstancedTriangles() const;
+
+    // Bytes used by the geometry, mesh, model and instance tables
+    size_t GetMemoryUsage() const;
+
+private:
+    // Don't allow copy
+    Scene(const Scene&);
+    Scene& operator= (const Scene&);
+
+private:
+    std::vector<XMFLOAT3> Positions;
+    std::vector<XMFLOAT2> TexCoords;
+    std::vector<uint32_t> Indices;      // 3 per triangle
+    std::vector<Mesh> Meshes;           // In triangle order
+    std::vector<Material> Materials;
+    std::vector<Model> Models;
+    std::vector<Instance> Instances;
+    std::vector<std::string> TextureNames;
+};
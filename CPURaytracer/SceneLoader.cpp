@@ -0,0 +1,1338 @@
+#include "Precomp.h"
+#include "SceneLoader.h"
+#include "Scene.h"
+#include "Debug.h"
+#include <fstream>
+#include <unordered_map>
+#include <limits.h>
+#include <DirectXPackedVector.h>
+
+bool HasExtension(const char* filename, const char* extension)
+{
+    size_t length = strlen(filename);
+    size_t extLength = strlen(extension);
+    if (length < extLength)
+    {
+        return false;
+    }
+
+    const char* ext = filename + length - extLength;
+    for (size_t i = 0; i < extLength; ++i)
+    {
+        if (tolower(ext[i]) != tolower(extension[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Directory part of a path, with the trailing separator. Empty if there isn't one.
+static std::string GetDirectory(const char* filename)
+{
+    const char* end = nullptr;
+    for (const char* p = filename; *p; ++p)
+    {
+        if (*p == '/' || *p == '\\')
+        {
+            end = p + 1;
+        }
+    }
+    return end ? std::string(filename, end) : std::string();
+}
+
+// Read count items from the current position of a binary file
+template <typename T>
+static bool ReadItems(std::istream& file, T* items, size_t count)
+{
+    file.read((char*)items, sizeof(T) * count);
+    return !!file;
+}
+
+// Read count items from offset bytes into a binary file
+template <typename T>
+static bool ReadItemsAt(std::istream& file, uint64_t offset, T* items, size_t count)
+{
+    file.seekg((std::streamoff)offset);
+    return ReadItems(file, items, count);
+}
+
+//
+// OBJ
+//
+
+/// Reads a text file a block at a time and hands it out a line at a time, so that
+/// large files never need to be in memory all at once.
+class LineReader
+{
+public:
+    explicit LineReader(std::istream* stream)
+        : Stream(stream)
+        , Capacity(0)
+        , Start(0)
+        , End(0)
+        , AtEnd(false)
+    {
+    }
+
+    bool Initialize()
+    {
+        // One extra byte, so there's always room to terminate the last line
+        Capacity = BlockSize;
+        Buffer.reset(new char[Capacity + 1]);
+        if (!Buffer)
+        {
+            LogError(L"Failed to allocate file buffer.");
+            return false;
+        }
+        return true;
+    }
+
+    // Next line without the line break, null terminated. Null at the end of the file.
+    char* ReadLine()
+    {
+        for (;;)
+        {
+            char* start = &Buffer[Start];
+            char* newline = (char*)memchr(start, '\n', End - Start);
+            if (newline || (AtEnd && Start < End))
+            {
+                char* end = newline ? newline : &Buffer[End];
+                Start = (end - Buffer.get()) + (newline ? 1 : 0);
+                if (end > start && end[-1] == '\r')
+                {
+                    --end;
+                }
+                *end = '\0';
+                return start;
+            }
+
+            if (AtEnd)
+            {
+                return nullptr;
+            }
+
+            // Move the partial line to the front, then fill the rest of the buffer
+            memmove(&Buffer[0], &Buffer[Start], End - Start);
+            End -= Start;
+            Start = 0;
+
+            if (End == Capacity)
+            {
+                // The line doesn't fit at all
+                std::unique_ptr<char[]> larger(new char[Capacity * 2 + 1]);
+                if (!larger)
+                {
+                    LogError(L"Failed to grow file buffer.");
+                    return nullptr;
+                }
+                memcpy(larger.get(), Buffer.get(), End);
+                Buffer.swap(larger);
+                Capacity *= 2;
+            }
+
+            Stream->read(&Buffer[End], Capacity - End);
+            size_t numRead = (size_t)Stream->gcount();
+            End += numRead;
+            AtEnd = End < Capacity;
+        }
+    }
+
+    void Rewind()
+    {
+        Stream->clear();
+        Stream->seekg(0);
+        Start = 0;
+        End = 0;
+        AtEnd = false;
+    }
+
+private:
+    // Don't allow copy
+    LineReader(const LineReader&);
+    LineReader& operator= (const LineReader&);
+
+private:
+    static const size_t BlockSize = 1024 * 1024;
+
+    std::istream* Stream;
+    std::unique_ptr<char[]> Buffer;
+    size_t Capacity;
+    size_t Start;       // Unread data is [Start, End)
+    size_t End;
+    bool AtEnd;
+};
+
+static const char* SkipSpaces(const char* p)
+{
+    while (*p == ' ' || *p == '\t')
+    {
+        ++p;
+    }
+    return p;
+}
+
+// If line starts with keyword followed by whitespace, returns what follows it. Otherwise null.
+static const char* MatchKeyword(const char* line, const char* keyword)
+{
+    size_t length = strlen(keyword);
+    if (strncmp(line, keyword, length) != 0 || (line[length] != ' ' && line[length] != '\t'))
+    {
+        return nullptr;
+    }
+    return SkipSpaces(line + length);
+}
+
+// Rest of a line, without trailing whitespace
+static std::string TrimmedRest(const char* p)
+{
+    p = SkipSpaces(p);
+    const char* end = p + strlen(p);
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t'))
+    {
+        --end;
+    }
+    return std::string(p, end);
+}
+
+static int CountTokens(const char* p)
+{
+    int count = 0;
+    for (;;)
+    {
+        p = SkipSpaces(p);
+        if (!*p)
+        {
+            return count;
+        }
+        ++count;
+        while (*p && *p != ' ' && *p != '\t')
+        {
+            ++p;
+        }
+    }
+}
+
+// A lot quicker than atof, which matters with millions of numbers to read. Digits are
+// gathered in a double and scaled by an exact power of 10, which leaves the result
+// correctly rounded for anything written with up to 15 significant digits.
+static const char* ParseFloat(const char* p, float* value)
+{
+    static const double PowersOf10[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
+
+    p = SkipSpaces(p);
+    bool negative = (*p == '-');
+    if (*p == '-' || *p == '+')
+    {
+        ++p;
+    }
+
+    double mantissa = 0.0;
+    int exponent = 0;
+    while (*p >= '0' && *p <= '9')
+    {
+        mantissa = mantissa * 10.0 + (*p++ - '0');
+    }
+    if (*p == '.')
+    {
+        ++p;
+        while (*p >= '0' && *p <= '9')
+        {
+            mantissa = mantissa * 10.0 + (*p++ - '0');
+            --exponent;
+        }
+    }
+    if (*p == 'e' || *p == 'E')
+    {
+        ++p;
+        bool negativeExponent = (*p == '-');
+        if (*p == '-' || *p == '+')
+        {
+            ++p;
+        }
+        int e = 0;
+        while (*p >= '0' && *p <= '9')
+        {
+            e = min(e * 10 + (*p - '0'), 1000);
+            ++p;
+        }
+        exponent += negativeExponent ? -e : e;
+    }
+
+    double result = mantissa;
+    if (exponent > 0)
+    {
+        result *= exponent < (int)_countof(PowersOf10) ? PowersOf10[exponent] : pow(10.0, exponent);
+    }
+    else if (exponent < 0)
+    {
+        result /= -exponent < (int)_countof(PowersOf10) ? PowersOf10[-exponent] : pow(10.0, -exponent);
+    }
+
+    *value = (float)(negative ? -result : result);
+    return p;
+}
+
+// OBJ indices are 1 based, or negative to count back from the last element read so far.
+// Returns the 0 based index, or -1 if it doesn't refer to one of the count elements.
+static const char* ParseIndex(const char* p, int count, int* index)
+{
+    bool negative = (*p == '-');
+    if (negative)
+    {
+        ++p;
+    }
+
+    int value = 0;
+    bool hasDigits = false;
+    while (*p >= '0' && *p <= '9')
+    {
+        value = min(value * 10 + (*p - '0'), 1 << 30);
+        ++p;
+        hasDigits = true;
+    }
+
+    int resolved = negative ? count - value : value - 1;
+    *index = (hasDigits && resolved >= 0 && resolved < count) ? resolved : -1;
+    return p;
+}
+
+static void LoadMtl(const std::string& filename, Scene* scene, std::unordered_map<std::string, int>* materials)
+{
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    LineReader reader(&file);
+    if (!file || !reader.Initialize())
+    {
+        // Faces using its materials fall back to the default one
+        Log(L"Couldn't read material library %S.", filename.c_str());
+        return;
+    }
+
+    std::string directory = GetDirectory(filename.c_str());
+
+    // Materials are added to the scene once complete
+    std::vector<std::string> names;
+    std::vector<Scene::Material> mtlMaterials;
+
+    for (char* line = reader.ReadLine(); line; line = reader.ReadLine())
+    {
+        const char* p = SkipSpaces(line);
+        const char* args = nullptr;
+
+        if ((args = MatchKeyword(p, "newmtl")) != nullptr)
+        {
+            Scene::Material material;
+            material.Color = XMFLOAT3(0.8f, 0.8f, 0.8f);
+            material.Emission = XMFLOAT3(0.f, 0.f, 0.f);
+            material.Texture = -1;
+            names.push_back(TrimmedRest(args));
+            mtlMaterials.push_back(material);
+        }
+        else if (mtlMaterials.empty())
+        {
+            continue;
+        }
+        else if ((args = MatchKeyword(p, "Kd")) != nullptr)
+        {
+            XMFLOAT3& color = mtlMaterials.back().Color;
+            ParseFloat(ParseFloat(ParseFloat(args, &color.x), &color.y), &color.z);
+        }
+        else if ((args = MatchKeyword(p, "Ke")) != nullptr)
+        {
+            XMFLOAT3& emission = mtlMaterials.back().Emission;
+            ParseFloat(ParseFloat(ParseFloat(args, &emission.x), &emission.y), &emission.z);
+        }
+        else if ((args = MatchKeyword(p, "map_Kd")) != nullptr)
+        {
+            // Options (-s, -o, ...) come first, so the file name is the last thing on the line
+            std::string name = TrimmedRest(args);
+            size_t space = name.find_last_of(" \t");
+            if (space != std::string::npos)
+            {
+                name = name.substr(space + 1);
+            }
+            mtlMaterials.back().Texture = scene->AddTexture((directory + name).c_str());
+        }
+    }
+
+    for (size_t i = 0; i < mtlMaterials.size(); ++i)
+    {
+        const Scene::Material& material = mtlMaterials[i];
+        (*materials)[names[i]] = scene->AddMaterial(material.Color, material.Emission, material.Texture);
+    }
+}
+
+static bool LoadObj(const char* filename, Scene* scene)
+{
+    std::ifstream file(filename, std::ios::binary);
+    LineReader reader(&file);
+    if (!file || !reader.Initialize())
+    {
+        LogError(L"Failed to open OBJ file.");
+        return false;
+    }
+
+    // A first pass just counts, so that everything can be allocated at its final size
+    int numPositions = 0;
+    int numTexCoords = 0;
+    int numTriangles = 0;
+    for (char* line = reader.ReadLine(); line; line = reader.ReadLine())
+    {
+        const char* args = nullptr;
+        const char* p = SkipSpaces(line);
+        if (MatchKeyword(p, "v"))
+        {
+            ++numPositions;
+        }
+        else if (MatchKeyword(p, "vt"))
+        {
+            ++numTexCoords;
+        }
+        else if ((args = MatchKeyword(p, "f")) != nullptr)
+        {
+            numTriangles += max(CountTokens(args) - 2, 0);
+        }
+    }
+    reader.Rewind();
+
+    std::vector<XMFLOAT3> positions;
+    std::vector<XMFLOAT2> texCoords;
+    positions.reserve(numPositions);
+    texCoords.reserve(numTexCoords);
+
+    // Scene vertices are the distinct position & texture coordinate pairs the faces use.
+    // Each position keeps a list of the vertices made from it, to find pairs seen before.
+    std::vector<int> firstVertex(numPositions, -1);
+    std::vector<int> nextVertex;
+    std::vector<int> vertexTexCoord;
+    nextVertex.reserve(max(numPositions, numTexCoords));
+    vertexTexCoord.reserve(max(numPositions, numTexCoords));
+
+    int baseVertex = scene->GetNumVertices();
+    scene->Reserve(baseVertex + max(numPositions, numTexCoords), scene->GetNumTriangles() + numTriangles);
+
+    std::string directory = GetDirectory(filename);
+    std::unordered_map<std::string, int> materials;
+    int currentMaterial = -1;
+    int defaultMaterial = -1;
+    std::vector<uint32_t> polygon;
+    int lineNumber = 0;
+
+    for (char* line = reader.ReadLine(); line; line = reader.ReadLine())
+    {
+        ++lineNumber;
+        const char* p = SkipSpaces(line);
+        const char* args = nullptr;
+
+        if ((args = MatchKeyword(p, "v")) != nullptr)
+        {
+            // Right handed to left handed
+            XMFLOAT3 position;
+            ParseFloat(ParseFloat(ParseFloat(args, &position.x), &position.y), &position.z);
+            position.z = -position.z;
+            positions.push_back(position);
+        }
+        else if ((args = MatchKeyword(p, "vt")) != nullptr)
+        {
+            // OBJ texture coordinates start at the bottom of the image
+            XMFLOAT2 texCoord;
+            ParseFloat(ParseFloat(args, &texCoord.x), &texCoord.y);
+            texCoord.y = 1.f - texCoord.y;
+            texCoords.push_back(texCoord);
+        }
+        else if ((args = MatchKeyword(p, "f")) != nullptr)
+        {
+            if (currentMaterial < 0)
+            {
+                if (defaultMaterial < 0)
+                {
+                    defaultMaterial = scene->AddMaterial(XMFLOAT3(0.8f, 0.8f, 0.8f), XMFLOAT3(0.f, 0.f, 0.f));
+                }
+                currentMaterial = defaultMaterial;
+                scene->SetMaterial(currentMaterial);
+            }
+
+            // Corners are v, v/vt, v//vn or v/vt/vn. Normals aren't used.
+            polygon.clear();
+            for (p = SkipSpaces(args); *p; p = SkipSpaces(p))
+            {
+                int position = -1;
+                int texCoord = -1;
+                p = ParseIndex(p, (int)positions.size(), &position);
+                if (*p == '/')
+                {
+                    ++p;
+                    if (*p != '/')
+                    {
+                        p = ParseIndex(p, (int)texCoords.size(), &texCoord);
+                        if (texCoord < 0)
+                        {
+                            position = -1;
+                        }
+                    }
+                    if (*p == '/')
+                    {
+                        int normal;
+                        p = ParseIndex(p + 1, INT_MAX, &normal);
+                    }
+                }
+
+                if (position < 0 || (*p && *p != ' ' && *p != '\t'))
+                {
+                    LogError(L"Invalid face in OBJ file at line %d.", lineNumber);
+                    return false;
+                }
+
+                int vertex = firstVertex[position];
+                while (vertex >= 0 && vertexTexCoord[vertex] != texCoord)
+                {
+                    vertex = nextVertex[vertex];
+                }
+
+                if (vertex < 0)
+                {
+                    vertex = (int)vertexTexCoord.size();
+                    vertexTexCoord.push_back(texCoord);
+                    nextVertex.push_back(firstVertex[position]);
+                    firstVertex[position] = vertex;
+                    scene->AddVertex(positions[position], texCoord >= 0 ? texCoords[texCoord] : XMFLOAT2(0.f, 0.f));
+                }
+
+                polygon.push_back(baseVertex + vertex);
+            }
+
+            // Fan out polygons, reversing the counter clockwise front faces to clockwise
+            for (size_t i = 2; i < polygon.size(); ++i)
+            {
+                scene->AddTriangle(polygon[0], polygon[i], polygon[i - 1]);
+            }
+        }
+        else if ((args = MatchKeyword(p, "usemtl")) != nullptr)
+        {
+            auto material = materials.find(TrimmedRest(args));
+            currentMaterial = (material != materials.end()) ? material->second : -1;
+            if (currentMaterial >= 0)
+            {
+                scene->SetMaterial(currentMaterial);
+            }
+        }
+        else if ((args = MatchKeyword(p, "mtllib")) != nullptr)
+        {
+            LoadMtl(directory + TrimmedRest(args), scene, &materials);
+        }
+    }
+
+    scene->ShrinkToFit();
+    return true;
+}
+
+//
+// SDKMESH
+//
+
+// File layout, as written by the legacy DirectX SDK Content Exporter. Matches
+// DXUT's (and DirectXTK's ModelLoadSDKMESH.cpp) definitions. Fields that hold
+// pointers at runtime are just 64 bit placeholders in the file.
+namespace SdkMesh
+{
+    static const uint32_t FileVersion = 101;
+    static const int MaxVertexElements = 32;
+    static const int MaxVertexStreams = 16;
+    static const int MaxName = 100;
+    static const int MaxPath = 260;
+
+    enum DeclUsage
+    {
+        UsagePosition = 0,
+        UsageTexCoord = 5,
+    };
+
+    enum DeclType
+    {
+        TypeFloat2 = 1,
+        TypeFloat3 = 2,
+        TypeFloat4 = 3,
+        TypeFloat16x2 = 15,
+        TypeFloat16x4 = 16,
+        TypeUnused = 17,
+    };
+
+    enum PrimitiveType
+    {
+        TriangleList = 0,
+    };
+
+    enum IndexType
+    {
+        Index16 = 0,
+        Index32 = 1,
+    };
+
+#pragma pack(push, 4)
+
+    struct VertexElement
+    {
+        uint16_t Stream;
+        uint16_t Offset;
+        uint8_t Type;
+        uint8_t Method;
+        uint8_t Usage;
+        uint8_t UsageIndex;
+    };
+
+#pragma pack(pop)
+#pragma pack(push, 8)
+
+    struct Header
+    {
+        uint32_t Version;
+        uint8_t IsBigEndian;
+        uint64_t HeaderSize;
+        uint64_t NonBufferDataSize;
+        uint64_t BufferDataSize;
+        uint32_t NumVertexBuffers;
+        uint32_t NumIndexBuffers;
+        uint32_t NumMeshes;
+        uint32_t NumTotalSubsets;
+        uint32_t NumFrames;
+        uint32_t NumMaterials;
+        uint64_t VertexStreamHeadersOffset;
+        uint64_t IndexStreamHeadersOffset;
+        uint64_t MeshDataOffset;
+        uint64_t SubsetDataOffset;
+        uint64_t FrameDataOffset;
+        uint64_t MaterialDataOffset;
+    };
+
+    struct VertexBufferHeader
+    {
+        uint64_t NumVertices;
+        uint64_t SizeBytes;
+        uint64_t StrideBytes;
+        VertexElement Decl[MaxVertexElements];
+        uint64_t DataOffset;
+    };
+
+    struct IndexBufferHeader
+    {
+        uint64_t NumIndices;
+        uint64_t SizeBytes;
+        uint32_t IndexType;
+        uint64_t DataOffset;
+    };
+
+    struct Mesh
+    {
+        char Name[MaxName];
+        uint8_t NumVertexBuffers;
+        uint32_t VertexBuffers[MaxVertexStreams];
+        uint32_t IndexBuffer;
+        uint32_t NumSubsets;
+        uint32_t NumFrameInfluences;
+        XMFLOAT3 BoundingBoxCenter;
+        XMFLOAT3 BoundingBoxExtents;
+        uint64_t SubsetOffset;
+        uint64_t FrameInfluenceOffset;
+    };
+
+    struct Subset
+    {
+        char Name[MaxName];
+        uint32_t MaterialID;
+        uint32_t PrimitiveType;
+        uint64_t IndexStart;
+        uint64_t IndexCount;
+        uint64_t VertexStart;
+        uint64_t VertexCount;
+    };
+
+    struct Material
+    {
+        char Name[MaxName];
+        char MaterialInstancePath[MaxPath];
+        char DiffuseTexture[MaxPath];
+        char NormalTexture[MaxPath];
+        char SpecularTexture[MaxPath];
+        XMFLOAT4 Diffuse;
+        XMFLOAT4 Ambient;
+        XMFLOAT4 Specular;
+        XMFLOAT4 Emissive;
+        float Power;
+        uint64_t RuntimeData[6];
+    };
+
+#pragma pack(pop)
+}
+
+static_assert(sizeof(SdkMesh::VertexElement) == 8, "SDKMESH structure size incorrect");
+static_assert(sizeof(SdkMesh::Header) == 104, "SDKMESH structure size incorrect");
+static_assert(sizeof(SdkMesh::VertexBufferHeader) == 288, "SDKMESH structure size incorrect");
+static_assert(sizeof(SdkMesh::IndexBufferHeader) == 32, "SDKMESH structure size incorrect");
+static_assert(sizeof(SdkMesh::Mesh) == 224, "SDKMESH structure size incorrect");
+static_assert(sizeof(SdkMesh::Subset) == 144, "SDKMESH structure size incorrect");
+static_assert(sizeof(SdkMesh::Material) == 1256, "SDKMESH structure size incorrect");
+
+// Vertices are streamed through a buffer this size, whatever else they hold besides
+// position and texture coordinates
+static const int VertexBlockSize = 4096;
+
+static bool ReadSdkMeshVertices(std::istream& file, const SdkMesh::VertexBufferHeader& header, Scene* scene)
+{
+    int positionOffset = -1;
+    int texCoordOffset = -1;
+    bool halfTexCoords = false;
+    for (int i = 0; i < SdkMesh::MaxVertexElements && header.Decl[i].Type != SdkMesh::TypeUnused; ++i)
+    {
+        const SdkMesh::VertexElement& element = header.Decl[i];
+        if (element.Stream != 0 || element.UsageIndex != 0)
+        {
+            continue;
+        }
+
+        if (element.Usage == SdkMesh::UsagePosition && element.Type == SdkMesh::TypeFloat3)
+        {
+            positionOffset = element.Offset;
+        }
+        else if (element.Usage == SdkMesh::UsageTexCoord)
+        {
+            switch (element.Type)
+            {
+            case SdkMesh::TypeFloat2:
+            case SdkMesh::TypeFloat3:
+            case SdkMesh::TypeFloat4:
+                texCoordOffset = element.Offset;
+                break;
+            case SdkMesh::TypeFloat16x2:
+            case SdkMesh::TypeFloat16x4:
+                texCoordOffset = element.Offset;
+                halfTexCoords = true;
+                break;
+            }
+        }
+    }
+
+    size_t stride = (size_t)header.StrideBytes;
+    if (positionOffset < 0 || stride < sizeof(XMFLOAT3) ||
+        positionOffset + sizeof(XMFLOAT3) > stride ||
+        (texCoordOffset >= 0 && texCoordOffset + sizeof(XMFLOAT2) > stride))
+    {
+        LogError(L"Unsupported SDKMESH vertex format.");
+        return false;
+    }
+
+    std::unique_ptr<uint8_t[]> block(new uint8_t[stride * VertexBlockSize]);
+    if (!block)
+    {
+        LogError(L"Failed to allocate vertex block.");
+        return false;
+    }
+
+    file.seekg((std::streamoff)header.DataOffset);
+    for (uint64_t first = 0; first < header.NumVertices; first += VertexBlockSize)
+    {
+        int count = (int)min(header.NumVertices - first, (uint64_t)VertexBlockSize);
+        if (!ReadItems(file, block.get(), stride * count))
+        {
+            LogError(L"Failed to read SDKMESH vertices.");
+            return false;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            const uint8_t* vertex = &block[i * stride];
+            XMFLOAT3 position;
+            memcpy(&position, vertex + positionOffset, sizeof(position));
+
+            XMFLOAT2 texCoord(0.f, 0.f);
+            if (halfTexCoords)
+            {
+                PackedVector::HALF half[2];
+                memcpy(half, vertex + texCoordOffset, sizeof(half));
+                texCoord.x = PackedVector::XMConvertHalfToFloat(half[0]);
+                texCoord.y = PackedVector::XMConvertHalfToFloat(half[1]);
+            }
+            else if (texCoordOffset >= 0)
+            {
+                memcpy(&texCoord, vertex + texCoordOffset, sizeof(texCoord));
+            }
+
+            scene->AddVertex(position, texCoord);
+        }
+    }
+
+    return true;
+}
+
+// Indices of one subset, added as triangles of vertices starting at baseVertex
+static bool ReadSdkMeshIndices(std::istream& file, const SdkMesh::IndexBufferHeader& header,
+    uint64_t start, uint64_t count, int baseVertex, uint32_t numVertices, Scene* scene)
+{
+    // Whole triangles per block
+    static const int BlockSize = 3 * 1024;
+
+    size_t indexSize = (header.IndexType == SdkMesh::Index32) ? 4 : 2;
+    uint32_t block[BlockSize];
+    uint16_t block16[BlockSize];
+
+    file.seekg((std::streamoff)(header.DataOffset + start * indexSize));
+    for (uint64_t first = 0; first < count; first += BlockSize)
+    {
+        int blockCount = (int)min(count - first, (uint64_t)BlockSize);
+        if (indexSize == 4)
+        {
+            if (!ReadItems(file, block, blockCount))
+            {
+                LogError(L"Failed to read SDKMESH indices.");
+                return false;
+            }
+        }
+        else
+        {
+            if (!ReadItems(file, block16, blockCount))
+            {
+                LogError(L"Failed to read SDKMESH indices.");
+                return false;
+            }
+            for (int i = 0; i < blockCount; ++i)
+            {
+                block[i] = block16[i];
+            }
+        }
+
+        for (int i = 0; i + 2 < blockCount; i += 3)
+        {
+            if (block[i] >= numVertices || block[i + 1] >= numVertices || block[i + 2] >= numVertices)
+            {
+                LogError(L"Invalid index in SDKMESH file.");
+                return false;
+            }
+            scene->AddTriangle(baseVertex + block[i], baseVertex + block[i + 1], baseVertex + block[i + 2]);
+        }
+    }
+
+    return true;
+}
+
+static bool LoadSdkMesh(const char* filename, Scene* scene)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        LogError(L"Failed to open SDKMESH file.");
+        return false;
+    }
+
+    SdkMesh::Header header;
+    if (!ReadItems(file, &header, 1))
+    {
+        LogError(L"Failed to read SDKMESH header.");
+        return false;
+    }
+
+    uint64_t headerSize = sizeof(SdkMesh::Header) +
+        header.NumVertexBuffers * sizeof(SdkMesh::VertexBufferHeader) +
+        header.NumIndexBuffers * sizeof(SdkMesh::IndexBufferHeader);
+    if (header.Version != SdkMesh::FileVersion || header.IsBigEndian || header.HeaderSize != headerSize ||
+        !header.NumVertexBuffers || !header.NumIndexBuffers || !header.NumMeshes || !header.NumTotalSubsets || !header.NumMaterials)
+    {
+        LogError(L"Not a supported SDKMESH file.");
+        return false;
+    }
+
+    // Everything but the vertex & index data is small enough to read up front
+    std::vector<SdkMesh::VertexBufferHeader> vertexBuffers(header.NumVertexBuffers);
+    std::vector<SdkMesh::IndexBufferHeader> indexBuffers(header.NumIndexBuffers);
+    std::vector<SdkMesh::Mesh> meshes(header.NumMeshes);
+    std::vector<SdkMesh::Subset> subsets(header.NumTotalSubsets);
+    std::vector<SdkMesh::Material> materials(header.NumMaterials);
+    if (!ReadItemsAt(file, header.VertexStreamHeadersOffset, vertexBuffers.data(), vertexBuffers.size()) ||
+        !ReadItemsAt(file, header.IndexStreamHeadersOffset, indexBuffers.data(), indexBuffers.size()) ||
+        !ReadItemsAt(file, header.MeshDataOffset, meshes.data(), meshes.size()) ||
+        !ReadItemsAt(file, header.SubsetDataOffset, subsets.data(), subsets.size()) ||
+        !ReadItemsAt(file, header.MaterialDataOffset, materials.data(), materials.size()))
+    {
+        LogError(L"Failed to read SDKMESH headers.");
+        return false;
+    }
+
+    std::string directory = GetDirectory(filename);
+    int firstMaterial = scene->GetNumMaterials();
+    for (size_t i = 0; i < materials.size(); ++i)
+    {
+        SdkMesh::Material& material = materials[i];
+        material.DiffuseTexture[SdkMesh::MaxPath - 1] = '\0';
+
+        int texture = -1;
+        if (material.DiffuseTexture[0])
+        {
+            texture = scene->AddTexture((directory + material.DiffuseTexture).c_str());
+        }
+        scene->AddMaterial(XMFLOAT3(material.Diffuse.x, material.Diffuse.y, material.Diffuse.z),
+            XMFLOAT3(material.Emissive.x, material.Emissive.y, material.Emissive.z), texture);
+    }
+
+    uint64_t numVertices = 0;
+    for (size_t i = 0; i < vertexBuffers.size(); ++i)
+    {
+        numVertices += vertexBuffers[i].NumVertices;
+    }
+    uint64_t numTriangles = 0;
+    for (size_t i = 0; i < subsets.size(); ++i)
+    {
+        if (subsets[i].PrimitiveType == SdkMesh::TriangleList)
+        {
+            numTriangles += subsets[i].IndexCount / 3;
+        }
+    }
+    if (scene->GetNumVertices() + numVertices > INT_MAX || (scene->GetNumTriangles() + numTriangles) * 3 > INT_MAX)
+    {
+        LogError(L"SDKMESH file is too large.");
+        return false;
+    }
+
+    int firstVertex = scene->GetNumVertices();
+    int firstTriangle = scene->GetNumTriangles();
+    scene->Reserve(firstVertex + (int)numVertices, firstTriangle + (int)numTriangles);
+
+    // Vertex buffers are read when a mesh first uses them. This is where each one starts in the scene.
+    std::vector<int> vertexBufferStarts(vertexBuffers.size(), -1);
+    std::vector<uint32_t> meshSubsets;
+    int numSkipped = 0;
+
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        const SdkMesh::Mesh& mesh = meshes[i];
+        if (!mesh.NumVertexBuffers || !mesh.NumSubsets ||
+            mesh.VertexBuffers[0] >= vertexBuffers.size() || mesh.IndexBuffer >= indexBuffers.size())
+        {
+            LogError(L"Invalid mesh in SDKMESH file.");
+            return false;
+        }
+
+        uint32_t vertexBuffer = mesh.VertexBuffers[0];
+        if (vertexBufferStarts[vertexBuffer] < 0)
+        {
+            vertexBufferStarts[vertexBuffer] = scene->GetNumVertices();
+            if (!ReadSdkMeshVertices(file, vertexBuffers[vertexBuffer], scene))
+            {
+                return false;
+            }
+        }
+
+        meshSubsets.resize(mesh.NumSubsets);
+        if (!ReadItemsAt(file, mesh.SubsetOffset, meshSubsets.data(), meshSubsets.size()))
+        {
+            LogError(L"Failed to read SDKMESH subsets.");
+            return false;
+        }
+
+        const SdkMesh::IndexBufferHeader& indexBuffer = indexBuffers[mesh.IndexBuffer];
+        for (size_t j = 0; j < meshSubsets.size(); ++j)
+        {
+            if (meshSubsets[j] >= subsets.size())
+            {
+                LogError(L"Invalid subset in SDKMESH file.");
+                return false;
+            }
+
+            const SdkMesh::Subset& subset = subsets[meshSubsets[j]];
+            if (subset.PrimitiveType != SdkMesh::TriangleList)
+            {
+                // Strips, lines & points never came out of the exporter for anything we'd render
+                ++numSkipped;
+                continue;
+            }
+
+            if (subset.MaterialID >= materials.size() ||
+                (indexBuffer.IndexType != SdkMesh::Index16 && indexBuffer.IndexType != SdkMesh::Index32) ||
+                subset.IndexStart + subset.IndexCount > indexBuffer.NumIndices)
+            {
+                LogError(L"Invalid subset in SDKMESH file.");
+                return false;
+            }
+
+            scene->SetMaterial(firstMaterial + subset.MaterialID);
+            if (!ReadSdkMeshIndices(file, indexBuffer, subset.IndexStart, subset.IndexCount,
+                vertexBufferStarts[vertexBuffer], (uint32_t)vertexBuffers[vertexBuffer].NumVertices, scene))
+            {
+                return false;
+            }
+        }
+    }
+
+    if (numSkipped > 0)
+    {
+        Log(L"Skipped %d SDKMESH subsets that aren't triangle lists.", numSkipped);
+    }
+
+    // Vertices split only for normals, tangents etc. can be shared now
+    if (!scene->WeldVertices(firstVertex, firstTriangle))
+    {
+        return false;
+    }
+    scene->ShrinkToFit();
+    return true;
+}
+
+//
+// CMO
+//
+
+// File layout, as written by the Visual Studio content pipeline. Matches the
+// VS Direct3D Starter Kit's (and DirectXTK's ModelLoadCMO.cpp) definitions.
+namespace Cmo
+{
+    static const int NumTextures = 8;
+
+#pragma pack(push, 1)
+
+    struct Material
+    {
+        XMFLOAT4 Ambient;
+        XMFLOAT4 Diffuse;
+        XMFLOAT4 Specular;
+        float SpecularPower;
+        XMFLOAT4 Emissive;
+        XMFLOAT4X4 UVTransform;
+    };
+
+    struct SubMesh
+    {
+        uint32_t MaterialIndex;
+        uint32_t IndexBufferIndex;
+        uint32_t VertexBufferIndex;
+        uint32_t StartIndex;
+        uint32_t PrimCount;
+    };
+
+    // Position, normal, tangent (4), color (packed 8 bit), texture coordinates
+    struct Vertex
+    {
+        XMFLOAT3 Position;
+        XMFLOAT3 Normal;
+        XMFLOAT4 Tangent;
+        uint32_t Color;
+        XMFLOAT2 TexCoord;
+    };
+
+#pragma pack(pop)
+
+    // Sizes of the parts that are skipped over
+    static const int SkinningVertexSize = 32;
+    static const int ExtentsSize = 40;
+    static const int BoneSize = 196;
+    static const int ClipSize = 12;         // Start & end time, keyframe count
+    static const int KeyframeSize = 72;
+}
+
+static_assert(sizeof(Cmo::Material) == 132, "CMO structure size incorrect");
+static_assert(sizeof(Cmo::SubMesh) == 20, "CMO structure size incorrect");
+static_assert(sizeof(Cmo::Vertex) == 52, "CMO structure size incorrect");
+
+// Length prefixed UTF-16 string. Anything outside of ASCII becomes '?', which is
+// fine for the only ones we keep (texture file names).
+static bool ReadCmoString(std::istream& file, std::string* value)
+{
+    uint32_t length = 0;
+    if (!ReadItems(file, &length, 1))
+    {
+        return false;
+    }
+
+    std::vector<uint16_t> chars(length);
+    if (length > 0 && !ReadItems(file, chars.data(), length))
+    {
+        return false;
+    }
+
+    value->clear();
+    for (uint32_t i = 0; i < length && chars[i]; ++i)
+    {
+        value->push_back(chars[i] < 128 ? (char)chars[i] : '?');
+    }
+    return true;
+}
+
+static bool SkipBytes(std::istream& file, uint64_t count)
+{
+    file.seekg((std::streamoff)count, std::ios::cur);
+    return !!file;
+}
+
+static bool LoadCmo(const char* filename, Scene* scene)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+    {
+        LogError(L"Failed to open CMO file.");
+        return false;
+    }
+
+    std::string directory = GetDirectory(filename);
+    int firstVertex = scene->GetNumVertices();
+    int firstTriangle = scene->GetNumTriangles();
+
+    uint32_t numMeshes = 0;
+    if (!ReadItems(file, &numMeshes, 1) || numMeshes == 0)
+    {
+        LogError(L"Not a valid CMO file.");
+        return false;
+    }
+
+    std::string name;
+    std::vector<XMFLOAT4X4> uvTransforms;
+    std::vector<Cmo::SubMesh> subMeshes;
+    std::vector<std::vector<uint16_t>> indexBuffers;
+    std::vector<int> vertexBufferStarts;
+    std::vector<uint32_t> vertexBufferSizes;
+    std::unique_ptr<Cmo::Vertex[]> block(new Cmo::Vertex[VertexBlockSize]);
+    if (!block)
+    {
+        LogError(L"Failed to allocate vertex block.");
+        return false;
+    }
+
+    for (uint32_t mesh = 0; mesh < numMeshes; ++mesh)
+    {
+        // Mesh name, then materials
+        uint32_t numMaterials = 0;
+        if (!ReadCmoString(file, &name) || !ReadItems(file, &numMaterials, 1))
+        {
+            LogError(L"Failed to read CMO mesh.");
+            return false;
+        }
+
+        int firstMaterial = scene->GetNumMaterials();
+        uvTransforms.resize(numMaterials);
+        for (uint32_t i = 0; i < numMaterials; ++i)
+        {
+            Cmo::Material material;
+            if (!ReadCmoString(file, &name) || !ReadItems(file, &material, 1) || !ReadCmoString(file, &name))
+            {
+                LogError(L"Failed to read CMO material.");
+                return false;
+            }
+
+            // The first texture is the diffuse map
+            int texture = -1;
+            for (int j = 0; j < Cmo::NumTextures; ++j)
+            {
+                if (!ReadCmoString(file, &name))
+                {
+                    LogError(L"Failed to read CMO material.");
+                    return false;
+                }
+                if (j == 0 && !name.empty())
+                {
+                    texture = scene->AddTexture((directory + name).c_str());
+                }
+            }
+
+            scene->AddMaterial(XMFLOAT3(material.Diffuse.x, material.Diffuse.y, material.Diffuse.z),
+                XMFLOAT3(material.Emissive.x, material.Emissive.y, material.Emissive.z), texture);
+            uvTransforms[i] = material.UVTransform;
+        }
+
+        uint8_t hasSkeleton = 0;
+        uint32_t numSubMeshes = 0;
+        if (!ReadItems(file, &hasSkeleton, 1) || !ReadItems(file, &numSubMeshes, 1))
+        {
+            LogError(L"Failed to read CMO mesh.");
+            return false;
+        }
+        subMeshes.resize(numSubMeshes);
+        if (numSubMeshes > 0 && !ReadItems(file, subMeshes.data(), numSubMeshes))
+        {
+            LogError(L"Failed to read CMO submeshes.");
+            return false;
+        }
+
+        // Index buffers come before the vertex buffers, so they're kept until the
+        // vertices are in place. They're 16 bit, so relatively small.
+        uint32_t numIndexBuffers = 0;
+        if (!ReadItems(file, &numIndexBuffers, 1))
+        {
+            LogError(L"Failed to read CMO mesh.");
+            return false;
+        }
+        indexBuffers.resize(numIndexBuffers);
+        for (uint32_t i = 0; i < numIndexBuffers; ++i)
+        {
+            uint32_t numIndices = 0;
+            if (!ReadItems(file, &numIndices, 1))
+            {
+                LogError(L"Failed to read CMO indices.");
+                return false;
+            }
+            indexBuffers[i].resize(numIndices);
+            if (numIndices > 0 && !ReadItems(file, indexBuffers[i].data(), numIndices))
+            {
+                LogError(L"Failed to read CMO indices.");
+                return false;
+            }
+        }
+
+        uint32_t numVertexBuffers = 0;
+        if (!ReadItems(file, &numVertexBuffers, 1))
+        {
+            LogError(L"Failed to read CMO mesh.");
+            return false;
+        }
+        vertexBufferStarts.resize(numVertexBuffers);
+        vertexBufferSizes.resize(numVertexBuffers);
+        for (uint32_t i = 0; i < numVertexBuffers; ++i)
+        {
+            uint32_t numVertices = 0;
+            if (!ReadItems(file, &numVertices, 1))
+            {
+                LogError(L"Failed to read CMO vertices.");
+                return false;
+            }
+
+            // Texture coordinates are stored before the material's UV transform. Like
+            // DirectXTK, use the transform of the first submesh drawing the buffer.
+            XMMATRIX uvTransform = XMMatrixIdentity();
+            for (uint32_t j = 0; j < numSubMeshes; ++j)
+            {
+                if (subMeshes[j].VertexBufferIndex == i && subMeshes[j].MaterialIndex < numMaterials)
+                {
+                    uvTransform = XMLoadFloat4x4(&uvTransforms[subMeshes[j].MaterialIndex]);
+                    break;
+                }
+            }
+            bool transformUVs = !XMMatrixIsIdentity(uvTransform);
+
+            vertexBufferStarts[i] = scene->GetNumVertices();
+            vertexBufferSizes[i] = numVertices;
+            for (uint32_t first = 0; first < numVertices; first += VertexBlockSize)
+            {
+                uint32_t count = min(numVertices - first, (uint32_t)VertexBlockSize);
+                if (!ReadItems(file, block.get(), count))
+                {
+                    LogError(L"Failed to read CMO vertices.");
+                    return false;
+                }
+
+                for (uint32_t j = 0; j < count; ++j)
+                {
+                    XMFLOAT2 texCoord = block[j].TexCoord;
+                    if (transformUVs)
+                    {
+                        XMStoreFloat2(&texCoord, XMVector4Transform(XMVectorSet(texCoord.x, texCoord.y, 0.f, 1.f), uvTransform));
+                    }
+
+                    // Right handed to left handed
+                    XMFLOAT3 position = block[j].Position;
+                    position.z = -position.z;
+                    scene->AddVertex(position, texCoord);
+                }
+            }
+        }
+
+        // Skinning data, extents and animation aren't used
+        uint32_t numSkinningBuffers = 0;
+        if (!ReadItems(file, &numSkinningBuffers, 1))
+        {
+            LogError(L"Failed to read CMO mesh.");
+            return false;
+        }
+        for (uint32_t i = 0; i < numSkinningBuffers; ++i)
+        {
+            uint32_t numVertices = 0;
+            if (!ReadItems(file, &numVertices, 1) || !SkipBytes(file, (uint64_t)numVertices * Cmo::SkinningVertexSize))
+            {
+                LogError(L"Failed to read CMO skinning data.");
+                return false;
+            }
+        }
+
+        if (!SkipBytes(file, Cmo::ExtentsSize))
+        {
+            LogError(L"Failed to read CMO mesh.");
+            return false;
+        }
+
+        if (hasSkeleton)
+        {
+            uint32_t numBones = 0;
+            uint32_t numClips = 0;
+            bool succeeded = ReadItems(file, &numBones, 1);
+            for (uint32_t i = 0; succeeded && i < numBones; ++i)
+            {
+                succeeded = ReadCmoString(file, &name) && SkipBytes(file, Cmo::BoneSize);
+            }
+            succeeded = succeeded && ReadItems(file, &numClips, 1);
+            for (uint32_t i = 0; succeeded && i < numClips; ++i)
+            {
+                float times[2];
+                uint32_t numKeys = 0;
+                succeeded = ReadCmoString(file, &name) && ReadItems(file, times, 2) && ReadItems(file, &numKeys, 1) &&
+                    SkipBytes(file, (uint64_t)numKeys * Cmo::KeyframeSize);
+            }
+            if (!succeeded)
+            {
+                LogError(L"Failed to read CMO animation data.");
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < numSubMeshes; ++i)
+        {
+            const Cmo::SubMesh& subMesh = subMeshes[i];
+            if (subMesh.MaterialIndex >= numMaterials || subMesh.IndexBufferIndex >= numIndexBuffers ||
+                subMesh.VertexBufferIndex >= numVertexBuffers ||
+                (uint64_t)subMesh.StartIndex + (uint64_t)subMesh.PrimCount * 3 > indexBuffers[subMesh.IndexBufferIndex].size())
+            {
+                LogError(L"Invalid submesh in CMO file.");
+                return false;
+            }
+
+            const uint16_t* indices = &indexBuffers[subMesh.IndexBufferIndex][subMesh.StartIndex];
+            int baseVertex = vertexBufferStarts[subMesh.VertexBufferIndex];
+            uint32_t numVertices = vertexBufferSizes[subMesh.VertexBufferIndex];
+
+            scene->SetMaterial(firstMaterial + subMesh.MaterialIndex);
+            for (uint32_t j = 0; j < subMesh.PrimCount; ++j, indices += 3)
+            {
+                if (indices[0] >= numVertices || indices[1] >= numVertices || indices[2] >= numVertices)
+                {
+                    LogError(L"Invalid index in CMO file.");
+                    return false;
+                }
+
+                // CMO front faces are counter clockwise
+                scene->AddTriangle(baseVertex + indices[0], baseVertex + indices[2], baseVertex + indices[1]);
+            }
+        }
+    }
+
+    if (!scene->WeldVertices(firstVertex, firstTriangle))
+    {
+        return false;
+    }
+    scene->ShrinkToFit();
+    return true;
+}
+
+bool LoadSceneFile(const char* filename, Scene* scene)
+{
+    if (HasExtension(filename, ".obj"))
+    {
+        return LoadObj(filename, scene);
+    }
+    else if (HasExtension(filename, ".sdkmesh"))
+    {
+        return LoadSdkMesh(filename, scene);
+    }
+    else if (HasExtension(filename, ".cmo"))
+    {
+        return LoadCmo(filename, scene);
+    }
+
+    LogError(L"Unsupported model format. Use .obj, .sdkmesh or .cmo.");
+    return false;
+}
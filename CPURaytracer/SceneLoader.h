@@ -0,0 +1,15 @@
+#pragma once
+
+class Scene;
+
+// Case insensitive check of a filename's extension (including the dot)
+bool HasExtension(const char* filename, const char* extension);
+
+// Append the meshes and materials of a model file to scene. The format is chosen from the
+// extension: .obj (with the materials in its .mtl libraries), .sdkmesh or .cmo (the formats
+// DirectXTK's Model loads). Files are read a piece at a time straight into the scene's
+// arrays, so they're never held in memory whole, and vertices that only differed in
+// attributes the renderer doesn't use are merged. Only positions, texture coordinates and
+// diffuse/emissive colors & textures are kept. Geometry is converted to the renderer's
+// conventions: left handed, clockwise front faces, texture v pointing down.
+bool LoadSceneFile(const char* filename, Scene* scene);
@@ -0,0 +1,163 @@
+#include "Precomp.h"
+#include "Texture.h"
+#include "Debug.h"
+
+// Texels are stored in TileSize x TileSize tiles, in Morton order inside each tile
+static const int TileShift = 3;
+static const int TileSize = 1 << TileShift;
+static const int TexelsPerTile = TileSize * TileSize;
+
+// Bits of a tile coordinate (0-7) spread out to the even bits, for interleaving x & y
+static const uint8_t MortonBits[TileSize] = { 0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15 };
+
+Texture::Texture()
+    : NumLevels(0)
+    , TotalTexels(0)
+{
+}
+
+bool Texture::Initialize(int width, int height, int numLevels)
+{
+    assert(width > 0 && height > 0);
+
+    Texels.reset();
+    NumLevels = 0;
+    TotalTexels = 0;
+
+    // Count the full chain, and cut it short if fewer levels were asked for
+    int maxLevels = 1;
+    for (int w = width, h = height; (w > 1 || h > 1) && maxLevels < MaxLevels; w /= 2, h /= 2)
+    {
+        ++maxLevels;
+    }
+    if (numLevels <= 0 || numLevels > maxLevels)
+    {
+        numLevels = maxLevels;
+    }
+
+    for (int i = 0; i < numLevels; ++i)
+    {
+        Level& level = Levels[i];
+        level.Width = max(width >> i, 1);
+        level.Height = max(height >> i, 1);
+        level.TilesX = (level.Width + TileSize - 1) / TileSize;
+        level.Offset = TotalTexels;
+
+        int tilesY = (level.Height + TileSize - 1) / TileSize;
+        TotalTexels += (size_t)level.TilesX * tilesY * TexelsPerTile;
+    }
+
+    Texels.reset(new uint32_t[TotalTexels]);
+    if (!Texels)
+    {
+        LogError(L"Failed to allocate texture.");
+        TotalTexels = 0;
+        return false;
+    }
+    memset(Texels.get(), 0, TotalTexels * sizeof(uint32_t));
+
+    NumLevels = numLevels;
+    return true;
+}
+
+void Texture::SetLevel(int level, const uint8_t* pixels, size_t rowPitch)
+{
+    assert(level >= 0 && level < NumLevels);
+
+    const Level& dest = Levels[level];
+    uint32_t* texels = &Texels[dest.Offset];
+    for (int y = 0; y < dest.Height; ++y)
+    {
+        const uint32_t* row = (const uint32_t*)(pixels + y * rowPitch);
+        for (int x = 0; x < dest.Width; ++x)
+        {
+            texels[GetTexelIndex(dest, x, y)] = row[x];
+        }
+    }
+}
+
+size_t Texture::GetTexelIndex(const Level& level, int x, int y)
+{
+    size_t tile = (size_t)(y >> TileShift) * level.TilesX + (x >> TileShift);
+    return tile * TexelsPerTile + (MortonBits[x & (TileSize - 1)] | (MortonBits[y & (TileSize - 1)] << 1));
+}
+
+XMVECTOR Texture::GatherBilinear(const Level& level, float u, float v, XMVECTOR* weights) const
+{
+    // Texel centers are at half texels, so the 4 texels blended are the ones around (x, y)
+    float x = (u - floorf(u)) * level.Width - 0.5f;
+    float y = (v - floorf(v)) * level.Height - 0.5f;
+    float fx = floorf(x);
+    float fy = floorf(y);
+    float tx = x - fx;
+    float ty = y - fy;
+
+    // Wrap around at the edges. Rounding can put u - floor(u) at exactly 1, which lands on
+    // the last texel, so neither end goes more than one texel out of range.
+    int x0 = (int)fx;
+    int y0 = (int)fy;
+    x0 = x0 < 0 ? level.Width - 1 : min(x0, level.Width - 1);
+    y0 = y0 < 0 ? level.Height - 1 : min(y0, level.Height - 1);
+    int x1 = x0 + 1 < level.Width ? x0 + 1 : 0;
+    int y1 = y0 + 1 < level.Height ? y0 + 1 : 0;
+
+    *weights = XMVectorSet((1.f - tx) * (1.f - ty), tx * (1.f - ty), (1.f - tx) * ty, tx * ty);
+
+    const uint32_t* texels = &Texels[level.Offset];
+    return XMVectorSetInt(
+        texels[GetTexelIndex(level, x0, y0)],
+        texels[GetTexelIndex(level, x1, y0)],
+        texels[GetTexelIndex(level, x0, y1)],
+        texels[GetTexelIndex(level, x1, y1)]);
+}
+
+// Weighted sum of 4 packed texels, as (r, g, b, 0). The weights are for colors in [0, 255].
+static inline XMVECTOR FilterTexels(FXMVECTOR texels, FXMVECTOR weights)
+{
+    static const XMVECTORU32 RedMask = { 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000 };
+    static const XMVECTORU32 GreenMask = { 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x0000FF00 };
+    static const XMVECTORU32 BlueMask = { 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF };
+
+    // One channel of all 4 texels per row, so the weights apply to every channel at once,
+    // then transposed so the sums over the texels come out as a single color
+    XMMATRIX channels;
+    channels.r[0] = XMConvertVectorIntToFloat(XMVectorAndInt(texels, RedMask), 16) * weights;
+    channels.r[1] = XMConvertVectorIntToFloat(XMVectorAndInt(texels, GreenMask), 8) * weights;
+    channels.r[2] = XMConvertVectorIntToFloat(XMVectorAndInt(texels, BlueMask), 0) * weights;
+    channels.r[3] = XMVectorZero();
+    channels = XMMatrixTranspose(channels);
+    return (channels.r[0] + channels.r[1]) + (channels.r[2] + channels.r[3]);
+}
+
+XMVECTOR Texture::SampleLevel(float u, float v, int level) const
+{
+    assert(level >= 0 && level < NumLevels);
+
+    XMVECTOR weights;
+    XMVECTOR texels = GatherBilinear(Levels[level], u, v, &weights);
+    return FilterTexels(texels, weights * (1.f / 255.f));
+}
+
+XMVECTOR Texture::Sample(float u, float v, float lod) const
+{
+    assert(NumLevels > 0);
+
+    // Magnified (or NaN, from a degenerate footprint): the top level is as sharp as it gets
+    if (!(lod > 0.f))
+    {
+        return SampleLevel(u, v, 0);
+    }
+    if (lod >= (float)(NumLevels - 1))
+    {
+        return SampleLevel(u, v, NumLevels - 1);
+    }
+
+    int level = (int)lod;
+    float blend = lod - level;
+
+    XMVECTOR weights0, weights1;
+    XMVECTOR texels0 = GatherBilinear(Levels[level], u, v, &weights0);
+    XMVECTOR texels1 = GatherBilinear(Levels[level + 1], u, v, &weights1);
+    return FilterTexels(texels0, weights0 * ((1.f - blend) / 255.f)) +
+        FilterTexels(texels1, weights1 * (blend / 255.f));
+}
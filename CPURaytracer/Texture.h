@@ -0,0 +1,66 @@
+#pragma once
+
+/// Mipmapped 32 bit texture (blue in the low byte, red in bits 16-23, like the back buffer),
+/// with filtered sampling for shading. Texture coordinates wrap, so textures tile.
+///
+/// Texels aren't stored row by row. Each mip level is split into 8x8 tiles, stored one
+/// after the other, and the 64 texels of a tile are in Morton (Z) order, so every aligned
+/// 4x4 block of texels is one 64 byte cache line. A bilinear footprint then usually sits in
+/// a single line whichever way the texture is oriented, where rows need one line per row
+/// and jump a whole row of memory apart. With mips picked to match the footprint of the ray,
+/// neighboring rays land on neighboring texels, and far away surfaces read small mips instead
+/// of striding across the full size image.
+class Texture
+{
+public:
+    Texture();
+
+    // Allocate width x height texels at the top level, plus numLevels - 1 mips below it (all
+    // of them if numLevels is 0). Each level is half the size of the one above, rounded down
+    // but at least 1, down to 1x1. Levels start out black until filled with SetLevel.
+    bool Initialize(int width, int height, int numLevels = 0);
+
+    // Fill a level from a row major image of its size, with rows rowPitch bytes apart
+    void SetLevel(int level, const uint8_t* pixels, size_t rowPitch);
+
+    bool IsValid() const { return NumLevels > 0; }
+
+    int GetWidth() const { return NumLevels > 0 ? Levels[0].Width : 0; }
+    int GetHeight() const { return NumLevels > 0 ? Levels[0].Height : 0; }
+    int GetNumLevels() const { return NumLevels; }
+
+    // Bilinear filtered color (r, g, b, 0) in [0, 1] from one mip level
+    XMVECTOR SampleLevel(float u, float v, int level) const;
+
+    // Trilinear filtered color (r, g, b, 0) in [0, 1]. lod is the mip level to sample, with the
+    // fraction blending between the two nearest levels: log2 of the width of the footprint
+    // being filtered, in texels of the top level. Clamped to the levels available.
+    XMVECTOR Sample(float u, float v, float lod) const;
+
+    size_t GetMemoryUsage() const { return TotalTexels * sizeof(uint32_t); }
+
+private:
+    // Don't allow copy
+    Texture(const Texture&);
+    Texture& operator= (const Texture&);
+
+    struct Level
+    {
+        int Width;
+        int Height;
+        int TilesX;         // Tiles per row of tiles
+        size_t Offset;      // First texel of the level in Texels
+    };
+
+    // Index of texel (x, y) of a level, within the level
+    static size_t GetTexelIndex(const Level& level, int x, int y);
+
+    // The 4 texels a bilinear lookup at (u, v) blends, packed in a vector, and their weights
+    XMVECTOR GatherBilinear(const Level& level, float u, float v, XMVECTOR* weights) const;
+
+    static const int MaxLevels = 16;
+    Level Levels[MaxLevels];
+    int NumLevels;
+    std::unique_ptr<uint32_t[]> Texels;
+    size_t TotalTexels;
+};
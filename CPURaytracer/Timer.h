@@ -0,0 +1,15 @@
+#pragma once
+
+// High resolution timer, in seconds from an arbitrary starting point
+inline double GetTimeInSeconds()
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency = {};
+    LARGE_INTEGER time = {};
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&time);
+    return (double)time.QuadPart / (double)frequency.QuadPart;
+#else
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
@@ -0,0 +1,245 @@
+#pragma once
+
+// Number of triangles tested at once by the SIMD intersection kernel. 8 wide when
+// the compiler is allowed to emit AVX2 (/arch:AVX2), otherwise 4 wide using DirectXMath.
+#if defined(__AVX2__)
+#include <immintrin.h>
+static const int TrianglePacketWidth = 8;
+#else
+static const int TrianglePacketWidth = 4;
+#endif
+
+// A group of triangles stored structure-of-arrays, so that a ray can be tested against
+// all of them at once. Each triangle is stored as its first vertex and the two edges
+// leaving it, which is what the Moller-Trumbore test consumes. Unused lanes have zero
+// length edges, so they are degenerate and never hit.
+struct TrianglePacket
+{
+    float V0[3][TrianglePacketWidth];       // x, y, z
+    float Edge1[3][TrianglePacketWidth];    // b - a
+    float Edge2[3][TrianglePacketWidth];    // c - a
+    int Triangle[TrianglePacketWidth];      // Index of source triangle, -1 if lane is unused
+};
+
+inline void ClearTrianglePacketLane(TrianglePacket* packet, int lane)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        packet->V0[i][lane] = 0.f;
+        packet->Edge1[i][lane] = 0.f;
+        packet->Edge2[i][lane] = 0.f;
+    }
+    packet->Triangle[lane] = -1;
+}
+
+inline void SetTrianglePacketLane(TrianglePacket* packet, int lane, FXMVECTOR a, FXMVECTOR b, FXMVECTOR c, int triangle)
+{
+    XMFLOAT3 v0, e1, e2;
+    XMStoreFloat3(&v0, a);
+    XMStoreFloat3(&e1, XMVectorSubtract(b, a));
+    XMStoreFloat3(&e2, XMVectorSubtract(c, a));
+
+    packet->V0[0][lane] = v0.x;
+    packet->V0[1][lane] = v0.y;
+    packet->V0[2][lane] = v0.z;
+    packet->Edge1[0][lane] = e1.x;
+    packet->Edge1[1][lane] = e1.y;
+    packet->Edge1[2][lane] = e1.z;
+    packet->Edge2[0][lane] = e2.x;
+    packet->Edge2[1][lane] = e2.y;
+    packet->Edge2[2][lane] = e2.z;
+    packet->Triangle[lane] = triangle;
+}
+
+//
+// Moller-Trumbore, one ray against TrianglePacketWidth triangles. Like the scalar test,
+// only the front face (counter clockwise, as seen by the ray) is hit.
+//
+// TrianglePacketHits returns a bit mask of the lanes hit closer than maxDist. If any
+// were hit and dists is non-null, the per-lane distances and barycentrics (weights of
+// the 2nd & 3rd vertex) are written to dists, us & vs.
+//
+
+#if defined(__AVX2__)
+
+// Ray with each component broadcast across the lanes, set up once per ray
+struct TrianglePacketRay
+{
+    __m256 Start[3];
+    __m256 Dir[3];
+};
+
+inline void PrepareTrianglePacketRay(FXMVECTOR start, FXMVECTOR dir, TrianglePacketRay* ray)
+{
+    ray->Start[0] = _mm256_set1_ps(XMVectorGetX(start));
+    ray->Start[1] = _mm256_set1_ps(XMVectorGetY(start));
+    ray->Start[2] = _mm256_set1_ps(XMVectorGetZ(start));
+    ray->Dir[0] = _mm256_set1_ps(XMVectorGetX(dir));
+    ray->Dir[1] = _mm256_set1_ps(XMVectorGetY(dir));
+    ray->Dir[2] = _mm256_set1_ps(XMVectorGetZ(dir));
+}
+
+inline int TrianglePacketHits(const TrianglePacketRay& ray, const TrianglePacket& packet, float maxDist, float* dists, float* us, float* vs)
+{
+    __m256 e1x = _mm256_loadu_ps(packet.Edge1[0]);
+    __m256 e1y = _mm256_loadu_ps(packet.Edge1[1]);
+    __m256 e1z = _mm256_loadu_ps(packet.Edge1[2]);
+    __m256 e2x = _mm256_loadu_ps(packet.Edge2[0]);
+    __m256 e2y = _mm256_loadu_ps(packet.Edge2[1]);
+    __m256 e2z = _mm256_loadu_ps(packet.Edge2[2]);
+
+    // p = dir x e2
+    __m256 px = _mm256_sub_ps(_mm256_mul_ps(ray.Dir[1], e2z), _mm256_mul_ps(ray.Dir[2], e2y));
+    __m256 py = _mm256_sub_ps(_mm256_mul_ps(ray.Dir[2], e2x), _mm256_mul_ps(ray.Dir[0], e2z));
+    __m256 pz = _mm256_sub_ps(_mm256_mul_ps(ray.Dir[0], e2y), _mm256_mul_ps(ray.Dir[1], e2x));
+
+    // det > 0 means the ray is heading into the front face
+    __m256 det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)), _mm256_mul_ps(e1z, pz));
+    __m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.f), det);
+
+    // t = start - v0
+    __m256 tx = _mm256_sub_ps(ray.Start[0], _mm256_loadu_ps(packet.V0[0]));
+    __m256 ty = _mm256_sub_ps(ray.Start[1], _mm256_loadu_ps(packet.V0[1]));
+    __m256 tz = _mm256_sub_ps(ray.Start[2], _mm256_loadu_ps(packet.V0[2]));
+
+    __m256 hitU = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(tx, px), _mm256_mul_ps(ty, py)), _mm256_mul_ps(tz, pz)), invDet);
+
+    // q = t x e1
+    __m256 qx = _mm256_sub_ps(_mm256_mul_ps(ty, e1z), _mm256_mul_ps(tz, e1y));
+    __m256 qy = _mm256_sub_ps(_mm256_mul_ps(tz, e1x), _mm256_mul_ps(tx, e1z));
+    __m256 qz = _mm256_sub_ps(_mm256_mul_ps(tx, e1y), _mm256_mul_ps(ty, e1x));
+
+    __m256 hitV = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ray.Dir[0], qx), _mm256_mul_ps(ray.Dir[1], qy)), _mm256_mul_ps(ray.Dir[2], qz)), invDet);
+    __m256 dist = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)), _mm256_mul_ps(e2z, qz)), invDet);
+
+    __m256 zero = _mm256_setzero_ps();
+    __m256 mask = _mm256_cmp_ps(det, zero, _CMP_GT_OQ);
+    mask = _mm256_and_ps(mask, _mm256_cmp_ps(hitU, zero, _CMP_GE_OQ));
+    mask = _mm256_and_ps(mask, _mm256_cmp_ps(hitV, zero, _CMP_GE_OQ));
+    mask = _mm256_and_ps(mask, _mm256_cmp_ps(_mm256_add_ps(hitU, hitV), _mm256_set1_ps(1.f), _CMP_LE_OQ));
+    mask = _mm256_and_ps(mask, _mm256_cmp_ps(dist, zero, _CMP_GT_OQ));
+    mask = _mm256_and_ps(mask, _mm256_cmp_ps(dist, _mm256_set1_ps(maxDist), _CMP_LT_OQ));
+
+    int hits = _mm256_movemask_ps(mask);
+    if (hits != 0 && dists)
+    {
+        _mm256_storeu_ps(dists, dist);
+        _mm256_storeu_ps(us, hitU);
+        _mm256_storeu_ps(vs, hitV);
+    }
+    return hits;
+}
+
+#else
+
+// Ray with each component broadcast across the lanes, set up once per ray
+struct TrianglePacketRay
+{
+    XMVECTOR Start[3];
+    XMVECTOR Dir[3];
+};
+
+inline void PrepareTrianglePacketRay(FXMVECTOR start, FXMVECTOR dir, TrianglePacketRay* ray)
+{
+    ray->Start[0] = XMVectorSplatX(start);
+    ray->Start[1] = XMVectorSplatY(start);
+    ray->Start[2] = XMVectorSplatZ(start);
+    ray->Dir[0] = XMVectorSplatX(dir);
+    ray->Dir[1] = XMVectorSplatY(dir);
+    ray->Dir[2] = XMVectorSplatZ(dir);
+}
+
+inline int TrianglePacketHits(const TrianglePacketRay& ray, const TrianglePacket& packet, float maxDist, float* dists, float* us, float* vs)
+{
+    XMVECTOR e1x = XMLoadFloat4((const XMFLOAT4*)packet.Edge1[0]);
+    XMVECTOR e1y = XMLoadFloat4((const XMFLOAT4*)packet.Edge1[1]);
+    XMVECTOR e1z = XMLoadFloat4((const XMFLOAT4*)packet.Edge1[2]);
+    XMVECTOR e2x = XMLoadFloat4((const XMFLOAT4*)packet.Edge2[0]);
+    XMVECTOR e2y = XMLoadFloat4((const XMFLOAT4*)packet.Edge2[1]);
+    XMVECTOR e2z = XMLoadFloat4((const XMFLOAT4*)packet.Edge2[2]);
+
+    // p = dir x e2
+    XMVECTOR px = ray.Dir[1] * e2z - ray.Dir[2] * e2y;
+    XMVECTOR py = ray.Dir[2] * e2x - ray.Dir[0] * e2z;
+    XMVECTOR pz = ray.Dir[0] * e2y - ray.Dir[1] * e2x;
+
+    // det > 0 means the ray is heading into the front face
+    XMVECTOR det = e1x * px + e1y * py + e1z * pz;
+    XMVECTOR invDet = XMVectorReciprocal(det);
+
+    // t = start - v0
+    XMVECTOR tx = ray.Start[0] - XMLoadFloat4((const XMFLOAT4*)packet.V0[0]);
+    XMVECTOR ty = ray.Start[1] - XMLoadFloat4((const XMFLOAT4*)packet.V0[1]);
+    XMVECTOR tz = ray.Start[2] - XMLoadFloat4((const XMFLOAT4*)packet.V0[2]);
+
+    XMVECTOR hitU = (tx * px + ty * py + tz * pz) * invDet;
+
+    // q = t x e1
+    XMVECTOR qx = ty * e1z - tz * e1y;
+    XMVECTOR qy = tz * e1x - tx * e1z;
+    XMVECTOR qz = tx * e1y - ty * e1x;
+
+    XMVECTOR hitV = (ray.Dir[0] * qx + ray.Dir[1] * qy + ray.Dir[2] * qz) * invDet;
+    XMVECTOR dist = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+
+    XMVECTOR zero = XMVectorZero();
+    XMVECTOR mask = XMVectorGreater(det, zero);
+    mask = XMVectorAndInt(mask, XMVectorGreaterOrEqual(hitU, zero));
+    mask = XMVectorAndInt(mask, XMVectorGreaterOrEqual(hitV, zero));
+    mask = XMVectorAndInt(mask, XMVectorLessOrEqual(hitU + hitV, XMVectorSplatOne()));
+    mask = XMVectorAndInt(mask, XMVectorGreater(dist, zero));
+    mask = XMVectorAndInt(mask, XMVectorLess(dist, XMVectorReplicate(maxDist)));
+
+    if (XMVector4EqualInt(mask, XMVectorFalseInt()))
+    {
+        return 0;
+    }
+
+    XMUINT4 maskLanes;
+    XMStoreUInt4(&maskLanes, mask);
+    int hits = (maskLanes.x ? 1 : 0) | (maskLanes.y ? 2 : 0) | (maskLanes.z ? 4 : 0) | (maskLanes.w ? 8 : 0);
+
+    if (dists)
+    {
+        XMStoreFloat4((XMFLOAT4*)dists, dist);
+        XMStoreFloat4((XMFLOAT4*)us, hitU);
+        XMStoreFloat4((XMFLOAT4*)vs, hitV);
+    }
+    return hits;
+}
+
+#endif
+
+// Returns the lane of the nearest hit closer than *nearest (updating nearest, u & v),
+// or -1 if there was none. Only the distance and barycentrics are produced; everything
+// else about the hit is left for the caller to compute once the final nearest triangle is known.
+inline int IntersectTrianglePacket(const TrianglePacketRay& ray, const TrianglePacket& packet, float* nearest, float* u, float* v)
+{
+    float dists[TrianglePacketWidth], us[TrianglePacketWidth], vs[TrianglePacketWidth];
+    int hits = TrianglePacketHits(ray, packet, *nearest, dists, us, vs);
+    if (hits == 0)
+    {
+        return -1;
+    }
+
+    // Rare path: at least one lane hit, pick the nearest
+    int nearestLane = -1;
+    for (int lane = 0; lane < TrianglePacketWidth; ++lane)
+    {
+        if ((hits & (1 << lane)) && dists[lane] < *nearest)
+        {
+            *nearest = dists[lane];
+            nearestLane = lane;
+        }
+    }
+
+    *u = us[nearestLane];
+    *v = vs[nearestLane];
+    return nearestLane;
+}
+
+// True if any triangle in the packet is hit closer than maxDist
+inline bool OccludeTrianglePacket(const TrianglePacketRay& ray, const TrianglePacket& packet, float maxDist)
+{
+    return TrianglePacketHits(ray, packet, maxDist, nullptr, nullptr, nullptr) != 0;
+}
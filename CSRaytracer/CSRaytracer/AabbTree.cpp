@@ -0,0 +1,507 @@
+#include "Precomp.h"
+#include "AabbTree.h"
+
+static Aabb Union(const Aabb& a, const Aabb& b)
+{
+    Aabb result;
+    XMStoreFloat3(&result.Min, XMVectorMin(XMLoadFloat3(&a.Min), XMLoadFloat3(&b.Min)));
+    XMStoreFloat3(&result.Max, XMVectorMax(XMLoadFloat3(&a.Max), XMLoadFloat3(&b.Max)));
+    return result;
+}
+
+static XMVECTOR Center(const Aabb& box)
+{
+    return (XMLoadFloat3(&box.Min) + XMLoadFloat3(&box.Max)) * 0.5f;
+}
+
+// Build the subtree over indices [0, count), returning its index as a child (an object's index
+// is encoded as -(i+1)), and its bounds
+static int BuildSubtree(const Aabb* objects, int* indices, int count, std::vector<AabbNode>* nodes, Aabb* bounds)
+{
+    if (count == 1)
+    {
+        *bounds = objects[indices[0]];
+        return -(indices[0] + 1);
+    }
+
+    // Split along the axis the objects' centers are most spread out on
+    XMVECTOR centerMin = Center(objects[indices[0]]);
+    XMVECTOR centerMax = centerMin;
+    for (int i = 1; i < count; ++i)
+    {
+        XMVECTOR center = Center(objects[indices[i]]);
+        centerMin = XMVectorMin(centerMin, center);
+        centerMax = XMVectorMax(centerMax, center);
+    }
+    XMFLOAT3 spread;
+    XMStoreFloat3(&spread, centerMax - centerMin);
+    int axis = (spread.x > spread.y && spread.x > spread.z) ? 0 : (spread.y > spread.z ? 1 : 2);
+
+    int half = count / 2;
+    std::nth_element(indices, indices + half, indices + count, [&](int a, int b)
+    {
+        return (&objects[a].Min.x)[axis] + (&objects[a].Max.x)[axis] < (&objects[b].Min.x)[axis] + (&objects[b].Max.x)[axis];
+    });
+
+    // Children are filled in after they're built, since building them can move the nodes
+    int index = (int)nodes->size();
+    nodes->push_back(AabbNode{});
+
+    Aabb left, right;
+    int leftIndex = BuildSubtree(objects, indices, half, nodes, &left);
+    int rightIndex = BuildSubtree(objects, indices + half, count - half, nodes, &right);
+
+    AabbNode& node = (*nodes)[index];
+    node.LeftMin = left.Min;
+    node.LeftMax = left.Max;
+    node.RightMin = right.Min;
+    node.RightMax = right.Max;
+    node.LeftIndex = leftIndex;
+    node.RightIndex = rightIndex;
+
+    *bounds = Union(left, right);
+    return index;
+}
+
+bool BuildAabbTree(const Aabb* objects, int numObjects, std::vector<AabbNode>* nodes)
+{
+    // The root has to be a node, with two children
+    if (numObjects < 2)
+    {
+        OutputDebugString(L"At least 2 objects are needed to build a tree.\n");
+        assert(false);
+        return false;
+    }
+
+    std::vector<int> indices(numObjects);
+    for (int i = 0; i < numObjects; ++i)
+    {
+        indices[i] = i;
+    }
+
+    nodes->clear();
+    nodes->reserve(numObjects - 1);
+
+    Aabb bounds;
+    BuildSubtree(objects, indices.data(), numObjects, nodes, &bounds);
+    return true;
+}
+
+void GenerateRandomBoxes(int numBoxes, float extent, uint32_t seed, std::vector<Aabb>* boxes)
+{
+    // Sizes are relative to the cube, so the scene looks much the same at any scale
+    static const float MinSize = 0.005f;
+    static const float MaxSize = 0.05f;
+
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> size(MinSize * extent, MaxSize * extent);
+
+    boxes->resize(numBoxes);
+    for (int i = 0; i < numBoxes; ++i)
+    {
+        XMVECTOR center = XMVectorSet(position(random), position(random), position(random), 0.f);
+        XMVECTOR halfSize = XMVectorSet(size(random), size(random), size(random), 0.f);
+        XMStoreFloat3(&(*boxes)[i].Min, center - halfSize);
+        XMStoreFloat3(&(*boxes)[i].Max, center + halfSize);
+    }
+}
+
+// Bounds of the subtree under a child (node or object), after checking that it's well formed
+static bool ValidateSubtree(const AabbNode* nodes, int numNodes, const Aabb* objects, int numObjects, int child,
+    std::vector<bool>* nodesSeen, std::vector<bool>* objectsSeen, Aabb* bounds)
+{
+    if (child < 0)
+    {
+        int object = -(child + 1);
+        if (object >= numObjects || (*objectsSeen)[object])
+        {
+            return false;
+        }
+        (*objectsSeen)[object] = true;
+        *bounds = objects[object];
+        return true;
+    }
+
+    if (child >= numNodes || (*nodesSeen)[child])
+    {
+        return false;
+    }
+    (*nodesSeen)[child] = true;
+
+    const AabbNode& node = nodes[child];
+    Aabb left, right;
+    if (!ValidateSubtree(nodes, numNodes, objects, numObjects, node.LeftIndex, nodesSeen, objectsSeen, &left) ||
+        !ValidateSubtree(nodes, numNodes, objects, numObjects, node.RightIndex, nodesSeen, objectsSeen, &right))
+    {
+        return false;
+    }
+
+    if (memcmp(&node.LeftMin, &left.Min, sizeof(XMFLOAT3)) || memcmp(&node.LeftMax, &left.Max, sizeof(XMFLOAT3)) ||
+        memcmp(&node.RightMin, &right.Min, sizeof(XMFLOAT3)) || memcmp(&node.RightMax, &right.Max, sizeof(XMFLOAT3)))
+    {
+        return false;
+    }
+
+    *bounds = Union(left, right);
+    return true;
+}
+
+bool ValidateAabbTree(const AabbNode* nodes, int numNodes, const Aabb* objects, int numObjects)
+{
+    // A tree of binary nodes always has one node less than it has objects
+    if (numObjects < 2 || numNodes != numObjects - 1)
+    {
+        return false;
+    }
+
+    std::vector<bool> nodesSeen(numNodes);
+    std::vector<bool> objectsSeen(numObjects);
+    Aabb bounds;
+    if (!ValidateSubtree(nodes, numNodes, objects, numObjects, 0, &nodesSeen, &objectsSeen, &bounds))
+    {
+        return false;
+    }
+
+    // With one node per object (less one), every object is reached if every node is
+    return std::find(nodesSeen.begin(), nodesSeen.end(), false) == nodesSeen.end();
+}
+
+//==============================================================================
+// Linear BVH builder
+//==============================================================================
+
+// Digits of the radix sort. 11 bits sorts 30 bit codes in 3 passes, and 63 bit codes in 6.
+static const int RadixBits = 11;
+static const int NumRadixBuckets = 1 << RadixBits;
+
+static double GetMilliseconds(std::chrono::high_resolution_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+// Split count items evenly into parts, and get the range of one of them
+static void GetRange(int count, int numParts, int part, int* first, int* end)
+{
+    *first = (int)((int64_t)count * part / numParts);
+    *end = (int)((int64_t)count * (part + 1) / numParts);
+}
+
+// Spread the low 10 bits of x out to every 3rd bit
+static uint64_t SpreadBits10(uint32_t x)
+{
+    x = (x * 0x00010001u) & 0xff0000ffu;
+    x = (x * 0x00000101u) & 0x0f00f00fu;
+    x = (x * 0x00000011u) & 0xc30c30c3u;
+    x = (x * 0x00000005u) & 0x49249249u;
+    return x;
+}
+
+// Spread the low 21 bits of x out to every 3rd bit
+static uint64_t SpreadBits21(uint64_t x)
+{
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x001f00000000ffffull;
+    x = (x | x << 16) & 0x001f0000ff0000ffull;
+    x = (x | x << 8) & 0x100f00f00f00f00full;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+    x = (x | x << 2) & 0x1249249249249249ull;
+    return x;
+}
+
+static int CountLeadingZeros(uint64_t x)
+{
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return 63 - (int)index;
+}
+
+// The length of the prefix that sorted codes i & j share. Codes that are the same are told apart
+// by their positions, as if those were appended to them. Positions outside of the codes share nothing.
+static int CommonPrefix(const uint64_t* codes, int numCodes, int i, int j)
+{
+    if (j < 0 || j >= numCodes)
+    {
+        return -1;
+    }
+    if (codes[i] == codes[j])
+    {
+        return 64 + CountLeadingZeros((uint64_t)(i ^ j));
+    }
+    return CountLeadingZeros(codes[i] ^ codes[j]);
+}
+
+LbvhBuilder::LbvhBuilder(int numThreads)
+    : NumThreads(std::max(numThreads, 1))
+    , Workers(NumThreads)
+    , MaxNodes(0)
+{
+    Stats = BuildStats{};
+    BucketOffsets.resize(NumThreads * NumRadixBuckets);
+}
+
+bool LbvhBuilder::Build(const Aabb* objects, int numObjects, bool use63BitCodes, std::vector<AabbNode>* nodes)
+{
+    if (numObjects < 2)
+    {
+        OutputDebugString(L"At least 2 objects are needed to build a tree.\n");
+        assert(false);
+        return false;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    if (numObjects > (int)Codes.size())
+    {
+        Codes.resize(numObjects);
+        Objects.resize(numObjects);
+        SortedCodes.resize(numObjects);
+        SortedObjects.resize(numObjects);
+        ObjectParents.resize(numObjects);
+    }
+
+    int numNodes = numObjects - 1;
+    if (numNodes > MaxNodes)
+    {
+        NodeParents.resize(numNodes);
+        NodeBounds.resize(numNodes);
+        ChildrenDone.reset(new std::atomic<int>[numNodes]);
+        MaxNodes = numNodes;
+    }
+    nodes->resize(numNodes);
+
+    auto stepTime = std::chrono::high_resolution_clock::now();
+    ComputeCodes(objects, numObjects, use63BitCodes);
+    Stats.Codes = GetMilliseconds(stepTime);
+
+    stepTime = std::chrono::high_resolution_clock::now();
+    SortCodes(numObjects, use63BitCodes ? 63 : 30);
+    Stats.Sort = GetMilliseconds(stepTime);
+
+    stepTime = std::chrono::high_resolution_clock::now();
+    BuildHierarchy(numObjects, nodes->data());
+    Stats.Hierarchy = GetMilliseconds(stepTime);
+
+    stepTime = std::chrono::high_resolution_clock::now();
+    ComputeBounds(objects, numObjects, nodes->data());
+    Stats.Bounds = GetMilliseconds(stepTime);
+
+    Stats.Total = GetMilliseconds(startTime);
+    return true;
+}
+
+void LbvhBuilder::ComputeCodes(const Aabb* objects, int numObjects, bool use63BitCodes)
+{
+    // Codes cover the bounds of the objects' centers (kept doubled, saving a multiply)
+    std::vector<XMFLOAT3> threadMins(NumThreads), threadMaxs(NumThreads);
+    Workers.Run([&](int thread)
+    {
+        int first, end;
+        GetRange(numObjects, NumThreads, thread, &first, &end);
+
+        XMVECTOR centerMin = XMVectorReplicate(FLT_MAX);
+        XMVECTOR centerMax = XMVectorReplicate(-FLT_MAX);
+        for (int i = first; i < end; ++i)
+        {
+            XMVECTOR center = XMLoadFloat3(&objects[i].Min) + XMLoadFloat3(&objects[i].Max);
+            centerMin = XMVectorMin(centerMin, center);
+            centerMax = XMVectorMax(centerMax, center);
+        }
+        XMStoreFloat3(&threadMins[thread], centerMin);
+        XMStoreFloat3(&threadMaxs[thread], centerMax);
+    });
+
+    XMVECTOR centerMin = XMLoadFloat3(&threadMins[0]);
+    XMVECTOR centerMax = XMLoadFloat3(&threadMaxs[0]);
+    for (int i = 1; i < NumThreads; ++i)
+    {
+        centerMin = XMVectorMin(centerMin, XMLoadFloat3(&threadMins[i]));
+        centerMax = XMVectorMax(centerMax, XMLoadFloat3(&threadMaxs[i]));
+    }
+
+    // Each axis is stretched over the whole grid, unless the centers are all the same on it
+    float gridMax = use63BitCodes ? (float)((1 << 21) - 1) : (float)((1 << 10) - 1);
+    XMVECTOR extent = centerMax - centerMin;
+    XMVECTOR scale = XMVectorSelect(XMVectorDivide(XMVectorReplicate(gridMax), extent), XMVectorZero(),
+        XMVectorEqual(extent, XMVectorZero()));
+
+    Workers.Run([&](int thread)
+    {
+        int first, end;
+        GetRange(numObjects, NumThreads, thread, &first, &end);
+
+        for (int i = first; i < end; ++i)
+        {
+            XMVECTOR center = XMLoadFloat3(&objects[i].Min) + XMLoadFloat3(&objects[i].Max);
+            XMVECTOR cell = XMVectorClamp((center - centerMin) * scale, XMVectorZero(), XMVectorReplicate(gridMax));
+            XMFLOAT3 c;
+            XMStoreFloat3(&c, cell);
+
+            if (use63BitCodes)
+            {
+                Codes[i] = (SpreadBits21((uint64_t)c.x) << 2) | (SpreadBits21((uint64_t)c.y) << 1) | SpreadBits21((uint64_t)c.z);
+            }
+            else
+            {
+                Codes[i] = (SpreadBits10((uint32_t)c.x) << 2) | (SpreadBits10((uint32_t)c.y) << 1) | SpreadBits10((uint32_t)c.z);
+            }
+            Objects[i] = i;
+        }
+    });
+}
+
+void LbvhBuilder::SortCodes(int numObjects, int numBits)
+{
+    // Least significant digit first. Each thread counts the digits in its part of the codes, and
+    // then moves its codes to where its share of each bucket starts, in order, keeping the sort stable.
+    for (int shift = 0; shift < numBits; shift += RadixBits)
+    {
+        Workers.Run([&](int thread)
+        {
+            int first, end;
+            GetRange(numObjects, NumThreads, thread, &first, &end);
+
+            int* counts = &BucketOffsets[thread * NumRadixBuckets];
+            memset(counts, 0, NumRadixBuckets * sizeof(int));
+            for (int i = first; i < end; ++i)
+            {
+                ++counts[(Codes[i] >> shift) & (NumRadixBuckets - 1)];
+            }
+        });
+
+        int offset = 0;
+        for (int bucket = 0; bucket < NumRadixBuckets; ++bucket)
+        {
+            for (int thread = 0; thread < NumThreads; ++thread)
+            {
+                int count = BucketOffsets[thread * NumRadixBuckets + bucket];
+                BucketOffsets[thread * NumRadixBuckets + bucket] = offset;
+                offset += count;
+            }
+        }
+
+        Workers.Run([&](int thread)
+        {
+            int first, end;
+            GetRange(numObjects, NumThreads, thread, &first, &end);
+
+            int* offsets = &BucketOffsets[thread * NumRadixBuckets];
+            for (int i = first; i < end; ++i)
+            {
+                int j = offsets[(Codes[i] >> shift) & (NumRadixBuckets - 1)]++;
+                SortedCodes[j] = Codes[i];
+                SortedObjects[j] = Objects[i];
+            }
+        });
+
+        std::swap(Codes, SortedCodes);
+        std::swap(Objects, SortedObjects);
+    }
+}
+
+void LbvhBuilder::BuildHierarchy(int numObjects, AabbNode* nodes)
+{
+    const uint64_t* codes = Codes.data();
+    NodeParents[0] = -1;
+
+    Workers.Run([&](int thread)
+    {
+        int first, end;
+        GetRange(numObjects - 1, NumThreads, thread, &first, &end);
+
+        for (int i = first; i < end; ++i)
+        {
+            // The node's range of codes extends in the direction that shares more with i
+            int d = CommonPrefix(codes, numObjects, i, i + 1) > CommonPrefix(codes, numObjects, i, i - 1) ? 1 : -1;
+
+            // Everything in the range shares more than i does with the code on the other side.
+            // Find roughly how far that goes, then the exact other end of the range (j).
+            int minPrefix = CommonPrefix(codes, numObjects, i, i - d);
+            int maxLength = 2;
+            while (CommonPrefix(codes, numObjects, i, i + maxLength * d) > minPrefix)
+            {
+                maxLength *= 2;
+            }
+            int length = 0;
+            for (int step = maxLength / 2; step >= 1; step /= 2)
+            {
+                if (CommonPrefix(codes, numObjects, i, i + (length + step) * d) > minPrefix)
+                {
+                    length += step;
+                }
+            }
+            int j = i + length * d;
+
+            // Split the range where the codes stop sharing the range's prefix
+            int nodePrefix = CommonPrefix(codes, numObjects, i, j);
+            int split = 0;
+            int step = length;
+            do
+            {
+                step = (step + 1) / 2;
+                if (CommonPrefix(codes, numObjects, i, i + (split + step) * d) > nodePrefix)
+                {
+                    split += step;
+                }
+            } while (step > 1);
+            int leftEnd = i + split * d + std::min(d, 0);
+
+            // Children that cover a single code are objects
+            AabbNode& node = nodes[i];
+            if (std::min(i, j) == leftEnd)
+            {
+                node.LeftIndex = -(Objects[leftEnd] + 1);
+                ObjectParents[leftEnd] = i;
+            }
+            else
+            {
+                node.LeftIndex = leftEnd;
+                NodeParents[leftEnd] = i;
+            }
+
+            if (std::max(i, j) == leftEnd + 1)
+            {
+                node.RightIndex = -(Objects[leftEnd + 1] + 1);
+                ObjectParents[leftEnd + 1] = i;
+            }
+            else
+            {
+                node.RightIndex = leftEnd + 1;
+                NodeParents[leftEnd + 1] = i;
+            }
+
+            ChildrenDone[i] = 0;
+        }
+    });
+}
+
+void LbvhBuilder::ComputeBounds(const Aabb* objects, int numObjects, AabbNode* nodes)
+{
+    Workers.Run([&](int thread)
+    {
+        int first, end;
+        GetRange(numObjects, NumThreads, thread, &first, &end);
+
+        // Walk up from each object. The first child to reach a node stops there, and the second
+        // (which then knows both children's bounds) fills the node in and carries on up.
+        for (int i = first; i < end; ++i)
+        {
+            for (int parent = ObjectParents[i]; parent >= 0; parent = NodeParents[parent])
+            {
+                if (ChildrenDone[parent].fetch_add(1) == 0)
+                {
+                    break;
+                }
+
+                AabbNode& node = nodes[parent];
+                const Aabb& left = node.LeftIndex < 0 ? objects[-(node.LeftIndex + 1)] : NodeBounds[node.LeftIndex];
+                const Aabb& right = node.RightIndex < 0 ? objects[-(node.RightIndex + 1)] : NodeBounds[node.RightIndex];
+                node.LeftMin = left.Min;
+                node.LeftMax = left.Max;
+                node.RightMin = right.Min;
+                node.RightMax = right.Max;
+                NodeBounds[parent] = Union(left, right);
+            }
+        }
+    });
+}
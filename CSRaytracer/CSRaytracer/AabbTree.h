@@ -0,0 +1,101 @@
+#pragma once
+
+#include "WorkerPool.h"
+
+// Layouts shared with the compute shaders (see ShaderCommon.hlsli)
+
+// A node in the AABB bounding volume hierarchy
+struct AabbNode
+{
+    XMFLOAT3 LeftMin, LeftMax;      // AABB of left child
+    XMFLOAT3 RightMin, RightMax;    // AABB of right child
+
+    // Index of left & right child
+    // >= 0 means node
+    // < 0 means object, compute object index by -(i+1)
+    int LeftIndex, RightIndex;
+};
+
+// Task node in per-pixel linked list
+struct Task
+{
+    int Node;
+    int Next;
+};
+
+struct Aabb
+{
+    XMFLOAT3 Min;
+    XMFLOAT3 Max;
+};
+
+// Build a hierarchy over a set of objects (at least 2), given their bounds. Objects are split in
+// half at the median of their centers along the longest axis, top down. The root is nodes[0].
+bool BuildAabbTree(const Aabb* objects, int numObjects, std::vector<AabbNode>* nodes);
+
+// Randomly placed & sized boxes inside of a cube (from -extent to extent on each axis), for test scenes
+void GenerateRandomBoxes(int numBoxes, float extent, uint32_t seed, std::vector<Aabb>* boxes);
+
+// Check that a tree covers each object exactly once, and that each child's box is exactly the
+// bounds of the objects under it
+bool ValidateAabbTree(const AabbNode* nodes, int numNodes, const Aabb* objects, int numObjects);
+
+// Builds trees the way GPU builders do, as a linear BVH (Karras, "Maximizing Parallelism in the
+// Construction of BVHs, Octrees, and k-d Trees", 2012). Objects are sorted along a Morton curve
+// through their centers, with a parallel radix sort, and then each node of the tree is found
+// independently from the sorted codes: node i covers a range of objects that starts or ends at
+// i, and is split where the highest bit that differs across the range changes. Bounds are filled
+// in from the leaves up, with the second child to finish a node completing it. Every step runs
+// across the builder's threads, which are kept around between builds along with the scratch
+// memory.
+class LbvhBuilder
+{
+public:
+    // Time taken by each step of the last build, in milliseconds
+    struct BuildStats
+    {
+        double      Codes;          // Finding the bounds of the centers, and the Morton codes
+        double      Sort;
+        double      Hierarchy;
+        double      Bounds;
+        double      Total;
+    };
+
+    LbvhBuilder(int numThreads);
+
+    // Morton codes are either 30 bits (10 bits per axis), which sort in 3 passes, or 63 bits
+    // (21 bits per axis), which take 6 passes but still tell apart centers that are 2048x closer.
+    // Objects with the same code are ordered by index. Needs at least 2 objects, and the root is nodes[0].
+    bool Build(const Aabb* objects, int numObjects, bool use63BitCodes, std::vector<AabbNode>* nodes);
+
+    const BuildStats& GetBuildStats() const { return Stats; }
+
+private:
+    // Don't allow copy
+    LbvhBuilder(const LbvhBuilder&);
+    LbvhBuilder& operator= (const LbvhBuilder&);
+
+    void ComputeCodes(const Aabb* objects, int numObjects, bool use63BitCodes);
+    void SortCodes(int numObjects, int numBits);
+    void BuildHierarchy(int numObjects, AabbNode* nodes);
+    void ComputeBounds(const Aabb* objects, int numObjects, AabbNode* nodes);
+
+    int                                         NumThreads;
+    WorkerPool                                  Workers;
+
+    // Sorted codes, and the objects they belong to
+    std::vector<uint64_t>                       Codes;
+    std::vector<int>                            Objects;
+    std::vector<uint64_t>                       SortedCodes;
+    std::vector<int>                            SortedObjects;
+    std::vector<int>                            BucketOffsets;   // Per thread, per bucket
+
+    // Parents of the nodes, and of the sorted objects. Nodes are complete once both children are.
+    std::vector<int>                            NodeParents;
+    std::vector<int>                            ObjectParents;
+    std::vector<Aabb>                           NodeBounds;
+    std::unique_ptr<std::atomic<int>[]>         ChildrenDone;
+    int                                         MaxNodes;
+
+    BuildStats                                  Stats;
+};
@@ -0,0 +1,470 @@
+#include "Precomp.h"
+#include "CpuRaytracer.h"
+
+// Same as RayAabbIntersect in ShaderCommon.hlsli: the ray only hits faces it enters the box
+// through, so it misses boxes that it starts inside of
+static bool RayAabbIntersect(const XMFLOAT3& rayStart, const XMFLOAT3& rayDir, const XMFLOAT3& aabbMin,
+    const XMFLOAT3& aabbMax)
+{
+    const float* start = &rayStart.x;
+    const float* dir = &rayDir.x;
+    const float* boxMin = &aabbMin.x;
+    const float* boxMax = &aabbMax.x;
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float plane;
+        if (start[axis] < boxMin[axis] && dir[axis] > 0)
+        {
+            plane = boxMin[axis];
+        }
+        else if (start[axis] > boxMax[axis] && dir[axis] < 0)
+        {
+            plane = boxMax[axis];
+        }
+        else
+        {
+            continue;
+        }
+
+        float h = (plane - start[axis]) / dir[axis];
+        int b = (axis + 1) % 3;
+        int c = (axis + 2) % 3;
+        float pb = start[b] + dir[b] * h;
+        float pc = start[c] + dir[c] * h;
+        if (pb >= boxMin[b] && pb <= boxMax[b] && pc >= boxMin[c] && pc <= boxMax[c])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// RayAabbIntersect for 4 rays against 4 boxes, all as planes of x, y & z. Each lane does exactly
+// the same arithmetic as the single ray version, so they always agree.
+static XMVECTOR RayAabbIntersect4(const XMVECTOR* start, const XMVECTOR* dir, const XMVECTOR* boxMin,
+    const XMVECTOR* boxMax)
+{
+    XMVECTOR zero = XMVectorZero();
+    XMVECTOR hits = XMVectorFalseInt();
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        XMVECTOR enterMin = XMVectorAndInt(XMVectorLess(start[axis], boxMin[axis]), XMVectorGreater(dir[axis], zero));
+        XMVECTOR enterMax = XMVectorAndInt(XMVectorGreater(start[axis], boxMax[axis]), XMVectorLess(dir[axis], zero));
+
+        XMVECTOR plane = XMVectorSelect(boxMax[axis], boxMin[axis], enterMin);
+        XMVECTOR h = XMVectorDivide(plane - start[axis], dir[axis]);
+        int b = (axis + 1) % 3;
+        int c = (axis + 2) % 3;
+        XMVECTOR pb = start[b] + dir[b] * h;
+        XMVECTOR pc = start[c] + dir[c] * h;
+
+        XMVECTOR inside = XMVectorAndInt(XMVectorGreaterOrEqual(pb, boxMin[b]), XMVectorLessOrEqual(pb, boxMax[b]));
+        inside = XMVectorAndInt(inside, XMVectorGreaterOrEqual(pc, boxMin[c]));
+        inside = XMVectorAndInt(inside, XMVectorLessOrEqual(pc, boxMax[c]));
+        hits = XMVectorOrInt(hits, XMVectorAndInt(XMVectorOrInt(enterMin, enterMax), inside));
+    }
+    return hits;
+}
+
+// Bit i set for each lane i that's set in a comparison mask
+static int GetLanes(FXMVECTOR mask)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_movemask_ps(mask);
+#else
+    XMUINT4 lanes;
+    XMStoreUInt4(&lanes, mask);
+    return (lanes.x ? 1 : 0) | (lanes.y ? 2 : 0) | (lanes.z ? 4 : 0) | (lanes.w ? 8 : 0);
+#endif
+}
+
+static int CountLanes(int lanes)
+{
+    return (lanes & 1) + ((lanes >> 1) & 1) + ((lanes >> 2) & 1) + ((lanes >> 3) & 1);
+}
+
+// Load one box of 4 nodes (min & max of either the left or right child) as planes of x, y & z
+static void LoadAabbs(const XMFLOAT3* const* mins, const XMFLOAT3* const* maxs, XMVECTOR* boxMin, XMVECTOR* boxMax)
+{
+    XMMATRIX m, n;
+    for (int i = 0; i < 4; ++i)
+    {
+        m.r[i] = XMLoadFloat3(mins[i]);
+        n.r[i] = XMLoadFloat3(maxs[i]);
+    }
+    m = XMMatrixTranspose(m);
+    n = XMMatrixTranspose(n);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        boxMin[i] = m.r[i];
+        boxMax[i] = n.r[i];
+    }
+}
+
+static double GetMilliseconds(std::chrono::high_resolution_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+CpuCSRaytracer::CpuCSRaytracer(int width, int height, int numThreads)
+    : Width(width / 4 * 4)
+    , Height(height / 4 * 4)
+    , NumThreads(std::max(numThreads, 1))
+    , Workers(NumThreads)
+    , NumTasks(0)
+{
+    RayStart = XMFLOAT3(0, 0, 0);
+    for (int i = 0; i < 3; ++i)
+    {
+        RayDirs[i].resize(Width * Height);
+    }
+    TaskHeads.resize(Width * Height);
+    Image.resize(Width * Height);
+}
+
+bool CpuCSRaytracer::Render(FXMMATRIX cameraWorld, float horizFovRadians, const AabbNode* nodes, int numNodes)
+{
+    if (numNodes < 1)
+    {
+        OutputDebugString(L"There must be at least a root node to render.\n");
+        assert(false);
+        return false;
+    }
+
+    PrepareRays(cameraWorld, horizFovRadians);
+    Passes.clear();
+    NumTasks = 0;
+
+    // The first pass appends at most 2 tasks per pixel
+    int pendingPixels = Width * Height;
+    for (int pass = 0; pendingPixels > 0; ++pass)
+    {
+        // Make room for every pending pixel hitting both children. Indices into Tasks are ints, as
+        // in the shaders, which puts a limit on how many tasks a render can append.
+        int64_t maxTasks = (int64_t)NumTasks + 2 * (int64_t)pendingPixels;
+        if (maxTasks > INT_MAX)
+        {
+            OutputDebugString(L"Too many tasks for Task indices.\n");
+            assert(false);
+            return false;
+        }
+        if (maxTasks > (int64_t)Tasks.size())
+        {
+            Tasks.resize(std::max((size_t)maxTasks, Tasks.size() + Tasks.size() / 2));
+        }
+
+        int startTasks = NumTasks;
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        RowStats totals;
+        if (pass == 0)
+        {
+            RunRows([&](int groupY, RowStats* stats) { RunFirstPass(groupY, nodes[0], stats); }, &totals);
+        }
+        else
+        {
+            RunRows([&](int groupY, RowStats* stats) { RunTaskPass(groupY, nodes, stats); }, &totals);
+        }
+
+        PassStats stats;
+        stats.ActivePixels = totals.ActivePixels;
+        stats.NewTasks = NumTasks - startTasks;
+        stats.TotalTasks = NumTasks;
+        stats.PendingPixels = totals.PendingPixels;
+        stats.MemoryUsage = TaskHeads.size() * sizeof(int) + (size_t)NumTasks * sizeof(Task);
+        stats.Time = GetMilliseconds(startTime);
+        Passes.push_back(stats);
+
+        pendingPixels = totals.PendingPixels;
+    }
+
+    return true;
+}
+
+bool CpuCSRaytracer::RenderWithStack(FXMMATRIX cameraWorld, float horizFovRadians, const AabbNode* nodes, int numNodes,
+    StackStats* stats)
+{
+    if (numNodes < 1)
+    {
+        OutputDebugString(L"There must be at least a root node to render.\n");
+        assert(false);
+        return false;
+    }
+
+    PrepareRays(cameraWorld, horizFovRadians);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    RowStats totals;
+    RunRows([&](int groupY, RowStats* rowStats)
+    {
+        std::vector<int> stack;
+        stack.reserve(64);
+
+        for (int y = groupY * 4; y < groupY * 4 + 4; ++y)
+        {
+            for (int x = 0; x < Width; ++x)
+            {
+                int pixel = y * Width + x;
+                XMFLOAT3 rayDir(RayDirs[0][pixel], RayDirs[1][pixel], RayDirs[2][pixel]);
+
+                // Children are pushed left then right, and popped in the opposite order, which
+                // is the order the task lists visit them in
+                stack.clear();
+                int node = 0;
+                for (;;)
+                {
+                    if (node >= 0)
+                    {
+                        const AabbNode& n = nodes[node];
+                        if (RayAabbIntersect(RayStart, rayDir, n.LeftMin, n.LeftMax))
+                        {
+                            stack.push_back(n.LeftIndex);
+                        }
+                        if (RayAabbIntersect(RayStart, rayDir, n.RightMin, n.RightMax))
+                        {
+                            stack.push_back(n.RightIndex);
+                        }
+                        rowStats->MaxStackSize = std::max(rowStats->MaxStackSize, (int)stack.size());
+                    }
+                    else
+                    {
+                        WriteLeafColor(pixel);
+                    }
+
+                    if (stack.empty())
+                    {
+                        break;
+                    }
+                    node = stack.back();
+                    stack.pop_back();
+                    ++rowStats->NodesVisited;
+                }
+            }
+        }
+    }, &totals);
+
+    stats->NodesVisited = totals.NodesVisited;
+    stats->MaxStackSize = totals.MaxStackSize;
+    stats->Time = GetMilliseconds(startTime);
+    return true;
+}
+
+void CpuCSRaytracer::PrepareRays(FXMMATRIX cameraWorld, float horizFovRadians)
+{
+    // The shaders' camera setup (see LocalRayFromPixelCoord)
+    float halfWidth = Width * 0.5f;
+    float halfHeight = Height * 0.5f;
+    float distToProjPlane = halfWidth / tanf(horizFovRadians * 0.5f);
+
+    XMStoreFloat3(&RayStart, cameraWorld.r[3]);
+
+    for (int y = 0; y < Height; ++y)
+    {
+        for (int x = 0; x < Width; ++x)
+        {
+            XMVECTOR localRay = XMVectorSet((float)x - halfWidth, halfHeight - (float)y, distToProjPlane, 0);
+            XMFLOAT3 dir;
+            XMStoreFloat3(&dir, XMVector3TransformNormal(XMVector3Normalize(localRay), cameraWorld));
+
+            int pixel = y * Width + x;
+            RayDirs[0][pixel] = dir.x;
+            RayDirs[1][pixel] = dir.y;
+            RayDirs[2][pixel] = dir.z;
+        }
+    }
+
+    std::fill(Image.begin(), Image.end(), 0);
+}
+
+void CpuCSRaytracer::RunRows(const std::function<void(int groupY, RowStats* stats)>& func, RowStats* totals)
+{
+    std::atomic<int> nextGroupY(0);
+    std::vector<RowStats> threadStats(NumThreads);
+
+    Workers.Run([&](int thread)
+    {
+        RowStats& stats = threadStats[thread];
+        stats = RowStats{};
+        for (int groupY = nextGroupY++; groupY < Height / 4; groupY = nextGroupY++)
+        {
+            func(groupY, &stats);
+        }
+    });
+
+    *totals = RowStats{};
+    for (auto& stats : threadStats)
+    {
+        totals->ActivePixels += stats.ActivePixels;
+        totals->PendingPixels += stats.PendingPixels;
+        totals->NodesVisited += stats.NodesVisited;
+        totals->MaxStackSize = std::max(totals->MaxStackSize, stats.MaxStackSize);
+    }
+}
+
+void CpuCSRaytracer::RunFirstPass(int groupY, const AabbNode& root, RowStats* stats)
+{
+    XMVECTOR start[3] = { XMVectorReplicate(RayStart.x), XMVectorReplicate(RayStart.y), XMVectorReplicate(RayStart.z) };
+
+    // Every pixel tests the root's children
+    XMVECTOR leftMin[3], leftMax[3], rightMin[3], rightMax[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        leftMin[i] = XMVectorReplicate((&root.LeftMin.x)[i]);
+        leftMax[i] = XMVectorReplicate((&root.LeftMax.x)[i]);
+        rightMin[i] = XMVectorReplicate((&root.RightMin.x)[i]);
+        rightMax[i] = XMVectorReplicate((&root.RightMax.x)[i]);
+    }
+
+    for (int y = groupY * 4; y < groupY * 4 + 4; ++y)
+    {
+        for (int x = 0; x < Width; x += 4)
+        {
+            int pixel = y * Width + x;
+            XMVECTOR dir[3] = { XMLoadFloat4((const XMFLOAT4*)&RayDirs[0][pixel]),
+                XMLoadFloat4((const XMFLOAT4*)&RayDirs[1][pixel]), XMLoadFloat4((const XMFLOAT4*)&RayDirs[2][pixel]) };
+
+            int leftHits = GetLanes(RayAabbIntersect4(start, dir, leftMin, leftMax));
+            int rightHits = GetLanes(RayAabbIntersect4(start, dir, rightMin, rightMax));
+
+            int i = 0;
+            if (leftHits | rightHits)
+            {
+                i = NumTasks.fetch_add(CountLanes(leftHits) + CountLanes(rightHits));
+            }
+
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                int head = -1;
+                if (leftHits & (1 << lane))
+                {
+                    Tasks[i].Node = root.LeftIndex;
+                    Tasks[i].Next = head;
+                    head = i++;
+                }
+                if (rightHits & (1 << lane))
+                {
+                    Tasks[i].Node = root.RightIndex;
+                    Tasks[i].Next = head;
+                    head = i++;
+                }
+                TaskHeads[pixel + lane] = head;
+                stats->PendingPixels += head >= 0 ? 1 : 0;
+            }
+            stats->ActivePixels += 4;
+        }
+    }
+}
+
+void CpuCSRaytracer::RunTaskPass(int groupY, const AabbNode* nodes, RowStats* stats)
+{
+    XMVECTOR start[3] = { XMVectorReplicate(RayStart.x), XMVectorReplicate(RayStart.y), XMVectorReplicate(RayStart.z) };
+
+    for (int y = groupY * 4; y < groupY * 4 + 4; ++y)
+    {
+        for (int x = 0; x < Width; x += 4)
+        {
+            int pixel = y * Width + x;
+            int* heads = &TaskHeads[pixel];
+            if ((heads[0] & heads[1] & heads[2] & heads[3]) < 0)
+            {
+                // Nothing to do for these pixels
+                continue;
+            }
+
+            // Take the first task off of each list. Lanes that are at an object (or have nothing
+            // to do) test the root's boxes, and their results are thrown away.
+            const AabbNode* laneNodes[4];
+            int nodeLanes = 0;
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                laneNodes[lane] = &nodes[0];
+                if (heads[lane] < 0)
+                {
+                    continue;
+                }
+
+                const Task& t = Tasks[heads[lane]];
+                heads[lane] = t.Next;
+                ++stats->ActivePixels;
+
+                if (t.Node >= 0)
+                {
+                    laneNodes[lane] = &nodes[t.Node];
+                    nodeLanes |= 1 << lane;
+                }
+                else
+                {
+                    // Each leaf object is assumed to be a solid box, as in the shader
+                    WriteLeafColor(pixel + lane);
+                }
+            }
+
+            if (nodeLanes)
+            {
+                XMVECTOR dir[3] = { XMLoadFloat4((const XMFLOAT4*)&RayDirs[0][pixel]),
+                    XMLoadFloat4((const XMFLOAT4*)&RayDirs[1][pixel]), XMLoadFloat4((const XMFLOAT4*)&RayDirs[2][pixel]) };
+
+                const XMFLOAT3* mins[4];
+                const XMFLOAT3* maxs[4];
+                XMVECTOR boxMin[3], boxMax[3];
+
+                for (int lane = 0; lane < 4; ++lane)
+                {
+                    mins[lane] = &laneNodes[lane]->LeftMin;
+                    maxs[lane] = &laneNodes[lane]->LeftMax;
+                }
+                LoadAabbs(mins, maxs, boxMin, boxMax);
+                int leftHits = GetLanes(RayAabbIntersect4(start, dir, boxMin, boxMax)) & nodeLanes;
+
+                for (int lane = 0; lane < 4; ++lane)
+                {
+                    mins[lane] = &laneNodes[lane]->RightMin;
+                    maxs[lane] = &laneNodes[lane]->RightMax;
+                }
+                LoadAabbs(mins, maxs, boxMin, boxMax);
+                int rightHits = GetLanes(RayAabbIntersect4(start, dir, boxMin, boxMax)) & nodeLanes;
+
+                if (leftHits | rightHits)
+                {
+                    // Push the left child, then the right, so the right child is processed next
+                    int i = NumTasks.fetch_add(CountLanes(leftHits) + CountLanes(rightHits));
+                    for (int lane = 0; lane < 4; ++lane)
+                    {
+                        if (leftHits & (1 << lane))
+                        {
+                            Tasks[i].Node = laneNodes[lane]->LeftIndex;
+                            Tasks[i].Next = heads[lane];
+                            heads[lane] = i++;
+                        }
+                        if (rightHits & (1 << lane))
+                        {
+                            Tasks[i].Node = laneNodes[lane]->RightIndex;
+                            Tasks[i].Next = heads[lane];
+                            heads[lane] = i++;
+                        }
+                    }
+                }
+            }
+
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                stats->PendingPixels += heads[lane] >= 0 ? 1 : 0;
+            }
+        }
+    }
+}
+
+void CpuCSRaytracer::WriteLeafColor(int pixel)
+{
+    // float4(abs(rayDir), 1) written to an R8G8B8A8_UNORM target
+    uint32_t color = 0xff000000;
+    for (int i = 0; i < 3; ++i)
+    {
+        float c = std::min(fabsf(RayDirs[i][pixel]), 1.0f);
+        color |= (uint32_t)(c * 255.0f + 0.5f) << (i * 8);
+    }
+    Image[pixel] = color;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "AabbTree.h"
+
+// The compute shader ray tracer's passes (RaytraceFirstPass & RaytraceTaskPass), run on the CPU
+// over the same AabbNode & Task layouts, so the algorithm can be measured without a D3D11 GPU.
+// Each pixel keeps a linked list of the nodes its ray still has to visit, and each pass takes
+// one task off of every list and appends tasks for the children the ray hits. Tasks are never
+// freed, as on the GPU, so the Tasks buffer grows with every pass.
+//
+// Pixels are processed 4 at a time (a row of a shader's 4x4 thread group), with the 4 rays
+// tested against their nodes' boxes together. The 4 pixels reserve all of their new tasks with a
+// single atomic add, which is how a thread group would aggregate its IncrementCounter calls.
+// Rows of groups are spread across a WorkerPool that lives as long as the raytracer, and a
+// pass finishes before the next one starts, as with a Dispatch.
+class CpuCSRaytracer
+{
+public:
+    // What happened during one pass. The first pass is pass 0.
+    struct PassStats
+    {
+        int         ActivePixels;   // Pixels that had a task to process
+        int         NewTasks;       // Tasks appended during the pass
+        int         TotalTasks;     // Tasks appended so far (the Tasks counter)
+        int         PendingPixels;  // Pixels with tasks left after the pass
+        size_t      MemoryUsage;    // Bytes of TaskHead & Tasks in use after the pass
+        double      Time;           // Milliseconds
+    };
+
+    // The same traversal, done the conventional way: each ray pushes and pops nodes on its own stack
+    struct StackStats
+    {
+        int64_t     NodesVisited;   // Nodes & objects popped, which matches the total of ActivePixels
+        int         MaxStackSize;
+        double      Time;           // Milliseconds
+    };
+
+    // Only whole 4x4 groups of pixels are rendered, like the GPU's Dispatch(Width / 4, Height / 4)
+    CpuCSRaytracer(int width, int height, int numThreads);
+
+    // Run the first pass, then task passes until every pixel's list is empty
+    bool Render(FXMMATRIX cameraWorld, float horizFovRadians, const AabbNode* nodes, int numNodes);
+
+    // Trace the same rays with a stack per ray instead. The image should come out the same.
+    bool RenderWithStack(FXMMATRIX cameraWorld, float horizFovRadians, const AabbNode* nodes, int numNodes,
+        StackStats* stats);
+
+    const std::vector<PassStats>& GetPassStats() const { return Passes; }
+
+    // R8G8B8A8, as the swap chain would have it. Pixels that don't hit anything are left at 0.
+    const uint32_t* GetImage() const { return Image.data(); }
+
+private:
+    // Don't allow copy
+    CpuCSRaytracer(const CpuCSRaytracer&);
+    CpuCSRaytracer& operator= (const CpuCSRaytracer&);
+
+    // Totals from the rows a thread processed during a pass
+    struct RowStats
+    {
+        int         ActivePixels;
+        int         PendingPixels;
+        int64_t     NodesVisited;
+        int         MaxStackSize;
+    };
+
+    // Work out the ray through each pixel, and clear the image
+    void PrepareRays(FXMMATRIX cameraWorld, float horizFovRadians);
+
+    // Call func for each row of 4x4 groups, across the threads, and total up their stats
+    void RunRows(const std::function<void(int groupY, RowStats* stats)>& func, RowStats* totals);
+
+    void RunFirstPass(int groupY, const AabbNode& root, RowStats* stats);
+    void RunTaskPass(int groupY, const AabbNode* nodes, RowStats* stats);
+
+    void WriteLeafColor(int pixel);
+
+    int                                 Width;
+    int                                 Height;
+    int                                 NumThreads;
+    WorkerPool                          Workers;
+
+    // Camera position, and the ray directions as planes of x, y & z (Width x Height)
+    XMFLOAT3                            RayStart;
+    std::vector<float>                  RayDirs[3];
+
+    std::vector<int>                    TaskHeads;
+    std::vector<Task>                   Tasks;
+    std::atomic<int>                    NumTasks;
+
+    std::vector<uint32_t>               Image;
+    std::vector<PassStats>              Passes;
+};
@@ -1,5 +1,6 @@
 #include "Precomp.h"
 #include "Raytracer.h"
+#include "CpuRaytracer.h"
 
 static HWND Window;
 static HINSTANCE Instance;
@@ -8,10 +9,25 @@ static uint32_t Height = 1080;
 static const wchar_t ClassName[] = L"CSRaytracer";
 
 static bool Initialize();
+static int RunOnCpu(int argc, char* argv[]);
+static int RunLbvhBenchmark(int argc, char* argv[]);
+static void AttachToParentConsole();
 static LRESULT CALLBACK WinProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
-int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
+int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR commandLine, int)
 {
+    if (strstr(commandLine, "-cpu"))
+    {
+        AttachToParentConsole();
+        return RunOnCpu(__argc, __argv);
+    }
+
+    if (strstr(commandLine, "-lbvh"))
+    {
+        AttachToParentConsole();
+        return RunLbvhBenchmark(__argc, __argv);
+    }
+
     Instance = instance;
 
     if (!Initialize())
@@ -20,9 +36,13 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
         return -1;
     }
 
+    // Same scene as -cpu
+    std::vector<Aabb> boxes;
+    GenerateRandomBoxes(10000, 4.0f, 1, &boxes);
+
     std::unique_ptr<D3D11CSRaytracer> raytracer(new D3D11CSRaytracer(Window));
 
-    if (!raytracer->Initialize())
+    if (!raytracer->Initialize(boxes.data(), (int)boxes.size()))
     {
         assert(false);
         return -2;
@@ -91,6 +111,215 @@ bool Initialize()
     return true;
 }
 
+// Run the passes on the CPU over a scene of random boxes, and report how the task lists grow.
+// Usage: CSRaytracer.exe -cpu [-boxes n] [-width w] [-height h] [-threads n]
+int RunOnCpu(int argc, char* argv[])
+{
+    int numBoxes = 10000;
+    int width = Width;
+    int height = Height;
+    int numThreads = (int)std::thread::hardware_concurrency();
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && !strcmp(argv[i], "-boxes"))
+        {
+            numBoxes = atoi(argv[++i]);
+        }
+        else if (i + 1 < argc && !strcmp(argv[i], "-width"))
+        {
+            width = atoi(argv[++i]);
+        }
+        else if (i + 1 < argc && !strcmp(argv[i], "-height"))
+        {
+            height = atoi(argv[++i]);
+        }
+        else if (i + 1 < argc && !strcmp(argv[i], "-threads"))
+        {
+            numThreads = atoi(argv[++i]);
+        }
+    }
+
+    if (numBoxes < 2 || width < 4 || height < 4)
+    {
+        printf("Need at least 2 boxes, and a 4x4 image.\n");
+        return -1;
+    }
+
+    std::vector<Aabb> boxes;
+    GenerateRandomBoxes(numBoxes, 4.0f, 1, &boxes);
+
+    std::vector<AabbNode> nodes;
+    if (!BuildAabbTree(boxes.data(), numBoxes, &nodes))
+    {
+        return -2;
+    }
+
+    // Same view as the window
+    XMMATRIX cameraWorld = XMMatrixIdentity();
+    cameraWorld.r[3] = XMVectorSet(1.5, 1, -10, 1);
+    float fov = XMConvertToRadians(60.0f);
+
+    std::unique_ptr<CpuCSRaytracer> raytracer(new CpuCSRaytracer(width, height, numThreads));
+
+    printf("%d boxes (%d nodes), %dx%d, %d threads\n\n", numBoxes, (int)nodes.size(), width / 4 * 4, height / 4 * 4,
+        std::max(numThreads, 1));
+
+    if (!raytracer->Render(cameraWorld, fov, nodes.data(), (int)nodes.size()))
+    {
+        return -3;
+    }
+
+    auto& passes = raytracer->GetPassStats();
+    printf(" Pass   Active      New      Total  Pending  Memory(MB)  Time(ms)\n");
+    double totalTime = 0;
+    int64_t tasksProcessed = 0;
+    for (int i = 0; i < (int)passes.size(); ++i)
+    {
+        auto& pass = passes[i];
+        printf("%5d %8d %8d %10d %8d %11.1f %9.2f\n", i, pass.ActivePixels, pass.NewTasks, pass.TotalTasks,
+            pass.PendingPixels, pass.MemoryUsage / (1024.0 * 1024.0), pass.Time);
+
+        totalTime += pass.Time;
+        if (i > 0)
+        {
+            tasksProcessed += pass.ActivePixels;
+        }
+    }
+
+    printf("\n%d passes, %lld tasks processed, %.1f MB peak, %.2f ms\n", (int)passes.size(), (long long)tasksProcessed,
+        passes.back().MemoryUsage / (1024.0 * 1024.0), totalTime);
+
+    // The GPU does the first pass and NumTaskPasses task passes
+    int gpuPasses = std::min((int)passes.size(), 1 + D3D11CSRaytracer::NumTaskPasses);
+    printf("The GPU's %d passes use %d of its %llu tasks\n", gpuPasses, passes[gpuPasses - 1].TotalTasks,
+        (unsigned long long)D3D11CSRaytracer::GetMaxTasks(width, height));
+    if ((int)passes.size() > gpuPasses)
+    {
+        printf("The GPU's %d passes leave %d pixels unfinished\n", gpuPasses, passes[gpuPasses - 1].PendingPixels);
+    }
+
+    std::vector<uint32_t> taskImage(raytracer->GetImage(), raytracer->GetImage() + (width / 4 * 4) * (height / 4 * 4));
+
+    CpuCSRaytracer::StackStats stackStats;
+    if (!raytracer->RenderWithStack(cameraWorld, fov, nodes.data(), (int)nodes.size(), &stackStats))
+    {
+        return -4;
+    }
+
+    bool match = std::equal(taskImage.begin(), taskImage.end(), raytracer->GetImage());
+    bool stackFaster = stackStats.Time < totalTime;
+    printf("\nStack traversal: %lld nodes visited, stack of up to %d, %.2f ms (%.2fx %s than the task lists), images %s\n",
+        (long long)stackStats.NodesVisited, stackStats.MaxStackSize, stackStats.Time,
+        stackFaster ? totalTime / stackStats.Time : stackStats.Time / totalTime, stackFaster ? "faster" : "slower",
+        match ? "match" : "DIFFER");
+
+    return (match && stackStats.NodesVisited == tasksProcessed) ? 0 : -5;
+}
+
+// Build trees over random boxes with each of the builders, and check them. Each build is run a few
+// times and the fastest is reported, with the nodes the rays of a small image visit as a measure
+// of the tree's quality.
+// Usage: CSRaytracer.exe -lbvh [-boxes n] [-threads n] [-runs n]
+int RunLbvhBenchmark(int argc, char* argv[])
+{
+    int numBoxes = 1000000;
+    int numThreads = (int)std::thread::hardware_concurrency();
+    int numRuns = 5;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && !strcmp(argv[i], "-boxes"))
+        {
+            numBoxes = atoi(argv[++i]);
+        }
+        else if (i + 1 < argc && !strcmp(argv[i], "-threads"))
+        {
+            numThreads = atoi(argv[++i]);
+        }
+        else if (i + 1 < argc && !strcmp(argv[i], "-runs"))
+        {
+            numRuns = atoi(argv[++i]);
+        }
+    }
+
+    if (numBoxes < 2 || numRuns < 1)
+    {
+        printf("Need at least 2 boxes, and 1 run.\n");
+        return -1;
+    }
+
+    std::vector<Aabb> boxes;
+    GenerateRandomBoxes(numBoxes, 4.0f, 1, &boxes);
+
+    printf("%d boxes, %d threads, best of %d runs\n\n", numBoxes, std::max(numThreads, 1), numRuns);
+    printf("Builder        Codes(ms)  Sort(ms)  Hierarchy(ms)  Bounds(ms)  Total(ms)  Valid  Visited\n");
+
+    XMMATRIX cameraWorld = XMMatrixIdentity();
+    cameraWorld.r[3] = XMVectorSet(1.5, 1, -10, 1);
+    std::unique_ptr<CpuCSRaytracer> raytracer(new CpuCSRaytracer(64, 36, numThreads));
+
+    std::unique_ptr<LbvhBuilder> builder(new LbvhBuilder(numThreads));
+    std::vector<AabbNode> nodes;
+    bool succeeded = true;
+
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        static const char* const Names[] = { "Median split", "LBVH 30 bit", "LBVH 63 bit" };
+
+        LbvhBuilder::BuildStats best{};
+        for (int run = 0; run < numRuns; ++run)
+        {
+            LbvhBuilder::BuildStats stats{};
+            if (pass == 0)
+            {
+                auto startTime = std::chrono::high_resolution_clock::now();
+                BuildAabbTree(boxes.data(), numBoxes, &nodes);
+                stats.Total = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+            }
+            else
+            {
+                builder->Build(boxes.data(), numBoxes, pass == 2, &nodes);
+                stats = builder->GetBuildStats();
+            }
+
+            if (run == 0 || stats.Total < best.Total)
+            {
+                best = stats;
+            }
+        }
+
+        bool valid = ValidateAabbTree(nodes.data(), (int)nodes.size(), boxes.data(), numBoxes);
+        succeeded = succeeded && valid;
+
+        CpuCSRaytracer::StackStats stackStats;
+        raytracer->RenderWithStack(cameraWorld, XMConvertToRadians(60.0f), nodes.data(), (int)nodes.size(), &stackStats);
+
+        if (pass == 0)
+        {
+            printf("%-14s %9s %9s %14s %11s %10.2f  %-5s  %lld\n", Names[pass], "", "", "", "", best.Total,
+                valid ? "yes" : "NO", (long long)stackStats.NodesVisited);
+        }
+        else
+        {
+            printf("%-14s %9.2f %9.2f %14.2f %11.2f %10.2f  %-5s  %lld\n", Names[pass], best.Codes, best.Sort,
+                best.Hierarchy, best.Bounds, best.Total, valid ? "yes" : "NO", (long long)stackStats.NodesVisited);
+        }
+    }
+
+    return succeeded ? 0 : -2;
+}
+
+void AttachToParentConsole()
+{
+    if (AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* console = nullptr;
+        freopen_s(&console, "CONOUT$", "w", stdout);
+        freopen_s(&console, "CONOUT$", "w", stderr);
+    }
+}
+
 LRESULT CALLBACK WinProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
     switch (msg)
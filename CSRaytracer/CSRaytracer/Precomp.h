@@ -1,10 +1,24 @@
 #pragma once
 
+#define NOMINMAX
 #include <Windows.h>
 #include <d3d11.h>
+#include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 #include <assert.h>
+#include <math.h>
+#include <float.h>
 #include <memory>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <random>
 
 #include <wrl.h>
 using namespace Microsoft::WRL;
@@ -77,39 +77,22 @@ dcl_input vThreadGroupID.xy
 dcl_input vThreadIDInGroup.xy
 dcl_temps 8
 dcl_thread_group 4, 4, 1
-//
-// Initial variable locations:
-//   vThreadIDInGroup.x <- GroupThreadID.x; vThreadIDInGroup.y <- GroupThreadID.y; vThreadIDInGroup.z <- GroupThreadID.z; 
-//   vThreadGroupID.x <- GroupID.x; vThreadGroupID.y <- GroupID.y; vThreadGroupID.z <- GroupID.z; 
-//   vThreadID.x <- DispatchThreadID.x; vThreadID.y <- DispatchThreadID.y; vThreadID.z <- DispatchThreadID.z
-//
-#line 17 "C:\src\downloads\CSRaytracer\CSRaytracer\RaytraceFirstPass.hlsl"
-mov r0.x, l(4)  // r0.x <- NUM_PIXELS_PER_GROUP_X
-mov r0.yzw, l(0,4,4,4)  // r0.w <- NUM_PIXELS_PER_GROUP_Y
-
-#line 27
+mov r0.x, l(4)
+mov r0.yzw, l(0,4,4,4)
 imul null, r0.xyzw, r0.xyzw, vThreadGroupID.xyyy
-iadd r0.xyzw, r0.xwyz, vThreadIDInGroup.xyyy  // r0.x <- pixelCoord.x; r0.w <- pixelCoord.y
-
-#line 30
+iadd r0.xyzw, r0.xwyz, vThreadIDInGroup.xyyy
 nop 
 mov r0.xy, r0.xyxx
 mov r1.xy, cb0[4].xyxx
 mov r2.z, cb0[4].z
-
-#line 43 "C:\src\downloads\CSRaytracer\CSRaytracer\ShaderCommon.hlsli"
 utof r1.z, r0.x
 mov r1.x, -r1.x
-add r2.x, r1.x, r1.z  // r2.x <- <LocalRayFromPixelCoord return value>.x
+add r2.x, r1.x, r1.z
 utof r1.x, r0.y
 mov r1.x, -r1.x
-add r2.y, r1.x, r1.y  // r2.y <- <LocalRayFromPixelCoord return value>.y
-mov r2.z, r2.z  // r2.z <- <LocalRayFromPixelCoord return value>.z
-
-#line 30 "C:\src\downloads\CSRaytracer\CSRaytracer\RaytraceFirstPass.hlsl"
-mov r2.xyz, r2.xyzx  // r2.x <- localRay.x; r2.y <- localRay.y; r2.z <- localRay.z
-
-#line 33
+add r2.y, r1.x, r1.y
+mov r2.z, r2.z
+mov r2.xyz, r2.xyzx
 dp3 r1.x, r2.xyzx, r2.xyzx
 rsq r1.x, r1.x
 mul r1.xyz, r1.xxxx, r2.xyzx
@@ -117,35 +100,29 @@ mul r2.xyz, r1.xxxx, cb0[0].xyzx
 mul r1.xyw, r1.yyyy, cb0[1].xyxz
 add r1.xyw, r1.xyxw, r2.xyxz
 mul r2.xyz, r1.zzzz, cb0[2].xyzx
-add r1.xyz, r1.xywx, r2.xyzx  // r1.x <- rayDir.x; r1.y <- rayDir.y; r1.z <- rayDir.z
-
-#line 36
-mov r2.xyz, cb0[3].xyzx  // r2.x <- rayStart.x; r2.y <- rayStart.y; r2.z <- rayStart.z
-
-#line 41
+add r1.xyz, r1.xywx, r2.xyzx
+mov r2.xyz, cb0[3].xyzx
 mov r1.w, l(0)
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r3.x, r1.w, l(0), t0.xxxx  // r3.x <- node.LeftMin.x
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r3.y, r1.w, l(4), t0.xxxx  // r3.y <- node.LeftMin.y
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r3.z, r1.w, l(8), t0.xxxx  // r3.z <- node.LeftMin.z
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r4.x, r1.w, l(12), t0.xxxx  // r4.x <- node.LeftMax.x
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r4.y, r1.w, l(16), t0.xxxx  // r4.y <- node.LeftMax.y
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r4.z, r1.w, l(20), t0.xxxx  // r4.z <- node.LeftMax.z
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r5.x, r1.w, l(24), t0.xxxx  // r5.x <- node.RightMin.x
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r5.y, r1.w, l(28), t0.xxxx  // r5.y <- node.RightMin.y
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r5.z, r1.w, l(32), t0.xxxx  // r5.z <- node.RightMin.z
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r6.x, r1.w, l(36), t0.xxxx  // r6.x <- node.RightMax.x
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r6.y, r1.w, l(40), t0.xxxx  // r6.y <- node.RightMax.y
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r6.z, r1.w, l(44), t0.xxxx  // r6.z <- node.RightMax.z
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r2.w, r1.w, l(48), t0.xxxx  // r2.w <- node.LeftIndex
-ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r1.w, r1.w, l(52), t0.xxxx  // r1.w <- node.RightIndex
-mov r7.x, l(0x0000ffff)  // r7.x <- i
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r3.x, r1.w, l(0), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r3.y, r1.w, l(4), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r3.z, r1.w, l(8), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r4.x, r1.w, l(12), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r4.y, r1.w, l(16), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r4.z, r1.w, l(20), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r5.x, r1.w, l(24), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r5.y, r1.w, l(28), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r5.z, r1.w, l(32), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r6.x, r1.w, l(36), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r6.y, r1.w, l(40), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r6.z, r1.w, l(44), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r2.w, r1.w, l(48), t0.xxxx
+ld_structured_indexable(structured_buffer, stride=56)(mixed,mixed,mixed,mixed) r1.w, r1.w, l(52), t0.xxxx
+mov r7.x, l(-1)
 nop 
 mov r2.xyz, r2.xyzx
 mov r1.xyz, r1.xyzx
 mov r3.xyz, r3.xyzx
 mov r4.xyz, r4.xyzx
-
-#line 52 "C:\src\downloads\CSRaytracer\CSRaytracer\ShaderCommon.hlsli"
 lt r3.w, r2.x, r3.x
 itof r4.w, l(0)
 lt r4.w, r4.w, r1.x
@@ -155,9 +132,9 @@ if_nz r3.w
   add r3.w, r3.w, r3.x
   itof r7.yzw, l(0, 1, 0, 0)
   dp3 r4.w, r7.yzwy, r1.xyzx
-  div r3.w, r3.w, r4.w  // r3.w <- h
+  div r3.w, r3.w, r4.w
   mul r7.yz, r1.yyzy, r3.wwww
-  add r7.yz, r2.yyzy, r7.yyzy  // r7.y <- p.y; r7.z <- p.z
+  add r7.yz, r2.yyzy, r7.yyzy
   ge r3.w, r7.y, r3.y
   ge r4.w, r4.y, r7.y
   and r3.w, r3.w, r4.w
@@ -167,22 +144,20 @@ if_nz r3.w
   and r3.w, r3.w, r4.w
   if_nz r3.w
     mov r4.w, l(-1)
-  endif   // r4.w <- <RayAabbIntersect return value>
+  endif 
 else 
   lt r5.w, r4.x, r2.x
   itof r6.w, l(0)
   lt r6.w, r1.x, r6.w
   and r5.w, r5.w, r6.w
   if_nz r5.w
-
-#line 63
     mov r5.w, -r4.x
     add r5.w, r2.x, r5.w
     itof r7.yzw, l(0, -1, 0, 0)
     dp3 r6.w, r7.yzwy, r1.xyzx
-    div r5.w, r5.w, r6.w  // r5.w <- h
+    div r5.w, r5.w, r6.w
     mul r7.yz, r1.yyzy, r5.wwww
-    add r7.yz, r2.yyzy, r7.yyzy  // r7.y <- p.y; r7.z <- p.z
+    add r7.yz, r2.yyzy, r7.yyzy
     ge r5.w, r7.y, r3.y
     ge r6.w, r4.y, r7.y
     and r5.w, r5.w, r6.w
@@ -192,13 +167,11 @@ else
     and r3.w, r5.w, r6.w
     if_nz r3.w
       mov r4.w, l(-1)
-    endif   // r4.w <- <RayAabbIntersect return value>
+    endif 
   else 
     mov r3.w, l(0)
-  endif   // r4.w <- <RayAabbIntersect return value>
+  endif 
 endif 
-
-#line 72
 if_z r3.w
   lt r3.w, r2.y, r3.y
   itof r5.w, l(0)
@@ -209,9 +182,9 @@ if_z r3.w
     add r3.w, r3.w, r3.y
     itof r7.yzw, l(0, 0, 1, 0)
     dp3 r5.w, r7.yzwy, r1.xyzx
-    div r3.w, r3.w, r5.w  // r3.w <- h
+    div r3.w, r3.w, r5.w
     mul r7.yz, r1.xxzx, r3.wwww
-    add r7.yz, r2.xxzx, r7.yyzy  // r7.z <- p.z; r7.y <- p.x
+    add r7.yz, r2.xxzx, r7.yyzy
     ge r3.w, r7.y, r3.x
     ge r5.w, r4.x, r7.y
     and r3.w, r3.w, r5.w
@@ -228,15 +201,13 @@ if_z r3.w
     lt r6.w, r1.y, r6.w
     and r5.w, r5.w, r6.w
     if_nz r5.w
-
-#line 83
       mov r5.w, -r4.y
       add r5.w, r2.y, r5.w
       itof r7.yzw, l(0, 0, -1, 0)
       dp3 r6.w, r7.yzwy, r1.xyzx
-      div r5.w, r5.w, r6.w  // r5.w <- h
+      div r5.w, r5.w, r6.w
       mul r7.yz, r1.xxzx, r5.wwww
-      add r7.yz, r2.xxzx, r7.yyzy  // r7.z <- p.z; r7.y <- p.x
+      add r7.yz, r2.xxzx, r7.yyzy
       ge r5.w, r7.y, r3.x
       ge r6.w, r4.x, r7.y
       and r5.w, r5.w, r6.w
@@ -251,8 +222,6 @@ if_z r3.w
       mov r3.w, l(0)
     endif 
   endif 
-
-#line 92
   if_z r3.w
     lt r3.w, r2.z, r3.z
     itof r5.w, l(0)
@@ -263,9 +232,9 @@ if_z r3.w
       add r3.z, r3.w, r3.z
       itof r7.yzw, l(0, 0, 0, 1)
       dp3 r3.w, r7.yzwy, r1.xyzx
-      div r3.z, r3.z, r3.w  // r3.z <- h
+      div r3.z, r3.z, r3.w
       mul r3.zw, r1.xxxy, r3.zzzz
-      add r3.zw, r2.xxxy, r3.zzzw  // r3.z <- p.x; r3.w <- p.y
+      add r3.zw, r2.xxxy, r3.zzzw
       ge r5.w, r3.z, r3.x
       ge r3.z, r4.x, r3.z
       and r3.z, r3.z, r5.w
@@ -276,21 +245,19 @@ if_z r3.w
       if_nz r3.z
         mov r4.w, l(-1)
       endif 
-    else   // Prior locations: r3.z <- node.LeftMin.z; r3.z <- aabbMin.z
+    else 
       lt r3.w, r4.z, r2.z
       itof r5.w, l(0)
       lt r5.w, r1.z, r5.w
       and r3.w, r3.w, r5.w
       if_nz r3.w
-
-#line 103
         mov r3.w, -r4.z
         add r3.w, r2.z, r3.w
         itof r7.yzw, l(0, 0, 0, -1)
         dp3 r4.z, r7.yzwy, r1.xyzx
-        div r3.w, r3.w, r4.z  // r3.w <- h
+        div r3.w, r3.w, r4.z
         mul r7.yz, r1.xxyx, r3.wwww
-        add r7.yz, r2.xxyx, r7.yyzy  // r7.y <- p.x; r7.z <- p.y
+        add r7.yz, r2.xxyx, r7.yyzy
         ge r3.x, r7.y, r3.x
         ge r3.w, r4.x, r7.y
         and r3.x, r3.w, r3.x
@@ -301,7 +268,7 @@ if_z r3.w
         if_nz r3.z
           mov r4.w, l(-1)
         endif 
-      else   // Prior locations: r3.x <- node.LeftMin.x; r3.y <- node.LeftMin.y; r3.z <- node.LeftMin.z; r4.z <- node.LeftMax.z; r3.x <- aabbMin.x; r3.y <- aabbMin.y; r3.z <- aabbMin.z; r4.z <- aabbMax.z
+      else 
         mov r3.z, l(0)
       endif 
     endif 
@@ -310,13 +277,9 @@ if_z r3.w
     endif 
   endif 
 endif 
-
-#line 43 "C:\src\downloads\CSRaytracer\CSRaytracer\RaytraceFirstPass.hlsl"
 if_nz r4.w
-
-#line 46
-  mov r2.w, r2.w  // r2.w <- t.Node
-  mov r3.x, l(-1)  // r3.x <- t.Next
+  mov r2.w, r2.w
+  mov r3.x, l(-1)
   imm_atomic_alloc r7.x, u1
   store_structured u1.x, r7.x, l(0), r2.w
   store_structured u1.x, r7.x, l(4), r3.x
@@ -326,8 +289,6 @@ endif
 nop 
 mov r5.xyz, r5.xyzx
 mov r6.xyz, r6.xyzx
-
-#line 52 "C:\src\downloads\CSRaytracer\CSRaytracer\ShaderCommon.hlsli"
 lt r2.w, r2.x, r5.x
 itof r3.x, l(0)
 lt r3.x, r3.x, r1.x
@@ -337,9 +298,9 @@ if_nz r2.w
   add r2.w, r2.w, r5.x
   itof r3.xyz, l(1, 0, 0, 0)
   dp3 r3.x, r3.xyzx, r1.xyzx
-  div r2.w, r2.w, r3.x  // r2.w <- h
+  div r2.w, r2.w, r3.x
   mul r3.xy, r1.yzyy, r2.wwww
-  add r3.xy, r2.yzyy, r3.xyxx  // r3.x <- p.y; r3.y <- p.z
+  add r3.xy, r2.yzyy, r3.xyxx
   ge r2.w, r3.x, r5.y
   ge r3.x, r6.y, r3.x
   and r2.w, r2.w, r3.x
@@ -349,22 +310,20 @@ if_nz r2.w
   and r2.w, r2.w, r3.x
   if_nz r2.w
     mov r3.x, l(-1)
-  endif   // r3.x <- <RayAabbIntersect return value>
+  endif 
 else 
   lt r3.y, r6.x, r2.x
   itof r3.z, l(0)
   lt r3.z, r1.x, r3.z
   and r3.y, r3.z, r3.y
   if_nz r3.y
-
-#line 63
     mov r3.y, -r6.x
     add r3.y, r2.x, r3.y
     itof r4.xyz, l(-1, 0, 0, 0)
     dp3 r3.z, r4.xyzx, r1.xyzx
-    div r3.y, r3.y, r3.z  // r3.y <- h
+    div r3.y, r3.y, r3.z
     mul r3.yz, r1.yyzy, r3.yyyy
-    add r3.yz, r2.yyzy, r3.yyzy  // r3.y <- p.y; r3.z <- p.z
+    add r3.yz, r2.yyzy, r3.yyzy
     ge r3.w, r3.y, r5.y
     ge r3.y, r6.y, r3.y
     and r3.y, r3.y, r3.w
@@ -374,13 +333,11 @@ else
     and r2.w, r3.z, r3.y
     if_nz r2.w
       mov r3.x, l(-1)
-    endif   // r3.x <- <RayAabbIntersect return value>
+    endif 
   else 
     mov r2.w, l(0)
-  endif   // r3.x <- <RayAabbIntersect return value>
+  endif 
 endif 
-
-#line 72
 if_z r2.w
   lt r2.w, r2.y, r5.y
   itof r3.y, l(0)
@@ -391,9 +348,9 @@ if_z r2.w
     add r2.w, r2.w, r5.y
     itof r3.yzw, l(0, 0, 1, 0)
     dp3 r3.y, r3.yzwy, r1.xyzx
-    div r2.w, r2.w, r3.y  // r2.w <- h
+    div r2.w, r2.w, r3.y
     mul r3.yz, r1.xxzx, r2.wwww
-    add r3.yz, r2.xxzx, r3.yyzy  // r3.z <- p.z; r3.y <- p.x
+    add r3.yz, r2.xxzx, r3.yyzy
     ge r2.w, r3.y, r5.x
     ge r3.y, r6.x, r3.y
     and r2.w, r2.w, r3.y
@@ -410,15 +367,13 @@ if_z r2.w
     lt r3.z, r1.y, r3.z
     and r3.y, r3.z, r3.y
     if_nz r3.y
-
-#line 83
       mov r3.y, -r6.y
       add r3.y, r2.y, r3.y
       itof r4.xyz, l(0, -1, 0, 0)
       dp3 r3.z, r4.xyzx, r1.xyzx
-      div r3.y, r3.y, r3.z  // r3.y <- h
+      div r3.y, r3.y, r3.z
       mul r3.yz, r1.xxzx, r3.yyyy
-      add r3.yz, r2.xxzx, r3.yyzy  // r3.z <- p.z; r3.y <- p.x
+      add r3.yz, r2.xxzx, r3.yyzy
       ge r3.w, r3.y, r5.x
       ge r3.y, r6.x, r3.y
       and r3.y, r3.y, r3.w
@@ -433,8 +388,6 @@ if_z r2.w
       mov r2.w, l(0)
     endif 
   endif 
-
-#line 92
   if_z r2.w
     lt r2.w, r2.z, r5.z
     itof r3.y, l(0)
@@ -445,9 +398,9 @@ if_z r2.w
       add r2.w, r2.w, r5.z
       itof r3.yzw, l(0, 0, 0, 1)
       dp3 r3.y, r3.yzwy, r1.xyzx
-      div r2.w, r2.w, r3.y  // r2.w <- h
+      div r2.w, r2.w, r3.y
       mul r3.yz, r1.xxyx, r2.wwww
-      add r3.yz, r2.xxyx, r3.yyzy  // r3.y <- p.x; r3.z <- p.y
+      add r3.yz, r2.xxyx, r3.yyzy
       ge r2.w, r3.y, r5.x
       ge r3.y, r6.x, r3.y
       and r2.w, r2.w, r3.y
@@ -464,15 +417,13 @@ if_z r2.w
       lt r3.z, r1.z, r3.z
       and r3.y, r3.z, r3.y
       if_nz r3.y
-
-#line 103
         mov r3.y, -r6.z
         add r2.z, r2.z, r3.y
         itof r3.yzw, l(0, 0, 0, -1)
         dp3 r1.z, r3.yzwy, r1.xyzx
-        div r1.z, r2.z, r1.z  // r1.z <- h
+        div r1.z, r2.z, r1.z
         mul r1.xy, r1.zzzz, r1.xyxx
-        add r1.xy, r1.xyxx, r2.xyxx  // r1.x <- p.x; r1.y <- p.y
+        add r1.xy, r1.xyxx, r2.xyxx
         ge r1.z, r1.x, r5.x
         ge r1.x, r6.x, r1.x
         and r1.x, r1.x, r1.z
@@ -483,7 +434,7 @@ if_z r2.w
         if_nz r2.w
           mov r3.x, l(-1)
         endif 
-      else   // Prior locations: r1.x <- rayDir.x; r1.y <- rayDir.y; r1.z <- rayDir.z; r2.z <- rayStart.z; r2.z <- rayStart.z; r1.x <- rayDir.x; r1.y <- rayDir.y; r1.z <- rayDir.z
+      else 
         mov r2.w, l(0)
       endif 
     endif 
@@ -492,15 +443,11 @@ if_z r2.w
     endif 
   endif 
 endif 
-
-#line 52 "C:\src\downloads\CSRaytracer\CSRaytracer\RaytraceFirstPass.hlsl"
 if_nz r3.x
-
-#line 55
-  mov r1.w, r1.w  // r1.w <- t.Node
-  mov r1.x, l(-1)  // r1.x <- t.Next
-  imm_atomic_alloc r2.x, u1  // r2.x <- j
-  ine r1.y, r7.x, l(0x0000ffff)
+  mov r1.w, r1.w
+  mov r1.x, l(-1)
+  imm_atomic_alloc r2.x, u1
+  ige r1.y, r7.x, l(0)
   if_nz r1.y
     mov r1.x, r7.x
   endif 
@@ -514,721 +461,531 @@ ret
 
 const BYTE RaytraceFirstPass[] =
 {
-     68,  88,  66,  67, 201,  78, 
-     74,  23,  47, 189,   6,  28, 
-     71,  16, 178,   3,  36,  76, 
-     97,  14,   1,   0,   0,   0, 
-    192, 197,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-    116,   4,   0,   0, 132,   4, 
-      0,   0, 148,   4,   0,   0, 
-     28,  39,   0,   0, 184,  39, 
-      0,   0,  82,  68,  69,  70, 
-     52,   4,   0,   0,   3,   0, 
-      0,   0, 220,   0,   0,   0, 
-      4,   0,   0,   0,  60,   0, 
-      0,   0,   0,   5,  83,  67, 
-      5,   1,   0,   0,   0,   4, 
-      0,   0,  82,  68,  49,  49, 
-     60,   0,   0,   0,  24,   0, 
-      0,   0,  32,   0,   0,   0, 
-     40,   0,   0,   0,  36,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 188,   0, 
-      0,   0,   5,   0,   0,   0, 
-      6,   0,   0,   0,   1,   0, 
-      0,   0,  56,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
+     68,  88,  66,  67,  77, 216, 
+     56,   1, 137,  33, 136,  88, 
+     30, 210, 249, 241,  53,  25, 
+     26, 161,   1,   0,   0,   0, 
+    180,  39,   0,   0,   5,   0, 
+      0,   0,  52,   0,   0,   0, 
+    112,   4,   0,   0, 128,   4, 
+      0,   0, 144,   4,   0,   0, 
+     24,  39,   0,   0,  82,  68, 
+     69,  70,  52,   4,   0,   0, 
+      3,   0,   0,   0, 220,   0, 
+      0,   0,   4,   0,   0,   0, 
+     60,   0,   0,   0,   0,   5, 
+     83,  67,   5,   1,   0,   0, 
+      0,   4,   0,   0,  82,  68, 
+     49,  49,  60,   0,   0,   0, 
+     24,   0,   0,   0,  32,   0, 
+      0,   0,  40,   0,   0,   0, 
+     36,   0,   0,   0,  12,   0, 
+      0,   0,   0,   0,   0,   0, 
+    188,   0,   0,   0,   5,   0, 
+      0,   0,   6,   0,   0,   0, 
+      1,   0,   0,   0,  56,   0, 
       0,   0,   0,   0,   0,   0, 
-    194,   0,   0,   0,   4,   0, 
-      0,   0,   3,   0,   0,   0, 
-      4,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
       1,   0,   0,   0,   0,   0, 
-      0,   0, 203,   0,   0,   0, 
-     11,   0,   0,   0,   6,   0, 
-      0,   0,   1,   0,   0,   0, 
-      8,   0,   0,   0,   1,   0, 
+      0,   0, 194,   0,   0,   0, 
+      4,   0,   0,   0,   3,   0, 
+      0,   0,   4,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 209,   0, 
+      0,   0,   0,   0, 203,   0, 
+      0,   0,  11,   0,   0,   0, 
+      6,   0,   0,   0,   1,   0, 
+      0,   0,   8,   0,   0,   0, 
+      1,   0,   0,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
+    209,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-     78, 111, 100, 101, 115,   0, 
-     84,  97, 115, 107,  72, 101, 
-     97, 100,   0,  84,  97, 115, 
-    107, 115,   0,  67,  97, 109, 
-    101, 114,  97,  68,  97, 116, 
-     97,   0, 209,   0,   0,   0, 
-      3,   0,   0,   0,  36,   1, 
-      0,   0,  80,   0,   0,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0,  78, 111, 100, 101, 
+    115,   0,  84,  97, 115, 107, 
+     72, 101,  97, 100,   0,  84, 
+     97, 115, 107, 115,   0,  67, 
+     97, 109, 101, 114,  97,  68, 
+     97, 116,  97,   0, 209,   0, 
+      0,   0,   3,   0,   0,   0, 
+     36,   1,   0,   0,  80,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 188,   0,   0,   0, 
-      1,   0,   0,   0,  88,   2, 
-      0,   0,  56,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0, 203,   0,   0,   0, 
-      1,   0,   0,   0, 140,   3, 
-      0,   0,   8,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0, 156,   1,   0,   0, 
-      0,   0,   0,   0,  64,   0, 
-      0,   0,   2,   0,   0,   0, 
-    188,   1,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0, 188,   0, 
+      0,   0,   1,   0,   0,   0, 
+     88,   2,   0,   0,  56,   0, 
+      0,   0,   0,   0,   0,   0, 
+      3,   0,   0,   0, 203,   0, 
+      0,   0,   1,   0,   0,   0, 
+    140,   3,   0,   0,   8,   0, 
+      0,   0,   0,   0,   0,   0, 
+      3,   0,   0,   0, 156,   1, 
+      0,   0,   0,   0,   0,   0, 
+     64,   0,   0,   0,   2,   0, 
+      0,   0, 188,   1,   0,   0, 
       0,   0,   0,   0, 255, 255, 
     255, 255,   0,   0,   0,   0, 
-    224,   1,   0,   0,  64,   0, 
-      0,   0,   8,   0,   0,   0, 
-      2,   0,   0,   0, 248,   1, 
-      0,   0,   0,   0,   0,   0, 
     255, 255, 255, 255,   0,   0, 
+      0,   0, 224,   1,   0,   0, 
+     64,   0,   0,   0,   8,   0, 
+      0,   0,   2,   0,   0,   0, 
+    248,   1,   0,   0,   0,   0, 
       0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,  28,   2, 
-      0,   0,  72,   0,   0,   0, 
-      4,   0,   0,   0,   2,   0, 
-      0,   0,  52,   2,   0,   0, 
       0,   0,   0,   0, 255, 255, 
     255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,  67,  97, 109, 101, 
-    114,  97,  87, 111, 114, 108, 
-    100,  84, 114,  97, 110, 115, 
-    102, 111, 114, 109,   0, 102, 
-    108, 111,  97, 116,  52, 120, 
-     52,   0, 171, 171,   3,   0, 
-      3,   0,   4,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+     28,   2,   0,   0,  72,   0, 
+      0,   0,   4,   0,   0,   0, 
+      2,   0,   0,   0,  52,   2, 
       0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0,  67,  97, 
+    109, 101, 114,  97,  87, 111, 
+    114, 108, 100,  84, 114,  97, 
+    110, 115, 102, 111, 114, 109, 
+      0, 102, 108, 111,  97, 116, 
+     52, 120,  52,   0, 171, 171, 
+      3,   0,   3,   0,   4,   0, 
+      4,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    177,   1,   0,   0,  72,  97, 
-    108, 102,  86, 105, 101, 119, 
-    112, 111, 114, 116,  83, 105, 
-    122, 101,   0, 102, 108, 111, 
-     97, 116,  50,   0,   1,   0, 
-      3,   0,   1,   0,   2,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0, 177,   1,   0,   0, 
+     72,  97, 108, 102,  86, 105, 
+    101, 119, 112, 111, 114, 116, 
+     83, 105, 122, 101,   0, 102, 
+    108, 111,  97, 116,  50,   0, 
+      1,   0,   3,   0,   1,   0, 
+      2,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-    241,   1,   0,   0,  68, 105, 
-    115, 116,  84, 111,  80, 114, 
-    111, 106,  80, 108,  97, 110, 
-    101,   0, 102, 108, 111,  97, 
-    116,   0, 171, 171,   0,   0, 
-      3,   0,   1,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0, 241,   1,   0,   0, 
+     68, 105, 115, 116,  84, 111, 
+     80, 114, 111, 106,  80, 108, 
+     97, 110, 101,   0, 102, 108, 
+    111,  97, 116,   0, 171, 171, 
+      0,   0,   3,   0,   1,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     44,   2,   0,   0, 128,   2, 
+      0,   0,  44,   2,   0,   0, 
+    128,   2,   0,   0,   0,   0, 
+      0,   0,  56,   0,   0,   0, 
+      2,   0,   0,   0, 104,   3, 
       0,   0,   0,   0,   0,   0, 
-     56,   0,   0,   0,   2,   0, 
-      0,   0, 104,   3,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
     255, 255, 255, 255,   0,   0, 
-      0,   0,  36,  69, 108, 101, 
-    109, 101, 110, 116,   0,  65, 
-     97,  98,  98,  78, 111, 100, 
-    101,   0,  76, 101, 102, 116, 
-     77, 105, 110,   0, 102, 108, 
-    111,  97, 116,  51,   0, 171, 
-    171, 171,   1,   0,   3,   0, 
-      1,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0,  36,  69, 
+    108, 101, 109, 101, 110, 116, 
+      0,  65,  97,  98,  98,  78, 
+    111, 100, 101,   0,  76, 101, 
+    102, 116,  77, 105, 110,   0, 
+    102, 108, 111,  97, 116,  51, 
+      0, 171, 171, 171,   1,   0, 
+      3,   0,   1,   0,   3,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 154,   2, 
-      0,   0,  76, 101, 102, 116, 
-     77,  97, 120,   0,  82, 105, 
-    103, 104, 116,  77, 105, 110, 
-      0,  82, 105, 103, 104, 116, 
-     77,  97, 120,   0,  76, 101, 
-    102, 116,  73, 110, 100, 101, 
-    120,   0, 105, 110, 116,   0, 
-      0,   0,   2,   0,   1,   0, 
-      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+    154,   2,   0,   0,  76, 101, 
+    102, 116,  77,  97, 120,   0, 
+     82, 105, 103, 104, 116,  77, 
+    105, 110,   0,  82, 105, 103, 
+    104, 116,  77,  97, 120,   0, 
+     76, 101, 102, 116,  73, 110, 
+    100, 101, 120,   0, 105, 110, 
+    116,   0,   0,   0,   2,   0, 
+      1,   0,   1,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 236,   2,   0,   0, 
-     82, 105, 103, 104, 116,  73, 
-    110, 100, 101, 120,   0, 171, 
-    146,   2,   0,   0, 164,   2, 
       0,   0,   0,   0,   0,   0, 
-    200,   2,   0,   0, 164,   2, 
-      0,   0,  12,   0,   0,   0, 
-    208,   2,   0,   0, 164,   2, 
-      0,   0,  24,   0,   0,   0, 
-    217,   2,   0,   0, 164,   2, 
-      0,   0,  36,   0,   0,   0, 
-    226,   2,   0,   0, 240,   2, 
-      0,   0,  48,   0,   0,   0, 
-     20,   3,   0,   0, 240,   2, 
-      0,   0,  52,   0,   0,   0, 
-      5,   0,   0,   0,   1,   0, 
-     14,   0,   0,   0,   6,   0, 
-     32,   3,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 236,   2, 
+      0,   0,  82, 105, 103, 104, 
+    116,  73, 110, 100, 101, 120, 
+      0, 171, 146,   2,   0,   0, 
+    164,   2,   0,   0,   0,   0, 
+      0,   0, 200,   2,   0,   0, 
+    164,   2,   0,   0,  12,   0, 
+      0,   0, 208,   2,   0,   0, 
+    164,   2,   0,   0,  24,   0, 
+      0,   0, 217,   2,   0,   0, 
+    164,   2,   0,   0,  36,   0, 
+      0,   0, 226,   2,   0,   0, 
+    240,   2,   0,   0,  48,   0, 
+      0,   0,  20,   3,   0,   0, 
+    240,   2,   0,   0,  52,   0, 
+      0,   0,   5,   0,   0,   0, 
+      1,   0,  14,   0,   0,   0, 
+      6,   0,  32,   3,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 137,   2,   0,   0, 
-    128,   2,   0,   0,   0,   0, 
-      0,   0,   8,   0,   0,   0, 
-      2,   0,   0,   0, 220,   3, 
       0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
+      0,   0,   0,   0, 137,   2, 
+      0,   0, 128,   2,   0,   0, 
+      0,   0,   0,   0,   8,   0, 
+      0,   0,   2,   0,   0,   0, 
+    220,   3,   0,   0,   0,   0, 
       0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,  84,  97, 
-    115, 107,   0,  78, 111, 100, 
-    101,   0,  78, 101, 120, 116, 
-      0, 171, 185,   3,   0,   0, 
-    240,   2,   0,   0,   0,   0, 
-      0,   0, 190,   3,   0,   0, 
-    240,   2,   0,   0,   4,   0, 
-      0,   0,   5,   0,   0,   0, 
-      1,   0,   2,   0,   0,   0, 
-      2,   0, 196,   3,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+     84,  97, 115, 107,   0,  78, 
+    111, 100, 101,   0,  78, 101, 
+    120, 116,   0, 171, 185,   3, 
+      0,   0, 240,   2,   0,   0, 
+      0,   0,   0,   0, 190,   3, 
+      0,   0, 240,   2,   0,   0, 
+      4,   0,   0,   0,   5,   0, 
+      0,   0,   1,   0,   2,   0, 
+      0,   0,   2,   0, 196,   3, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    180,   3,   0,   0,  77, 105, 
+     99, 114, 111, 115, 111, 102, 
+    116,  32,  40,  82,  41,  32, 
+     72,  76,  83,  76,  32,  83, 
+    104,  97, 100, 101, 114,  32, 
+     67, 111, 109, 112, 105, 108, 
+    101, 114,  32,  54,  46,  51, 
+     46,  57,  54,  48,  48,  46, 
+     49,  54,  51,  56,  52,   0, 
+    171, 171,  73,  83,  71,  78, 
+      8,   0,   0,   0,   0,   0, 
+      0,   0,   8,   0,   0,   0, 
+     79,  83,  71,  78,   8,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 180,   3, 
-      0,   0,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  54,  46,  51,  46,  57, 
-     54,  48,  48,  46,  49,  54, 
-     51,  56,  52,   0, 171, 171, 
-     73,  83,  71,  78,   8,   0, 
+      8,   0,   0,   0,  83,  72, 
+     69,  88, 128,  34,   0,   0, 
+     80,   0,   5,   0, 160,   8, 
+      0,   0, 106, 136,   0,   1, 
+     89,   0,   0,   4,  70, 142, 
+     32,   0,   0,   0,   0,   0, 
+      5,   0,   0,   0, 162,   0, 
+      0,   4,   0, 112,  16,   0, 
+      0,   0,   0,   0,  56,   0, 
+      0,   0, 156,  24,   0,   4, 
+      0, 224,  17,   0,   0,   0, 
+      0,   0,  51,  51,   0,   0, 
+    158,   0, 128,   4,   0, 224, 
+     17,   0,   1,   0,   0,   0, 
+      8,   0,   0,   0,  95,   0, 
+      0,   2,  50,  16,   2,   0, 
+     95,   0,   0,   2,  50,  32, 
+      2,   0, 104,   0,   0,   2, 
+      8,   0,   0,   0, 155,   0, 
+      0,   4,   4,   0,   0,   0, 
+      4,   0,   0,   0,   1,   0, 
+      0,   0,  54,   0,   0,   5, 
+     18,   0,  16,   0,   0,   0, 
+      0,   0,   1,  64,   0,   0, 
+      4,   0,   0,   0,  54,   0, 
+      0,   8, 226,   0,  16,   0, 
+      0,   0,   0,   0,   2,  64, 
       0,   0,   0,   0,   0,   0, 
-      8,   0,   0,   0,  79,  83, 
-     71,  78,   8,   0,   0,   0, 
-      0,   0,   0,   0,   8,   0, 
-      0,   0,  83,  72,  69,  88, 
-    128,  34,   0,   0,  80,   0, 
-      5,   0, 160,   8,   0,   0, 
-    106, 136,   0,   1,  89,   0, 
-      0,   4,  70, 142,  32,   0, 
-      0,   0,   0,   0,   5,   0, 
-      0,   0, 162,   0,   0,   4, 
-      0, 112,  16,   0,   0,   0, 
-      0,   0,  56,   0,   0,   0, 
-    156,  24,   0,   4,   0, 224, 
-     17,   0,   0,   0,   0,   0, 
-     51,  51,   0,   0, 158,   0, 
-    128,   4,   0, 224,  17,   0, 
-      1,   0,   0,   0,   8,   0, 
-      0,   0,  95,   0,   0,   2, 
-     50,  16,   2,   0,  95,   0, 
-      0,   2,  50,  32,   2,   0, 
-    104,   0,   0,   2,   8,   0, 
-      0,   0, 155,   0,   0,   4, 
       4,   0,   0,   0,   4,   0, 
-      0,   0,   1,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   4,   0, 
-      0,   0,  54,   0,   0,   8, 
-    226,   0,  16,   0,   0,   0, 
-      0,   0,   2,  64,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
       0,   0,   4,   0,   0,   0, 
-      4,   0,   0,   0,  38,   0, 
-      0,   7,   0, 208,   0,   0, 
-    242,   0,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  70,  21, 
-      2,   0,  30,   0,   0,   6, 
-    242,   0,  16,   0,   0,   0, 
-      0,   0, 198,   9,  16,   0, 
-      0,   0,   0,   0,  70,  37, 
-      2,   0,  58,   0,   0,   1, 
-     54,   0,   0,   5,  50,   0, 
+     38,   0,   0,   7,   0, 208, 
+      0,   0, 242,   0,  16,   0, 
+      0,   0,   0,   0,  70,  14, 
      16,   0,   0,   0,   0,   0, 
-     70,   0,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   6, 
-     50,   0,  16,   0,   1,   0, 
-      0,   0,  70, 128,  32,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,  54,   0,   0,   6, 
-     66,   0,  16,   0,   2,   0, 
-      0,   0,  42, 128,  32,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,  86,   0,   0,   5, 
-     66,   0,  16,   0,   1,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   6,  18,   0,  16,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16, 128,  65,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   7,  18,   0,  16,   0, 
-      2,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-     42,   0,  16,   0,   1,   0, 
-      0,   0,  86,   0,   0,   5, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  26,   0,  16,   0, 
+     70,  21,   2,   0,  30,   0, 
+      0,   6, 242,   0,  16,   0, 
+      0,   0,   0,   0, 198,   9, 
+     16,   0,   0,   0,   0,   0, 
+     70,  37,   2,   0,  58,   0, 
+      0,   1,  54,   0,   0,   5, 
+     50,   0,  16,   0,   0,   0, 
+      0,   0,  70,   0,  16,   0, 
       0,   0,   0,   0,  54,   0, 
-      0,   6,  18,   0,  16,   0, 
+      0,   6,  50,   0,  16,   0, 
+      1,   0,   0,   0,  70, 128, 
+     32,   0,   0,   0,   0,   0, 
+      4,   0,   0,   0,  54,   0, 
+      0,   6,  66,   0,  16,   0, 
+      2,   0,   0,   0,  42, 128, 
+     32,   0,   0,   0,   0,   0, 
+      4,   0,   0,   0,  86,   0, 
+      0,   5,  66,   0,  16,   0, 
       1,   0,   0,   0,  10,   0, 
-     16, 128,  65,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   7,  34,   0,  16,   0, 
-      2,   0,   0,   0,  10,   0, 
+     16,   0,   0,   0,   0,   0, 
+     54,   0,   0,   6,  18,   0, 
      16,   0,   1,   0,   0,   0, 
-     26,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-     66,   0,  16,   0,   2,   0, 
-      0,   0,  42,   0,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      2,   0,   0,   0,  70,   2, 
+     10,   0,  16, 128,  65,   0, 
+      0,   0,   1,   0,   0,   0, 
+      0,   0,   0,   7,  18,   0, 
      16,   0,   2,   0,   0,   0, 
-     16,   0,   0,   7,  18,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   2,   0, 
-      0,   0,  70,   2,  16,   0, 
-      2,   0,   0,   0,  68,   0, 
+     10,   0,  16,   0,   1,   0, 
+      0,   0,  42,   0,  16,   0, 
+      1,   0,   0,   0,  86,   0, 
       0,   5,  18,   0,  16,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   1,   0,   0,   0, 
-      6,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      2,   0,   0,   0,  56,   0, 
-      0,   8, 114,   0,  16,   0, 
-      2,   0,   0,   0,   6,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70, 130,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     56,   0,   0,   8, 178,   0, 
+      1,   0,   0,   0,  26,   0, 
+     16,   0,   0,   0,   0,   0, 
+     54,   0,   0,   6,  18,   0, 
      16,   0,   1,   0,   0,   0, 
-     86,   5,  16,   0,   1,   0, 
-      0,   0,  70, 136,  32,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   7, 
-    178,   0,  16,   0,   1,   0, 
-      0,   0,  70,  12,  16,   0, 
-      1,   0,   0,   0,  70,   8, 
+     10,   0,  16, 128,  65,   0, 
+      0,   0,   1,   0,   0,   0, 
+      0,   0,   0,   7,  34,   0, 
      16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   8, 114,   0, 
+     10,   0,  16,   0,   1,   0, 
+      0,   0,  26,   0,  16,   0, 
+      1,   0,   0,   0,  54,   0, 
+      0,   5,  66,   0,  16,   0, 
+      2,   0,   0,   0,  42,   0, 
      16,   0,   2,   0,   0,   0, 
-    166,  10,  16,   0,   1,   0, 
-      0,   0,  70, 130,  32,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   7, 
+     54,   0,   0,   5, 114,   0, 
+     16,   0,   2,   0,   0,   0, 
+     70,   2,  16,   0,   2,   0, 
+      0,   0,  16,   0,   0,   7, 
+     18,   0,  16,   0,   1,   0, 
+      0,   0,  70,   2,  16,   0, 
+      2,   0,   0,   0,  70,   2, 
+     16,   0,   2,   0,   0,   0, 
+     68,   0,   0,   5,  18,   0, 
+     16,   0,   1,   0,   0,   0, 
+     10,   0,  16,   0,   1,   0, 
+      0,   0,  56,   0,   0,   7, 
     114,   0,  16,   0,   1,   0, 
-      0,   0,  70,   3,  16,   0, 
+      0,   0,   6,   0,  16,   0, 
       1,   0,   0,   0,  70,   2, 
      16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   6, 114,   0, 
+     56,   0,   0,   8, 114,   0, 
      16,   0,   2,   0,   0,   0, 
-     70, 130,  32,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
+      6,   0,  16,   0,   1,   0, 
+      0,   0,  70, 130,  32,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,  56,   0,   0,   8, 
+    178,   0,  16,   0,   1,   0, 
+      0,   0,  86,   5,  16,   0, 
+      1,   0,   0,   0,  70, 136, 
+     32,   0,   0,   0,   0,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   7, 178,   0,  16,   0, 
+      1,   0,   0,   0,  70,  12, 
      16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0, 167,   0,   0, 139, 
-      2, 195,   1, 128, 131, 153, 
-     25,   0,  18,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
+     70,   8,  16,   0,   2,   0, 
+      0,   0,  56,   0,   0,   8, 
+    114,   0,  16,   0,   2,   0, 
+      0,   0, 166,  10,  16,   0, 
+      1,   0,   0,   0,  70, 130, 
+     32,   0,   0,   0,   0,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   7, 114,   0,  16,   0, 
+      1,   0,   0,   0,  70,   3, 
      16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,   6, 112,  16,   0, 
+     70,   2,  16,   0,   2,   0, 
+      0,   0,  54,   0,   0,   6, 
+    114,   0,  16,   0,   2,   0, 
+      0,   0,  70, 130,  32,   0, 
+      0,   0,   0,   0,   3,   0, 
+      0,   0,  54,   0,   0,   5, 
+    130,   0,  16,   0,   1,   0, 
+      0,   0,   1,  64,   0,   0, 
       0,   0,   0,   0, 167,   0, 
       0, 139,   2, 195,   1, 128, 
-    131, 153,  25,   0,  34,   0, 
+    131, 153,  25,   0,  18,   0, 
      16,   0,   3,   0,   0,   0, 
      58,   0,  16,   0,   1,   0, 
       0,   0,   1,  64,   0,   0, 
-      4,   0,   0,   0,   6, 112, 
+      0,   0,   0,   0,   6, 112, 
      16,   0,   0,   0,   0,   0, 
     167,   0,   0, 139,   2, 195, 
       1, 128, 131, 153,  25,   0, 
-     66,   0,  16,   0,   3,   0, 
+     34,   0,  16,   0,   3,   0, 
       0,   0,  58,   0,  16,   0, 
       1,   0,   0,   0,   1,  64, 
-      0,   0,   8,   0,   0,   0, 
+      0,   0,   4,   0,   0,   0, 
       6, 112,  16,   0,   0,   0, 
       0,   0, 167,   0,   0, 139, 
       2, 195,   1, 128, 131, 153, 
-     25,   0,  18,   0,  16,   0, 
-      4,   0,   0,   0,  58,   0, 
+     25,   0,  66,   0,  16,   0, 
+      3,   0,   0,   0,  58,   0, 
      16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,  12,   0, 
+      1,  64,   0,   0,   8,   0, 
       0,   0,   6, 112,  16,   0, 
       0,   0,   0,   0, 167,   0, 
       0, 139,   2, 195,   1, 128, 
-    131, 153,  25,   0,  34,   0, 
+    131, 153,  25,   0,  18,   0, 
      16,   0,   4,   0,   0,   0, 
      58,   0,  16,   0,   1,   0, 
       0,   0,   1,  64,   0,   0, 
-     16,   0,   0,   0,   6, 112, 
+     12,   0,   0,   0,   6, 112, 
      16,   0,   0,   0,   0,   0, 
     167,   0,   0, 139,   2, 195, 
       1, 128, 131, 153,  25,   0, 
-     66,   0,  16,   0,   4,   0, 
+     34,   0,  16,   0,   4,   0, 
       0,   0,  58,   0,  16,   0, 
       1,   0,   0,   0,   1,  64, 
-      0,   0,  20,   0,   0,   0, 
+      0,   0,  16,   0,   0,   0, 
       6, 112,  16,   0,   0,   0, 
       0,   0, 167,   0,   0, 139, 
       2, 195,   1, 128, 131, 153, 
-     25,   0,  18,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
+     25,   0,  66,   0,  16,   0, 
+      4,   0,   0,   0,  58,   0, 
      16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,  24,   0, 
+      1,  64,   0,   0,  20,   0, 
       0,   0,   6, 112,  16,   0, 
       0,   0,   0,   0, 167,   0, 
       0, 139,   2, 195,   1, 128, 
-    131, 153,  25,   0,  34,   0, 
+    131, 153,  25,   0,  18,   0, 
      16,   0,   5,   0,   0,   0, 
      58,   0,  16,   0,   1,   0, 
       0,   0,   1,  64,   0,   0, 
-     28,   0,   0,   0,   6, 112, 
+     24,   0,   0,   0,   6, 112, 
      16,   0,   0,   0,   0,   0, 
     167,   0,   0, 139,   2, 195, 
       1, 128, 131, 153,  25,   0, 
-     66,   0,  16,   0,   5,   0, 
+     34,   0,  16,   0,   5,   0, 
       0,   0,  58,   0,  16,   0, 
       1,   0,   0,   0,   1,  64, 
-      0,   0,  32,   0,   0,   0, 
+      0,   0,  28,   0,   0,   0, 
       6, 112,  16,   0,   0,   0, 
       0,   0, 167,   0,   0, 139, 
       2, 195,   1, 128, 131, 153, 
-     25,   0,  18,   0,  16,   0, 
-      6,   0,   0,   0,  58,   0, 
+     25,   0,  66,   0,  16,   0, 
+      5,   0,   0,   0,  58,   0, 
      16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,  36,   0, 
+      1,  64,   0,   0,  32,   0, 
       0,   0,   6, 112,  16,   0, 
       0,   0,   0,   0, 167,   0, 
       0, 139,   2, 195,   1, 128, 
-    131, 153,  25,   0,  34,   0, 
+    131, 153,  25,   0,  18,   0, 
      16,   0,   6,   0,   0,   0, 
      58,   0,  16,   0,   1,   0, 
       0,   0,   1,  64,   0,   0, 
-     40,   0,   0,   0,   6, 112, 
+     36,   0,   0,   0,   6, 112, 
      16,   0,   0,   0,   0,   0, 
     167,   0,   0, 139,   2, 195, 
       1, 128, 131, 153,  25,   0, 
-     66,   0,  16,   0,   6,   0, 
+     34,   0,  16,   0,   6,   0, 
       0,   0,  58,   0,  16,   0, 
       1,   0,   0,   0,   1,  64, 
-      0,   0,  44,   0,   0,   0, 
+      0,   0,  40,   0,   0,   0, 
       6, 112,  16,   0,   0,   0, 
       0,   0, 167,   0,   0, 139, 
       2, 195,   1, 128, 131, 153, 
-     25,   0, 130,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
+     25,   0,  66,   0,  16,   0, 
+      6,   0,   0,   0,  58,   0, 
      16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,  48,   0, 
+      1,  64,   0,   0,  44,   0, 
       0,   0,   6, 112,  16,   0, 
       0,   0,   0,   0, 167,   0, 
       0, 139,   2, 195,   1, 128, 
     131, 153,  25,   0, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
+     16,   0,   2,   0,   0,   0, 
      58,   0,  16,   0,   1,   0, 
       0,   0,   1,  64,   0,   0, 
-     52,   0,   0,   0,   6, 112, 
+     48,   0,   0,   0,   6, 112, 
      16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   7,   0,   0,   0, 
-      1,  64,   0,   0, 255, 255, 
-      0,   0,  58,   0,   0,   1, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,   2,  16,   0,   2,   0, 
+    167,   0,   0, 139,   2, 195, 
+      1, 128, 131, 153,  25,   0, 
+    130,   0,  16,   0,   1,   0, 
+      0,   0,  58,   0,  16,   0, 
+      1,   0,   0,   0,   1,  64, 
+      0,   0,  52,   0,   0,   0, 
+      6, 112,  16,   0,   0,   0, 
       0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   1,   0, 
+     18,   0,  16,   0,   7,   0, 
+      0,   0,   1,  64,   0,   0, 
+    255, 255, 255, 255,  58,   0, 
+      0,   1,  54,   0,   0,   5, 
+    114,   0,  16,   0,   2,   0, 
       0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
+      2,   0,   0,   0,  54,   0, 
       0,   5, 114,   0,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  49,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  10,   0,  16,   0, 
-      2,   0,   0,   0,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-     43,   0,   0,   5, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  49,   0,   0,   7, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      4,   0,   0,   0,  10,   0, 
+      1,   0,   0,   0,  70,   2, 
      16,   0,   1,   0,   0,   0, 
-      1,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      4,   0,   0,   0,  31,   0, 
-      4,   3,  58,   0,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
-      0,   6, 130,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
-     16, 128,  65,   0,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     10,   0,  16,   0,   3,   0, 
-      0,   0,  43,   0,   0,   8, 
-    226,   0,  16,   0,   7,   0, 
-      0,   0,   2,  64,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  16,   0, 
-      0,   7, 130,   0,  16,   0, 
-      4,   0,   0,   0, 150,   7, 
-     16,   0,   7,   0,   0,   0, 
-     70,   2,  16,   0,   1,   0, 
-      0,   0,  14,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     56,   0,   0,   7,  98,   0, 
-     16,   0,   7,   0,   0,   0, 
-     86,   6,  16,   0,   1,   0, 
-      0,   0, 246,  15,  16,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   7,  98,   0,  16,   0, 
-      7,   0,   0,   0,  86,   6, 
-     16,   0,   2,   0,   0,   0, 
-     86,   6,  16,   0,   7,   0, 
-      0,   0,  29,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      7,   0,   0,   0,  26,   0, 
-     16,   0,   3,   0,   0,   0, 
-     29,   0,   0,   7, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     26,   0,  16,   0,   4,   0, 
-      0,   0,  26,   0,  16,   0, 
-      7,   0,   0,   0,   1,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  29,   0,   0,   7, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  42,   0,  16,   0, 
-      7,   0,   0,   0,  42,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      4,   0,   0,   0,  29,   0, 
-      0,   7, 130,   0,  16,   0, 
-      4,   0,   0,   0,  42,   0, 
-     16,   0,   4,   0,   0,   0, 
-     42,   0,  16,   0,   7,   0, 
-      0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     31,   0,   4,   3,  58,   0, 
+     54,   0,   0,   5, 114,   0, 
      16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-      1,  64,   0,   0, 255, 255, 
-    255, 255,  21,   0,   0,   1, 
-     18,   0,   0,   1,  49,   0, 
-      0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  10,   0, 
-     16,   0,   4,   0,   0,   0, 
-     10,   0,  16,   0,   2,   0, 
-      0,   0,  43,   0,   0,   5, 
-    130,   0,  16,   0,   6,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  49,   0, 
-      0,   7, 130,   0,  16,   0, 
-      6,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   6,   0, 
-      0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   6,   0,   0,   0, 
-     31,   0,   4,   3,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     54,   0,   0,   6, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     10,   0,  16, 128,  65,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     10,   0,  16,   0,   2,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  43,   0, 
-      0,   8, 226,   0,  16,   0, 
-      7,   0,   0,   0,   2,  64, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   6,   0,   0,   0, 
-    150,   7,  16,   0,   7,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  14,   0, 
-      0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   6,   0, 
-      0,   0,  56,   0,   0,   7, 
-     98,   0,  16,   0,   7,   0, 
-      0,   0,  86,   6,  16,   0, 
-      1,   0,   0,   0, 246,  15, 
-     16,   0,   5,   0,   0,   0, 
-      0,   0,   0,   7,  98,   0, 
-     16,   0,   7,   0,   0,   0, 
-     86,   6,  16,   0,   2,   0, 
-      0,   0,  86,   6,  16,   0, 
-      7,   0,   0,   0,  29,   0, 
-      0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  26,   0, 
-     16,   0,   7,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  29,   0,   0,   7, 
-    130,   0,  16,   0,   6,   0, 
-      0,   0,  26,   0,  16,   0, 
-      4,   0,   0,   0,  26,   0, 
-     16,   0,   7,   0,   0,   0, 
-      1,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      6,   0,   0,   0,  29,   0, 
-      0,   7, 130,   0,  16,   0, 
-      6,   0,   0,   0,  42,   0, 
-     16,   0,   7,   0,   0,   0, 
-     42,   0,  16,   0,   3,   0, 
-      0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   6,   0,   0,   0, 
-     29,   0,   0,   7, 130,   0, 
-     16,   0,   6,   0,   0,   0, 
-     42,   0,  16,   0,   4,   0, 
-      0,   0,  42,   0,  16,   0, 
-      7,   0,   0,   0,   1,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   6,   0, 
-      0,   0,  31,   0,   4,   3, 
-     58,   0,  16,   0,   3,   0, 
+     70,   2,  16,   0,   3,   0, 
       0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,   1,  64,   0,   0, 
-    255, 255, 255, 255,  21,   0, 
-      0,   1,  18,   0,   0,   1, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  21,   0,   0,   1, 
-     21,   0,   0,   1,  31,   0, 
-      0,   3,  58,   0,  16,   0, 
-      3,   0,   0,   0,  49,   0, 
+    114,   0,  16,   0,   4,   0, 
+      0,   0,  70,   2,  16,   0, 
+      4,   0,   0,   0,  49,   0, 
       0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  26,   0, 
+      3,   0,   0,   0,  10,   0, 
      16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
+     10,   0,  16,   0,   3,   0, 
       0,   0,  43,   0,   0,   5, 
-    130,   0,  16,   0,   5,   0, 
+    130,   0,  16,   0,   4,   0, 
       0,   0,   1,  64,   0,   0, 
       0,   0,   0,   0,  49,   0, 
       0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     26,   0,  16,   0,   1,   0, 
+      4,   0,   0,   0,  58,   0, 
+     16,   0,   4,   0,   0,   0, 
+     10,   0,  16,   0,   1,   0, 
       0,   0,   1,   0,   0,   7, 
     130,   0,  16,   0,   3,   0, 
       0,   0,  58,   0,  16,   0, 
       3,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
+     16,   0,   4,   0,   0,   0, 
      31,   0,   4,   3,  58,   0, 
      16,   0,   3,   0,   0,   0, 
      54,   0,   0,   6, 130,   0, 
      16,   0,   3,   0,   0,   0, 
-     26,   0,  16, 128,  65,   0, 
+     10,   0,  16, 128,  65,   0, 
       0,   0,   2,   0,   0,   0, 
       0,   0,   0,   7, 130,   0, 
      16,   0,   3,   0,   0,   0, 
      58,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
+      0,   0,  10,   0,  16,   0, 
       3,   0,   0,   0,  43,   0, 
       0,   8, 226,   0,  16,   0, 
       7,   0,   0,   0,   2,  64, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
      16,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
+     16,   0,   4,   0,   0,   0, 
     150,   7,  16,   0,   7,   0, 
       0,   0,  70,   2,  16,   0, 
       1,   0,   0,   0,  14,   0, 
       0,   7, 130,   0,  16,   0, 
       3,   0,   0,   0,  58,   0, 
      16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
+     58,   0,  16,   0,   4,   0, 
       0,   0,  56,   0,   0,   7, 
      98,   0,  16,   0,   7,   0, 
-      0,   0,   6,   2,  16,   0, 
+      0,   0,  86,   6,  16,   0, 
       1,   0,   0,   0, 246,  15, 
      16,   0,   3,   0,   0,   0, 
       0,   0,   0,   7,  98,   0, 
      16,   0,   7,   0,   0,   0, 
-      6,   2,  16,   0,   2,   0, 
+     86,   6,  16,   0,   2,   0, 
       0,   0,  86,   6,  16,   0, 
       7,   0,   0,   0,  29,   0, 
       0,   7, 130,   0,  16,   0, 
       3,   0,   0,   0,  26,   0, 
      16,   0,   7,   0,   0,   0, 
-     10,   0,  16,   0,   3,   0, 
+     26,   0,  16,   0,   3,   0, 
       0,   0,  29,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  10,   0,  16,   0, 
+    130,   0,  16,   0,   4,   0, 
+      0,   0,  26,   0,  16,   0, 
       4,   0,   0,   0,  26,   0, 
      16,   0,   7,   0,   0,   0, 
       1,   0,   0,   7, 130,   0, 
      16,   0,   3,   0,   0,   0, 
      58,   0,  16,   0,   3,   0, 
       0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  29,   0, 
+      4,   0,   0,   0,  29,   0, 
       0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  42,   0, 
+      4,   0,   0,   0,  42,   0, 
      16,   0,   7,   0,   0,   0, 
      42,   0,  16,   0,   3,   0, 
       0,   0,   1,   0,   0,   7, 
     130,   0,  16,   0,   3,   0, 
       0,   0,  58,   0,  16,   0, 
       3,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
+     16,   0,   4,   0,   0,   0, 
      29,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
+     16,   0,   4,   0,   0,   0, 
      42,   0,  16,   0,   4,   0, 
       0,   0,  42,   0,  16,   0, 
       7,   0,   0,   0,   1,   0, 
       0,   7, 130,   0,  16,   0, 
       3,   0,   0,   0,  58,   0, 
      16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
+     58,   0,  16,   0,   4,   0, 
       0,   0,  31,   0,   4,   3, 
      58,   0,  16,   0,   3,   0, 
       0,   0,  54,   0,   0,   5, 
@@ -1238,15 +995,15 @@ const BYTE RaytraceFirstPass[] =
       0,   1,  18,   0,   0,   1, 
      49,   0,   0,   7, 130,   0, 
      16,   0,   5,   0,   0,   0, 
-     26,   0,  16,   0,   4,   0, 
-      0,   0,  26,   0,  16,   0, 
+     10,   0,  16,   0,   4,   0, 
+      0,   0,  10,   0,  16,   0, 
       2,   0,   0,   0,  43,   0, 
       0,   5, 130,   0,  16,   0, 
       6,   0,   0,   0,   1,  64, 
       0,   0,   0,   0,   0,   0, 
      49,   0,   0,   7, 130,   0, 
      16,   0,   6,   0,   0,   0, 
-     26,   0,  16,   0,   1,   0, 
+     10,   0,  16,   0,   1,   0, 
       0,   0,  58,   0,  16,   0, 
       6,   0,   0,   0,   1,   0, 
       0,   7, 130,   0,  16,   0, 
@@ -1257,18 +1014,18 @@ const BYTE RaytraceFirstPass[] =
      58,   0,  16,   0,   5,   0, 
       0,   0,  54,   0,   0,   6, 
     130,   0,  16,   0,   5,   0, 
-      0,   0,  26,   0,  16, 128, 
+      0,   0,  10,   0,  16, 128, 
      65,   0,   0,   0,   4,   0, 
       0,   0,   0,   0,   0,   7, 
     130,   0,  16,   0,   5,   0, 
-      0,   0,  26,   0,  16,   0, 
+      0,   0,  10,   0,  16,   0, 
       2,   0,   0,   0,  58,   0, 
      16,   0,   5,   0,   0,   0, 
      43,   0,   0,   8, 226,   0, 
      16,   0,   7,   0,   0,   0, 
       2,  64,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
       0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
       0,   0,  16,   0,   0,   7, 
     130,   0,  16,   0,   6,   0, 
       0,   0, 150,   7,  16,   0, 
@@ -1280,21 +1037,21 @@ const BYTE RaytraceFirstPass[] =
       0,   0,  58,   0,  16,   0, 
       6,   0,   0,   0,  56,   0, 
       0,   7,  98,   0,  16,   0, 
-      7,   0,   0,   0,   6,   2, 
+      7,   0,   0,   0,  86,   6, 
      16,   0,   1,   0,   0,   0, 
     246,  15,  16,   0,   5,   0, 
       0,   0,   0,   0,   0,   7, 
      98,   0,  16,   0,   7,   0, 
-      0,   0,   6,   2,  16,   0, 
+      0,   0,  86,   6,  16,   0, 
       2,   0,   0,   0,  86,   6, 
      16,   0,   7,   0,   0,   0, 
      29,   0,   0,   7, 130,   0, 
      16,   0,   5,   0,   0,   0, 
      26,   0,  16,   0,   7,   0, 
-      0,   0,  10,   0,  16,   0, 
+      0,   0,  26,   0,  16,   0, 
       3,   0,   0,   0,  29,   0, 
       0,   7, 130,   0,  16,   0, 
-      6,   0,   0,   0,  10,   0, 
+      6,   0,   0,   0,  26,   0, 
      16,   0,   4,   0,   0,   0, 
      26,   0,  16,   0,   7,   0, 
       0,   0,   1,   0,   0,   7, 
@@ -1336,8 +1093,8 @@ const BYTE RaytraceFirstPass[] =
      16,   0,   3,   0,   0,   0, 
      49,   0,   0,   7, 130,   0, 
      16,   0,   3,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
-      0,   0,  42,   0,  16,   0, 
+     26,   0,  16,   0,   2,   0, 
+      0,   0,  26,   0,  16,   0, 
       3,   0,   0,   0,  43,   0, 
       0,   5, 130,   0,  16,   0, 
       5,   0,   0,   0,   1,  64, 
@@ -1345,7 +1102,7 @@ const BYTE RaytraceFirstPass[] =
      49,   0,   0,   7, 130,   0, 
      16,   0,   5,   0,   0,   0, 
      58,   0,  16,   0,   5,   0, 
-      0,   0,  42,   0,  16,   0, 
+      0,   0,  26,   0,  16,   0, 
       1,   0,   0,   0,   1,   0, 
       0,   7, 130,   0,  16,   0, 
       3,   0,   0,   0,  58,   0, 
@@ -1355,493 +1112,493 @@ const BYTE RaytraceFirstPass[] =
      58,   0,  16,   0,   3,   0, 
       0,   0,  54,   0,   0,   6, 
     130,   0,  16,   0,   3,   0, 
-      0,   0,  42,   0,  16, 128, 
+      0,   0,  26,   0,  16, 128, 
      65,   0,   0,   0,   2,   0, 
       0,   0,   0,   0,   0,   7, 
-     66,   0,  16,   0,   3,   0, 
+    130,   0,  16,   0,   3,   0, 
       0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
+      3,   0,   0,   0,  26,   0, 
      16,   0,   3,   0,   0,   0, 
      43,   0,   0,   8, 226,   0, 
      16,   0,   7,   0,   0,   0, 
       2,  64,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
+      1,   0,   0,   0,   0,   0, 
       0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
+    130,   0,  16,   0,   5,   0, 
       0,   0, 150,   7,  16,   0, 
       7,   0,   0,   0,  70,   2, 
      16,   0,   1,   0,   0,   0, 
-     14,   0,   0,   7,  66,   0, 
+     14,   0,   0,   7, 130,   0, 
      16,   0,   3,   0,   0,   0, 
-     42,   0,  16,   0,   3,   0, 
+     58,   0,  16,   0,   3,   0, 
       0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   7, 194,   0,  16,   0, 
-      3,   0,   0,   0,   6,   4, 
+      5,   0,   0,   0,  56,   0, 
+      0,   7,  98,   0,  16,   0, 
+      7,   0,   0,   0,   6,   2, 
      16,   0,   1,   0,   0,   0, 
-    166,  10,  16,   0,   3,   0, 
+    246,  15,  16,   0,   3,   0, 
       0,   0,   0,   0,   0,   7, 
-    194,   0,  16,   0,   3,   0, 
-      0,   0,   6,   4,  16,   0, 
-      2,   0,   0,   0, 166,  14, 
-     16,   0,   3,   0,   0,   0, 
+     98,   0,  16,   0,   7,   0, 
+      0,   0,   6,   2,  16,   0, 
+      2,   0,   0,   0,  86,   6, 
+     16,   0,   7,   0,   0,   0, 
      29,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     42,   0,  16,   0,   3,   0, 
+     16,   0,   3,   0,   0,   0, 
+     26,   0,  16,   0,   7,   0, 
       0,   0,  10,   0,  16,   0, 
       3,   0,   0,   0,  29,   0, 
-      0,   7,  66,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
+      0,   7, 130,   0,  16,   0, 
+      5,   0,   0,   0,  10,   0, 
      16,   0,   4,   0,   0,   0, 
-     42,   0,  16,   0,   3,   0, 
+     26,   0,  16,   0,   7,   0, 
       0,   0,   1,   0,   0,   7, 
-     66,   0,  16,   0,   3,   0, 
-      0,   0,  42,   0,  16,   0, 
+    130,   0,  16,   0,   3,   0, 
+      0,   0,  58,   0,  16,   0, 
       3,   0,   0,   0,  58,   0, 
      16,   0,   5,   0,   0,   0, 
      29,   0,   0,   7, 130,   0, 
      16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
+     42,   0,  16,   0,   7,   0, 
+      0,   0,  42,   0,  16,   0, 
       3,   0,   0,   0,   1,   0, 
-      0,   7,  66,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
+      0,   7, 130,   0,  16,   0, 
+      3,   0,   0,   0,  58,   0, 
      16,   0,   3,   0,   0,   0, 
      58,   0,  16,   0,   5,   0, 
       0,   0,  29,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      4,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,   0,   0,   7,  66,   0, 
+    130,   0,  16,   0,   5,   0, 
+      0,   0,  42,   0,  16,   0, 
+      4,   0,   0,   0,  42,   0, 
+     16,   0,   7,   0,   0,   0, 
+      1,   0,   0,   7, 130,   0, 
      16,   0,   3,   0,   0,   0, 
      58,   0,  16,   0,   3,   0, 
-      0,   0,  42,   0,  16,   0, 
-      3,   0,   0,   0,  31,   0, 
-      4,   3,  42,   0,  16,   0, 
+      0,   0,  58,   0,  16,   0, 
+      5,   0,   0,   0,  31,   0, 
+      4,   3,  58,   0,  16,   0, 
       3,   0,   0,   0,  54,   0, 
       0,   5, 130,   0,  16,   0, 
       4,   0,   0,   0,   1,  64, 
       0,   0, 255, 255, 255, 255, 
      21,   0,   0,   1,  18,   0, 
       0,   1,  49,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  42,   0,  16,   0, 
-      4,   0,   0,   0,  42,   0, 
+    130,   0,  16,   0,   5,   0, 
+      0,   0,  26,   0,  16,   0, 
+      4,   0,   0,   0,  26,   0, 
      16,   0,   2,   0,   0,   0, 
      43,   0,   0,   5, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
+     16,   0,   6,   0,   0,   0, 
       1,  64,   0,   0,   0,   0, 
       0,   0,  49,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  42,   0,  16,   0, 
+    130,   0,  16,   0,   6,   0, 
+      0,   0,  26,   0,  16,   0, 
       1,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
+     16,   0,   6,   0,   0,   0, 
       1,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   3,   0, 
+     16,   0,   5,   0,   0,   0, 
+     58,   0,  16,   0,   5,   0, 
       0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  31,   0, 
+      6,   0,   0,   0,  31,   0, 
       4,   3,  58,   0,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
+      5,   0,   0,   0,  54,   0, 
       0,   6, 130,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
+      5,   0,   0,   0,  26,   0, 
      16, 128,  65,   0,   0,   0, 
       4,   0,   0,   0,   0,   0, 
       0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
+      5,   0,   0,   0,  26,   0, 
      16,   0,   2,   0,   0,   0, 
-     58,   0,  16,   0,   3,   0, 
+     58,   0,  16,   0,   5,   0, 
       0,   0,  43,   0,   0,   8, 
     226,   0,  16,   0,   7,   0, 
       0,   0,   2,  64,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  16,   0, 
-      0,   7,  66,   0,  16,   0, 
-      4,   0,   0,   0, 150,   7, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0,  16,   0, 
+      0,   7, 130,   0,  16,   0, 
+      6,   0,   0,   0, 150,   7, 
      16,   0,   7,   0,   0,   0, 
      70,   2,  16,   0,   1,   0, 
       0,   0,  14,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
+    130,   0,  16,   0,   5,   0, 
       0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
-     16,   0,   4,   0,   0,   0, 
+      5,   0,   0,   0,  58,   0, 
+     16,   0,   6,   0,   0,   0, 
      56,   0,   0,   7,  98,   0, 
      16,   0,   7,   0,   0,   0, 
-      6,   1,  16,   0,   1,   0, 
+      6,   2,  16,   0,   1,   0, 
       0,   0, 246,  15,  16,   0, 
-      3,   0,   0,   0,   0,   0, 
+      5,   0,   0,   0,   0,   0, 
       0,   7,  98,   0,  16,   0, 
-      7,   0,   0,   0,   6,   1, 
+      7,   0,   0,   0,   6,   2, 
      16,   0,   2,   0,   0,   0, 
      86,   6,  16,   0,   7,   0, 
       0,   0,  29,   0,   0,   7, 
-     18,   0,  16,   0,   3,   0, 
+    130,   0,  16,   0,   5,   0, 
       0,   0,  26,   0,  16,   0, 
       7,   0,   0,   0,  10,   0, 
      16,   0,   3,   0,   0,   0, 
      29,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
+     16,   0,   6,   0,   0,   0, 
      10,   0,  16,   0,   4,   0, 
       0,   0,  26,   0,  16,   0, 
       7,   0,   0,   0,   1,   0, 
-      0,   7,  18,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     10,   0,  16,   0,   3,   0, 
+      0,   7, 130,   0,  16,   0, 
+      5,   0,   0,   0,  58,   0, 
+     16,   0,   5,   0,   0,   0, 
+     58,   0,  16,   0,   6,   0, 
       0,   0,  29,   0,   0,   7, 
-     34,   0,  16,   0,   3,   0, 
+    130,   0,  16,   0,   6,   0, 
       0,   0,  42,   0,  16,   0, 
-      7,   0,   0,   0,  26,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,   0,   0,   7,  18,   0, 
+      7,   0,   0,   0,  42,   0, 
      16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  10,   0,  16,   0, 
-      3,   0,   0,   0,  29,   0, 
-      0,   7,  34,   0,  16,   0, 
-      3,   0,   0,   0,  26,   0, 
+      1,   0,   0,   7, 130,   0, 
+     16,   0,   5,   0,   0,   0, 
+     58,   0,  16,   0,   5,   0, 
+      0,   0,  58,   0,  16,   0, 
+      6,   0,   0,   0,  29,   0, 
+      0,   7, 130,   0,  16,   0, 
+      6,   0,   0,   0,  42,   0, 
      16,   0,   4,   0,   0,   0, 
      42,   0,  16,   0,   7,   0, 
       0,   0,   1,   0,   0,   7, 
-     66,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-     31,   0,   4,   3,  42,   0, 
+    130,   0,  16,   0,   3,   0, 
+      0,   0,  58,   0,  16,   0, 
+      5,   0,   0,   0,  58,   0, 
+     16,   0,   6,   0,   0,   0, 
+     31,   0,   4,   3,  58,   0, 
      16,   0,   3,   0,   0,   0, 
      54,   0,   0,   5, 130,   0, 
      16,   0,   4,   0,   0,   0, 
       1,  64,   0,   0, 255, 255, 
     255, 255,  21,   0,   0,   1, 
      18,   0,   0,   1,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
+      0,   5, 130,   0,  16,   0, 
       3,   0,   0,   0,   1,  64, 
       0,   0,   0,   0,   0,   0, 
      21,   0,   0,   1,  21,   0, 
       0,   1,  31,   0,   0,   3, 
-     42,   0,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  21,   0, 
-      0,   1,  21,   0,   0,   1, 
-     21,   0,   0,   1,  31,   0, 
-      4,   3,  58,   0,  16,   0, 
-      4,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
+     58,   0,  16,   0,   3,   0, 
+      0,   0,  49,   0,   0,   7, 
+    130,   0,  16,   0,   3,   0, 
+      0,   0,  42,   0,  16,   0, 
+      2,   0,   0,   0,  42,   0, 
      16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0, 255, 255, 
-    255, 255, 178,   0,   0,   5, 
-     18,   0,  16,   0,   7,   0, 
-      0,   0,   0, 224,  17,   0, 
-      1,   0,   0,   0, 168,   0, 
-      0,   9,  18, 224,  17,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   7,   0,   0,   0, 
+     43,   0,   0,   5, 130,   0, 
+     16,   0,   5,   0,   0,   0, 
       1,  64,   0,   0,   0,   0, 
+      0,   0,  49,   0,   0,   7, 
+    130,   0,  16,   0,   5,   0, 
       0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0, 168,   0, 
-      0,   9,  18, 224,  17,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   7,   0,   0,   0, 
-      1,  64,   0,   0,   4,   0, 
-      0,   0,  10,   0,  16,   0, 
-      3,   0,   0,   0, 164,   0, 
-      0,   7, 242, 224,  17,   0, 
-      0,   0,   0,   0,  70,   5, 
-     16,   0,   0,   0,   0,   0, 
-      6,   0,  16,   0,   7,   0, 
-      0,   0,  54,   0,   0,   5, 
-     18,   0,  16,   0,   7,   0, 
-      0,   0,  10,   0,  16,   0, 
-      7,   0,   0,   0,  21,   0, 
-      0,   1,  58,   0,   0,   1, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   5,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0,  70,   2,  16,   0, 
-      6,   0,   0,   0,  49,   0, 
-      0,   7, 130,   0,  16,   0, 
-      2,   0,   0,   0,  10,   0, 
-     16,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   5,   0, 
-      0,   0,  43,   0,   0,   5, 
-     18,   0,  16,   0,   3,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  49,   0, 
-      0,   7,  18,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
+      5,   0,   0,   0,  42,   0, 
+     16,   0,   1,   0,   0,   0, 
+      1,   0,   0,   7, 130,   0, 
      16,   0,   3,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   2,   0, 
+     58,   0,  16,   0,   3,   0, 
       0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  10,   0, 
+      5,   0,   0,   0,  31,   0, 
+      4,   3,  58,   0,  16,   0, 
+      3,   0,   0,   0,  54,   0, 
+      0,   6, 130,   0,  16,   0, 
+      3,   0,   0,   0,  42,   0, 
+     16, 128,  65,   0,   0,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   7,  66,   0,  16,   0, 
+      3,   0,   0,   0,  58,   0, 
      16,   0,   3,   0,   0,   0, 
-     31,   0,   4,   3,  58,   0, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   6, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-     10,   0,  16, 128,  65,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,   0,   7, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-     58,   0,  16,   0,   2,   0, 
-      0,   0,  10,   0,  16,   0, 
-      5,   0,   0,   0,  43,   0, 
-      0,   8, 114,   0,  16,   0, 
-      3,   0,   0,   0,   2,  64, 
-      0,   0,   1,   0,   0,   0, 
+     42,   0,  16,   0,   3,   0, 
+      0,   0,  43,   0,   0,   8, 
+    226,   0,  16,   0,   7,   0, 
+      0,   0,   2,  64,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   7,  18,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  14,   0, 
+      1,   0,   0,   0,  16,   0, 
       0,   7, 130,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
-     16,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   3,   0, 
-      0,   0,  56,   0,   0,   7, 
-     50,   0,  16,   0,   3,   0, 
-      0,   0, 150,   5,  16,   0, 
-      1,   0,   0,   0, 246,  15, 
-     16,   0,   2,   0,   0,   0, 
-      0,   0,   0,   7,  50,   0, 
+      3,   0,   0,   0, 150,   7, 
+     16,   0,   7,   0,   0,   0, 
+     70,   2,  16,   0,   1,   0, 
+      0,   0,  14,   0,   0,   7, 
+     66,   0,  16,   0,   3,   0, 
+      0,   0,  42,   0,  16,   0, 
+      3,   0,   0,   0,  58,   0, 
      16,   0,   3,   0,   0,   0, 
-    150,   5,  16,   0,   2,   0, 
-      0,   0,  70,   0,  16,   0, 
-      3,   0,   0,   0,  29,   0, 
-      0,   7, 130,   0,  16,   0, 
-      2,   0,   0,   0,  10,   0, 
+     56,   0,   0,   7, 194,   0, 
      16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   5,   0, 
-      0,   0,  29,   0,   0,   7, 
-     18,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      6,   0,   0,   0,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,   0,   0,   7, 130,   0, 
+      6,   4,  16,   0,   1,   0, 
+      0,   0, 166,  10,  16,   0, 
+      3,   0,   0,   0,   0,   0, 
+      0,   7, 194,   0,  16,   0, 
+      3,   0,   0,   0,   6,   4, 
      16,   0,   2,   0,   0,   0, 
-     58,   0,  16,   0,   2,   0, 
-      0,   0,  10,   0,  16,   0, 
-      3,   0,   0,   0,  29,   0, 
-      0,   7,  18,   0,  16,   0, 
+    166,  14,  16,   0,   3,   0, 
+      0,   0,  29,   0,   0,   7, 
+    130,   0,  16,   0,   5,   0, 
+      0,   0,  42,   0,  16,   0, 
+      3,   0,   0,   0,  10,   0, 
+     16,   0,   3,   0,   0,   0, 
+     29,   0,   0,   7,  66,   0, 
+     16,   0,   3,   0,   0,   0, 
+     10,   0,  16,   0,   4,   0, 
+      0,   0,  42,   0,  16,   0, 
+      3,   0,   0,   0,   1,   0, 
+      0,   7,  66,   0,  16,   0, 
+      3,   0,   0,   0,  42,   0, 
+     16,   0,   3,   0,   0,   0, 
+     58,   0,  16,   0,   5,   0, 
+      0,   0,  29,   0,   0,   7, 
+    130,   0,  16,   0,   5,   0, 
+      0,   0,  58,   0,  16,   0, 
       3,   0,   0,   0,  26,   0, 
      16,   0,   3,   0,   0,   0, 
-     42,   0,  16,   0,   5,   0, 
+      1,   0,   0,   7,  66,   0, 
+     16,   0,   3,   0,   0,   0, 
+     42,   0,  16,   0,   3,   0, 
+      0,   0,  58,   0,  16,   0, 
+      5,   0,   0,   0,  29,   0, 
+      0,   7, 130,   0,  16,   0, 
+      3,   0,   0,   0,  26,   0, 
+     16,   0,   4,   0,   0,   0, 
+     58,   0,  16,   0,   3,   0, 
       0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   2,   0, 
+     66,   0,  16,   0,   3,   0, 
       0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  10,   0, 
+      3,   0,   0,   0,  42,   0, 
      16,   0,   3,   0,   0,   0, 
-     29,   0,   0,   7,  18,   0, 
+     31,   0,   4,   3,  42,   0, 
      16,   0,   3,   0,   0,   0, 
-     42,   0,  16,   0,   6,   0, 
-      0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,   1,   0, 
+     54,   0,   0,   5, 130,   0, 
+     16,   0,   4,   0,   0,   0, 
+      1,  64,   0,   0, 255, 255, 
+    255, 255,  21,   0,   0,   1, 
+     18,   0,   0,   1,  49,   0, 
       0,   7, 130,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
-     16,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   3,   0, 
-      0,   0,  31,   0,   4,   3, 
-     58,   0,  16,   0,   2,   0, 
-      0,   0,  54,   0,   0,   5, 
-     18,   0,  16,   0,   3,   0, 
+      3,   0,   0,   0,  42,   0, 
+     16,   0,   4,   0,   0,   0, 
+     42,   0,  16,   0,   2,   0, 
+      0,   0,  43,   0,   0,   5, 
+    130,   0,  16,   0,   5,   0, 
       0,   0,   1,  64,   0,   0, 
-    255, 255, 255, 255,  21,   0, 
-      0,   1,  18,   0,   0,   1, 
-     49,   0,   0,   7,  34,   0, 
-     16,   0,   3,   0,   0,   0, 
-     10,   0,  16,   0,   6,   0, 
-      0,   0,  10,   0,  16,   0, 
-      2,   0,   0,   0,  43,   0, 
-      0,   5,  66,   0,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     49,   0,   0,   7,  66,   0, 
+      0,   0,   0,   0,  49,   0, 
+      0,   7, 130,   0,  16,   0, 
+      5,   0,   0,   0,  42,   0, 
+     16,   0,   1,   0,   0,   0, 
+     58,   0,  16,   0,   5,   0, 
+      0,   0,   1,   0,   0,   7, 
+    130,   0,  16,   0,   3,   0, 
+      0,   0,  58,   0,  16,   0, 
+      3,   0,   0,   0,  58,   0, 
+     16,   0,   5,   0,   0,   0, 
+     31,   0,   4,   3,  58,   0, 
      16,   0,   3,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  42,   0,  16,   0, 
-      3,   0,   0,   0,   1,   0, 
-      0,   7,  34,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
+     54,   0,   0,   6, 130,   0, 
      16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  31,   0,   4,   3, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   6, 
-     34,   0,  16,   0,   3,   0, 
-      0,   0,  10,   0,  16, 128, 
-     65,   0,   0,   0,   6,   0, 
-      0,   0,   0,   0,   0,   7, 
-     34,   0,  16,   0,   3,   0, 
-      0,   0,  10,   0,  16,   0, 
-      2,   0,   0,   0,  26,   0, 
+     42,   0,  16, 128,  65,   0, 
+      0,   0,   4,   0,   0,   0, 
+      0,   0,   0,   7, 130,   0, 
      16,   0,   3,   0,   0,   0, 
-     43,   0,   0,   8, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-      2,  64,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
+     42,   0,  16,   0,   2,   0, 
+      0,   0,  58,   0,  16,   0, 
+      3,   0,   0,   0,  43,   0, 
+      0,   8, 226,   0,  16,   0, 
+      7,   0,   0,   0,   2,  64, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   7, 
-     66,   0,  16,   0,   3,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+     16,   0,   0,   7,  66,   0, 
+     16,   0,   4,   0,   0,   0, 
+    150,   7,  16,   0,   7,   0, 
       0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   1,   0,   0,   0, 
-     14,   0,   0,   7,  34,   0, 
+      1,   0,   0,   0,  14,   0, 
+      0,   7, 130,   0,  16,   0, 
+      3,   0,   0,   0,  58,   0, 
      16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  42,   0,  16,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   7,  98,   0,  16,   0, 
-      3,   0,   0,   0,  86,   6, 
-     16,   0,   1,   0,   0,   0, 
-     86,   5,  16,   0,   3,   0, 
-      0,   0,   0,   0,   0,   7, 
-     98,   0,  16,   0,   3,   0, 
-      0,   0,  86,   6,  16,   0, 
-      2,   0,   0,   0,  86,   6, 
+     42,   0,  16,   0,   4,   0, 
+      0,   0,  56,   0,   0,   7, 
+     98,   0,  16,   0,   7,   0, 
+      0,   0,   6,   1,  16,   0, 
+      1,   0,   0,   0, 246,  15, 
      16,   0,   3,   0,   0,   0, 
-     29,   0,   0,   7, 130,   0, 
+      0,   0,   0,   7,  98,   0, 
+     16,   0,   7,   0,   0,   0, 
+      6,   1,  16,   0,   2,   0, 
+      0,   0,  86,   6,  16,   0, 
+      7,   0,   0,   0,  29,   0, 
+      0,   7,  18,   0,  16,   0, 
+      3,   0,   0,   0,  26,   0, 
+     16,   0,   7,   0,   0,   0, 
+     10,   0,  16,   0,   3,   0, 
+      0,   0,  29,   0,   0,   7, 
+    130,   0,  16,   0,   3,   0, 
+      0,   0,  10,   0,  16,   0, 
+      4,   0,   0,   0,  26,   0, 
+     16,   0,   7,   0,   0,   0, 
+      1,   0,   0,   7,  18,   0, 
      16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      5,   0,   0,   0,  29,   0, 
+     58,   0,  16,   0,   3,   0, 
+      0,   0,  10,   0,  16,   0, 
+      3,   0,   0,   0,  29,   0, 
       0,   7,  34,   0,  16,   0, 
-      3,   0,   0,   0,  26,   0, 
-     16,   0,   6,   0,   0,   0, 
+      3,   0,   0,   0,  42,   0, 
+     16,   0,   7,   0,   0,   0, 
      26,   0,  16,   0,   3,   0, 
       0,   0,   1,   0,   0,   7, 
-     34,   0,  16,   0,   3,   0, 
+     18,   0,  16,   0,   3,   0, 
       0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
+      3,   0,   0,   0,  10,   0, 
      16,   0,   3,   0,   0,   0, 
-     29,   0,   0,   7, 130,   0, 
+     29,   0,   0,   7,  34,   0, 
      16,   0,   3,   0,   0,   0, 
-     42,   0,  16,   0,   3,   0, 
+     26,   0,  16,   0,   4,   0, 
       0,   0,  42,   0,  16,   0, 
-      5,   0,   0,   0,   1,   0, 
-      0,   7,  34,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
+      7,   0,   0,   0,   1,   0, 
+      0,   7,  66,   0,  16,   0, 
+      3,   0,   0,   0,  26,   0, 
      16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  29,   0,   0,   7, 
-     66,   0,  16,   0,   3,   0, 
-      0,   0,  42,   0,  16,   0, 
-      6,   0,   0,   0,  42,   0, 
+     10,   0,  16,   0,   3,   0, 
+      0,   0,  31,   0,   4,   3, 
+     42,   0,  16,   0,   3,   0, 
+      0,   0,  54,   0,   0,   5, 
+    130,   0,  16,   0,   4,   0, 
+      0,   0,   1,  64,   0,   0, 
+    255, 255, 255, 255,  21,   0, 
+      0,   1,  18,   0,   0,   1, 
+     54,   0,   0,   5,  66,   0, 
      16,   0,   3,   0,   0,   0, 
-      1,   0,   0,   7, 130,   0, 
+      1,  64,   0,   0,   0,   0, 
+      0,   0,  21,   0,   0,   1, 
+     21,   0,   0,   1,  31,   0, 
+      0,   3,  42,   0,  16,   0, 
+      3,   0,   0,   0,  54,   0, 
+      0,   5, 130,   0,  16,   0, 
+      4,   0,   0,   0,   1,  64, 
+      0,   0,   0,   0,   0,   0, 
+     21,   0,   0,   1,  21,   0, 
+      0,   1,  21,   0,   0,   1, 
+     31,   0,   4,   3,  58,   0, 
+     16,   0,   4,   0,   0,   0, 
+     54,   0,   0,   5, 130,   0, 
      16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,  31,   0, 
-      4,   3,  58,   0,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
+     58,   0,  16,   0,   2,   0, 
+      0,   0,  54,   0,   0,   5, 
+     18,   0,  16,   0,   3,   0, 
+      0,   0,   1,  64,   0,   0, 
+    255, 255, 255, 255, 178,   0, 
       0,   5,  18,   0,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0, 255, 255, 255, 255, 
-     21,   0,   0,   1,  18,   0, 
-      0,   1,  54,   0,   0,   5, 
-    130,   0,  16,   0,   2,   0, 
+      7,   0,   0,   0,   0, 224, 
+     17,   0,   1,   0,   0,   0, 
+    168,   0,   0,   9,  18, 224, 
+     17,   0,   1,   0,   0,   0, 
+     10,   0,  16,   0,   7,   0, 
       0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  21,   0, 
-      0,   1,  21,   0,   0,   1, 
-     31,   0,   0,   3,  58,   0, 
+      0,   0,   0,   0,  58,   0, 
      16,   0,   2,   0,   0,   0, 
+    168,   0,   0,   9,  18, 224, 
+     17,   0,   1,   0,   0,   0, 
+     10,   0,  16,   0,   7,   0, 
+      0,   0,   1,  64,   0,   0, 
+      4,   0,   0,   0,  10,   0, 
+     16,   0,   3,   0,   0,   0, 
+    164,   0,   0,   7, 242, 224, 
+     17,   0,   0,   0,   0,   0, 
+     70,   5,  16,   0,   0,   0, 
+      0,   0,   6,   0,  16,   0, 
+      7,   0,   0,   0,  54,   0, 
+      0,   5,  18,   0,  16,   0, 
+      7,   0,   0,   0,  10,   0, 
+     16,   0,   7,   0,   0,   0, 
+     21,   0,   0,   1,  58,   0, 
+      0,   1,  54,   0,   0,   5, 
+    114,   0,  16,   0,   5,   0, 
+      0,   0,  70,   2,  16,   0, 
+      5,   0,   0,   0,  54,   0, 
+      0,   5, 114,   0,  16,   0, 
+      6,   0,   0,   0,  70,   2, 
+     16,   0,   6,   0,   0,   0, 
      49,   0,   0,   7, 130,   0, 
      16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16,   0, 
+     10,   0,  16,   0,   2,   0, 
+      0,   0,  10,   0,  16,   0, 
       5,   0,   0,   0,  43,   0, 
-      0,   5,  34,   0,  16,   0, 
+      0,   5,  18,   0,  16,   0, 
       3,   0,   0,   0,   1,  64, 
       0,   0,   0,   0,   0,   0, 
-     49,   0,   0,   7,  34,   0, 
+     49,   0,   0,   7,  18,   0, 
      16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
+     10,   0,  16,   0,   3,   0, 
+      0,   0,  10,   0,  16,   0, 
       1,   0,   0,   0,   1,   0, 
       0,   7, 130,   0,  16,   0, 
       2,   0,   0,   0,  58,   0, 
      16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
+     10,   0,  16,   0,   3,   0, 
       0,   0,  31,   0,   4,   3, 
      58,   0,  16,   0,   2,   0, 
       0,   0,  54,   0,   0,   6, 
     130,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16, 128, 
+      0,   0,  10,   0,  16, 128, 
      65,   0,   0,   0,   2,   0, 
       0,   0,   0,   0,   0,   7, 
     130,   0,  16,   0,   2,   0, 
       0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  26,   0, 
+      2,   0,   0,   0,  10,   0, 
      16,   0,   5,   0,   0,   0, 
-     43,   0,   0,   8, 226,   0, 
+     43,   0,   0,   8, 114,   0, 
      16,   0,   3,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
+      2,  64,   0,   0,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
       0,   0,  16,   0,   0,   7, 
-     34,   0,  16,   0,   3,   0, 
-      0,   0, 150,   7,  16,   0, 
+     18,   0,  16,   0,   3,   0, 
+      0,   0,  70,   2,  16,   0, 
       3,   0,   0,   0,  70,   2, 
      16,   0,   1,   0,   0,   0, 
      14,   0,   0,   7, 130,   0, 
      16,   0,   2,   0,   0,   0, 
      58,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16,   0, 
+      0,   0,  10,   0,  16,   0, 
       3,   0,   0,   0,  56,   0, 
-      0,   7,  98,   0,  16,   0, 
-      3,   0,   0,   0,   6,   2, 
+      0,   7,  50,   0,  16,   0, 
+      3,   0,   0,   0, 150,   5, 
      16,   0,   1,   0,   0,   0, 
     246,  15,  16,   0,   2,   0, 
       0,   0,   0,   0,   0,   7, 
-     98,   0,  16,   0,   3,   0, 
-      0,   0,   6,   2,  16,   0, 
-      2,   0,   0,   0,  86,   6, 
+     50,   0,  16,   0,   3,   0, 
+      0,   0, 150,   5,  16,   0, 
+      2,   0,   0,   0,  70,   0, 
      16,   0,   3,   0,   0,   0, 
      29,   0,   0,   7, 130,   0, 
      16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
-      0,   0,  10,   0,  16,   0, 
+     10,   0,  16,   0,   3,   0, 
+      0,   0,  26,   0,  16,   0, 
       5,   0,   0,   0,  29,   0, 
-      0,   7,  34,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
+      0,   7,  18,   0,  16,   0, 
+      3,   0,   0,   0,  26,   0, 
      16,   0,   6,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
+     10,   0,  16,   0,   3,   0, 
       0,   0,   1,   0,   0,   7, 
     130,   0,  16,   0,   2,   0, 
       0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  26,   0, 
+      2,   0,   0,   0,  10,   0, 
      16,   0,   3,   0,   0,   0, 
-     29,   0,   0,   7,  34,   0, 
+     29,   0,   0,   7,  18,   0, 
      16,   0,   3,   0,   0,   0, 
-     42,   0,  16,   0,   3,   0, 
+     26,   0,  16,   0,   3,   0, 
       0,   0,  42,   0,  16,   0, 
       5,   0,   0,   0,   1,   0, 
       0,   7, 130,   0,  16,   0, 
       2,   0,   0,   0,  58,   0, 
      16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   3,   0, 
+     10,   0,  16,   0,   3,   0, 
       0,   0,  29,   0,   0,   7, 
-     34,   0,  16,   0,   3,   0, 
+     18,   0,  16,   0,   3,   0, 
       0,   0,  42,   0,  16,   0, 
-      6,   0,   0,   0,  42,   0, 
+      6,   0,   0,   0,  26,   0, 
      16,   0,   3,   0,   0,   0, 
       1,   0,   0,   7, 130,   0, 
      16,   0,   2,   0,   0,   0, 
      58,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16,   0, 
+      0,   0,  10,   0,  16,   0, 
       3,   0,   0,   0,  31,   0, 
       4,   3,  58,   0,  16,   0, 
       2,   0,   0,   0,  54,   0, 
@@ -1851,15 +1608,15 @@ const BYTE RaytraceFirstPass[] =
      21,   0,   0,   1,  18,   0, 
       0,   1,  49,   0,   0,   7, 
      34,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
-      6,   0,   0,   0,  26,   0, 
+      0,   0,  10,   0,  16,   0, 
+      6,   0,   0,   0,  10,   0, 
      16,   0,   2,   0,   0,   0, 
      43,   0,   0,   5,  66,   0, 
      16,   0,   3,   0,   0,   0, 
       1,  64,   0,   0,   0,   0, 
       0,   0,  49,   0,   0,   7, 
      66,   0,  16,   0,   3,   0, 
-      0,   0,  26,   0,  16,   0, 
+      0,   0,  10,   0,  16,   0, 
       1,   0,   0,   0,  42,   0, 
      16,   0,   3,   0,   0,   0, 
       1,   0,   0,   7,  34,   0, 
@@ -1870,18 +1627,18 @@ const BYTE RaytraceFirstPass[] =
       4,   3,  26,   0,  16,   0, 
       3,   0,   0,   0,  54,   0, 
       0,   6,  34,   0,  16,   0, 
-      3,   0,   0,   0,  26,   0, 
+      3,   0,   0,   0,  10,   0, 
      16, 128,  65,   0,   0,   0, 
       6,   0,   0,   0,   0,   0, 
       0,   7,  34,   0,  16,   0, 
-      3,   0,   0,   0,  26,   0, 
+      3,   0,   0,   0,  10,   0, 
      16,   0,   2,   0,   0,   0, 
      26,   0,  16,   0,   3,   0, 
       0,   0,  43,   0,   0,   8, 
     114,   0,  16,   0,   4,   0, 
       0,   0,   2,  64,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,  16,   0, 
       0,   7,  66,   0,  16,   0, 
       3,   0,   0,   0,  70,   2, 
@@ -1894,21 +1651,21 @@ const BYTE RaytraceFirstPass[] =
      16,   0,   3,   0,   0,   0, 
      56,   0,   0,   7,  98,   0, 
      16,   0,   3,   0,   0,   0, 
-      6,   2,  16,   0,   1,   0, 
+     86,   6,  16,   0,   1,   0, 
       0,   0,  86,   5,  16,   0, 
       3,   0,   0,   0,   0,   0, 
       0,   7,  98,   0,  16,   0, 
-      3,   0,   0,   0,   6,   2, 
+      3,   0,   0,   0,  86,   6, 
      16,   0,   2,   0,   0,   0, 
      86,   6,  16,   0,   3,   0, 
       0,   0,  29,   0,   0,   7, 
     130,   0,  16,   0,   3,   0, 
       0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
+      3,   0,   0,   0,  26,   0, 
      16,   0,   5,   0,   0,   0, 
      29,   0,   0,   7,  34,   0, 
      16,   0,   3,   0,   0,   0, 
-     10,   0,  16,   0,   6,   0, 
+     26,   0,  16,   0,   6,   0, 
       0,   0,  26,   0,  16,   0, 
       3,   0,   0,   0,   1,   0, 
       0,   7,  34,   0,  16,   0, 
@@ -1949,8 +1706,8 @@ const BYTE RaytraceFirstPass[] =
      58,   0,  16,   0,   2,   0, 
       0,   0,  49,   0,   0,   7, 
     130,   0,  16,   0,   2,   0, 
-      0,   0,  42,   0,  16,   0, 
-      2,   0,   0,   0,  42,   0, 
+      0,   0,  26,   0,  16,   0, 
+      2,   0,   0,   0,  26,   0, 
      16,   0,   5,   0,   0,   0, 
      43,   0,   0,   5,  34,   0, 
      16,   0,   3,   0,   0,   0, 
@@ -1958,7 +1715,7 @@ const BYTE RaytraceFirstPass[] =
       0,   0,  49,   0,   0,   7, 
      34,   0,  16,   0,   3,   0, 
       0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
+      3,   0,   0,   0,  26,   0, 
      16,   0,   1,   0,   0,   0, 
       1,   0,   0,   7, 130,   0, 
      16,   0,   2,   0,   0,   0, 
@@ -1968,19 +1725,19 @@ const BYTE RaytraceFirstPass[] =
       4,   3,  58,   0,  16,   0, 
       2,   0,   0,   0,  54,   0, 
       0,   6, 130,   0,  16,   0, 
-      2,   0,   0,   0,  42,   0, 
+      2,   0,   0,   0,  26,   0, 
      16, 128,  65,   0,   0,   0, 
       2,   0,   0,   0,   0,   0, 
       0,   7, 130,   0,  16,   0, 
       2,   0,   0,   0,  58,   0, 
      16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   5,   0, 
+     26,   0,  16,   0,   5,   0, 
       0,   0,  43,   0,   0,   8, 
     226,   0,  16,   0,   3,   0, 
       0,   0,   2,  64,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,  16,   0, 
+      0,   0,   1,   0,   0,   0, 
+      0,   0,   0,   0,  16,   0, 
       0,   7,  34,   0,  16,   0, 
       3,   0,   0,   0, 150,   7, 
      16,   0,   3,   0,   0,   0, 
@@ -1992,11 +1749,11 @@ const BYTE RaytraceFirstPass[] =
      16,   0,   3,   0,   0,   0, 
      56,   0,   0,   7,  98,   0, 
      16,   0,   3,   0,   0,   0, 
-      6,   1,  16,   0,   1,   0, 
+      6,   2,  16,   0,   1,   0, 
       0,   0, 246,  15,  16,   0, 
       2,   0,   0,   0,   0,   0, 
       0,   7,  98,   0,  16,   0, 
-      3,   0,   0,   0,   6,   1, 
+      3,   0,   0,   0,   6,   2, 
      16,   0,   2,   0,   0,   0, 
      86,   6,  16,   0,   3,   0, 
       0,   0,  29,   0,   0,   7, 
@@ -2016,7 +1773,7 @@ const BYTE RaytraceFirstPass[] =
       0,   0,  29,   0,   0,   7, 
      34,   0,  16,   0,   3,   0, 
       0,   0,  42,   0,  16,   0, 
-      3,   0,   0,   0,  26,   0, 
+      3,   0,   0,   0,  42,   0, 
      16,   0,   5,   0,   0,   0, 
       1,   0,   0,   7, 130,   0, 
      16,   0,   2,   0,   0,   0, 
@@ -2024,7 +1781,7 @@ const BYTE RaytraceFirstPass[] =
       0,   0,  26,   0,  16,   0, 
       3,   0,   0,   0,  29,   0, 
       0,   7,  34,   0,  16,   0, 
-      3,   0,   0,   0,  26,   0, 
+      3,   0,   0,   0,  42,   0, 
      16,   0,   6,   0,   0,   0, 
      42,   0,  16,   0,   3,   0, 
       0,   0,   1,   0,   0,   7, 
@@ -2040,15 +1797,15 @@ const BYTE RaytraceFirstPass[] =
     255, 255,  21,   0,   0,   1, 
      18,   0,   0,   1,  49,   0, 
       0,   7,  34,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
+      3,   0,   0,   0,  26,   0, 
      16,   0,   6,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
+     26,   0,  16,   0,   2,   0, 
       0,   0,  43,   0,   0,   5, 
      66,   0,  16,   0,   3,   0, 
       0,   0,   1,  64,   0,   0, 
       0,   0,   0,   0,  49,   0, 
       0,   7,  66,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
+      3,   0,   0,   0,  26,   0, 
      16,   0,   1,   0,   0,   0, 
      42,   0,  16,   0,   3,   0, 
       0,   0,   1,   0,   0,   7, 
@@ -2060,69 +1817,69 @@ const BYTE RaytraceFirstPass[] =
      16,   0,   3,   0,   0,   0, 
      54,   0,   0,   6,  34,   0, 
      16,   0,   3,   0,   0,   0, 
-     42,   0,  16, 128,  65,   0, 
+     26,   0,  16, 128,  65,   0, 
       0,   0,   6,   0,   0,   0, 
-      0,   0,   0,   7,  66,   0, 
-     16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
+      0,   0,   0,   7,  34,   0, 
+     16,   0,   3,   0,   0,   0, 
+     26,   0,  16,   0,   2,   0, 
       0,   0,  26,   0,  16,   0, 
       3,   0,   0,   0,  43,   0, 
-      0,   8, 226,   0,  16,   0, 
-      3,   0,   0,   0,   2,  64, 
+      0,   8, 114,   0,  16,   0, 
+      4,   0,   0,   0,   2,  64, 
       0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
      16,   0,   0,   7,  66,   0, 
-     16,   0,   1,   0,   0,   0, 
-    150,   7,  16,   0,   3,   0, 
+     16,   0,   3,   0,   0,   0, 
+     70,   2,  16,   0,   4,   0, 
       0,   0,  70,   2,  16,   0, 
       1,   0,   0,   0,  14,   0, 
-      0,   7,  66,   0,  16,   0, 
-      1,   0,   0,   0,  42,   0, 
-     16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   1,   0, 
+      0,   7,  34,   0,  16,   0, 
+      3,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+     42,   0,  16,   0,   3,   0, 
       0,   0,  56,   0,   0,   7, 
-     50,   0,  16,   0,   1,   0, 
-      0,   0, 166,  10,  16,   0, 
-      1,   0,   0,   0,  70,   0, 
-     16,   0,   1,   0,   0,   0, 
-      0,   0,   0,   7,  50,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   0,  16,   0,   1,   0, 
-      0,   0,  70,   0,  16,   0, 
-      2,   0,   0,   0,  29,   0, 
-      0,   7,  66,   0,  16,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
+     98,   0,  16,   0,   3,   0, 
+      0,   0,   6,   2,  16,   0, 
+      1,   0,   0,   0,  86,   5, 
+     16,   0,   3,   0,   0,   0, 
+      0,   0,   0,   7,  98,   0, 
+     16,   0,   3,   0,   0,   0, 
+      6,   2,  16,   0,   2,   0, 
+      0,   0,  86,   6,  16,   0, 
+      3,   0,   0,   0,  29,   0, 
+      0,   7, 130,   0,  16,   0, 
+      3,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
      10,   0,  16,   0,   5,   0, 
       0,   0,  29,   0,   0,   7, 
-     18,   0,  16,   0,   1,   0, 
+     34,   0,  16,   0,   3,   0, 
       0,   0,  10,   0,  16,   0, 
-      6,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-      1,   0,   0,   7,  18,   0, 
-     16,   0,   1,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  42,   0,  16,   0, 
-      1,   0,   0,   0,  29,   0, 
-      0,   7,  66,   0,  16,   0, 
-      1,   0,   0,   0,  26,   0, 
-     16,   0,   1,   0,   0,   0, 
-     26,   0,  16,   0,   5,   0, 
+      6,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+      1,   0,   0,   7,  34,   0, 
+     16,   0,   3,   0,   0,   0, 
+     26,   0,  16,   0,   3,   0, 
+      0,   0,  58,   0,  16,   0, 
+      3,   0,   0,   0,  29,   0, 
+      0,   7, 130,   0,  16,   0, 
+      3,   0,   0,   0,  42,   0, 
+     16,   0,   3,   0,   0,   0, 
+     42,   0,  16,   0,   5,   0, 
       0,   0,   1,   0,   0,   7, 
-     18,   0,  16,   0,   1,   0, 
+     34,   0,  16,   0,   3,   0, 
+      0,   0,  58,   0,  16,   0, 
+      3,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+     29,   0,   0,   7,  66,   0, 
+     16,   0,   3,   0,   0,   0, 
+     42,   0,  16,   0,   6,   0, 
       0,   0,  42,   0,  16,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-     29,   0,   0,   7,  34,   0, 
-     16,   0,   1,   0,   0,   0, 
-     26,   0,  16,   0,   6,   0, 
-      0,   0,  26,   0,  16,   0, 
-      1,   0,   0,   0,   1,   0, 
+      3,   0,   0,   0,   1,   0, 
       0,   7, 130,   0,  16,   0, 
-      2,   0,   0,   0,  26,   0, 
-     16,   0,   1,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
+      2,   0,   0,   0,  42,   0, 
+     16,   0,   3,   0,   0,   0, 
+     26,   0,  16,   0,   3,   0, 
       0,   0,  31,   0,   4,   3, 
      58,   0,  16,   0,   2,   0, 
       0,   0,  54,   0,   0,   5, 
@@ -2136,361 +1893,258 @@ const BYTE RaytraceFirstPass[] =
       0,   0,  21,   0,   0,   1, 
      21,   0,   0,   1,  31,   0, 
       0,   3,  58,   0,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     21,   0,   0,   1,  21,   0, 
-      0,   1,  21,   0,   0,   1, 
-     31,   0,   4,   3,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,   1,  64,   0,   0, 
-    255, 255, 255, 255, 178,   0, 
-      0,   5,  18,   0,  16,   0, 
-      2,   0,   0,   0,   0, 224, 
-     17,   0,   1,   0,   0,   0, 
-     39,   0,   0,   7,  34,   0, 
-     16,   0,   1,   0,   0,   0, 
-     10,   0,  16,   0,   7,   0, 
-      0,   0,   1,  64,   0,   0, 
-    255, 255,   0,   0,  31,   0, 
-      4,   3,  26,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   7,   0,   0,   0, 
-     21,   0,   0,   1, 168,   0, 
-      0,   9,  18, 224,  17,   0, 
-      1,   0,   0,   0,  10,   0, 
+      2,   0,   0,   0,  49,   0, 
+      0,   7, 130,   0,  16,   0, 
+      2,   0,   0,   0,  42,   0, 
      16,   0,   2,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
+     42,   0,  16,   0,   5,   0, 
+      0,   0,  43,   0,   0,   5, 
+     34,   0,  16,   0,   3,   0, 
+      0,   0,   1,  64,   0,   0, 
+      0,   0,   0,   0,  49,   0, 
+      0,   7,  34,   0,  16,   0, 
+      3,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+     42,   0,  16,   0,   1,   0, 
+      0,   0,   1,   0,   0,   7, 
+    130,   0,  16,   0,   2,   0, 
       0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0, 168,   0, 
-      0,   9,  18, 224,  17,   0, 
-      1,   0,   0,   0,  10,   0, 
+      2,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+     31,   0,   4,   3,  58,   0, 
      16,   0,   2,   0,   0,   0, 
-      1,  64,   0,   0,   4,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0, 164,   0, 
-      0,   7, 242, 224,  17,   0, 
-      0,   0,   0,   0, 134,   7, 
-     16,   0,   0,   0,   0,   0, 
-      6,   0,  16,   0,   2,   0, 
-      0,   0,  21,   0,   0,   1, 
-     62,   0,   0,   1,  83,  84, 
-     65,  84, 148,   0,   0,   0, 
-    123,   1,   0,   0,   8,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0, 156,   0, 
-      0,   0,   3,   0,   0,   0, 
-     48,   0,   0,   0,  13,   0, 
-      0,   0,  33,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     14,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  42,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+     54,   0,   0,   6, 130,   0, 
+     16,   0,   2,   0,   0,   0, 
+     42,   0,  16, 128,  65,   0, 
       0,   0,   2,   0,   0,   0, 
-      6,   0,   0,   0,  83,  80, 
-     68,  66,   0, 158,   0,   0, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  67,  47, 
-     67,  43,  43,  32,  77,  83, 
-     70,  32,  55,  46,  48,  48, 
-     13,  10,  26,  68,  83,   0, 
-      0,   0,   0,   2,   0,   0, 
-      2,   0,   0,   0,  79,   0, 
-      0,   0,  96,   1,   0,   0, 
-      0,   0,   0,   0,  76,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   7, 130,   0, 
+     16,   0,   2,   0,   0,   0, 
+     58,   0,  16,   0,   2,   0, 
+      0,   0,  42,   0,  16,   0, 
+      5,   0,   0,   0,  43,   0, 
+      0,   8, 226,   0,  16,   0, 
+      3,   0,   0,   0,   2,  64, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,   1,   0,   0,   0, 
+     16,   0,   0,   7,  34,   0, 
+     16,   0,   3,   0,   0,   0, 
+    150,   7,  16,   0,   3,   0, 
+      0,   0,  70,   2,  16,   0, 
+      1,   0,   0,   0,  14,   0, 
+      0,   7, 130,   0,  16,   0, 
+      2,   0,   0,   0,  58,   0, 
+     16,   0,   2,   0,   0,   0, 
+     26,   0,  16,   0,   3,   0, 
+      0,   0,  56,   0,   0,   7, 
+     98,   0,  16,   0,   3,   0, 
+      0,   0,   6,   1,  16,   0, 
+      1,   0,   0,   0, 246,  15, 
+     16,   0,   2,   0,   0,   0, 
+      0,   0,   0,   7,  98,   0, 
+     16,   0,   3,   0,   0,   0, 
+      6,   1,  16,   0,   2,   0, 
+      0,   0,  86,   6,  16,   0, 
+      3,   0,   0,   0,  29,   0, 
+      0,   7, 130,   0,  16,   0, 
+      2,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+     10,   0,  16,   0,   5,   0, 
+      0,   0,  29,   0,   0,   7, 
+     34,   0,  16,   0,   3,   0, 
+      0,   0,  10,   0,  16,   0, 
+      6,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+      1,   0,   0,   7, 130,   0, 
+     16,   0,   2,   0,   0,   0, 
+     58,   0,  16,   0,   2,   0, 
+      0,   0,  26,   0,  16,   0, 
+      3,   0,   0,   0,  29,   0, 
+      0,   7,  34,   0,  16,   0, 
+      3,   0,   0,   0,  42,   0, 
+     16,   0,   3,   0,   0,   0, 
+     26,   0,  16,   0,   5,   0, 
+      0,   0,   1,   0,   0,   7, 
+    130,   0,  16,   0,   2,   0, 
+      0,   0,  58,   0,  16,   0, 
+      2,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+     29,   0,   0,   7,  34,   0, 
+     16,   0,   3,   0,   0,   0, 
+     26,   0,  16,   0,   6,   0, 
+      0,   0,  42,   0,  16,   0, 
+      3,   0,   0,   0,   1,   0, 
+      0,   7, 130,   0,  16,   0, 
+      2,   0,   0,   0,  58,   0, 
+     16,   0,   2,   0,   0,   0, 
+     26,   0,  16,   0,   3,   0, 
+      0,   0,  31,   0,   4,   3, 
+     58,   0,  16,   0,   2,   0, 
+      0,   0,  54,   0,   0,   5, 
+     18,   0,  16,   0,   3,   0, 
+      0,   0,   1,  64,   0,   0, 
+    255, 255, 255, 255,  21,   0, 
+      0,   1,  18,   0,   0,   1, 
+     49,   0,   0,   7,  34,   0, 
+     16,   0,   3,   0,   0,   0, 
+     42,   0,  16,   0,   6,   0, 
+      0,   0,  42,   0,  16,   0, 
+      2,   0,   0,   0,  43,   0, 
+      0,   5,  66,   0,  16,   0, 
+      3,   0,   0,   0,   1,  64, 
       0,   0,   0,   0,   0,   0, 
-      0,   0, 192, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,  56,   0, 
+     49,   0,   0,   7,  66,   0, 
+     16,   0,   3,   0,   0,   0, 
+     42,   0,  16,   0,   1,   0, 
+      0,   0,  42,   0,  16,   0, 
+      3,   0,   0,   0,   1,   0, 
+      0,   7,  34,   0,  16,   0, 
+      3,   0,   0,   0,  42,   0, 
+     16,   0,   3,   0,   0,   0, 
+     26,   0,  16,   0,   3,   0, 
+      0,   0,  31,   0,   4,   3, 
+     26,   0,  16,   0,   3,   0, 
+      0,   0,  54,   0,   0,   6, 
+     34,   0,  16,   0,   3,   0, 
+      0,   0,  42,   0,  16, 128, 
+     65,   0,   0,   0,   6,   0, 
+      0,   0,   0,   0,   0,   7, 
+     66,   0,  16,   0,   2,   0, 
+      0,   0,  42,   0,  16,   0, 
+      2,   0,   0,   0,  26,   0, 
+     16,   0,   3,   0,   0,   0, 
+     43,   0,   0,   8, 226,   0, 
+     16,   0,   3,   0,   0,   0, 
+      2,  64,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0, 224, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-      5,   0,   0,   0,  32,   0, 
-      0,   0,  60,   0,   0,   0, 
       0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      6,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+    255, 255,  16,   0,   0,   7, 
+     66,   0,  16,   0,   1,   0, 
+      0,   0, 150,   7,  16,   0, 
+      3,   0,   0,   0,  70,   2, 
+     16,   0,   1,   0,   0,   0, 
+     14,   0,   0,   7,  66,   0, 
+     16,   0,   1,   0,   0,   0, 
+     42,   0,  16,   0,   2,   0, 
+      0,   0,  42,   0,  16,   0, 
+      1,   0,   0,   0,  56,   0, 
+      0,   7,  50,   0,  16,   0, 
+      1,   0,   0,   0, 166,  10, 
+     16,   0,   1,   0,   0,   0, 
+     70,   0,  16,   0,   1,   0, 
+      0,   0,   0,   0,   0,   7, 
+     50,   0,  16,   0,   1,   0, 
+      0,   0,  70,   0,  16,   0, 
+      1,   0,   0,   0,  70,   0, 
+     16,   0,   2,   0,   0,   0, 
+     29,   0,   0,   7,  66,   0, 
+     16,   0,   1,   0,   0,   0, 
+     10,   0,  16,   0,   1,   0, 
+      0,   0,  10,   0,  16,   0, 
+      5,   0,   0,   0,  29,   0, 
+      0,   7,  18,   0,  16,   0, 
+      1,   0,   0,   0,  10,   0, 
+     16,   0,   6,   0,   0,   0, 
+     10,   0,  16,   0,   1,   0, 
+      0,   0,   1,   0,   0,   7, 
+     18,   0,  16,   0,   1,   0, 
+      0,   0,  10,   0,  16,   0, 
+      1,   0,   0,   0,  42,   0, 
+     16,   0,   1,   0,   0,   0, 
+     29,   0,   0,   7,  66,   0, 
+     16,   0,   1,   0,   0,   0, 
+     26,   0,  16,   0,   1,   0, 
+      0,   0,  26,   0,  16,   0, 
+      5,   0,   0,   0,   1,   0, 
+      0,   7,  18,   0,  16,   0, 
+      1,   0,   0,   0,  42,   0, 
+     16,   0,   1,   0,   0,   0, 
+     10,   0,  16,   0,   1,   0, 
+      0,   0,  29,   0,   0,   7, 
+     34,   0,  16,   0,   1,   0, 
+      0,   0,  26,   0,  16,   0, 
+      6,   0,   0,   0,  26,   0, 
+     16,   0,   1,   0,   0,   0, 
+      1,   0,   0,   7, 130,   0, 
+     16,   0,   2,   0,   0,   0, 
+     26,   0,  16,   0,   1,   0, 
+      0,   0,  10,   0,  16,   0, 
+      1,   0,   0,   0,  31,   0, 
+      4,   3,  58,   0,  16,   0, 
+      2,   0,   0,   0,  54,   0, 
+      0,   5,  18,   0,  16,   0, 
+      3,   0,   0,   0,   1,  64, 
+      0,   0, 255, 255, 255, 255, 
+     21,   0,   0,   1,  18,   0, 
+      0,   1,  54,   0,   0,   5, 
+    130,   0,  16,   0,   2,   0, 
+      0,   0,   1,  64,   0,   0, 
+      0,   0,   0,   0,  21,   0, 
+      0,   1,  21,   0,   0,   1, 
+     31,   0,   0,   3,  58,   0, 
+     16,   0,   2,   0,   0,   0, 
+     54,   0,   0,   5,  18,   0, 
+     16,   0,   3,   0,   0,   0, 
+      1,  64,   0,   0,   0,   0, 
+      0,   0,  21,   0,   0,   1, 
+     21,   0,   0,   1,  21,   0, 
+      0,   1,  31,   0,   4,   3, 
+     10,   0,  16,   0,   3,   0, 
+      0,   0,  54,   0,   0,   5, 
+    130,   0,  16,   0,   1,   0, 
+      0,   0,  58,   0,  16,   0, 
+      1,   0,   0,   0,  54,   0, 
+      0,   5,  18,   0,  16,   0, 
+      1,   0,   0,   0,   1,  64, 
+      0,   0, 255, 255, 255, 255, 
+    178,   0,   0,   5,  18,   0, 
+     16,   0,   2,   0,   0,   0, 
+      0, 224,  17,   0,   1,   0, 
+      0,   0,  33,   0,   0,   7, 
+     34,   0,  16,   0,   1,   0, 
+      0,   0,  10,   0,  16,   0, 
+      7,   0,   0,   0,   1,  64, 
       0,   0,   0,   0,   0,   0, 
+     31,   0,   4,   3,  26,   0, 
+     16,   0,   1,   0,   0,   0, 
+     54,   0,   0,   5,  18,   0, 
+     16,   0,   1,   0,   0,   0, 
+     10,   0,  16,   0,   7,   0, 
+      0,   0,  21,   0,   0,   1, 
+    168,   0,   0,   9,  18, 224, 
+     17,   0,   1,   0,   0,   0, 
+     10,   0,  16,   0,   2,   0, 
+      0,   0,   1,  64,   0,   0, 
+      0,   0,   0,   0,  58,   0, 
+     16,   0,   1,   0,   0,   0, 
+    168,   0,   0,   9,  18, 224, 
+     17,   0,   1,   0,   0,   0, 
+     10,   0,  16,   0,   2,   0, 
+      0,   0,   1,  64,   0,   0, 
+      4,   0,   0,   0,  10,   0, 
+     16,   0,   1,   0,   0,   0, 
+    164,   0,   0,   7, 242, 224, 
+     17,   0,   0,   0,   0,   0, 
+    134,   7,  16,   0,   0,   0, 
+      0,   0,   6,   0,  16,   0, 
+      2,   0,   0,   0,  21,   0, 
+      0,   1,  62,   0,   0,   1, 
+     83,  84,  65,  84, 148,   0, 
+      0,   0, 123,   1,   0,   0, 
+      8,   0,   0,   0,   0,   0, 
+      0,   0,   2,   0,   0,   0, 
+    156,   0,   0,   0,   3,   0, 
+      0,   0,  48,   0,   0,   0, 
+     13,   0,   0,   0,  33,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+      0,   0,  14,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+     42,   0,   0,   0,   0,   0, 
+      0,   0,  26,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -2499,6457 +2153,6 @@ const BYTE RaytraceFirstPass[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1,  42, 205, 210,  85, 
-      1,   0,   0,   0,  42, 143, 
-    235, 186,  32, 167,   8,  65, 
-    170,  34, 168, 178, 150,  30, 
-      4,  35,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     65, 145,  50,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    111, 109, 109, 111, 110,  46, 
-    104, 108, 115, 108, 105,  34, 
-     13,  10,  13,  10,  83, 116, 
-    114, 117,  99, 116, 117, 114, 
-    101, 100,  66, 117, 102, 102, 
-    101, 114,  60,  65,  97,  98, 
-     98,  78, 111, 100, 101,  62, 
-     32,  78, 111, 100, 101, 115, 
-     59,  13,  10,  13,  10,  82, 
-     87,  84, 101, 120, 116, 117, 
-    114, 101,  50,  68,  60, 105, 
-    110, 116,  62,  32,  84,  97, 
-    115, 107,  72, 101,  97, 100, 
-     59,  13,  10,  82,  87,  83, 
-    116, 114, 117,  99, 116, 117, 
-    114, 101, 100,  66, 117, 102, 
-    102, 101, 114,  60,  84,  97, 
-    115, 107,  62,  32,  84,  97, 
-    115, 107, 115,  59,  13,  10, 
-     13,  10,  47,  47,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  13,  10, 
-     47,  47,  32,  77,  97, 105, 
-    110,  32, 101, 110, 116, 114, 
-    121,  32, 112, 111, 105, 110, 
-    116,  13,  10,  47,  47,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  13, 
-     10,  13,  10, 115, 116,  97, 
-    116, 105,  99,  32,  99, 111, 
-    110, 115, 116,  32, 117, 105, 
-    110, 116,  32,  78,  85,  77, 
-     95,  80,  73,  88,  69,  76, 
-     83,  95,  80,  69,  82,  95, 
-     71,  82,  79,  85,  80,  95, 
-     88,  32,  61,  32,  52,  59, 
-     13,  10, 115, 116,  97, 116, 
-    105,  99,  32,  99, 111, 110, 
-    115, 116,  32, 117, 105, 110, 
-    116,  32,  78,  85,  77,  95, 
-     80,  73,  88,  69,  76,  83, 
-     95,  80,  69,  82,  95,  71, 
-     82,  79,  85,  80,  95,  89, 
-     32,  61,  32,  52,  59,  13, 
-     10,  13,  10,  91, 110, 117, 
-    109, 116, 104, 114, 101,  97, 
-    100, 115,  40,  78,  85,  77, 
-     95,  80,  73,  88,  69,  76, 
-     83,  95,  80,  69,  82,  95, 
-     71,  82,  79,  85,  80,  95, 
-     88,  44,  32,  78,  85,  77, 
-     95,  80,  73,  88,  69,  76, 
-     83,  95,  80,  69,  82,  95, 
-     71,  82,  79,  85,  80,  95, 
-     89,  44,  32,  49,  41,  93, 
-     13,  10, 118, 111, 105, 100, 
-     32, 109,  97, 105, 110,  40, 
-     13,  10,  32,  32,  32,  32, 
-    117, 105, 110, 116,  51,  32, 
-     71, 114, 111, 117, 112,  84, 
-    104, 114, 101,  97, 100,  73, 
-     68,  32,  58,  32,  83,  86, 
-     95,  71, 114, 111, 117, 112, 
-     84, 104, 102, 121,   0,   0, 
-    243,  75,   0,   0,  97, 116, 
-      0,   0, 108, 114,   0,   0, 
-     87, 112,   0,   0,  51,  77, 
-      0,   0, 221, 120,   0,   0, 
-    252,   2,   0,   0, 209,  70, 
-      0,   0, 129,  95,   0,   0, 
-     78, 121,   0,   0,  47,  44, 
-      0,   0, 247,  26,   0,   0, 
-    226,  35,   0,   0, 127,  51, 
-      0,   0, 115,  66,   0,   0, 
-    254,  26,   0,   0, 247,  34, 
-      0,   0, 220, 124,   0,   0, 
-     35,  77,   0,   0, 167,  30, 
-      0,   0, 213,  38,   0,   0, 
-    125,  28,   0,   0, 205,  25, 
-      0,   0, 195,  18,   0,   0, 
-    241,  99,   0,   0, 252,   2, 
-      0,   0, 224,  76,   0,   0, 
-    201,  11,   0,   0,  93,  66, 
-      0,   0,  97,   7,   0,   0, 
-     81,  86,   0,   0, 216,  30, 
-      0,   0, 158,  54,   0,   0, 
-      0,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  47,  47, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     13,  10,  47,  47,  32,  70, 
-    105, 114, 115, 116,  32, 112, 
-     97, 115, 115,  32, 111, 102, 
-     32,  99, 111, 109, 112, 117, 
-    116, 101,  32, 115, 104,  97, 
-    100, 101, 114,  32,  98,  97, 
-    115, 101, 100,  32, 114,  97, 
-    121,  32, 116, 114,  97,  99, 
-    101, 114,  46,  13,  10,  47, 
-     47,  32,  82, 101, 122,  97, 
-     32,  78, 111, 117, 114,  97, 
-    105,  13,  10,  47,  47,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  13, 
-     10,  13,  10,  35, 105, 110, 
-     99, 108, 117, 100, 101,  32, 
-     34,  83, 104,  97, 100, 101, 
-    114,  67, 111, 109, 109, 111, 
-    110,  46, 104, 108, 115, 108, 
-    105,  34,  13,  10,  13,  10, 
-     83, 116, 114, 117,  99, 116, 
-    117, 114, 101, 100,  66, 117, 
-    102, 102, 101, 114,  60,  65, 
-     97,  98,  98,  78, 111, 100, 
-    101,  62,  32,  78, 111, 100, 
-    101, 115,  59,  13,  10,  13, 
-     10,  82,  87,  84, 101, 120, 
-    116, 117, 114, 101,  50,  68, 
-     60, 105, 110, 116,  62,  32, 
-     84,  97, 115, 107,  72, 101, 
-     97, 100,  59,  13,  10,  82, 
-     87,  83, 116, 114, 117,  99, 
-    116, 117, 114, 101, 100,  66, 
-    117, 102, 102, 101, 114,  60, 
-     84,  97, 115, 107,  62,  32, 
-     84,  97, 115, 107, 115,  59, 
-     13,  10,  13,  10,  47,  47, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     13,  10,  47,  47,  32,  77, 
-     97, 105, 110,  32, 101, 110, 
-    116, 114, 121,  32, 112, 111, 
-    105, 110, 116,  13,  10,  47, 
-     47,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  13,  10,  13,  10, 115, 
-    116,  97, 116, 105,  99,  32, 
-     99, 111, 110, 115, 116,  32, 
-    117, 105, 110, 116,  32,  78, 
-     85,  77,  95,  80,  73,  88, 
-     69,  76,  83,  95,  80,  69, 
-     82,  95,  71,  82,  79,  85, 
-     80,  95,  88,  32,  61,  32, 
-     52,  59,  13,  10, 115, 116, 
-     97, 116, 105,  99,  32,  99, 
-    111, 110, 115, 116,  32, 117, 
-    105, 110, 116,  32,  78,  85, 
-     77,  95,  80,  73,  88,  69, 
-     76,  83,  95,  80,  69,  82, 
-     95,  71,  82,  79,  85,  80, 
-     95,  89,  32,  61,  32,  52, 
-     59,  13,  10,  13,  10,  91, 
-    110, 117, 109, 116, 104, 114, 
-    101,  97, 100, 115,  40,  78, 
-     85,  77,  95,  80,  73,  88, 
-     69,  76,  83,  95,  80,  69, 
-     82,  95,  71,  82,  79,  85, 
-     80,  95,  88,  44,  32,  78, 
-     85,  77,  95,  80,  73,  88, 
-     69,  76,  83,  95,  80,  69, 
-     82,  95,  71,  82,  79,  85, 
-     80,  95,  89,  44,  32,  49, 
-     41,  93,  13,  10, 118, 111, 
-    105, 100,  32, 109,  97, 105, 
-    110,  40,  13,  10,  32,  32, 
-     32,  32, 117, 105, 110, 116, 
-     51,  32,  71, 114, 111, 117, 
-    112,  84, 104, 114, 101,  97, 
-    100,  73,  68,  32,  58,  32, 
-     83,  86,  95,  71, 114, 111, 
-    117, 112,  84, 104, 114, 101, 
-     97, 100,  73,  68,  44,  13, 
-     10,  32,  32,  32,  32, 117, 
-    105, 110, 116,  51,  32,  71, 
-    114, 111, 117, 112,  73,  68, 
-     32,  58,  32,  83,  86,  95, 
-     71, 114, 111, 117, 112,  73, 
-     68,  44,  13,  10,  32,  32, 
-     32,  32, 117, 105, 110, 116, 
-     51,  32,  68, 105, 115, 112, 
-     97, 116,  99, 104,  84, 104, 
-    114, 101,  97, 100,  73,  68, 
-     32,  58,  32,  83,  86,  95, 
-     68, 105, 115, 112,  97, 116, 
-     99, 104,  84, 104, 114, 101, 
-     97, 100,  73,  68,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32,  47,  47,  32,  68, 
-    101, 116, 101, 114, 109, 105, 
-    110, 101,  32, 119, 104, 105, 
-     99, 104,  32, 112, 105, 120, 
-    101, 108,  32, 119, 101,  32, 
-     97, 114, 101,  13,  10,  32, 
-     32,  32,  32, 117, 105, 110, 
-    116,  50,  32, 112, 105, 120, 
-    101, 108,  67, 111, 111, 114, 
-    100,  32,  61,  32,  71, 114, 
-    111, 117, 112,  73,  68,  46, 
-    120, 121,  32,  42,  32, 117, 
-    105, 110, 116,  50,  40,  78, 
-     85,  77,  95,  80,  73,  88, 
-     69,  76,  83,  95,  80,  69, 
-     82,  95,  71,  82,  79,  85, 
-     80,  95,  88,  44,  32,  78, 
-     85,  77,  95,  80,  73,  88, 
-     69,  76,  83,  95,  80,  69, 
-     82,  95,  71,  82,  79,  85, 
-     80,  95,  89,  41,  32,  43, 
-     32,  71, 114, 111, 117, 112, 
-     84, 104, 114, 101,  97, 100, 
-     73,  68,  46, 120, 121,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32,  47,  47,  32,  71, 
-    101, 116,  32, 108, 111,  99, 
-     97, 108,  32, 114,  97, 121, 
-     32, 102, 111, 114,  32, 116, 
-    104, 105, 115,  32, 112, 105, 
-    120, 101, 108,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 108, 111, 
-     99,  97, 108,  82,  97, 121, 
-     32,  61,  32,  76, 111,  99, 
-     97, 108,  82,  97, 121,  70, 
-    114, 111, 109,  80, 105, 120, 
-    101, 108,  67, 111, 111, 114, 
-    100,  40, 112, 105, 120, 101, 
-    108,  67, 111, 111, 114, 100, 
-     44,  32,  72,  97, 108, 102, 
-     86, 105, 101, 119, 112, 111, 
-    114, 116,  83, 105, 122, 101, 
-     44,  32,  68, 105, 115, 116, 
-     84, 111,  80, 114, 111, 106, 
-     80, 108,  97, 110, 101,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-     84, 114,  97, 110, 115, 102, 
-    111, 114, 109,  32, 116, 111, 
-     32, 119, 111, 114, 108, 100, 
-     32, 115, 112,  97,  99, 101, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 114,  97, 121,  68, 105, 
-    114,  32,  61,  32, 109, 117, 
-    108,  40,  40, 102, 108, 111, 
-     97, 116,  51, 120,  51,  41, 
-     67,  97, 109, 101, 114,  97, 
-     87, 111, 114, 108, 100,  84, 
-    114,  97, 110, 115, 102, 111, 
-    114, 109,  44,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40, 108, 111,  99,  97, 
-    108,  82,  97, 121,  41,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-     85, 115, 101,  32,  99,  97, 
-    109, 101, 114,  97,  32, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  32,  97, 115,  32, 114, 
-     97, 121,  32, 115, 116,  97, 
-    114, 116,  32, 112, 111, 115, 
-    105, 116, 105, 111, 110,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,  32,  61,  32,  67, 
-     97, 109, 101, 114,  97,  87, 
-    111, 114, 108, 100,  84, 114, 
-     97, 110, 115, 102, 111, 114, 
-    109,  46,  95, 109,  48,  51, 
-     95, 109,  49,  51,  95, 109, 
-     50,  51,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  82,  97, 121,  32, 
-    116, 114,  97,  99, 101,  32, 
-     97, 103,  97, 105, 110, 115, 
-    116,  32, 114, 111, 111, 116, 
-     32, 110, 111, 100, 101,  39, 
-    115,  32,  99, 104, 105, 108, 
-    100, 114, 101, 110,  46,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  73, 102,  32, 110, 
-    111,  32, 104, 105, 116,  44, 
-     32, 119, 101,  39, 114, 101, 
-     32, 100, 111, 110, 101,  46, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47,  32,  73, 102,  32, 
-    101, 105, 116, 104, 101, 114, 
-     32, 115, 105, 100, 101,  32, 
-    104, 105, 116, 115,  44,  32, 
-     97, 112, 112, 101, 110, 100, 
-     32, 116, 111,  32,  84,  97, 
-    115, 107, 115,  32, 108, 105, 
-    115, 116,  32,  97, 110, 100, 
-     32, 117, 112, 100,  97, 116, 
-    101,  32, 104, 101,  97, 100, 
-     32, 105, 110, 100, 101, 120, 
-     32, 102, 111, 114,  32, 116, 
-    104, 105, 115,  32, 112, 105, 
-    120, 101, 108,  13,  10,  32, 
-     32,  32,  32,  65,  97,  98, 
-     98,  78, 111, 100, 101,  32, 
-    110, 111, 100, 101,  32,  61, 
-     32,  78, 111, 100, 101, 115, 
-     91,  48,  93,  59,  13,  10, 
-     32,  32,  32,  32, 117, 105, 
-    110, 116,  32, 105,  32,  61, 
-     32,  48, 120, 102, 102, 102, 
-    102,  59,  13,  10,  32,  32, 
-     32,  32, 105, 102,  32,  40, 
-     82,  97, 121,  65,  97,  98, 
-     98,  73, 110, 116, 101, 114, 
-    115, 101,  99, 116,  40, 114, 
-     97, 121,  83, 116,  97, 114, 
-    116,  44,  32, 114,  97, 121, 
-     68, 105, 114,  44,  32, 110, 
-    111, 100, 101,  46,  76, 101, 
-    102, 116,  77, 105, 110,  44, 
-     32, 110, 111, 100, 101,  46, 
-     76, 101, 102, 116,  77,  97, 
-    120,  41,  41,  13,  10,  32, 
-     32,  32,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  84,  97, 115, 107, 
-     32, 116,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 116,  46,  78, 111, 100, 
-    101,  32,  61,  32, 110, 111, 
-    100, 101,  46,  76, 101, 102, 
-    116,  73, 110, 100, 101, 120, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 116, 
-     46,  78, 101, 120, 116,  32, 
-     61,  32,  45,  49,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 105,  32,  61, 
-     32,  84,  97, 115, 107, 115, 
-     46,  73, 110,  99, 114, 101, 
-    109, 101, 110, 116,  67, 111, 
-    117, 110, 116, 101, 114,  40, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     84,  97, 115, 107, 115,  91, 
-    105,  93,  32,  61,  32, 116, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  84, 
-     97, 115, 107,  72, 101,  97, 
-    100,  91, 112, 105, 120, 101, 
-    108,  67, 111, 111, 114, 100, 
-     93,  32,  61,  32, 105,  59, 
-     13,  10,  32,  32,  32,  32, 
-    125,  13,  10,  32,  32,  32, 
-     32, 105, 102,  32,  40,  82, 
-     97, 121,  65,  97,  98,  98, 
-     73, 110, 116, 101, 114, 115, 
-    101,  99, 116,  40, 114,  97, 
-    121,  83, 116,  97, 114, 116, 
-     44,  32, 114,  97, 121,  68, 
-    105, 114,  44,  32, 110, 111, 
-    100, 101,  46,  82, 105, 103, 
-    104, 116,  77, 105, 110,  44, 
-     32, 110, 111, 100, 101,  46, 
-     82, 105, 103, 104, 116,  77, 
-     97, 120,  41,  41,  13,  10, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  84,  97, 115, 
-    107,  32, 116,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 116,  46,  78, 111, 
-    100, 101,  32,  61,  32, 110, 
-    111, 100, 101,  46,  82, 105, 
-    103, 104, 116,  73, 110, 100, 
-    101, 120,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 116,  46,  78, 101, 120, 
-    116,  32,  61,  32,  45,  49, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 117, 
-    105, 110, 116,  32, 106,  32, 
-     61,  32,  84,  97, 115, 107, 
-    115,  46,  73, 110,  99, 114, 
-    101, 109, 101, 110, 116,  67, 
-    111, 117, 110, 116, 101, 114, 
-     40,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 105, 102,  32,  40, 105, 
-     32,  33,  61,  32,  48, 120, 
-    102, 102, 102, 102,  41,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    116,  46,  78, 101, 120, 116, 
-     32,  61,  32, 105,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 125,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  84,  97, 115, 107, 
-    115,  91, 106,  93,  32,  61, 
-     32, 116,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  84,  97, 115, 107,  72, 
-    101,  97, 100,  91, 112, 105, 
-    120, 101, 108,  67, 111, 111, 
-    114, 100,  93,  32,  61,  32, 
-    106,  59,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10, 125, 
-     13,  10,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  47,  47,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  13,  10, 
-     47,  47,  32,  67, 111, 109, 
-    109, 111, 110,  32, 115, 116, 
-    114, 117,  99, 116, 115,  32, 
-     97, 110, 100,  32, 104, 101, 
-    108, 112, 101, 114,  32, 102, 
-    117, 110,  99, 116, 105, 111, 
-    110, 115,  46,  13,  10,  47, 
-     47,  32,  82, 101, 122,  97, 
-     32,  78, 111, 117, 114,  97, 
-    105,  13,  10,  47,  47,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  13, 
-     10,  13,  10,  47,  47,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  13, 
-     10,  47,  47,  32,  68,  97, 
-    116,  97,  32, 115, 116, 114, 
-    117,  99, 116, 117, 114, 101, 
-    115,  13,  10,  47,  47,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  13, 
-     10,  13,  10,  47,  47,  32, 
-     85, 115, 101, 100,  32, 116, 
-    111,  32,  99, 111, 109, 112, 
-    117, 116, 101,  32, 112, 114, 
-    105, 109,  97, 114, 121,  32, 
-    101, 121, 101,  32, 114,  97, 
-    121, 115,  13,  10,  99,  98, 
-    117, 102, 102, 101, 114,  32, 
-     67,  97, 109, 101, 114,  97, 
-     68,  97, 116,  97,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52, 120,  52,  32,  67,  97, 
-    109, 101, 114,  97,  87, 111, 
-    114, 108, 100,  84, 114,  97, 
-    110, 115, 102, 111, 114, 109, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32,  72,  97, 108, 102, 
-     86, 105, 101, 119, 112, 111, 
-    114, 116,  83, 105, 122, 101, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32,  68, 105, 115, 116,  84, 
-    111,  80, 114, 111, 106,  80, 
-    108,  97, 110, 101,  59,  13, 
-     10, 125,  59,  13,  10,  13, 
-     10,  47,  47,  32,  65,  32, 
-    110, 111, 100, 101,  32, 105, 
-    110,  32, 116, 104, 101,  32, 
-     65,  65,  66,  66,  32,  98, 
-    111, 117, 110, 100, 105, 110, 
-    103,  32, 118, 111, 108, 117, 
-    109, 101,  32, 104, 105, 101, 
-    114,  97, 114,  99, 104, 121, 
-     13,  10, 115, 116, 114, 117, 
-     99, 116,  32,  65,  97,  98, 
-     98,  78, 111, 100, 101,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32,  76, 101, 102, 
-    116,  77, 105, 110,  44,  32, 
-     76, 101, 102, 116,  77,  97, 
-    120,  59,  32,  32,  32,  32, 
-     47,  47,  32,  65,  65,  66, 
-     66,  32, 111, 102,  32, 108, 
-    101, 102, 116,  32,  99, 104, 
-    105, 108, 100,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32,  82, 105, 
-    103, 104, 116,  77, 105, 110, 
-     44,  32,  82, 105, 103, 104, 
-    116,  77,  97, 120,  59,  32, 
-     32,  47,  47,  32,  65,  65, 
-     66,  66,  32, 111, 102,  32, 
-    114, 105, 103, 104, 116,  32, 
-     99, 104, 105, 108, 100,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32,  47,  47,  32,  73, 110, 
-    100, 101, 120,  32, 111, 102, 
-     32, 108, 101, 102, 116,  32, 
-     38,  32, 114, 105, 103, 104, 
-    116,  32,  99, 104, 105, 108, 
-    100,  13,  10,  32,  32,  32, 
-     32,  47,  47,  32,  62,  61, 
-     32,  48,  32, 109, 101,  97, 
-    110, 115,  32, 110, 111, 100, 
-    101,  13,  10,  32,  32,  32, 
-     32,  47,  47,  32,  60,  32, 
-     48,  32, 109, 101,  97, 110, 
-    115,  32, 111,  98, 106, 101, 
-     99, 116,  44,  32,  99, 111, 
-    109, 112, 117, 116, 101,  32, 
-    111,  98, 106, 101,  99, 116, 
-     32, 105, 110, 100, 101, 120, 
-     32,  98, 121,  32,  45,  40, 
-    105,  43,  49,  41,  13,  10, 
-     32,  32,  32,  32, 105, 110, 
-    116,  32,  76, 101, 102, 116, 
-     73, 110, 100, 101, 120,  44, 
-     32,  82, 105, 103, 104, 116, 
-     73, 110, 100, 101, 120,  59, 
-     13,  10, 125,  59,  13,  10, 
-     13,  10,  47,  47,  32,  84, 
-     97, 115, 107,  32, 110, 111, 
-    100, 101,  32, 105, 110,  32, 
-    112, 101, 114,  45, 112, 105, 
-    120, 101, 108,  32, 108, 105, 
-    110, 107, 101, 100,  32, 108, 
-    105, 115, 116,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     84,  97, 115, 107,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 105, 110, 116,  32,  78, 
-    111, 100, 101,  59,  13,  10, 
-     32,  32,  32,  32, 105, 110, 
-    116,  32,  78, 101, 120, 116, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10,  47,  47,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  13, 
-     10,  47,  47,  32,  72, 101, 
-    108, 112, 101, 114,  32, 102, 
-    117, 110,  99, 116, 105, 111, 
-    110, 115,  13,  10,  47,  47, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     13,  10,  13,  10, 102, 108, 
-    111,  97, 116,  51,  32,  76, 
-    111,  99,  97, 108,  82,  97, 
-    121,  70, 114, 111, 109,  80, 
-    105, 120, 101, 108,  67, 111, 
-    111, 114, 100,  40, 117, 105, 
-    110, 116,  50,  32, 112, 105, 
-    120, 101, 108,  67, 111, 111, 
-    114, 100,  44,  32, 102, 108, 
-    111,  97, 116,  50,  32, 104, 
-     97, 108, 102,  86, 105, 101, 
-    119, 112, 111, 114, 116,  83, 
-    105, 122, 101,  44,  32, 102, 
-    108, 111,  97, 116,  32, 100, 
-    105, 115, 116,  84, 111,  80, 
-    114, 111, 106,  80, 108,  97, 
-    110, 101,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  40, 102, 108, 111, 
-     97, 116,  41, 112, 105, 120, 
-    101, 108,  67, 111, 111, 114, 
-    100,  46, 120,  32,  45,  32, 
-    104,  97, 108, 102,  86, 105, 
-    101, 119, 112, 111, 114, 116, 
-     83, 105, 122, 101,  46, 120, 
-     44,  32, 104,  97, 108, 102, 
-     86, 105, 101, 119, 112, 111, 
-    114, 116,  83, 105, 122, 101, 
-     46, 121,  32,  45,  32,  40, 
-    102, 108, 111,  97, 116,  41, 
-    112, 105, 120, 101, 108,  67, 
-    111, 111, 114, 100,  46, 121, 
-     44,  32, 100, 105, 115, 116, 
-     84, 111,  80, 114, 111, 106, 
-     80, 108,  97, 110, 101,  41, 
-     59,  13,  10, 125,  13,  10, 
-     13,  10,  98, 111, 111, 108, 
-     32,  82,  97, 121,  65,  97, 
-     98,  98,  73, 110, 116, 101, 
-    114, 115, 101,  99, 116,  40, 
-    102, 108, 111,  97, 116,  51, 
-     32, 114,  97, 121,  83, 116, 
-     97, 114, 116,  44,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    114,  97, 121,  68, 105, 114, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  32,  97,  97,  98, 
-     98,  77, 105, 110,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  97,  97,  98,  98,  77, 
-     97, 120,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    104,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 112,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32,  47,  47,  32,  67, 104, 
-    101,  99, 107,  32, 120,  13, 
-     10,  32,  32,  32,  32, 105, 
-    102,  32,  40, 114,  97, 121, 
-     83, 116,  97, 114, 116,  46, 
-    120,  32,  60,  32,  97,  97, 
-     98,  98,  77, 105, 110,  46, 
-    120,  32,  38,  38,  32, 114, 
-     97, 121,  68, 105, 114,  46, 
-    120,  32,  62,  32,  48,  41, 
-     13,  10,  32,  32,  32,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 104, 
-     32,  61,  32,  40,  97,  97, 
-     98,  98,  77, 105, 110,  46, 
-    120,  32,  45,  32, 114,  97, 
-    121,  83, 116,  97, 114, 116, 
-     46, 120,  41,  32,  47,  32, 
-    100, 111, 116,  40, 102, 108, 
-    111,  97, 116,  51,  40,  49, 
-     44,  32,  48,  44,  32,  48, 
-     41,  44,  32, 114,  97, 121, 
-     68, 105, 114,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 112,  32,  61, 
-     32, 114,  97, 121,  83, 116, 
-     97, 114, 116,  32,  43,  32, 
-    114,  97, 121,  68, 105, 114, 
-     32,  42,  32, 104,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40, 112,  46, 121,  32,  62, 
-     61,  32,  97,  97,  98,  98, 
-     77, 105, 110,  46, 121,  32, 
-     38,  38,  32, 112,  46, 121, 
-     32,  60,  61,  32,  97,  97, 
-     98,  98,  77,  97, 120,  46, 
-    121,  32,  38,  38,  32, 112, 
-     46, 122,  32,  62,  61,  32, 
-     97,  97,  98,  98,  77, 105, 
-    110,  46, 122,  32,  38,  38, 
-     32, 112,  46, 122,  32,  60, 
-     61,  32,  97,  97,  98,  98, 
-     77,  97, 120,  46, 122,  41, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 116, 114, 117, 101, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 125, 
-     13,  10,  32,  32,  32,  32, 
-    125,  13,  10,  32,  32,  32, 
-     32, 101, 108, 115, 101,  32, 
-    105, 102,  32,  40, 114,  97, 
-    121,  83, 116,  97, 114, 116, 
-     46, 120,  32,  62,  32,  97, 
-     97,  98,  98,  77,  97, 120, 
-     46, 120,  32,  38,  38,  32, 
-    114,  97, 121,  68, 105, 114, 
-     46, 120,  32,  60,  32,  48, 
-     41,  13,  10,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    104,  32,  61,  32,  40, 114, 
-     97, 121,  83, 116,  97, 114, 
-    116,  46, 120,  32,  45,  32, 
-     97,  97,  98,  98,  77,  97, 
-    120,  46, 120,  41,  32,  47, 
-     32, 100, 111, 116,  40, 102, 
-    108, 111,  97, 116,  51,  40, 
-     45,  49,  44,  32,  48,  44, 
-     32,  48,  41,  44,  32, 114, 
-     97, 121,  68, 105, 114,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 112, 
-     32,  61,  32, 114,  97, 121, 
-     83, 116,  97, 114, 116,  32, 
-     43,  32, 114,  97, 121,  68, 
-    105, 114,  32,  42,  32, 104, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 105, 
-    102,  32,  40, 112,  46, 121, 
-     32,  62,  61,  32,  97,  97, 
-     98,  98,  77, 105, 110,  46, 
-    121,  32,  38,  38,  32, 112, 
-     46, 121,  32,  60,  61,  32, 
-     97,  97,  98,  98,  77,  97, 
-    120,  46, 121,  32,  38,  38, 
-     32, 112,  46, 122,  32,  62, 
-     61,  32,  97,  97,  98,  98, 
-     77, 105, 110,  46, 122,  32, 
-     38,  38,  32, 112,  46, 122, 
-     32,  60,  61,  32,  97,  97, 
-     98,  98,  77,  97, 120,  46, 
-    122,  41,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 116, 114, 
-    117, 101,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 125,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  67, 104, 101,  99, 
-    107,  32, 121,  13,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40, 114,  97, 121,  83, 116, 
-     97, 114, 116,  46, 121,  32, 
-     60,  32,  97,  97,  98,  98, 
-     77, 105, 110,  46, 121,  32, 
-     38,  38,  32, 114,  97, 121, 
-     68, 105, 114,  46, 121,  32, 
-     62,  32,  48,  41,  13,  10, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 104,  32,  61, 
-     32,  40,  97,  97,  98,  98, 
-     77, 105, 110,  46, 121,  32, 
-     45,  32, 114,  97, 121,  83, 
-    116,  97, 114, 116,  46, 121, 
-     41,  32,  47,  32, 100, 111, 
-    116,  40, 102, 108, 111,  97, 
-    116,  51,  40,  48,  44,  32, 
-     49,  44,  32,  48,  41,  44, 
-     32, 114,  97, 121,  68, 105, 
-    114,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 112,  32,  61,  32, 114, 
-     97, 121,  83, 116,  97, 114, 
-    116,  32,  43,  32, 114,  97, 
-    121,  68, 105, 114,  32,  42, 
-     32, 104,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 105, 102,  32,  40, 112, 
-     46, 120,  32,  62,  61,  32, 
-     97,  97,  98,  98,  77, 105, 
-    110,  46, 120,  32,  38,  38, 
-     32, 112,  46, 120,  32,  60, 
-     61,  32,  97,  97,  98,  98, 
-     77,  97, 120,  46, 120,  32, 
-     38,  38,  32, 112,  46, 122, 
-     32,  62,  61,  32,  97,  97, 
-     98,  98,  77, 105, 110,  46, 
-    122,  32,  38,  38,  32, 112, 
-     46, 122,  32,  60,  61,  32, 
-     97,  97,  98,  98,  77,  97, 
-    120,  46, 122,  41,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 123,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    116, 114, 117, 101,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 125,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10,  32,  32,  32,  32, 101, 
-    108, 115, 101,  32, 105, 102, 
-     32,  40, 114,  97, 121,  83, 
-    116,  97, 114, 116,  46, 121, 
-     32,  62,  32,  97,  97,  98, 
-     98,  77,  97, 120,  46, 121, 
-     32,  38,  38,  32, 114,  97, 
-    121,  68, 105, 114,  46, 121, 
-     32,  60,  32,  48,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 104,  32, 
-     61,  32,  40, 114,  97, 121, 
-     83, 116,  97, 114, 116,  46, 
-    121,  32,  45,  32,  97,  97, 
-     98,  98,  77,  97, 120,  46, 
-    121,  41,  32,  47,  32, 100, 
-    111, 116,  40, 102, 108, 111, 
-     97, 116,  51,  40,  48,  44, 
-     32,  45,  49,  44,  32,  48, 
-     41,  44,  32, 114,  97, 121, 
-     68, 105, 114,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 112,  32,  61, 
-     32, 114,  97, 121,  83, 116, 
-     97, 114, 116,  32,  43,  32, 
-    114,  97, 121,  68, 105, 114, 
-     32,  42,  32, 104,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40, 112,  46, 120,  32,  62, 
-     61,  32,  97,  97,  98,  98, 
-     77, 105, 110,  46, 120,  32, 
-     38,  38,  32, 112,  46, 120, 
-     32,  60,  61,  32,  97,  97, 
-     98,  98,  77,  97, 120,  46, 
-    120,  32,  38,  38,  32, 112, 
-     46, 122,  32,  62,  61,  32, 
-     97,  97,  98,  98,  77, 105, 
-    110,  46, 122,  32,  38,  38, 
-     32, 112,  46, 122,  32,  60, 
-     61,  32,  97,  97,  98,  98, 
-     77,  97, 120,  46, 122,  41, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 116, 114, 117, 101, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 125, 
-     13,  10,  32,  32,  32,  32, 
-    125,  13,  10,  13,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-     67, 104, 101,  99, 107,  32, 
-    122,  13,  10,  32,  32,  32, 
-     32, 105, 102,  32,  40, 114, 
-     97, 121,  83, 116,  97, 114, 
-    116,  46, 122,  32,  60,  32, 
-     97,  97,  98,  98,  77, 105, 
-    110,  46, 122,  32,  38,  38, 
-     32, 114,  97, 121,  68, 105, 
-    114,  46, 122,  32,  62,  32, 
-     48,  41,  13,  10,  32,  32, 
-     32,  32, 123,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 104,  32,  61,  32,  40, 
-     97,  97,  98,  98,  77, 105, 
-    110,  46, 122,  32,  45,  32, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,  46, 122,  41,  32, 
-     47,  32, 100, 111, 116,  40, 
-    102, 108, 111,  97, 116,  51, 
-     40,  48,  44,  32,  48,  44, 
-     32,  49,  41,  44,  32, 114, 
-     97, 121,  68, 105, 114,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 112, 
-     32,  61,  32, 114,  97, 121, 
-     83, 116,  97, 114, 116,  32, 
-     43,  32, 114,  97, 121,  68, 
-    105, 114,  32,  42,  32, 104, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 105, 
-    102,  32,  40, 112,  46, 120, 
-     32,  62,  61,  32,  97,  97, 
-     98,  98,  77, 105, 110,  46, 
-    120,  32,  38,  38,  32, 112, 
-     46, 120,  32,  60,  61,  32, 
-     97,  97,  98,  98,  77,  97, 
-    120,  46, 120,  32,  38,  38, 
-     32, 112,  46, 121,  32,  62, 
-     61,  32,  97,  97,  98,  98, 
-     77, 105, 110,  46, 121,  32, 
-     38,  38,  32, 112,  46, 121, 
-     32,  60,  61,  32,  97,  97, 
-     98,  98,  77,  97, 120,  46, 
-    121,  41,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 116, 114, 
-    117, 101,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 125,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10,  32, 
-     32,  32,  32, 101, 108, 115, 
-    101,  32, 105, 102,  32,  40, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,  46, 122,  32,  62, 
-     32,  97,  97,  98,  98,  77, 
-     97, 120,  46, 122,  32,  38, 
-     38,  32, 114,  97, 121,  68, 
-    105, 114,  46, 122,  32,  60, 
-     32,  48,  41,  13,  10,  32, 
-     32,  32,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 104,  32,  61,  32, 
-     40, 114,  97, 121,  83, 116, 
-     97, 114, 116,  46, 122,  32, 
-     45,  32,  97,  97,  98,  98, 
-     77,  97, 120,  46, 122,  41, 
-     32,  47,  32, 100, 111, 116, 
-     40, 102, 108, 111,  97, 116, 
-     51,  40,  48,  44,  32,  48, 
-     44,  32,  45,  49,  41,  44, 
-     32, 114,  97, 121,  68, 105, 
-    114,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 112,  32,  61,  32, 114, 
-     97, 121,  83, 116,  97, 114, 
-    116,  32,  43,  32, 114,  97, 
-    121,  68, 105, 114,  32,  42, 
-     32, 104,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 105, 102,  32,  40, 112, 
-     46, 120,  32,  62,  61,  32, 
-     97,  97,  98,  98,  77, 105, 
-    110,  46, 120,  32,  38,  38, 
-     32, 112,  46, 120,  32,  60, 
-     61,  32,  97,  97,  98,  98, 
-     77,  97, 120,  46, 120,  32, 
-     38,  38,  32, 112,  46, 121, 
-     32,  62,  61,  32,  97,  97, 
-     98,  98,  77, 105, 110,  46, 
-    121,  32,  38,  38,  32, 112, 
-     46, 121,  32,  60,  61,  32, 
-     97,  97,  98,  98,  77,  97, 
-    120,  46, 121,  41,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 123,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    116, 114, 117, 101,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 125,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 102,  97, 108, 115, 
-    101,  59,  13,  10, 125,  13, 
-     10,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-     19,  23,   0,   0,   0,  67, 
-     58,  92, 115, 114,  99,  92, 
-    100, 111, 119, 110, 108, 111, 
-     97, 100, 115,  92,  67,  83, 
-     82,  97, 121, 116, 114,  97, 
-     99, 101, 114,  92,  67,  83, 
-     82,  97, 121, 116, 114,  97, 
-     99, 101, 114,  92,  82,  97, 
-    121, 116, 114,  97,  99, 101, 
-     70, 105, 114, 115, 116,  80, 
-     97, 115, 115,  46, 104, 108, 
-    115, 108,   0,   0,  99,  58, 
-     92, 115, 114,  99,  92, 100, 
-    111, 119, 110, 108, 111,  97, 
-    100, 115,  92,  99, 115, 114, 
-     97, 121, 116, 114,  97,  99, 
-    101, 114,  92,  99, 115, 114, 
-     97, 121, 116, 114,  97,  99, 
-    101, 114,  92, 114,  97, 121, 
-    116, 114,  97,  99, 101, 102, 
-    105, 114, 115, 116, 112,  97, 
-    115, 115,  46, 104, 108, 115, 
-    108,   0,  67,  58,  92, 115, 
-    114,  99,  92, 100, 111, 119, 
-    110, 108, 111,  97, 100, 115, 
-     92,  67,  83,  82,  97, 121, 
-    116, 114,  97,  99, 101, 114, 
-     92,  67,  83,  82,  97, 121, 
-    116, 114,  97,  99, 101, 114, 
-     92,  83, 104,  97, 100, 101, 
-    114,  67, 111, 109, 109, 111, 
-    110,  46, 104, 108, 115, 108, 
-    105,   0,  99,  58,  92, 115, 
-    114,  99,  92, 100, 111, 119, 
-    110, 108, 111,  97, 100, 115, 
-     92,  99, 115, 114,  97, 121, 
-    116, 114,  97,  99, 101, 114, 
-     92,  99, 115, 114,  97, 121, 
-    116, 114,  97,  99, 101, 114, 
-     92, 115, 104,  97, 100, 101, 
-    114,  99, 111, 109, 109, 111, 
-    110,  46, 104, 108, 115, 108, 
-    105,   0,  47,  47,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  13,  10, 
-     47,  47,  32,  70, 105, 114, 
-    115, 116,  32, 112,  97, 115, 
-    115,  32, 111, 102,  32,  99, 
-    111, 109, 112, 117, 116, 101, 
-     32, 115, 104,  97, 100, 101, 
-    114,  32,  98,  97, 115, 101, 
-    100,  32, 114,  97, 121,  32, 
-    116, 114,  97,  99, 101, 114, 
-     46,  13,  10,  47,  47,  32, 
-     82, 101, 122,  97,  32,  78, 
-    111, 117, 114,  97, 105,  13, 
-     10,  47,  47,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  13,  10,  13, 
-     10,  35, 105, 110,  99, 108, 
-    117, 100, 101,  32,  34,  83, 
-    104,  97, 100, 101, 114,  67, 
-     27, 226,  48,   1, 172,   0, 
-      0,   0, 123, 191,  18,  20, 
-    125, 217, 208,   1,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   0,   4,   0,   0,   0, 
-      1,   0,   0,   0,  12,   0, 
-      0,   0,   0,   0,   0,   0, 
-     66,   0,   0,   0,  40,   0, 
-      0,   0,  27, 226,  48,   1, 
-    120,  38,  24, 207, 134,   8, 
-      0,   0,   1,   0,   0,   0, 
-     65,   0,   0,   0,  66,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 190,   0,   0,   0, 
-     40,   0,   0,   0,  27, 226, 
-     48,   1, 109,  74, 168, 210, 
-    145,  13,   0,   0, 130,   0, 
-      0,   0,  65,   0,   0,   0, 
-    190,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-     74,   0,  60,  17,  16,   1, 
-      0,   0,   0,   1,   6,   0, 
-      3,   0,   0,  64, 128,  37, 
-      6,   0,   3,   0,   0,  64, 
-    128,  37,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  54,  46,  51,  46,  57, 
-     54,  48,  48,  46,  49,  54, 
-     51,  56,  52,   0,  54,   0, 
-     61,  17,   1, 104, 108, 115, 
-    108,  70, 108,  97, 103, 115, 
-      0,  48, 120,  53,   0, 104, 
-    108, 115, 108,  84,  97, 114, 
-    103, 101, 116,   0,  99, 115, 
-     95,  53,  95,  48,   0, 104, 
-    108, 115, 108,  69, 110, 116, 
-    114, 121,   0, 109,  97, 105, 
-    110,   0,   0,   0,   0,   0, 
-     42,   0,  16,  17,   0,   0, 
-      0,   0, 108,  25,   0,   0, 
-      0,   0,   0,   0,  12,  34, 
-      0,   0,   0,   0,   0,   0, 
-     12,  34,   0,   0,   3,  16, 
-      0,   0, 116,   0,   0,   0, 
-      1,   0, 160, 109,  97, 105, 
-    110,   0,  54,   0,  62,  17, 
-      0,  16,   0,   0,   9,   0, 
-     71, 114, 111, 117, 112,  84, 
-    104, 114, 101,  97, 100,  73, 
-     68,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,  34,   0,   5,   0, 
-      0,   0,   4,   0, 116,   0, 
-      0,   0,   1,   0,  12,  34, 
-    160, 255, 255, 255,  22,   0, 
-     80,  17,  34,   0,   5,   0, 
-      4,   0,   4,   0, 116,   0, 
-      0,   0,   1,   0,  12,  34, 
-    164, 255, 255, 255,  22,   0, 
-     80,  17,  34,   0,   5,   0, 
-      8,   0,   4,   0, 116,   0, 
-      0,   0,   1,   0,  12,  34, 
-    168, 255, 255, 255,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      9,   0,  71, 114, 111, 117, 
-    112,  73,  68,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,  33,   0,   5,   0, 
-      0,   0,   4,   0, 116,   0, 
-      0,   0,   1,   0,  12,  34, 
-    144, 255, 255, 255,  22,   0, 
-     80,  17,  33,   0,   5,   0, 
-      4,   0,   4,   0, 116,   0, 
-      0,   0,   1,   0,  12,  34, 
-    148, 255, 255, 255,  22,   0, 
-     80,  17,  33,   0,   5,   0, 
-      8,   0,   4,   0, 116,   0, 
-      0,   0,   1,   0,  12,  34, 
-    152, 255, 255, 255,  54,   0, 
-     62,  17,   0,  16,   0,   0, 
-      9,   0,  68, 105, 115, 112, 
-     97, 116,  99, 104,  84, 104, 
-    114, 101,  97, 100,  73,  68, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,  32,   0, 
-      5,   0,   0,   0,   4,   0, 
-    116,   0,   0,   0,   1,   0, 
-     12,  34, 176, 255, 255, 255, 
-     22,   0,  80,  17,  32,   0, 
-      5,   0,   4,   0,   4,   0, 
-    116,   0,   0,   0,   1,   0, 
-     12,  34, 180, 255, 255, 255, 
-     22,   0,  80,  17,  32,   0, 
-      5,   0,   8,   0,   4,   0, 
-    116,   0,   0,   0,   1,   0, 
-     12,  34, 184, 255, 255, 255, 
-     50,   0,  62,  17,   4,  16, 
-      0,   0,   8,   0, 112, 105, 
-    120, 101, 108,  67, 111, 111, 
-    114, 100,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 220,   0, 
-      0,   0,   1,   0, 164,  33, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 220,   0, 
-      0,   0,   1,   0, 164,  33, 
-     12,   0,   0,   0,  46,   0, 
-     62,  17,   5,  16,   0,   0, 
-      8,   0, 108, 111,  99,  97, 
-    108,  82,  97, 121,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 220,   1, 
-      0,   0,   1,   0, 108,   0, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 220,   1, 
-      0,   0,   1,   0, 108,   0, 
-     36,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 220,   1, 
-      0,   0,   1,   0, 108,   0, 
-     40,   0,   0,   0,  46,   0, 
-     62,  17,   5,  16,   0,   0, 
-      8,   0, 114,  97, 121,  68, 
-    105, 114,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 192,   2, 
-      0,   0,   1,   0, 152,  30, 
-    124,  29,   8,   1,  16,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 192,   2,   0,   0, 
-      1,   0, 152,  30, 124,  29, 
-      8,   1,  20,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    192,   2,   0,   0,   1,   0, 
-    152,  30,  68,  29,  64,   1, 
-     24,   0,   0,   0,  46,   0, 
-     62,  17,   5,  16,   0,   0, 
-      8,   0, 114,  97, 121,  83, 
-    116,  97, 114, 116,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 216,   2, 
-      0,   0,   1,   0, 252,  30, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 216,   2, 
-      0,   0,   1,   0, 168,  31, 
-     36,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 216,   2, 
-      0,   0,   1,   0, 128,  30, 
-    240,  28, 124,   1,  40,   0, 
-      0,   0,  42,   0,  62,  17, 
-      7,  16,   0,   0,   8,   0, 
-    110, 111, 100, 101,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  24,   3, 
-      0,   0,   1,   0, 224,  15, 
-    252,  14, 208,   0,  48,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  68,   3,   0,   0, 
-      1,   0, 180,  15,  36,  15, 
-    124,   0,  52,   0,   0,   0, 
-     30,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    112,   3,   0,   0,   1,   0, 
-    136,  15, 212,  11, 124,   1, 
-     76,  15,  40,   0,  56,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0, 156,   3,   0,   0, 
-      1,   0, 244,  16,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  16,   0, 
-      4,   0, 200,   3,   0,   0, 
-      1,   0, 200,  16,  68,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,  20,   0, 
-      4,   0, 244,   3,   0,   0, 
-      1,   0,   4,  15, 176,  13, 
-     64,   1,  72,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  24,   0,   4,   0, 
-     32,   4,   0,   0,   1,   0, 
-     96,  30,  80,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  28,   0,   4,   0, 
-     76,   4,   0,   0,   1,   0, 
-     52,  30,  84,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  32,   0,   4,   0, 
-    120,   4,   0,   0,   1,   0, 
-      8,  30,  88,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  36,   0,   4,   0, 
-    164,   4,   0,   0,   1,   0, 
-    220,  29,  96,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  40,   0,   4,   0, 
-    208,   4,   0,   0,   1,   0, 
-    176,  29, 100,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  44,   0,   4,   0, 
-    252,   4,   0,   0,   1,   0, 
-    132,  29, 104,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  48,   0,   4,   0, 
-     40,   5,   0,   0,   1,   0, 
-    200,  14,  44,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  52,   0,   4,   0, 
-     84,   5,   0,   0,   1,   0, 
-     40,  29,  28,   0,   0,   0, 
-     42,   0,  62,  17, 117,   0, 
-      0,   0,   0,   0, 105,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 104,   5,   0,   0, 
-      1,   0,  24,  29, 112,   0, 
-      0,   0,  42,   0,  62,  17, 
-      9,  16,   0,   0,   8,   0, 
-    116,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  76,  19, 
-      0,   0,   1,   0, 164,   0, 
-     44,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  96,  19, 
-      0,   0,   1,   0, 144,   0, 
-     48,   0,   0,   0,  42,   0, 
-     62,  17,   9,  16,   0,   0, 
-      8,   0, 116,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    172,  33,   0,   0,   1,   0, 
-    208,   0,  28,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    192,  33,   0,   0,   1,   0, 
-    188,   0,  16,   0,   0,   0, 
-     42,   0,  62,  17, 117,   0, 
-      0,   0,   0,   0, 106,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 212,  33,   0,   0, 
-      1,   0, 168,   0,  32,   0, 
-      0,   0,  62,   0,  62,  17, 
-     10,  16,   0,   0,   0,   0, 
-     78,  85,  77,  95,  80,  73, 
-     88,  69,  76,  83,  95,  80, 
-     69,  82,  95,  71,  82,  79, 
-     85,  80,  95,  88,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-    136,   0,   0,   0,   1,   0, 
-     60,   0,   0,   0,   0,   0, 
-     62,   0,  62,  17,  10,  16, 
-      0,   0,   0,   0,  78,  85, 
-     77,  95,  80,  73,  88,  69, 
-     76,  83,  95,  80,  69,  82, 
-     95,  71,  82,  79,  85,  80, 
-     95,  89,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 168,   0, 
-      0,   0,   1,   0,  28,   0, 
-     12,   0,   0,   0,  62,   0, 
-     77,  17, 136,   0,   0,   0, 
-    124,   9,   0,   0,   0,  16, 
-      0,   0,   7,   0,   9,   5, 
-     13, 119,   6,   2,  12, 128, 
-    164, 128, 176,   8,   0,   9, 
-     19,  13,  37,   1, 129,  36, 
-      3,   0,  13,  58,   3,  20, 
-      9,  82,  13, 100,   3,  52, 
-      9,  61,   3,  20,   9,   5, 
-     13, 119,  12,  20,  52,   0, 
-      0,   0,  78,   0,  62,  17, 
-     13,  16,   0,   0, 136,   0, 
-     60,  76, 111,  99,  97, 108, 
-     82,  97, 121,  70, 114, 111, 
-    109,  80, 105, 120, 101, 108, 
-     67, 111, 111, 114, 100,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 108,   1, 
-      0,   0,   1,   0, 112,   0, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 180,   1, 
-      0,   0,   1,   0,  40,   0, 
-     36,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 200,   1, 
-      0,   0,   1,   0,  20,   0, 
-     40,   0,   0,   0,  50,   0, 
-     62,  17,   4,  16,   0,   0, 
-      9,   0, 112, 105, 120, 101, 
-    108,  67, 111, 111, 114, 100, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  36,   1,   0,   0, 
-      1,   0, 184,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  36,   1,   0,   0, 
-      1,   0, 184,   0,   4,   0, 
-      0,   0,  54,   0,  62,  17, 
-     11,  16,   0,   0,   9,   0, 
-    104,  97, 108, 102,  86, 105, 
-    101, 119, 112, 111, 114, 116, 
-     83, 105, 122, 101,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  36,   1, 
-      0,   0,   1,   0,  44,   0, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  36,   1, 
-      0,   0,   1,   0, 184,   0, 
-     20,   0,   0,   0,  54,   0, 
-     62,  17,  64,   0,   0,   0, 
-      1,   0, 100, 105, 115, 116, 
-     84, 111,  80, 114, 111, 106, 
-     80, 108,  97, 110, 101,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     36,   1,   0,   0,   1,   0, 
-    184,   0,  40,   0,   0,   0, 
-      2,   0,  78,  17,  46,   4, 
-     77,  17, 136,   0,   0,   0, 
-     96,  17,   0,   0,   1,  16, 
-      0,   0,   7,   0,   9,   5, 
-     13,  47,   6,  10,   3, 133, 
-     72,   9,   9,  13,  68,   6, 
-      4,   3, 116,  13,  34,   6, 
-      2,   3, 128, 140,  13,  89, 
-      6,   2,   3,  56,   9,  13, 
-     13,  24,   6,   4,   3, 128, 
-    208,   9,   9,  13,   9,   6, 
-      2,   3,  20,   9,   5,  13, 
-      5,  11,  36,   9,  10,  13, 
-     52,  11,  36,   9,   9,  13, 
-     69,   6,   4,   3, 116,  13, 
-     34,   6,   2,   3, 128, 140, 
-     13,  89,   6,   2,   3,  56, 
-      9,  13,  13,  24,   6,   4, 
-      3, 128, 208,   9,   9,  13, 
-      9,   6,   2,   3,  20,   9, 
-      5,  13,   5,  11,  36,  13, 
-     47,   6,   6,   3,  32,   9, 
-      9,  13,  68,   6,   4,   3, 
-    128, 128,  13,  34,   6,   2, 
-      3, 128, 140,  13,  89,   6, 
-      2,   3,  56,   9,  13,  13, 
-     24,   6,   4,   3, 128, 208, 
-      9,   9,  13,   9,   6,   2, 
-      3,  20,   9,   5,  13,   5, 
-     11,  36,   9,  10,  13,  52, 
-     11,  36,   9,   9,  13,  69, 
-      6,   4,   3, 116,  13,  34, 
-      6,   2,   3, 128, 140,  13, 
-     89,   6,   2,   3,  56,   9, 
-     13,  13,  24,   6,   4,   3, 
-    128, 208,   9,   9,  13,   9, 
-      6,   2,   3,  20,   9,   5, 
-     13,   5,  11,  36,  13,  47, 
-      6,   6,   3,  32,   9,   9, 
-     13,  68,   6,   4,   3, 128, 
-    128,  13,  34,   6,   2,   3, 
-    128, 140,  13,  89,   6,   2, 
-      3,  56,   9,  13,  13,  24, 
-      6,   4,   3, 128, 208,   9, 
-      9,  13,   9,   6,   2,   3, 
-     20,   9,   5,  13,   5,  11, 
-     36,   9,  10,  13,  52,  11, 
-     36,   9,   9,  13,  69,   6, 
-      4,   3, 116,  13,  34,   6, 
-      2,   3, 128, 140,  13,  89, 
-      6,   2,   3,  56,   9,  13, 
-     13,  24,   6,   4,   3, 128, 
-    208,   9,   9,  13,   9,   6, 
-      2,   3,  20,   9,   5,  13, 
-      5,  11,  36,  13,  17,   6, 
-      4,   3,  32,   9,  17,  12, 
-     12,  32,   8,   0,   9,   9, 
-     13,  30,   1, 133, 188,   6, 
-    119,   3,   0,   9,  35,  13, 
-     46,   3,  28,   9,   9,   3, 
-     48,   9,   5,  13,  47,   3, 
-     28,   9,  14,  13,  35,  11, 
-     76,   9,  44,  13,  58,   3, 
-     52,   9,  40,  13,  67,   3, 
-     32,   9,  13,   3,  28,   9, 
-     24,  13,  33,   6,   2,   3, 
-     28,   9,  13,   3,  28,  13, 
-     28,   6,   2,   3,  28,   9, 
-     33,  13,  48,   3,  28,   9, 
-     13,   3,  28,   9,  53,  13, 
-     68,   3,  28,   9,  13,   3, 
-     28,   9,  73,  13,  88,   3, 
-     28,   9,  13,   3,  28,   9, 
-      9,  13,  89,   3,  28,   9, 
-     13,  13,  24,  11,  76,   9, 
-      9,  13,   9,   6,   2,   3, 
-     20,   9,   5,  13,   5,  11, 
-     36,   9,  14,  13,  35,  11, 
-     36,   9,  40,  13,  51,   3, 
-     28,   9,  14,   3,  48,   9, 
-     10,  13,  52,   3,  28,   9, 
-     14,  13,  35,  11,  76,   9, 
-     44,  13,  59,   3,  52,   9, 
-     40,  13,  68,   3,  32,   9, 
-     13,   3,  28,   9,  24,  13, 
-     33,   6,   2,   3,  28,   9, 
-     13,   3,  28,  13,  28,   6, 
-      2,   3,  28,   9,  33,  13, 
-     48,   3,  28,   9,  13,   3, 
-     28,   9,  53,  13,  68,   3, 
-     28,   9,  13,   3,  28,   9, 
-     73,  13,  88,   3,  28,   9, 
-     13,   3,  28,   9,   9,  13, 
-     89,   3,  28,   9,  13,  13, 
-     24,  11,  76,   9,   9,  13, 
-      9,   6,   2,   3,  20,   9, 
-      5,  13,   5,  11,  36,  13, 
-     47,   6,   6,   3,  32,   9, 
-      9,  13,  30,   3,  12,   9, 
-     35,  13,  46,   3,  28,   9, 
-      9,   3,  48,   9,   5,  13, 
-     47,   3,  28,   9,  14,  13, 
-     35,  11,  76,   9,  44,  13, 
-     58,   3,  52,   9,  40,  13, 
-     67,   3,  32,   9,  13,   3, 
-     28,   9,  24,  13,  33,   6, 
-      2,   3,  28,   9,  13,   3, 
-     28,  13,  28,   6,   2,   3, 
-     28,   9,  33,  13,  48,   3, 
-     28,   9,  13,   3,  28,   9, 
-     53,  13,  68,   3,  28,   9, 
-     13,   3,  28,   9,  73,  13, 
-     88,   3,  28,   9,  13,   3, 
-     28,   9,   9,  13,  89,   3, 
-     28,   9,  13,  13,  24,  11, 
-     76,   9,   9,  13,   9,   6, 
-      2,   3,  20,   9,   5,  13, 
-      5,  11,  36,   9,  14,  13, 
-     35,  11,  36,   9,  40,  13, 
-     51,   3,  28,   9,  14,   3, 
-     48,   9,  10,  13,  52,   3, 
-     28,   9,  14,  13,  35,  11, 
-     76,   9,  44,  13,  59,   3, 
-     52,   9,  40,  13,  68,   3, 
-     32,   9,  13,   3,  28,   9, 
-     24,  13,  33,   6,   2,   3, 
-     28,   9,  13,   3,  28,  13, 
-     28,   6,   2,   3,  28,   9, 
-     33,  13,  48,   3,  28,   9, 
-     13,   3,  28,   9,  53,  13, 
-     68,   3,  28,   9,  13,   3, 
-     28,   9,  73,  13,  88,   3, 
-     28,   9,  13,   3,  28,   9, 
-      9,  13,  89,   3,  28,   9, 
-     13,  13,  24,  11,  76,   9, 
-      9,  13,   9,   6,   2,   3, 
-     20,   9,   5,  13,   5,  11, 
-     36,  13,  47,   6,   6,   3, 
-     32,   9,   9,  13,  30,   3, 
-     12,   9,  35,  13,  46,   3, 
-     28,   9,   9,   3,  48,   9, 
-      5,  13,  47,   3,  28,   9, 
-     14,  13,  35,  11,  76,   9, 
-     44,  13,  58,   3,  52,   9, 
-     40,  13,  67,   3,  32,   9, 
-     13,   3,  28,   9,  24,  13, 
-     33,   6,   2,   3,  28,   9, 
-     13,   3,  28,  13,  28,   6, 
-      2,   3,  28,   9,  33,  13, 
-     48,   3,  28,   9,  13,   3, 
-     28,   9,  53,  13,  68,   3, 
-     28,   9,  13,   3,  28,   9, 
-     73,  13,  88,   3,  28,   9, 
-     13,   3,  28,   9,   9,  13, 
-     89,   3,  28,   9,  13,  13, 
-     24,  11,  76,   9,   9,  13, 
-      9,   6,   2,   3,  20,   9, 
-      5,  13,   5,  11,  36,   9, 
-     14,  13,  35,  11,  36,   9, 
-     40,  13,  51,   3,  28,   9, 
-     14,   3,  48,   9,  10,  13, 
-     52,   3,  28,   9,  14,  13, 
-     35,  11,  76,   9,  44,  13, 
-     59,   3,  52,   9,  40,  13, 
-     68,   3,  32,   9,  13,   3, 
-     28,   9,  24,  13,  33,   6, 
-      2,   3,  28,   9,  13,   3, 
-     28,  13,  28,   6,   2,   3, 
-     28,   9,  33,  13,  48,   3, 
-     28,   9,  13,   3,  28,   9, 
-     53,  13,  68,   3,  28,   9, 
-     13,   3,  28,   9,  73,  13, 
-     88,   3,  28,   9,  13,   3, 
-     28,   9,   9,  13,  89,   3, 
-     28,   9,  13,  13,  24,  11, 
-     76,   9,   9,  13,   9,   6, 
-      2,   3,  20,   9,   5,  13, 
-      5,  11,  36,  13,  17,   6, 
-      4,   3,  32,   9,  17,  12, 
-     12,  32,  70,   0,  62,  17, 
-     16,  16,   0,   0, 128,   0, 
-     60,  82,  97, 121,  65,  97, 
-     98,  98,  73, 110, 116, 101, 
-    114, 115, 101,  99, 116,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  30,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 220,   7,   0,   0, 
-      1,   0,  92,  11,   4,   0, 
-     32,   2,  40,   2,  24,   0, 
-     76,   0,   0,   0,  46,   0, 
-     62,  17,   5,  16,   0,   0, 
-      9,   0, 114,  97, 121,  83, 
-    116,  97, 114, 116,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 188,   5, 
-      0,   0,   1,   0, 124,  13, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 188,   5, 
-      0,   0,   1,   0, 124,  13, 
-     36,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 188,   5, 
-      0,   0,   1,   0, 124,  13, 
-     40,   0,   0,   0,  46,   0, 
-     62,  17,   5,  16,   0,   0, 
-      9,   0, 114,  97, 121,  68, 
-    105, 114,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 188,   5, 
-      0,   0,   1,   0, 124,  13, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 188,   5, 
-      0,   0,   1,   0, 124,  13, 
-     20,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 188,   5, 
-      0,   0,   1,   0, 124,  13, 
-     24,   0,   0,   0,  46,   0, 
-     62,  17,   5,  16,   0,   0, 
-      9,   0,  97,  97,  98,  98, 
-     77, 105, 110,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 188,   5, 
-      0,   0,   1,   0,  60,  13, 
-     88,  12, 208,   0,  48,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 188,   5,   0,   0, 
-      1,   0,  60,  13, 172,  12, 
-    124,   0,  52,   0,   0,   0, 
-     30,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    188,   5,   0,   0,   1,   0, 
-     60,  13, 136,   9, 124,   1, 
-      0,  13,  40,   0,  56,   0, 
-      0,   0,  46,   0,  62,  17, 
-      5,  16,   0,   0,   9,   0, 
-     97,  97,  98,  98,  77,  97, 
-    120,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 188,   5,   0,   0, 
-      1,   0, 124,  13,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 188,   5,   0,   0, 
-      1,   0, 124,  13,  68,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 188,   5,   0,   0, 
-      1,   0,  60,  13, 232,  11, 
-     64,   1,  72,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 104,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  30,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 188,   6,   0,   0, 
-      1,   0, 116,  11,  84,   0, 
-     28,   4, 196,   4,  64,   6, 
-     60,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 224,   8, 
-      0,   0,   1,   0, 196,   4, 
-     84,   0,  28,   4,  92,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 156,  15,   0,   0, 
-      1,   0,  28,   0,  56,   0, 
-      0,   0,  42,   0,  62,  17, 
-      5,  16,   0,   0,   8,   0, 
-    112,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 244,   6, 
-      0,   0,   1,   0,  16,   3, 
-    236,   0,  56,   1, 116,   0, 
-      0,   0,  34,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 244,   6,   0,   0, 
-      1,   0, 128,   7, 236,   0, 
-     56,   1,  16,   3,  96,   1, 
-     92,   5,  56,   1, 120,   0, 
-      0,   0,  30,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 100,  11,   0,   0, 
-      1,   0, 128,   7, 236,   0, 
-     56,   1,  16,   3, 132,   3, 
-    116,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 212,  15, 
-      0,   0,   1,   0,  56,   0, 
-     56,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 212,  15, 
-      0,   0,   1,   0, 168,   0, 
-     60,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 248,  17, 
-      0,   0,   1,   0, 236,   0, 
-    120,   0,   0,   0,   2,   0, 
-     78,  17,  46,   4,  77,  17, 
-    136,   0,   0,   0, 104,  25, 
-      0,   0,   1,  16,   0,   0, 
-      7,   0,   9,   5,  13,  47, 
-      6,  10,   3, 147, 168,   9, 
-      9,  13,  68,   6,   4,   3, 
-    116,  13,  34,   6,   2,   3, 
-    128, 140,  13,  89,   6,   2, 
-      3,  56,   9,  13,  13,  24, 
-      6,   4,   3, 128, 208,   9, 
-      9,  13,   9,   6,   2,   3, 
-     20,   9,   5,  13,   5,  11, 
-     36,   9,  10,  13,  52,  11, 
-     36,   9,   9,  13,  69,   6, 
-      4,   3, 116,  13,  34,   6, 
-      2,   3, 128, 140,  13,  89, 
-      6,   2,   3,  56,   9,  13, 
-     13,  24,   6,   4,   3, 128, 
-    208,   9,   9,  13,   9,   6, 
-      2,   3,  20,   9,   5,  13, 
-      5,  11,  36,  13,  47,   6, 
-      6,   3,  32,   9,   9,  13, 
-     68,   6,   4,   3, 128, 128, 
-     13,  34,   6,   2,   3, 128, 
-    140,  13,  89,   6,   2,   3, 
-     56,   9,  13,  13,  24,   6, 
-      4,   3, 128, 208,   9,   9, 
-     13,   9,   6,   2,   3,  20, 
-      9,   5,  13,   5,  11,  36, 
-      9,  10,  13,  52,  11,  36, 
-      9,   9,  13,  69,   6,   4, 
-      3, 116,  13,  34,   6,   2, 
-      3, 128, 140,  13,  89,   6, 
-      2,   3,  56,   9,  13,  13, 
-     24,   6,   4,   3, 128, 208, 
-      9,   9,  13,   9,   6,   2, 
-      3,  20,   9,   5,  13,   5, 
-     11,  36,  13,  47,   6,   6, 
-      3,  32,   9,   9,  13,  68, 
-      6,   4,   3, 128, 128,  13, 
-     34,   6,   2,   3, 128, 140, 
-     13,  89,   6,   2,   3,  56, 
-      9,  13,  13,  24,   6,   4, 
-      3, 128, 208,   9,   9,  13, 
-      9,   6,   2,   3,  20,   9, 
-      5,  13,   5,  11,  36,   9, 
-     10,  13,  52,  11,  36,   9, 
-      9,  13,  69,   6,   4,   3, 
-    116,  13,  34,   6,   2,   3, 
-    128, 140,  13,  89,   6,   2, 
-      3,  56,   9,  13,  13,  24, 
-      6,   4,   3, 128, 208,   9, 
-      9,  13,   9,   6,   2,   3, 
-     20,   9,   5,  13,   5,  11, 
-     36,  13,  17,   6,   4,   3, 
-     32,   9,  17,  12,  12,  32, 
-      8,   0,   9,   9,  13,  30, 
-      1, 148,  28,   6, 119,   3, 
-      0,   9,  35,  13,  46,   3, 
-     28,   9,   9,   3,  48,   9, 
-      5,  13,  47,   3,  28,   9, 
-     14,  13,  35,  11,  76,   9, 
-     44,  13,  58,   3,  52,   9, 
-     40,  13,  67,   3,  32,   9, 
-     13,   3,  28,   9,  24,  13, 
-     33,   6,   2,   3,  28,   9, 
-     13,   3,  28,  13,  28,   6, 
-      2,   3,  28,   9,  33,  13, 
-     48,   3,  28,   9,  13,   3, 
-     28,   9,  53,  13,  68,   3, 
-     28,   9,  13,   3,  28,   9, 
-     73,  13,  88,   3,  28,   9, 
-     13,   3,  28,   9,   9,  13, 
-     89,   3,  28,   9,  13,  13, 
-     24,  11,  76,   9,   9,  13, 
-      9,   6,   2,   3,  20,   9, 
-      5,  13,   5,  11,  36,   9, 
-     14,  13,  35,  11,  36,   9, 
-     40,  13,  51,   3,  28,   9, 
-     14,   3,  48,   9,  10,  13, 
-     52,   3,  28,   9,  14,  13, 
-     35,  11,  76,   9,  44,  13, 
-     59,   3,  52,   9,  40,  13, 
-     68,   3,  32,   9,  13,   3, 
-     28,   9,  24,  13,  33,   6, 
-      2,   3,  28,   9,  13,   3, 
-     28,  13,  28,   6,   2,   3, 
-     28,   9,  33,  13,  48,   3, 
-     28,   9,  13,   3,  28,   9, 
-     53,  13,  68,   3,  28,   9, 
-     13,   3,  28,   9,  73,  13, 
-     88,   3,  28,   9,  13,   3, 
-     28,   9,   9,  13,  89,   3, 
-     28,   9,  13,  13,  24,  11, 
-     76,   9,   9,  13,   9,   6, 
-      2,   3,  20,   9,   5,  13, 
-      5,  11,  36,  13,  47,   6, 
-      6,   3,  32,   9,   9,  13, 
-     30,   3,  12,   9,  35,  13, 
-     46,   3,  28,   9,   9,   3, 
-     48,   9,   5,  13,  47,   3, 
-     28,   9,  14,  13,  35,  11, 
-     76,   9,  44,  13,  58,   3, 
-     52,   9,  40,  13,  67,   3, 
-     32,   9,  13,   3,  28,   9, 
-     24,  13,  33,   6,   2,   3, 
-     28,   9,  13,   3,  28,  13, 
-     28,   6,   2,   3,  28,   9, 
-     33,  13,  48,   3,  28,   9, 
-     13,   3,  28,   9,  53,  13, 
-     68,   3,  28,   9,  13,   3, 
-     28,   9,  73,  13,  88,   3, 
-     28,   9,  13,   3,  28,   9, 
-      9,  13,  89,   3,  28,   9, 
-     13,  13,  24,  11,  76,   9, 
-      9,  13,   9,   6,   2,   3, 
-     20,   9,   5,  13,   5,  11, 
-     36,   9,  14,  13,  35,  11, 
-     36,   9,  40,  13,  51,   3, 
-     28,   9,  14,   3,  48,   9, 
-     10,  13,  52,   3,  28,   9, 
-     14,  13,  35,  11,  76,   9, 
-     44,  13,  59,   3,  52,   9, 
-     40,  13,  68,   3,  32,   9, 
-     13,   3,  28,   9,  24,  13, 
-     33,   6,   2,   3,  28,   9, 
-     13,   3,  28,  13,  28,   6, 
-      2,   3,  28,   9,  33,  13, 
-     48,   3,  28,   9,  13,   3, 
-     28,   9,  53,  13,  68,   3, 
-     28,   9,  13,   3,  28,   9, 
-     73,  13,  88,   3,  28,   9, 
-     13,   3,  28,   9,   9,  13, 
-     89,   3,  28,   9,  13,  13, 
-     24,  11,  76,   9,   9,  13, 
-      9,   6,   2,   3,  20,   9, 
-      5,  13,   5,  11,  36,  13, 
-     47,   6,   6,   3,  32,   9, 
-      9,  13,  30,   3,  12,   9, 
-     35,  13,  46,   3,  28,   9, 
-      9,   3,  48,   9,   5,  13, 
-     47,   3,  28,   9,  14,  13, 
-     35,  11,  76,   9,  44,  13, 
-     58,   3,  52,   9,  40,  13, 
-     67,   3,  32,   9,  13,   3, 
-     28,   9,  24,  13,  33,   6, 
-      2,   3,  28,   9,  13,   3, 
-     28,  13,  28,   6,   2,   3, 
-     28,   9,  33,  13,  48,   3, 
-     28,   9,  13,   3,  28,   9, 
-     53,  13,  68,   3,  28,   9, 
-     13,   3,  28,   9,  73,  13, 
-     88,   3,  28,   9,  13,   3, 
-     28,   9,   9,  13,  89,   3, 
-     28,   9,  13,  13,  24,  11, 
-     76,   9,   9,  13,   9,   6, 
-      2,   3,  20,   9,   5,  13, 
-      5,  11,  36,   9,  14,  13, 
-     35,  11,  36,   9,  40,  13, 
-     51,   3,  28,   9,  14,   3, 
-     48,   9,  10,  13,  52,   3, 
-     28,   9,  14,  13,  35,  11, 
-     76,   9,  44,  13,  59,   3, 
-     52,   9,  40,  13,  68,   3, 
-     32,   9,  13,   3,  28,   9, 
-     24,  13,  33,   6,   2,   3, 
-     28,   9,  13,   3,  28,  13, 
-     28,   6,   2,   3,  28,   9, 
-     33,  13,  48,   3,  28,   9, 
-     13,   3,  28,   9,  53,  13, 
-     68,   3,  28,   9,  13,   3, 
-     28,   9,  73,  13,  88,   3, 
-     28,   9,  13,   3,  28,   9, 
-      9,  13,  89,   3,  28,   9, 
-     13,  13,  24,  11,  76,   9, 
-      9,  13,   9,   6,   2,   3, 
-     20,   9,   5,  13,   5,  11, 
-     36,  13,  17,   6,   4,   3, 
-     32,   9,  17,  12,  12,  32, 
-     70,   0,  62,  17,  16,  16, 
-      0,   0, 128,   0,  60,  82, 
-     97, 121,  65,  97,  98,  98, 
-     73, 110, 116, 101, 114, 115, 
-    101,  99, 116,  32, 114, 101, 
-    116, 117, 114, 110,  32, 118, 
-     97, 108, 117, 101,  62,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     30,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     60,  22,   0,   0,   1,   0, 
-     92,  11,   4,   0,  32,   2, 
-     40,   2,  24,   0,  48,   0, 
-      0,   0,  46,   0,  62,  17, 
-      5,  16,   0,   0,   9,   0, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  28,  20,   0,   0, 
-      1,   0, 124,  13,  32,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  28,  20,   0,   0, 
-      1,   0, 124,  13,  36,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  28,  20,   0,   0, 
-      1,   0,  60,  13, 172,  11, 
-    124,   1,  40,   0,   0,   0, 
-     46,   0,  62,  17,   5,  16, 
-      0,   0,   9,   0, 114,  97, 
-    121,  68, 105, 114,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     28,  20,   0,   0,   1,   0, 
-     60,  13,  32,  12,   8,   1, 
-     16,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  28,  20, 
-      0,   0,   1,   0,  60,  13, 
-     32,  12,   8,   1,  20,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  28,  20,   0,   0, 
-      1,   0,  60,  13, 232,  11, 
-     64,   1,  24,   0,   0,   0, 
-     46,   0,  62,  17,   5,  16, 
-      0,   0,   9,   0,  97,  97, 
-     98,  98,  77, 105, 110,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     28,  20,   0,   0,   1,   0, 
-    124,  13,  80,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     28,  20,   0,   0,   1,   0, 
-    124,  13,  84,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     28,  20,   0,   0,   1,   0, 
-    124,  13,  88,   0,   0,   0, 
-     46,   0,  62,  17,   5,  16, 
-      0,   0,   9,   0,  97,  97, 
-     98,  98,  77,  97, 120,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     28,  20,   0,   0,   1,   0, 
-    124,  13,  96,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     28,  20,   0,   0,   1,   0, 
-    124,  13, 100,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     28,  20,   0,   0,   1,   0, 
-    124,  13, 104,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 104,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  30,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  28,  21,   0,   0, 
-      1,   0,  52,   9,  84,   0, 
-     28,   4, 196,   4,  28,   4, 
-     44,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  64,  23, 
-      0,   0,   1,   0, 140,   4, 
-     28,   0,  84,   4,  52,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  32,  32,   0,   0, 
-      1,   0,  84,   0,  24,   0, 
-      0,   0,  42,   0,  62,  17, 
-      5,  16,   0,   0,   8,   0, 
-    112,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  84,  21, 
-      0,   0,   1,   0,  56,   0, 
-     48,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  84,  21, 
-      0,   0,   1,   0, 236,   0, 
-     52,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 120,  23, 
-      0,   0,   1,   0,  56,   0, 
-     52,   0,   0,   0,  30,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 120,  23, 
-      0,   0,   1,   0,  24,   5, 
-    168,   0, 164,   1,  56,   3, 
-     56,   1,  56,   0,   0,   0, 
-     30,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    196,  25,   0,   0,   1,   0, 
-    168,   4,  56,   0, 236,   1, 
-     92,   2,  20,   2,  52,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  52,  30,   0,   0, 
-      1,   0, 236,   0,  56,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  88,  32,   0,   0, 
-      1,   0,  56,   0,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  88,  32,   0,   0, 
-      1,   0, 168,   0,  20,   0, 
-      0,   0,   2,   0,  78,  17, 
-      2,   0,   6,   0,  42,   0, 
-     82,  17,  10,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-     78,  85,  77,  95,  80,  73, 
-     88,  69,  76,  83,  95,  80, 
-     69,  82,  95,  71,  82,  79, 
-     85,  80,  95,  88,   0,   0, 
-     42,   0,  82,  17,  10,  16, 
-      0,   0,   0,   0,   0,   0, 
-      4,   0, 255, 255, 255, 255, 
-    255, 255,  78,  85,  77,  95, 
-     80,  73,  88,  69,  76,  83, 
-     95,  80,  69,  82,  95,  71, 
-     82,  79,  85,  80,  95,  89, 
-      0,   0, 244,   0,   0,   0, 
-     48,   0,   0,   0,   1,   0, 
-      0,   0,  16,   1,  85, 187, 
-    166,  77, 157,  47, 241,  87, 
-    158, 200, 188, 174,  71, 253, 
-     24, 107,   0,   0, 130,   0, 
-      0,   0,  16,   1, 109, 201, 
-    201, 118,  37,  22,  25,   0, 
-    143, 163, 207,  14, 206,  48, 
-      3, 255,   0,   0, 242,   0, 
-      0,   0, 160,  35,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      1,   0, 128,  34,   0,   0, 
-      0,   0,   0,   0, 246,   2, 
-      0,   0, 148,  35,   0,   0, 
-    116,   0,   0,   0,  17,   0, 
-      0, 128, 116,   0,   0,   0, 
-     17,   0,   0,   0, 136,   0, 
-      0,   0,  18,   0,   0, 128, 
-    136,   0,   0,   0,  18,   0, 
-      0,   0, 168,   0,   0,   0, 
-     27,   0,   0, 128, 168,   0, 
-      0,   0,  27,   0,   0,   0, 
-    196,   0,   0,   0,  27,   0, 
-      0, 128, 196,   0,   0,   0, 
-     27,   0,   0,   0, 220,   0, 
-      0,   0,  30,   0,   0, 128, 
-    220,   0,   0,   0,  30,   0, 
-      0,   0, 224,   0,   0,   0, 
-     30,   0,   0, 128, 224,   0, 
-      0,   0,  30,   0,   0,   0, 
-    244,   0,   0,   0,  30,   0, 
-      0, 128, 244,   0,   0,   0, 
-     30,   0,   0,   0,  12,   1, 
-      0,   0,  30,   0,   0, 128, 
-     12,   1,   0,   0,  30,   0, 
-      0,   0,  36,   1,   0,   0, 
-     30,   0,   0, 128,  36,   1, 
-      0,   0,  30,   0,   0,   0, 
-     56,   1,   0,   0,  30,   0, 
-      0, 128,  56,   1,   0,   0, 
-     30,   0,   0,   0,  80,   1, 
-      0,   0,  30,   0,   0, 128, 
-     80,   1,   0,   0,  30,   0, 
-      0,   0, 108,   1,   0,   0, 
-     30,   0,   0, 128, 108,   1, 
-      0,   0,  30,   0,   0,   0, 
-    128,   1,   0,   0,  30,   0, 
-      0, 128, 128,   1,   0,   0, 
-     30,   0,   0,   0, 152,   1, 
-      0,   0,  30,   0,   0, 128, 
-    152,   1,   0,   0,  30,   0, 
-      0,   0, 180,   1,   0,   0, 
-     30,   0,   0, 128, 180,   1, 
-      0,   0,  30,   0,   0,   0, 
-    200,   1,   0,   0,  30,   0, 
-      0, 128, 200,   1,   0,   0, 
-     30,   0,   0,   0, 220,   1, 
-      0,   0,  33,   0,   0, 128, 
-    220,   1,   0,   0,  33,   0, 
-      0,   0, 248,   1,   0,   0, 
-     33,   0,   0, 128, 248,   1, 
-      0,   0,  33,   0,   0,   0, 
-     12,   2,   0,   0,  33,   0, 
-      0, 128,  12,   2,   0,   0, 
-     33,   0,   0,   0,  40,   2, 
-      0,   0,  33,   0,   0, 128, 
-     40,   2,   0,   0,  33,   0, 
-      0,   0,  72,   2,   0,   0, 
-     33,   0,   0, 128,  72,   2, 
-      0,   0,  33,   0,   0,   0, 
-    104,   2,   0,   0,  33,   0, 
-      0, 128, 104,   2,   0,   0, 
-     33,   0,   0,   0, 132,   2, 
-      0,   0,  33,   0,   0, 128, 
-    132,   2,   0,   0,  33,   0, 
-      0,   0, 164,   2,   0,   0, 
-     33,   0,   0, 128, 164,   2, 
-      0,   0,  33,   0,   0,   0, 
-    192,   2,   0,   0,  36,   0, 
-      0, 128, 192,   2,   0,   0, 
-     36,   0,   0,   0, 216,   2, 
-      0,   0,  41,   0,   0, 128, 
-    216,   2,   0,   0,  41,   0, 
-      0,   0, 236,   2,   0,   0, 
-     41,   0,   0, 128, 236,   2, 
-      0,   0,  41,   0,   0,   0, 
-     24,   3,   0,   0,  41,   0, 
-      0, 128,  24,   3,   0,   0, 
-     41,   0,   0,   0,  68,   3, 
-      0,   0,  41,   0,   0, 128, 
-     68,   3,   0,   0,  41,   0, 
-      0,   0, 112,   3,   0,   0, 
-     41,   0,   0, 128, 112,   3, 
-      0,   0,  41,   0,   0,   0, 
-    156,   3,   0,   0,  41,   0, 
-      0, 128, 156,   3,   0,   0, 
-     41,   0,   0,   0, 200,   3, 
-      0,   0,  41,   0,   0, 128, 
-    200,   3,   0,   0,  41,   0, 
-      0,   0, 244,   3,   0,   0, 
-     41,   0,   0, 128, 244,   3, 
-      0,   0,  41,   0,   0,   0, 
-     32,   4,   0,   0,  41,   0, 
-      0, 128,  32,   4,   0,   0, 
-     41,   0,   0,   0,  76,   4, 
-      0,   0,  41,   0,   0, 128, 
-     76,   4,   0,   0,  41,   0, 
-      0,   0, 120,   4,   0,   0, 
-     41,   0,   0, 128, 120,   4, 
-      0,   0,  41,   0,   0,   0, 
-    164,   4,   0,   0,  41,   0, 
-      0, 128, 164,   4,   0,   0, 
-     41,   0,   0,   0, 208,   4, 
-      0,   0,  41,   0,   0, 128, 
-    208,   4,   0,   0,  41,   0, 
-      0,   0, 252,   4,   0,   0, 
-     41,   0,   0, 128, 252,   4, 
-      0,   0,  41,   0,   0,   0, 
-     40,   5,   0,   0,  41,   0, 
-      0, 128,  40,   5,   0,   0, 
-     41,   0,   0,   0,  84,   5, 
-      0,   0,  42,   0,   0, 128, 
-     84,   5,   0,   0,  42,   0, 
-      0,   0, 104,   5,   0,   0, 
-     43,   0,   0, 128, 104,   5, 
-      0,   0,  43,   0,   0,   0, 
-    108,   5,   0,   0,  43,   0, 
-      0, 128, 108,   5,   0,   0, 
-     43,   0,   0,   0, 128,   5, 
-      0,   0,  43,   0,   0, 128, 
-    128,   5,   0,   0,  43,   0, 
-      0,   0, 148,   5,   0,   0, 
-     43,   0,   0, 128, 148,   5, 
-      0,   0,  43,   0,   0,   0, 
-    168,   5,   0,   0,  43,   0, 
-      0, 128, 168,   5,   0,   0, 
-     43,   0,   0,   0, 188,   5, 
-      0,   0,  43,   0,   0, 128, 
-    188,   5,   0,   0,  43,   0, 
-      0,   0, 216,   5,   0,   0, 
-     43,   0,   0, 128, 216,   5, 
-      0,   0,  43,   0,   0,   0, 
-    236,   5,   0,   0,  43,   0, 
-      0, 128, 236,   5,   0,   0, 
-     43,   0,   0,   0,   8,   6, 
-      0,   0,  43,   0,   0, 128, 
-      8,   6,   0,   0,  43,   0, 
-      0,   0,  36,   6,   0,   0, 
-     43,   0,   0, 128,  36,   6, 
-      0,   0,  43,   0,   0,   0, 
-     48,   6,   0,   0,  43,   0, 
-      0, 128,  48,   6,   0,   0, 
-     43,   0,   0,   0,  72,   6, 
-      0,   0,  43,   0,   0, 128, 
-     72,   6,   0,   0,  43,   0, 
-      0,   0, 100,   6,   0,   0, 
-     43,   0,   0, 128, 100,   6, 
-      0,   0,  43,   0,   0,   0, 
-    132,   6,   0,   0,  43,   0, 
-      0, 128, 132,   6,   0,   0, 
-     43,   0,   0,   0, 160,   6, 
-      0,   0,  43,   0,   0, 128, 
-    160,   6,   0,   0,  43,   0, 
-      0,   0, 188,   6,   0,   0, 
-     43,   0,   0, 128, 188,   6, 
-      0,   0,  43,   0,   0,   0, 
-    216,   6,   0,   0,  43,   0, 
-      0, 128, 216,   6,   0,   0, 
-     43,   0,   0,   0, 244,   6, 
-      0,   0,  43,   0,   0, 128, 
-    244,   6,   0,   0,  43,   0, 
-      0,   0,  16,   7,   0,   0, 
-     43,   0,   0, 128,  16,   7, 
-      0,   0,  43,   0,   0,   0, 
-     44,   7,   0,   0,  43,   0, 
-      0, 128,  44,   7,   0,   0, 
-     43,   0,   0,   0,  72,   7, 
-      0,   0,  43,   0,   0, 128, 
-     72,   7,   0,   0,  43,   0, 
-      0,   0, 100,   7,   0,   0, 
-     43,   0,   0, 128, 100,   7, 
-      0,   0,  43,   0,   0,   0, 
-    128,   7,   0,   0,  43,   0, 
-      0, 128, 128,   7,   0,   0, 
-     43,   0,   0,   0, 156,   7, 
-      0,   0,  43,   0,   0, 128, 
-    156,   7,   0,   0,  43,   0, 
-      0,   0, 184,   7,   0,   0, 
-     43,   0,   0, 128, 184,   7, 
-      0,   0,  43,   0,   0,   0, 
-    196,   7,   0,   0,  43,   0, 
-      0, 128, 196,   7,   0,   0, 
-     43,   0,   0,   0, 216,   7, 
-      0,   0,  43,   0,   0, 128, 
-    216,   7,   0,   0,  43,   0, 
-      0,   0, 220,   7,   0,   0, 
-     43,   0,   0, 128, 220,   7, 
-      0,   0,  43,   0,   0,   0, 
-    224,   7,   0,   0,  43,   0, 
-      0, 128, 224,   7,   0,   0, 
-     43,   0,   0,   0, 252,   7, 
-      0,   0,  43,   0,   0, 128, 
-    252,   7,   0,   0,  43,   0, 
-      0,   0,  16,   8,   0,   0, 
-     43,   0,   0, 128,  16,   8, 
-      0,   0,  43,   0,   0,   0, 
-     44,   8,   0,   0,  43,   0, 
-      0, 128,  44,   8,   0,   0, 
-     43,   0,   0,   0,  72,   8, 
-      0,   0,  43,   0,   0, 128, 
-     72,   8,   0,   0,  43,   0, 
-      0,   0,  84,   8,   0,   0, 
-     43,   0,   0, 128,  84,   8, 
-      0,   0,  43,   0,   0,   0, 
-    108,   8,   0,   0,  43,   0, 
-      0, 128, 108,   8,   0,   0, 
-     43,   0,   0,   0, 136,   8, 
-      0,   0,  43,   0,   0, 128, 
-    136,   8,   0,   0,  43,   0, 
-      0,   0, 168,   8,   0,   0, 
-     43,   0,   0, 128, 168,   8, 
-      0,   0,  43,   0,   0,   0, 
-    196,   8,   0,   0,  43,   0, 
-      0, 128, 196,   8,   0,   0, 
-     43,   0,   0,   0, 224,   8, 
-      0,   0,  43,   0,   0, 128, 
-    224,   8,   0,   0,  43,   0, 
-      0,   0, 252,   8,   0,   0, 
-     43,   0,   0, 128, 252,   8, 
-      0,   0,  43,   0,   0,   0, 
-     24,   9,   0,   0,  43,   0, 
-      0, 128,  24,   9,   0,   0, 
-     43,   0,   0,   0,  52,   9, 
-      0,   0,  43,   0,   0, 128, 
-     52,   9,   0,   0,  43,   0, 
-      0,   0,  80,   9,   0,   0, 
-     43,   0,   0, 128,  80,   9, 
-      0,   0,  43,   0,   0,   0, 
-    108,   9,   0,   0,  43,   0, 
-      0, 128, 108,   9,   0,   0, 
-     43,   0,   0,   0, 136,   9, 
-      0,   0,  43,   0,   0, 128, 
-    136,   9,   0,   0,  43,   0, 
-      0,   0, 164,   9,   0,   0, 
-     43,   0,   0, 128, 164,   9, 
-      0,   0,  43,   0,   0,   0, 
-    192,   9,   0,   0,  43,   0, 
-      0, 128, 192,   9,   0,   0, 
-     43,   0,   0,   0, 220,   9, 
-      0,   0,  43,   0,   0, 128, 
-    220,   9,   0,   0,  43,   0, 
-      0,   0, 232,   9,   0,   0, 
-     43,   0,   0, 128, 232,   9, 
-      0,   0,  43,   0,   0,   0, 
-    252,   9,   0,   0,  43,   0, 
-      0, 128, 252,   9,   0,   0, 
-     43,   0,   0,   0,   0,  10, 
-      0,   0,  43,   0,   0, 128, 
-      0,  10,   0,   0,  43,   0, 
-      0,   0,   4,  10,   0,   0, 
-     43,   0,   0, 128,   4,  10, 
-      0,   0,  43,   0,   0,   0, 
-     24,  10,   0,   0,  43,   0, 
-      0, 128,  24,  10,   0,   0, 
-     43,   0,   0,   0,  28,  10, 
-      0,   0,  43,   0,   0, 128, 
-     28,  10,   0,   0,  43,   0, 
-      0,   0,  32,  10,   0,   0, 
-     43,   0,   0, 128,  32,  10, 
-      0,   0,  43,   0,   0,   0, 
-     44,  10,   0,   0,  43,   0, 
-      0, 128,  44,  10,   0,   0, 
-     43,   0,   0,   0,  72,  10, 
-      0,   0,  43,   0,   0, 128, 
-     72,  10,   0,   0,  43,   0, 
-      0,   0,  92,  10,   0,   0, 
-     43,   0,   0, 128,  92,  10, 
-      0,   0,  43,   0,   0,   0, 
-    120,  10,   0,   0,  43,   0, 
-      0, 128, 120,  10,   0,   0, 
-     43,   0,   0,   0, 148,  10, 
-      0,   0,  43,   0,   0, 128, 
-    148,  10,   0,   0,  43,   0, 
-      0,   0, 160,  10,   0,   0, 
-     43,   0,   0, 128, 160,  10, 
-      0,   0,  43,   0,   0,   0, 
-    184,  10,   0,   0,  43,   0, 
-      0, 128, 184,  10,   0,   0, 
-     43,   0,   0,   0, 212,  10, 
-      0,   0,  43,   0,   0, 128, 
-    212,  10,   0,   0,  43,   0, 
-      0,   0, 244,  10,   0,   0, 
-     43,   0,   0, 128, 244,  10, 
-      0,   0,  43,   0,   0,   0, 
-     16,  11,   0,   0,  43,   0, 
-      0, 128,  16,  11,   0,   0, 
-     43,   0,   0,   0,  44,  11, 
-      0,   0,  43,   0,   0, 128, 
-     44,  11,   0,   0,  43,   0, 
-      0,   0,  72,  11,   0,   0, 
-     43,   0,   0, 128,  72,  11, 
-      0,   0,  43,   0,   0,   0, 
-    100,  11,   0,   0,  43,   0, 
-      0, 128, 100,  11,   0,   0, 
-     43,   0,   0,   0, 128,  11, 
-      0,   0,  43,   0,   0, 128, 
-    128,  11,   0,   0,  43,   0, 
-      0,   0, 156,  11,   0,   0, 
-     43,   0,   0, 128, 156,  11, 
-      0,   0,  43,   0,   0,   0, 
-    184,  11,   0,   0,  43,   0, 
-      0, 128, 184,  11,   0,   0, 
-     43,   0,   0,   0, 212,  11, 
-      0,   0,  43,   0,   0, 128, 
-    212,  11,   0,   0,  43,   0, 
-      0,   0, 240,  11,   0,   0, 
-     43,   0,   0, 128, 240,  11, 
-      0,   0,  43,   0,   0,   0, 
-     12,  12,   0,   0,  43,   0, 
-      0, 128,  12,  12,   0,   0, 
-     43,   0,   0,   0,  40,  12, 
-      0,   0,  43,   0,   0, 128, 
-     40,  12,   0,   0,  43,   0, 
-      0,   0,  52,  12,   0,   0, 
-     43,   0,   0, 128,  52,  12, 
-      0,   0,  43,   0,   0,   0, 
-     72,  12,   0,   0,  43,   0, 
-      0, 128,  72,  12,   0,   0, 
-     43,   0,   0,   0,  76,  12, 
-      0,   0,  43,   0,   0, 128, 
-     76,  12,   0,   0,  43,   0, 
-      0,   0,  80,  12,   0,   0, 
-     43,   0,   0, 128,  80,  12, 
-      0,   0,  43,   0,   0,   0, 
-    108,  12,   0,   0,  43,   0, 
-      0, 128, 108,  12,   0,   0, 
-     43,   0,   0,   0, 128,  12, 
-      0,   0,  43,   0,   0, 128, 
-    128,  12,   0,   0,  43,   0, 
-      0,   0, 156,  12,   0,   0, 
-     43,   0,   0, 128, 156,  12, 
-      0,   0,  43,   0,   0,   0, 
-    184,  12,   0,   0,  43,   0, 
-      0, 128, 184,  12,   0,   0, 
-     43,   0,   0,   0, 196,  12, 
-      0,   0,  43,   0,   0, 128, 
-    196,  12,   0,   0,  43,   0, 
-      0,   0, 220,  12,   0,   0, 
-     43,   0,   0, 128, 220,  12, 
-      0,   0,  43,   0,   0,   0, 
-    248,  12,   0,   0,  43,   0, 
-      0, 128, 248,  12,   0,   0, 
-     43,   0,   0,   0,  24,  13, 
-      0,   0,  43,   0,   0, 128, 
-     24,  13,   0,   0,  43,   0, 
-      0,   0,  52,  13,   0,   0, 
-     43,   0,   0, 128,  52,  13, 
-      0,   0,  43,   0,   0,   0, 
-     80,  13,   0,   0,  43,   0, 
-      0, 128,  80,  13,   0,   0, 
-     43,   0,   0,   0, 108,  13, 
-      0,   0,  43,   0,   0, 128, 
-    108,  13,   0,   0,  43,   0, 
-      0,   0, 136,  13,   0,   0, 
-     43,   0,   0, 128, 136,  13, 
-      0,   0,  43,   0,   0,   0, 
-    164,  13,   0,   0,  43,   0, 
-      0, 128, 164,  13,   0,   0, 
-     43,   0,   0,   0, 192,  13, 
-      0,   0,  43,   0,   0, 128, 
-    192,  13,   0,   0,  43,   0, 
-      0,   0, 220,  13,   0,   0, 
-     43,   0,   0, 128, 220,  13, 
-      0,   0,  43,   0,   0,   0, 
-    248,  13,   0,   0,  43,   0, 
-      0, 128, 248,  13,   0,   0, 
-     43,   0,   0,   0,  20,  14, 
-      0,   0,  43,   0,   0, 128, 
-     20,  14,   0,   0,  43,   0, 
-      0,   0,  48,  14,   0,   0, 
-     43,   0,   0, 128,  48,  14, 
-      0,   0,  43,   0,   0,   0, 
-     76,  14,   0,   0,  43,   0, 
-      0, 128,  76,  14,   0,   0, 
-     43,   0,   0,   0,  88,  14, 
-      0,   0,  43,   0,   0, 128, 
-     88,  14,   0,   0,  43,   0, 
-      0,   0, 108,  14,   0,   0, 
-     43,   0,   0, 128, 108,  14, 
-      0,   0,  43,   0,   0,   0, 
-    112,  14,   0,   0,  43,   0, 
-      0, 128, 112,  14,   0,   0, 
-     43,   0,   0,   0, 116,  14, 
-      0,   0,  43,   0,   0, 128, 
-    116,  14,   0,   0,  43,   0, 
-      0,   0, 136,  14,   0,   0, 
-     43,   0,   0, 128, 136,  14, 
-      0,   0,  43,   0,   0,   0, 
-    140,  14,   0,   0,  43,   0, 
-      0, 128, 140,  14,   0,   0, 
-     43,   0,   0,   0, 144,  14, 
-      0,   0,  43,   0,   0, 128, 
-    144,  14,   0,   0,  43,   0, 
-      0,   0, 156,  14,   0,   0, 
-     43,   0,   0, 128, 156,  14, 
-      0,   0,  43,   0,   0,   0, 
-    184,  14,   0,   0,  43,   0, 
-      0, 128, 184,  14,   0,   0, 
-     43,   0,   0,   0, 204,  14, 
-      0,   0,  43,   0,   0, 128, 
-    204,  14,   0,   0,  43,   0, 
-      0,   0, 232,  14,   0,   0, 
-     43,   0,   0, 128, 232,  14, 
-      0,   0,  43,   0,   0,   0, 
-      4,  15,   0,   0,  43,   0, 
-      0, 128,   4,  15,   0,   0, 
-     43,   0,   0,   0,  16,  15, 
-      0,   0,  43,   0,   0, 128, 
-     16,  15,   0,   0,  43,   0, 
-      0,   0,  40,  15,   0,   0, 
-     43,   0,   0, 128,  40,  15, 
-      0,   0,  43,   0,   0,   0, 
-     68,  15,   0,   0,  43,   0, 
-      0, 128,  68,  15,   0,   0, 
-     43,   0,   0,   0, 100,  15, 
-      0,   0,  43,   0,   0, 128, 
-    100,  15,   0,   0,  43,   0, 
-      0,   0, 128,  15,   0,   0, 
-     43,   0,   0, 128, 128,  15, 
-      0,   0,  43,   0,   0,   0, 
-    156,  15,   0,   0,  43,   0, 
-      0, 128, 156,  15,   0,   0, 
-     43,   0,   0,   0, 184,  15, 
-      0,   0,  43,   0,   0, 128, 
-    184,  15,   0,   0,  43,   0, 
-      0,   0, 212,  15,   0,   0, 
-     43,   0,   0, 128, 212,  15, 
-      0,   0,  43,   0,   0,   0, 
-    240,  15,   0,   0,  43,   0, 
-      0, 128, 240,  15,   0,   0, 
-     43,   0,   0,   0,  12,  16, 
-      0,   0,  43,   0,   0, 128, 
-     12,  16,   0,   0,  43,   0, 
-      0,   0,  40,  16,   0,   0, 
-     43,   0,   0, 128,  40,  16, 
-      0,   0,  43,   0,   0,   0, 
-     68,  16,   0,   0,  43,   0, 
-      0, 128,  68,  16,   0,   0, 
-     43,   0,   0,   0,  96,  16, 
-      0,   0,  43,   0,   0, 128, 
-     96,  16,   0,   0,  43,   0, 
-      0,   0, 124,  16,   0,   0, 
-     43,   0,   0, 128, 124,  16, 
-      0,   0,  43,   0,   0,   0, 
-    152,  16,   0,   0,  43,   0, 
-      0, 128, 152,  16,   0,   0, 
-     43,   0,   0,   0, 164,  16, 
-      0,   0,  43,   0,   0, 128, 
-    164,  16,   0,   0,  43,   0, 
-      0,   0, 184,  16,   0,   0, 
-     43,   0,   0, 128, 184,  16, 
-      0,   0,  43,   0,   0,   0, 
-    188,  16,   0,   0,  43,   0, 
-      0, 128, 188,  16,   0,   0, 
-     43,   0,   0,   0, 192,  16, 
-      0,   0,  43,   0,   0, 128, 
-    192,  16,   0,   0,  43,   0, 
-      0,   0, 220,  16,   0,   0, 
-     43,   0,   0, 128, 220,  16, 
-      0,   0,  43,   0,   0,   0, 
-    240,  16,   0,   0,  43,   0, 
-      0, 128, 240,  16,   0,   0, 
-     43,   0,   0,   0,  12,  17, 
-      0,   0,  43,   0,   0, 128, 
-     12,  17,   0,   0,  43,   0, 
-      0,   0,  40,  17,   0,   0, 
-     43,   0,   0, 128,  40,  17, 
-      0,   0,  43,   0,   0,   0, 
-     52,  17,   0,   0,  43,   0, 
-      0, 128,  52,  17,   0,   0, 
-     43,   0,   0,   0,  76,  17, 
-      0,   0,  43,   0,   0, 128, 
-     76,  17,   0,   0,  43,   0, 
-      0,   0, 104,  17,   0,   0, 
-     43,   0,   0, 128, 104,  17, 
-      0,   0,  43,   0,   0,   0, 
-    136,  17,   0,   0,  43,   0, 
-      0, 128, 136,  17,   0,   0, 
-     43,   0,   0,   0, 164,  17, 
-      0,   0,  43,   0,   0, 128, 
-    164,  17,   0,   0,  43,   0, 
-      0,   0, 192,  17,   0,   0, 
-     43,   0,   0, 128, 192,  17, 
-      0,   0,  43,   0,   0,   0, 
-    220,  17,   0,   0,  43,   0, 
-      0, 128, 220,  17,   0,   0, 
-     43,   0,   0,   0, 248,  17, 
-      0,   0,  43,   0,   0, 128, 
-    248,  17,   0,   0,  43,   0, 
-      0,   0,  20,  18,   0,   0, 
-     43,   0,   0, 128,  20,  18, 
-      0,   0,  43,   0,   0,   0, 
-     48,  18,   0,   0,  43,   0, 
-      0, 128,  48,  18,   0,   0, 
-     43,   0,   0,   0,  76,  18, 
-      0,   0,  43,   0,   0, 128, 
-     76,  18,   0,   0,  43,   0, 
-      0,   0, 104,  18,   0,   0, 
-     43,   0,   0, 128, 104,  18, 
-      0,   0,  43,   0,   0,   0, 
-    132,  18,   0,   0,  43,   0, 
-      0, 128, 132,  18,   0,   0, 
-     43,   0,   0,   0, 160,  18, 
-      0,   0,  43,   0,   0, 128, 
-    160,  18,   0,   0,  43,   0, 
-      0,   0, 188,  18,   0,   0, 
-     43,   0,   0, 128, 188,  18, 
-      0,   0,  43,   0,   0,   0, 
-    200,  18,   0,   0,  43,   0, 
-      0, 128, 200,  18,   0,   0, 
-     43,   0,   0,   0, 220,  18, 
-      0,   0,  43,   0,   0, 128, 
-    220,  18,   0,   0,  43,   0, 
-      0,   0, 224,  18,   0,   0, 
-     43,   0,   0, 128, 224,  18, 
-      0,   0,  43,   0,   0,   0, 
-    228,  18,   0,   0,  43,   0, 
-      0, 128, 228,  18,   0,   0, 
-     43,   0,   0,   0, 248,  18, 
-      0,   0,  43,   0,   0, 128, 
-    248,  18,   0,   0,  43,   0, 
-      0,   0, 252,  18,   0,   0, 
-     43,   0,   0, 128, 252,  18, 
-      0,   0,  43,   0,   0,   0, 
-      0,  19,   0,   0,  43,   0, 
-      0, 128,   0,  19,   0,   0, 
-     43,   0,   0,   0,  12,  19, 
-      0,   0,  43,   0,   0, 128, 
-     12,  19,   0,   0,  43,   0, 
-      0,   0,  32,  19,   0,   0, 
-     43,   0,   0, 128,  32,  19, 
-      0,   0,  43,   0,   0,   0, 
-     36,  19,   0,   0,  43,   0, 
-      0, 128,  36,  19,   0,   0, 
-     43,   0,   0,   0,  40,  19, 
-      0,   0,  43,   0,   0, 128, 
-     40,  19,   0,   0,  43,   0, 
-      0,   0,  44,  19,   0,   0, 
-     43,   0,   0, 128,  44,  19, 
-      0,   0,  43,   0,   0,   0, 
-     56,  19,   0,   0,  46,   0, 
-      0, 128,  56,  19,   0,   0, 
-     46,   0,   0,   0,  76,  19, 
-      0,   0,  47,   0,   0, 128, 
-     76,  19,   0,   0,  47,   0, 
-      0,   0,  96,  19,   0,   0, 
-     48,   0,   0, 128,  96,  19, 
-      0,   0,  48,   0,   0,   0, 
-    116,  19,   0,   0,  49,   0, 
-      0, 128, 116,  19,   0,   0, 
-     49,   0,   0,   0, 152,  19, 
-      0,   0,  49,   0,   0, 128, 
-    152,  19,   0,   0,  49,   0, 
-      0,   0, 188,  19,   0,   0, 
-     50,   0,   0, 128, 188,  19, 
-      0,   0,  50,   0,   0,   0, 
-    216,  19,   0,   0,  51,   0, 
-      0, 128, 216,  19,   0,   0, 
-     51,   0,   0,   0, 236,  19, 
-      0,   0,  51,   0,   0, 128, 
-    236,  19,   0,   0,  51,   0, 
-      0,   0, 240,  19,   0,   0, 
-     52,   0,   0, 128, 240,  19, 
-      0,   0,  52,   0,   0,   0, 
-    244,  19,   0,   0,  52,   0, 
-      0, 128, 244,  19,   0,   0, 
-     52,   0,   0,   0,   8,  20, 
-      0,   0,  52,   0,   0, 128, 
-      8,  20,   0,   0,  52,   0, 
-      0,   0,  28,  20,   0,   0, 
-     52,   0,   0, 128,  28,  20, 
-      0,   0,  52,   0,   0,   0, 
-     56,  20,   0,   0,  52,   0, 
-      0, 128,  56,  20,   0,   0, 
-     52,   0,   0,   0,  76,  20, 
-      0,   0,  52,   0,   0, 128, 
-     76,  20,   0,   0,  52,   0, 
-      0,   0, 104,  20,   0,   0, 
-     52,   0,   0, 128, 104,  20, 
-      0,   0,  52,   0,   0,   0, 
-    132,  20,   0,   0,  52,   0, 
-      0, 128, 132,  20,   0,   0, 
-     52,   0,   0,   0, 144,  20, 
-      0,   0,  52,   0,   0, 128, 
-    144,  20,   0,   0,  52,   0, 
-      0,   0, 168,  20,   0,   0, 
-     52,   0,   0, 128, 168,  20, 
-      0,   0,  52,   0,   0,   0, 
-    196,  20,   0,   0,  52,   0, 
-      0, 128, 196,  20,   0,   0, 
-     52,   0,   0,   0, 228,  20, 
-      0,   0,  52,   0,   0, 128, 
-    228,  20,   0,   0,  52,   0, 
-      0,   0,   0,  21,   0,   0, 
-     52,   0,   0, 128,   0,  21, 
-      0,   0,  52,   0,   0,   0, 
-     28,  21,   0,   0,  52,   0, 
-      0, 128,  28,  21,   0,   0, 
-     52,   0,   0,   0,  56,  21, 
-      0,   0,  52,   0,   0, 128, 
-     56,  21,   0,   0,  52,   0, 
-      0,   0,  84,  21,   0,   0, 
-     52,   0,   0, 128,  84,  21, 
-      0,   0,  52,   0,   0,   0, 
-    112,  21,   0,   0,  52,   0, 
-      0, 128, 112,  21,   0,   0, 
-     52,   0,   0,   0, 140,  21, 
-      0,   0,  52,   0,   0, 128, 
-    140,  21,   0,   0,  52,   0, 
-      0,   0, 168,  21,   0,   0, 
-     52,   0,   0, 128, 168,  21, 
-      0,   0,  52,   0,   0,   0, 
-    196,  21,   0,   0,  52,   0, 
-      0, 128, 196,  21,   0,   0, 
-     52,   0,   0,   0, 224,  21, 
-      0,   0,  52,   0,   0, 128, 
-    224,  21,   0,   0,  52,   0, 
-      0,   0, 252,  21,   0,   0, 
-     52,   0,   0, 128, 252,  21, 
-      0,   0,  52,   0,   0,   0, 
-     24,  22,   0,   0,  52,   0, 
-      0, 128,  24,  22,   0,   0, 
-     52,   0,   0,   0,  36,  22, 
-      0,   0,  52,   0,   0, 128, 
-     36,  22,   0,   0,  52,   0, 
-      0,   0,  56,  22,   0,   0, 
-     52,   0,   0, 128,  56,  22, 
-      0,   0,  52,   0,   0,   0, 
-     60,  22,   0,   0,  52,   0, 
-      0, 128,  60,  22,   0,   0, 
-     52,   0,   0,   0,  64,  22, 
-      0,   0,  52,   0,   0, 128, 
-     64,  22,   0,   0,  52,   0, 
-      0,   0,  92,  22,   0,   0, 
-     52,   0,   0, 128,  92,  22, 
-      0,   0,  52,   0,   0,   0, 
-    112,  22,   0,   0,  52,   0, 
-      0, 128, 112,  22,   0,   0, 
-     52,   0,   0,   0, 140,  22, 
-      0,   0,  52,   0,   0, 128, 
-    140,  22,   0,   0,  52,   0, 
-      0,   0, 168,  22,   0,   0, 
-     52,   0,   0, 128, 168,  22, 
-      0,   0,  52,   0,   0,   0, 
-    180,  22,   0,   0,  52,   0, 
-      0, 128, 180,  22,   0,   0, 
-     52,   0,   0,   0, 204,  22, 
-      0,   0,  52,   0,   0, 128, 
-    204,  22,   0,   0,  52,   0, 
-      0,   0, 232,  22,   0,   0, 
-     52,   0,   0, 128, 232,  22, 
-      0,   0,  52,   0,   0,   0, 
-      8,  23,   0,   0,  52,   0, 
-      0, 128,   8,  23,   0,   0, 
-     52,   0,   0,   0,  36,  23, 
-      0,   0,  52,   0,   0, 128, 
-     36,  23,   0,   0,  52,   0, 
-      0,   0,  64,  23,   0,   0, 
-     52,   0,   0, 128,  64,  23, 
-      0,   0,  52,   0,   0,   0, 
-     92,  23,   0,   0,  52,   0, 
-      0, 128,  92,  23,   0,   0, 
-     52,   0,   0,   0, 120,  23, 
-      0,   0,  52,   0,   0, 128, 
-    120,  23,   0,   0,  52,   0, 
-      0,   0, 148,  23,   0,   0, 
-     52,   0,   0, 128, 148,  23, 
-      0,   0,  52,   0,   0,   0, 
-    176,  23,   0,   0,  52,   0, 
-      0, 128, 176,  23,   0,   0, 
-     52,   0,   0,   0, 204,  23, 
-      0,   0,  52,   0,   0, 128, 
-    204,  23,   0,   0,  52,   0, 
-      0,   0, 232,  23,   0,   0, 
-     52,   0,   0, 128, 232,  23, 
-      0,   0,  52,   0,   0,   0, 
-      4,  24,   0,   0,  52,   0, 
-      0, 128,   4,  24,   0,   0, 
-     52,   0,   0,   0,  32,  24, 
-      0,   0,  52,   0,   0, 128, 
-     32,  24,   0,   0,  52,   0, 
-      0,   0,  60,  24,   0,   0, 
-     52,   0,   0, 128,  60,  24, 
-      0,   0,  52,   0,   0,   0, 
-     72,  24,   0,   0,  52,   0, 
-      0, 128,  72,  24,   0,   0, 
-     52,   0,   0,   0,  92,  24, 
-      0,   0,  52,   0,   0, 128, 
-     92,  24,   0,   0,  52,   0, 
-      0,   0,  96,  24,   0,   0, 
-     52,   0,   0, 128,  96,  24, 
-      0,   0,  52,   0,   0,   0, 
-    100,  24,   0,   0,  52,   0, 
-      0, 128, 100,  24,   0,   0, 
-     52,   0,   0,   0, 120,  24, 
-      0,   0,  52,   0,   0, 128, 
-    120,  24,   0,   0,  52,   0, 
-      0,   0, 124,  24,   0,   0, 
-     52,   0,   0, 128, 124,  24, 
-      0,   0,  52,   0,   0,   0, 
-    128,  24,   0,   0,  52,   0, 
-      0, 128, 128,  24,   0,   0, 
-     52,   0,   0,   0, 140,  24, 
-      0,   0,  52,   0,   0, 128, 
-    140,  24,   0,   0,  52,   0, 
-      0,   0, 168,  24,   0,   0, 
-     52,   0,   0, 128, 168,  24, 
-      0,   0,  52,   0,   0,   0, 
-    188,  24,   0,   0,  52,   0, 
-      0, 128, 188,  24,   0,   0, 
-     52,   0,   0,   0, 216,  24, 
-      0,   0,  52,   0,   0, 128, 
-    216,  24,   0,   0,  52,   0, 
-      0,   0, 244,  24,   0,   0, 
-     52,   0,   0, 128, 244,  24, 
-      0,   0,  52,   0,   0,   0, 
-      0,  25,   0,   0,  52,   0, 
-      0, 128,   0,  25,   0,   0, 
-     52,   0,   0,   0,  24,  25, 
-      0,   0,  52,   0,   0, 128, 
-     24,  25,   0,   0,  52,   0, 
-      0,   0,  52,  25,   0,   0, 
-     52,   0,   0, 128,  52,  25, 
-      0,   0,  52,   0,   0,   0, 
-     84,  25,   0,   0,  52,   0, 
-      0, 128,  84,  25,   0,   0, 
-     52,   0,   0,   0, 112,  25, 
-      0,   0,  52,   0,   0, 128, 
-    112,  25,   0,   0,  52,   0, 
-      0,   0, 140,  25,   0,   0, 
-     52,   0,   0, 128, 140,  25, 
-      0,   0,  52,   0,   0,   0, 
-    168,  25,   0,   0,  52,   0, 
-      0, 128, 168,  25,   0,   0, 
-     52,   0,   0,   0, 196,  25, 
-      0,   0,  52,   0,   0, 128, 
-    196,  25,   0,   0,  52,   0, 
-      0,   0, 224,  25,   0,   0, 
-     52,   0,   0, 128, 224,  25, 
-      0,   0,  52,   0,   0,   0, 
-    252,  25,   0,   0,  52,   0, 
-      0, 128, 252,  25,   0,   0, 
-     52,   0,   0,   0,  24,  26, 
-      0,   0,  52,   0,   0, 128, 
-     24,  26,   0,   0,  52,   0, 
-      0,   0,  52,  26,   0,   0, 
-     52,   0,   0, 128,  52,  26, 
-      0,   0,  52,   0,   0,   0, 
-     80,  26,   0,   0,  52,   0, 
-      0, 128,  80,  26,   0,   0, 
-     52,   0,   0,   0, 108,  26, 
-      0,   0,  52,   0,   0, 128, 
-    108,  26,   0,   0,  52,   0, 
-      0,   0, 136,  26,   0,   0, 
-     52,   0,   0, 128, 136,  26, 
-      0,   0,  52,   0,   0,   0, 
-    148,  26,   0,   0,  52,   0, 
-      0, 128, 148,  26,   0,   0, 
-     52,   0,   0,   0, 168,  26, 
-      0,   0,  52,   0,   0, 128, 
-    168,  26,   0,   0,  52,   0, 
-      0,   0, 172,  26,   0,   0, 
-     52,   0,   0, 128, 172,  26, 
-      0,   0,  52,   0,   0,   0, 
-    176,  26,   0,   0,  52,   0, 
-      0, 128, 176,  26,   0,   0, 
-     52,   0,   0,   0, 204,  26, 
-      0,   0,  52,   0,   0, 128, 
-    204,  26,   0,   0,  52,   0, 
-      0,   0, 224,  26,   0,   0, 
-     52,   0,   0, 128, 224,  26, 
-      0,   0,  52,   0,   0,   0, 
-    252,  26,   0,   0,  52,   0, 
-      0, 128, 252,  26,   0,   0, 
-     52,   0,   0,   0,  24,  27, 
-      0,   0,  52,   0,   0, 128, 
-     24,  27,   0,   0,  52,   0, 
-      0,   0,  36,  27,   0,   0, 
-     52,   0,   0, 128,  36,  27, 
-      0,   0,  52,   0,   0,   0, 
-     60,  27,   0,   0,  52,   0, 
-      0, 128,  60,  27,   0,   0, 
-     52,   0,   0,   0,  88,  27, 
-      0,   0,  52,   0,   0, 128, 
-     88,  27,   0,   0,  52,   0, 
-      0,   0, 120,  27,   0,   0, 
-     52,   0,   0, 128, 120,  27, 
-      0,   0,  52,   0,   0,   0, 
-    148,  27,   0,   0,  52,   0, 
-      0, 128, 148,  27,   0,   0, 
-     52,   0,   0,   0, 176,  27, 
-      0,   0,  52,   0,   0, 128, 
-    176,  27,   0,   0,  52,   0, 
-      0,   0, 204,  27,   0,   0, 
-     52,   0,   0, 128, 204,  27, 
-      0,   0,  52,   0,   0,   0, 
-    232,  27,   0,   0,  52,   0, 
-      0, 128, 232,  27,   0,   0, 
-     52,   0,   0,   0,   4,  28, 
-      0,   0,  52,   0,   0, 128, 
-      4,  28,   0,   0,  52,   0, 
-      0,   0,  32,  28,   0,   0, 
-     52,   0,   0, 128,  32,  28, 
-      0,   0,  52,   0,   0,   0, 
-     60,  28,   0,   0,  52,   0, 
-      0, 128,  60,  28,   0,   0, 
-     52,   0,   0,   0,  88,  28, 
-      0,   0,  52,   0,   0, 128, 
-     88,  28,   0,   0,  52,   0, 
-      0,   0, 116,  28,   0,   0, 
-     52,   0,   0, 128, 116,  28, 
-      0,   0,  52,   0,   0,   0, 
-    144,  28,   0,   0,  52,   0, 
-      0, 128, 144,  28,   0,   0, 
-     52,   0,   0,   0, 172,  28, 
-      0,   0,  52,   0,   0, 128, 
-    172,  28,   0,   0,  52,   0, 
-      0,   0, 184,  28,   0,   0, 
-     52,   0,   0, 128, 184,  28, 
-      0,   0,  52,   0,   0,   0, 
-    204,  28,   0,   0,  52,   0, 
-      0, 128, 204,  28,   0,   0, 
-     52,   0,   0,   0, 208,  28, 
-      0,   0,  52,   0,   0, 128, 
-    208,  28,   0,   0,  52,   0, 
-      0,   0, 212,  28,   0,   0, 
-     52,   0,   0, 128, 212,  28, 
-      0,   0,  52,   0,   0,   0, 
-    232,  28,   0,   0,  52,   0, 
-      0, 128, 232,  28,   0,   0, 
-     52,   0,   0,   0, 236,  28, 
-      0,   0,  52,   0,   0, 128, 
-    236,  28,   0,   0,  52,   0, 
-      0,   0, 240,  28,   0,   0, 
-     52,   0,   0, 128, 240,  28, 
-      0,   0,  52,   0,   0,   0, 
-    252,  28,   0,   0,  52,   0, 
-      0, 128, 252,  28,   0,   0, 
-     52,   0,   0,   0,  24,  29, 
-      0,   0,  52,   0,   0, 128, 
-     24,  29,   0,   0,  52,   0, 
-      0,   0,  44,  29,   0,   0, 
-     52,   0,   0, 128,  44,  29, 
-      0,   0,  52,   0,   0,   0, 
-     72,  29,   0,   0,  52,   0, 
-      0, 128,  72,  29,   0,   0, 
-     52,   0,   0,   0, 100,  29, 
-      0,   0,  52,   0,   0, 128, 
-    100,  29,   0,   0,  52,   0, 
-      0,   0, 112,  29,   0,   0, 
-     52,   0,   0, 128, 112,  29, 
-      0,   0,  52,   0,   0,   0, 
-    136,  29,   0,   0,  52,   0, 
-      0, 128, 136,  29,   0,   0, 
-     52,   0,   0,   0, 164,  29, 
-      0,   0,  52,   0,   0, 128, 
-    164,  29,   0,   0,  52,   0, 
-      0,   0, 196,  29,   0,   0, 
-     52,   0,   0, 128, 196,  29, 
-      0,   0,  52,   0,   0,   0, 
-    224,  29,   0,   0,  52,   0, 
-      0, 128, 224,  29,   0,   0, 
-     52,   0,   0,   0, 252,  29, 
-      0,   0,  52,   0,   0, 128, 
-    252,  29,   0,   0,  52,   0, 
-      0,   0,  24,  30,   0,   0, 
-     52,   0,   0, 128,  24,  30, 
-      0,   0,  52,   0,   0,   0, 
-     52,  30,   0,   0,  52,   0, 
-      0, 128,  52,  30,   0,   0, 
-     52,   0,   0,   0,  80,  30, 
-      0,   0,  52,   0,   0, 128, 
-     80,  30,   0,   0,  52,   0, 
-      0,   0, 108,  30,   0,   0, 
-     52,   0,   0, 128, 108,  30, 
-      0,   0,  52,   0,   0,   0, 
-    136,  30,   0,   0,  52,   0, 
-      0, 128, 136,  30,   0,   0, 
-     52,   0,   0,   0, 164,  30, 
-      0,   0,  52,   0,   0, 128, 
-    164,  30,   0,   0,  52,   0, 
-      0,   0, 192,  30,   0,   0, 
-     52,   0,   0, 128, 192,  30, 
-      0,   0,  52,   0,   0,   0, 
-    220,  30,   0,   0,  52,   0, 
-      0, 128, 220,  30,   0,   0, 
-     52,   0,   0,   0, 248,  30, 
-      0,   0,  52,   0,   0, 128, 
-    248,  30,   0,   0,  52,   0, 
-      0,   0,   4,  31,   0,   0, 
-     52,   0,   0, 128,   4,  31, 
-      0,   0,  52,   0,   0,   0, 
-     24,  31,   0,   0,  52,   0, 
-      0, 128,  24,  31,   0,   0, 
-     52,   0,   0,   0,  28,  31, 
-      0,   0,  52,   0,   0, 128, 
-     28,  31,   0,   0,  52,   0, 
-      0,   0,  32,  31,   0,   0, 
-     52,   0,   0, 128,  32,  31, 
-      0,   0,  52,   0,   0,   0, 
-     60,  31,   0,   0,  52,   0, 
-      0, 128,  60,  31,   0,   0, 
-     52,   0,   0,   0,  80,  31, 
-      0,   0,  52,   0,   0, 128, 
-     80,  31,   0,   0,  52,   0, 
-      0,   0, 108,  31,   0,   0, 
-     52,   0,   0, 128, 108,  31, 
-      0,   0,  52,   0,   0,   0, 
-    136,  31,   0,   0,  52,   0, 
-      0, 128, 136,  31,   0,   0, 
-     52,   0,   0,   0, 148,  31, 
-      0,   0,  52,   0,   0, 128, 
-    148,  31,   0,   0,  52,   0, 
-      0,   0, 172,  31,   0,   0, 
-     52,   0,   0, 128, 172,  31, 
-      0,   0,  52,   0,   0,   0, 
-    200,  31,   0,   0,  52,   0, 
-      0, 128, 200,  31,   0,   0, 
-     52,   0,   0,   0, 232,  31, 
-      0,   0,  52,   0,   0, 128, 
-    232,  31,   0,   0,  52,   0, 
-      0,   0,   4,  32,   0,   0, 
-     52,   0,   0, 128,   4,  32, 
-      0,   0,  52,   0,   0,   0, 
-     32,  32,   0,   0,  52,   0, 
-      0, 128,  32,  32,   0,   0, 
-     52,   0,   0,   0,  60,  32, 
-      0,   0,  52,   0,   0, 128, 
-     60,  32,   0,   0,  52,   0, 
-      0,   0,  88,  32,   0,   0, 
-     52,   0,   0, 128,  88,  32, 
-      0,   0,  52,   0,   0,   0, 
-    116,  32,   0,   0,  52,   0, 
-      0, 128, 116,  32,   0,   0, 
-     52,   0,   0,   0, 144,  32, 
-      0,   0,  52,   0,   0, 128, 
-    144,  32,   0,   0,  52,   0, 
-      0,   0, 172,  32,   0,   0, 
-     52,   0,   0, 128, 172,  32, 
-      0,   0,  52,   0,   0,   0, 
-    200,  32,   0,   0,  52,   0, 
-      0, 128, 200,  32,   0,   0, 
-     52,   0,   0,   0, 228,  32, 
-      0,   0,  52,   0,   0, 128, 
-    228,  32,   0,   0,  52,   0, 
-      0,   0,   0,  33,   0,   0, 
-     52,   0,   0, 128,   0,  33, 
-      0,   0,  52,   0,   0,   0, 
-     28,  33,   0,   0,  52,   0, 
-      0, 128,  28,  33,   0,   0, 
-     52,   0,   0,   0,  40,  33, 
-      0,   0,  52,   0,   0, 128, 
-     40,  33,   0,   0,  52,   0, 
-      0,   0,  60,  33,   0,   0, 
-     52,   0,   0, 128,  60,  33, 
-      0,   0,  52,   0,   0,   0, 
-     64,  33,   0,   0,  52,   0, 
-      0, 128,  64,  33,   0,   0, 
-     52,   0,   0,   0,  68,  33, 
-      0,   0,  52,   0,   0, 128, 
-     68,  33,   0,   0,  52,   0, 
-      0,   0,  88,  33,   0,   0, 
-     52,   0,   0, 128,  88,  33, 
-      0,   0,  52,   0,   0,   0, 
-     92,  33,   0,   0,  52,   0, 
-      0, 128,  92,  33,   0,   0, 
-     52,   0,   0,   0,  96,  33, 
-      0,   0,  52,   0,   0, 128, 
-     96,  33,   0,   0,  52,   0, 
-      0,   0, 108,  33,   0,   0, 
-     52,   0,   0, 128, 108,  33, 
-      0,   0,  52,   0,   0,   0, 
-    128,  33,   0,   0,  52,   0, 
-      0, 128, 128,  33,   0,   0, 
-     52,   0,   0,   0, 132,  33, 
-      0,   0,  52,   0,   0, 128, 
-    132,  33,   0,   0,  52,   0, 
-      0,   0, 136,  33,   0,   0, 
-     52,   0,   0, 128, 136,  33, 
-      0,   0,  52,   0,   0,   0, 
-    140,  33,   0,   0,  52,   0, 
-      0, 128, 140,  33,   0,   0, 
-     52,   0,   0,   0, 152,  33, 
-      0,   0,  55,   0,   0, 128, 
-    152,  33,   0,   0,  55,   0, 
-      0,   0, 172,  33,   0,   0, 
-     56,   0,   0, 128, 172,  33, 
-      0,   0,  56,   0,   0,   0, 
-    192,  33,   0,   0,  57,   0, 
-      0, 128, 192,  33,   0,   0, 
-     57,   0,   0,   0, 212,  33, 
-      0,   0,  58,   0,   0, 128, 
-    212,  33,   0,   0,  58,   0, 
-      0,   0, 240,  33,   0,   0, 
-     58,   0,   0, 128, 240,  33, 
-      0,   0,  58,   0,   0,   0, 
-    252,  33,   0,   0,  60,   0, 
-      0, 128, 252,  33,   0,   0, 
-     60,   0,   0,   0,  16,  34, 
-      0,   0,  61,   0,   0, 128, 
-     16,  34,   0,   0,  61,   0, 
-      0,   0,  20,  34,   0,   0, 
-     62,   0,   0, 128,  20,  34, 
-      0,   0,  62,   0,   0,   0, 
-     56,  34,   0,   0,  62,   0, 
-      0, 128,  56,  34,   0,   0, 
-     62,   0,   0,   0,  92,  34, 
-      0,   0,  63,   0,   0, 128, 
-     92,  34,   0,   0,  63,   0, 
-      0,   0, 120,  34,   0,   0, 
-     64,   0,   0, 128, 120,  34, 
-      0,   0,  64,   0,   0,   0, 
-    124,  34,   0,   0,  65,   0, 
-      0, 128, 124,  34,   0,   0, 
-     65,   0,   0,   0,  19,   0, 
-     44,   0,  19,   0,  44,   0, 
-     19,   0,  44,   0,  19,   0, 
-     44,   0,   5,   0, 109,   0, 
-     24,   0,  89,   0,   5,   0, 
-    109,   0,  24,   0, 108,   0, 
-      5,   0,  92,   0,  23,   0, 
-     91,   0,   5,   0,  92,   0, 
-     23,   0,  91,   0,   5,   0, 
-     92,   0,  23,   0,  91,   0, 
-      5,   0,  92,   0,  23,   0, 
-     91,   0,   5,   0,  92,   0, 
-     23,   0,  91,   0,   5,   0, 
-     92,   0,  23,   0,  91,   0, 
-      5,   0,  92,   0,  23,   0, 
-     91,   0,   5,   0,  92,   0, 
-     23,   0,  91,   0,   5,   0, 
-     92,   0,  23,   0,  91,   0, 
-      5,   0,  92,   0,  23,   0, 
-     91,   0,   5,   0,  92,   0, 
-     23,   0,  91,   0,   5,   0, 
-     92,   0,  12,   0,  91,   0, 
-      5,   0,  77,   0,  57,   0, 
-     75,   0,   5,   0,  77,   0, 
-     57,   0,  75,   0,   5,   0, 
-     77,   0,  57,   0,  75,   0, 
-      5,   0,  77,   0,  21,   0, 
-     76,   0,   5,   0,  77,   0, 
-     21,   0,  76,   0,   5,   0, 
-     77,   0,  21,   0,  76,   0, 
-      5,   0,  77,   0,  21,   0, 
-     76,   0,   5,   0,  77,   0, 
-     21,   0,  76,   0,   5,   0, 
-     56,   0,  12,   0,  55,   0, 
-      5,   0,  29,   0,  21,   0, 
-     28,   0,   5,   0,  29,   0, 
-     21,   0,  28,   0,   5,   0, 
-     29,   0,  21,   0,  28,   0, 
-      5,   0,  29,   0,  21,   0, 
-     28,   0,   5,   0,  29,   0, 
-     21,   0,  28,   0,   5,   0, 
-     29,   0,  21,   0,  28,   0, 
-      5,   0,  29,   0,  21,   0, 
-     28,   0,   5,   0,  29,   0, 
-     21,   0,  28,   0,   5,   0, 
-     29,   0,  21,   0,  28,   0, 
-      5,   0,  29,   0,  21,   0, 
-     28,   0,   5,   0,  29,   0, 
-     21,   0,  28,   0,   5,   0, 
-     29,   0,  21,   0,  28,   0, 
-      5,   0,  29,   0,  21,   0, 
-     28,   0,   5,   0,  29,   0, 
-     21,   0,  28,   0,   5,   0, 
-     29,   0,  21,   0,  28,   0, 
-      5,   0,  20,   0,  10,   0, 
-     19,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      9,   0,  70,   0,   5,   0, 
-     71,   0,   9,   0,  70,   0, 
-      5,   0,  71,   0,   9,   0, 
-     70,   0,   5,   0,  71,   0, 
-      5,   0,  71,   0,   9,   0, 
-     32,   0,   9,   0,  31,   0, 
-      9,   0,  20,   0,   9,   0, 
-     19,   0,   9,   0,  37,   0, 
-     13,   0,  36,   0,   9,   0, 
-     21,   0,   9,   0,  20,   0, 
-      9,   0,  21,   0,   9,   0, 
-     20,   0,   9,   0,  33,   0, 
-      9,   0,  32,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   9,   0,  72,   0, 
-      5,   0,  73,   0,   9,   0, 
-     72,   0,   5,   0,  73,   0, 
-      9,   0,  72,   0,   5,   0, 
-     73,   0,   5,   0,  73,   0, 
-      9,   0,  33,   0,   9,   0, 
-     32,   0,   9,   0,  20,   0, 
-      9,   0,  19,   0,   9,   0, 
-     42,   0,  18,   0,  41,   0, 
-      9,   0,  24,   0,  13,   0, 
-     23,   0,   9,   0,  24,   0, 
-      9,   0,  24,   0,  13,   0, 
-     23,   0,  13,   0,  22,   0, 
-      9,   0,   9,   0,   9,   0, 
-      9,   0,   9,   0,  21,   0, 
-      9,   0,  20,   0,   9,   0, 
-     21,   0,   9,   0,  20,   0, 
-      9,   0,  33,   0,   9,   0, 
-     32,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,   1,   0, 
-      1,   0,   1,   0,   1,   0, 
-    246,   0,   0,   0,  52,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,  16,   0,   0,  24,   0, 
-      0,   0,  42,   0,   0,   0, 
-      0,   0,   0,   0,   1,  16, 
-      0,   0,  24,   0,   0,   0, 
-     47,   0,   0,   0,   0,   0, 
-      0,   0,   1,  16,   0,   0, 
-     24,   0,   0,   0,  47,   0, 
-      0,   0,   0,   0,   0,   0, 
-     36,   0,   0,   0,   0,   0, 
-      0,   0,  20,   0,   0,   0, 
-     64,   0,   0,   0, 104,   0, 
-      0,   0, 140,   0,   0,   0, 
-    168,   0,   0,   0, 200,   0, 
-      0,   0, 228,   0,   0,   0, 
-     16,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     14,   0,   8,  16,  16,  16, 
-      0,   0,  23,   0,   4,   0, 
-     15,  16,   0,   0,  30,   0, 
-     28,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,   4,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,  64,   0, 102, 108, 111, 
-     97, 116,  52, 120,  52,   0, 
-     10,   0,  24,  21,  18,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,  19,  16, 
-      0,   0,   1,   0,   0,   2, 
-     10,   0,  24,  21,  11,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,  21,  16, 
-      0,   0,   1,   0,   0,   2, 
-     10,   0,  24,  21,  64,   0, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,  23,  16, 
-      0,   0,   1,   0,   0,   2, 
-    126,   0,   3,  18,  13,  21, 
-      3,   0,   5,  16,   0,   0, 
-      0,   0,  76, 101, 102, 116, 
-     77, 105, 110,   0, 242, 241, 
-     13,  21,   3,   0,   5,  16, 
-      0,   0,  16,   0,  76, 101, 
-    102, 116,  77,  97, 120,   0, 
-    242, 241,  13,  21,   3,   0, 
-      5,  16,   0,   0,  32,   0, 
-     82, 105, 103, 104, 116,  77, 
-    105, 110,   0, 241,  13,  21, 
-      3,   0,   5,  16,   0,   0, 
-     48,   0,  82, 105, 103, 104, 
-    116,  77,  97, 120,   0, 241, 
-     13,  21,   3,   0, 116,   0, 
-      0,   0,  60,   0,  76, 101, 
-    102, 116,  73, 110, 100, 101, 
-    120,   0,  13,  21,   3,   0, 
-    116,   0,   0,   0,  64,   0, 
-     82, 105, 103, 104, 116,  73, 
-    110, 100, 101, 120,   0, 243, 
-    242, 241,  30,   0,   5,  21, 
-      6,   0,   0,   0,  25,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  68,   0, 
-     65,  97,  98,  98,  78, 111, 
-    100, 101,   0, 241,  14,   0, 
-     23,  21,  26,  16,   0,   0, 
-     26,   2,   0,   0,   0,   0, 
-    242, 241,  10,   0,  24,  21, 
-     27,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     28,  16,   0,   0,   1,   0, 
-      0,   2,  14,   0,  23,  21, 
-    116,   0,   0,   0,  20,   2, 
-      0,   0,   0,   0, 242, 241, 
-     10,   0,  24,  21,  30,  16, 
-      0,   0,   1,   0,   0,   2, 
-     14,   0,  23,  21,   9,  16, 
-      0,   0,  27,   2,   0,   0, 
-      0,   0, 242, 241,  10,   0, 
-     24,  21,  32,  16,   0,   0, 
-      1,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,  34,  16,   0,   0, 
-     64,   3,   0,   0,  11,   0, 
-    255, 255,   4,   0,   0,   0, 
-      3, 128,   0,   0,   0,   0, 
-      0,   0, 136,   0,   0,   0, 
-    136,   0,   0,   0,   8,   0, 
-      0,   0, 144,   0,   0,   0, 
-      0,   0,   0,   0,  18,   0, 
-     27,  21, 117,   0,   0,   0, 
-      3,   0,   0,   0,  12,   0, 
-    117, 105, 110, 116,  51,   0, 
-     18,   0,   1,  18,   3,   0, 
-      0,   0,   0,  16,   0,   0, 
-      0,  16,   0,   0,   0,  16, 
-      0,   0,  10,   0,  24,  21, 
-      3,   0,   0,   0,   1,   0, 
-      1,   0,  14,   0,   8,  16, 
-      2,  16,   0,   0,  23,   0, 
-      3,   0,   1,  16,   0,   0, 
-     18,   0,  27,  21, 117,   0, 
-      0,   0,   2,   0,   0,   0, 
-      8,   0, 117, 105, 110, 116, 
-     50,   0,  22,   0,  27,  21, 
-     64,   0,   0,   0,   3,   0, 
-      0,   0,  12,   0, 102, 108, 
-    111,  97, 116,  51,   0, 243, 
-    242, 241, 126,   0,   3,  18, 
-     13,  21,   3,   0,   5,  16, 
-      0,   0,   0,   0,  76, 101, 
-    102, 116,  77, 105, 110,   0, 
-    242, 241,  13,  21,   3,   0, 
-      5,  16,   0,   0,  12,   0, 
-     76, 101, 102, 116,  77,  97, 
-    120,   0, 242, 241,  13,  21, 
-      3,   0,   5,  16,   0,   0, 
-     24,   0,  82, 105, 103, 104, 
-    116,  77, 105, 110,   0, 241, 
-     13,  21,   3,   0,   5,  16, 
-      0,   0,  36,   0,  82, 105, 
-    103, 104, 116,  77,  97, 120, 
-      0, 241,  13,  21,   3,   0, 
-    116,   0,   0,   0,  48,   0, 
-     76, 101, 102, 116,  73, 110, 
-    100, 101, 120,   0,  13,  21, 
-      3,   0, 116,   0,   0,   0, 
-     52,   0,  82, 105, 103, 104, 
-    116,  73, 110, 100, 101, 120, 
-      0, 243, 242, 241,  30,   0, 
-      5,  21,   6,   0,   0,   0, 
-      6,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     56,   0,  65,  97,  98,  98, 
-     78, 111, 100, 101,   0, 241, 
-     34,   0,   3,  18,  13,  21, 
-      3,   0, 116,   0,   0,   0, 
-      0,   0,  78, 111, 100, 101, 
-      0, 241,  13,  21,   3,   0, 
-    116,   0,   0,   0,   4,   0, 
-     78, 101, 120, 116,   0, 241, 
-     26,   0,   5,  21,   2,   0, 
-      0,   0,   8,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   8,   0,  84,  97, 
-    115, 107,   0, 241,  10,   0, 
-     24,  21, 117,   0,   0,   0, 
-      1,   0,   1,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      2,   0,   0,   0,   8,   0, 
-    102, 108, 111,  97, 116,  50, 
-      0, 243, 242, 241,  18,   0, 
-      1,  18,   3,   0,   0,   0, 
-      4,  16,   0,   0,  11,  16, 
-      0,   0,  64,   0,   0,   0, 
-     10,   0,  24,  21,   5,  16, 
-      0,   0,   1,   0,   1,   0, 
-     14,   0,   8,  16,  13,  16, 
-      0,   0,  23,   0,   3,   0, 
-     12,  16,   0,   0,  22,   0, 
-      1,  18,   4,   0,   0,   0, 
-      5,  16,   0,   0,   5,  16, 
-      0,   0,   5,  16,   0,   0, 
-      5,  16,   0,   0,  10,   0, 
-     24,  21,  98,   0,   0,   0, 
-      1,   0,   1,   0, 220,  80, 
-      0,   0, 166,  76,   0,   0, 
-      0,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    114, 101,  97, 100,  73,  68, 
-     44,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  51, 
-     32,  71, 114, 111, 117, 112, 
-     73,  68,  32,  58,  32,  83, 
-     86,  95,  71, 114, 111, 117, 
-    112,  73,  68,  44,  13,  10, 
-     32,  32,  32,  32, 117, 105, 
-    110, 116,  51,  32,  68, 105, 
-    115, 112,  97, 116,  99, 104, 
-     84, 104, 114, 101,  97, 100, 
-     73,  68,  32,  58,  32,  83, 
-     86,  95,  68, 105, 115, 112, 
-     97, 116,  99, 104,  84, 104, 
-    114, 101,  97, 100,  73,  68, 
-     41,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  68, 101, 116, 101, 114, 
-    109, 105, 110, 101,  32, 119, 
-    104, 105,  99, 104,  32, 112, 
-    105, 120, 101, 108,  32, 119, 
-    101,  32,  97, 114, 101,  13, 
-     10,  32,  32,  32,  32, 117, 
-    105, 110, 116,  50,  32, 112, 
-    105, 120, 101, 108,  67, 111, 
-    111, 114, 100,  32,  61,  32, 
-     71, 114, 111, 117, 112,  73, 
-     68,  46, 120, 121,  32,  42, 
-     32, 117, 105, 110, 116,  50, 
-     40,  78,  85,  77,  95,  80, 
-     73,  88,  69,  76,  83,  95, 
-     80,  69,  82,  95,  71,  82, 
-     79,  85,  80,  95,  88,  44, 
-     32,  78,  85,  77,  95,  80, 
-     73,  88,  69,  76,  83,  95, 
-     80,  69,  82,  95,  71,  82, 
-     79,  85,  80,  95,  89,  41, 
-     32,  43,  32,  71, 114, 111, 
-    117, 112,  84, 104, 114, 101, 
-     97, 100,  73,  68,  46, 120, 
-    121,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  71, 101, 116,  32, 108, 
-    111,  99,  97, 108,  32, 114, 
-     97, 121,  32, 102, 111, 114, 
-     32, 116, 104, 105, 115,  32, 
-    112, 105, 120, 101, 108,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    108, 111,  99,  97, 108,  82, 
-     97, 121,  32,  61,  32,  76, 
-    111,  99,  97, 108,  82,  97, 
-    121,  70, 114, 111, 109,  80, 
-    105, 120, 101, 108,  67, 111, 
-    111, 114, 100,  40, 112, 105, 
-    120, 101, 108,  67, 111, 111, 
-    114, 100,  44,  32,  72,  97, 
-    108, 102,  86, 105, 101, 119, 
-    112, 111, 114, 116,  83, 105, 
-    122, 101,  44,  32,  68, 105, 
-    115, 116,  84, 111,  80, 114, 
-    111, 106,  80, 108,  97, 110, 
-    101,  41,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  84, 114,  97, 110, 
-    115, 102, 111, 114, 109,  32, 
-    116, 111,  32, 119, 111, 114, 
-    108, 100,  32, 115, 112,  97, 
-     99, 101,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 114,  97, 121, 
-     68, 105, 114,  32,  61,  32, 
-    109, 117, 108,  40,  40, 102, 
-    108, 111,  97, 116,  51, 120, 
-     51,  41,  67,  97, 109, 101, 
-    114,  97,  87, 111, 114, 108, 
-    100,  84, 114,  97, 110, 115, 
-    102, 111, 114, 109,  44,  32, 
-    110, 111, 114, 109,  97, 108, 
-    105, 122, 101,  40, 108, 111, 
-     99,  97, 108,  82,  97, 121, 
-     41,  41,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  85, 115, 101,  32, 
-     99,  97, 109, 101, 114,  97, 
-     32, 112, 111, 115, 105, 116, 
-    105, 111, 110,  32,  97, 115, 
-     32, 114,  97, 121,  32, 115, 
-    116,  97, 114, 116,  32, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 114,  97, 121,  83, 
-    116,  97, 114, 116,  32,  61, 
-     32,  67,  97, 109, 101, 114, 
-     97,  87, 111, 114, 108, 100, 
-     84, 114,  97, 110, 115, 102, 
-    111, 114, 109,  46,  95, 109, 
-     48,  51,  95, 109,  49,  51, 
-     95, 109,  50,  51,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32,  47,  47,  32,  82,  97, 
-    121,  32, 116, 114,  97,  99, 
-    101,  32,  97, 103,  97, 105, 
-    110, 115, 116,  32, 114, 111, 
-    111, 116,  32, 110, 111, 100, 
-    101,  39, 115,  32,  99, 104, 
-    105, 108, 100, 114, 101, 110, 
-     46,  13,  10,  32,  32,  32, 
-     32,  47,  47,  32,  73, 102, 
-     32, 110, 111,  32, 104, 105, 
-    116,  44,  32, 119, 101,  39, 
-    114, 101,  32, 100, 111, 110, 
-    101,  46,  13,  10,  32,  32, 
-     32,  32,  47,  47,  32,  73, 
-    102,  32, 101, 105, 116, 104, 
-    101, 114,  32, 115, 105, 100, 
-    101,  32, 104, 105, 116, 115, 
-     44,  32,  97, 112, 112, 101, 
-    110, 100,  32, 116, 111,  32, 
-     84,  97, 115, 107, 115,  32, 
-    108, 105, 115, 116,  32,  97, 
-    110, 100,  32, 117, 112, 100, 
-     97, 116, 101,  32, 104, 101, 
-     97, 100,  32, 105, 110, 100, 
-    101, 120,  32, 102, 111, 114, 
-     32, 116, 104, 105, 115,  32, 
-    112, 105, 120, 101, 108,  13, 
-     10,  32,  32,  32,  32,  65, 
-     97,  98,  98,  78, 111, 100, 
-    101,  32, 110, 111, 100, 101, 
-     32,  61,  32,  78, 111, 100, 
-    101, 115,  91,  48,  93,  59, 
-     13,  10,  32,  32,  32,  32, 
-    117, 105, 110, 116,  32, 105, 
-     32,  61,  32,  48, 120, 102, 
-    102, 102, 102,  59,  13,  10, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40,  82,  97, 121,  65, 
-     97,  98,  98,  73, 110, 116, 
-    101, 114, 115, 101,  99, 116, 
-     40, 114,  97, 121,  83, 116, 
-     97, 114, 116,  44,  32, 114, 
-     97, 121,  68, 105, 114,  44, 
-     32, 110, 111, 100, 101,  46, 
-     76, 101, 102, 116,  77, 105, 
-    110,  44,  32, 110, 111, 100, 
-    101,  46,  76, 101, 102, 116, 
-     77,  97, 120,  41,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  84,  97, 
-    115, 107,  32, 116,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 116,  46,  78, 
-    111, 100, 101,  32,  61,  32, 
-    110, 111, 100, 101,  46,  76, 
-    101, 102, 116,  73, 110, 100, 
-    101, 120,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 116,  46,  78, 101, 120, 
-    116,  32,  61,  32,  45,  49, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 105, 
-     32,  61,  32,  84,  97, 115, 
-    107, 115,  46,  73, 110,  99, 
-    114, 101, 109, 101, 110, 116, 
-     67, 111, 117, 110, 116, 101, 
-    114,  40,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  84,  97, 115, 107, 
-    115,  91, 105,  93,  32,  61, 
-     32, 116,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  84,  97, 115, 107,  72, 
-    101,  97, 100,  91, 112, 105, 
-    120, 101, 108,  67, 111, 111, 
-    114, 100,  93,  32,  61,  32, 
-    105,  59,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40,  82,  97, 121,  65,  97, 
-     98,  98,  73, 110, 116, 101, 
-    114, 115, 101,  99, 116,  40, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,  44,  32, 114,  97, 
-    121,  68, 105, 114,  44,  32, 
-    110, 111, 100, 101,  46,  82, 
-    105, 103, 104, 116,  77, 105, 
-    110,  44,  32, 110, 111, 100, 
-    101,  46,  82, 105, 103, 104, 
-    116,  77,  97, 120,  41,  41, 
-     13,  10,  32,  32,  32,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  84, 
-     97, 115, 107,  32, 116,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 116,  46, 
-     78, 111, 100, 101,  32,  61, 
-     32, 110, 111, 100, 101,  46, 
-     82, 105, 103, 104, 116,  73, 
-    110, 100, 101, 120,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 116,  46,  78, 
-    101, 120, 116,  32,  61,  32, 
-     45,  49,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    106,  32,  61,  32,  84,  97, 
-    115, 107, 115,  46,  73, 110, 
-     99, 114, 101, 109, 101, 110, 
-    116,  67, 111, 117, 110, 116, 
-    101, 114,  40,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40, 105,  32,  33,  61,  32, 
-     48, 120, 102, 102, 102, 102, 
-     41,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 116,  46,  78, 101, 
-    120, 116,  32,  61,  32, 105, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 125, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  84,  97, 
-    115, 107, 115,  91, 106,  93, 
-     32,  61,  32, 116,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  84,  97, 115, 
-    107,  72, 101,  97, 100,  91, 
-    112, 105, 120, 101, 108,  67, 
-    111, 111, 114, 100,  93,  32, 
-     61,  32, 106,  59,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10, 125,  13,  10,   0,  47, 
-     47,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  13,  10,  47,  47,  32, 
-     67, 111, 109, 109, 111, 110, 
-     32, 115, 116, 114, 117,  99, 
-    116, 115,  32,  97, 110, 100, 
-     32, 104, 101, 108, 112, 101, 
-    114,  32, 102, 117, 110,  99, 
-    116, 105, 111, 110, 115,  46, 
-     13,  10,  47,  47,  32,  82, 
-    101, 122,  97,  32,  78, 111, 
-    117, 114,  97, 105,  13,  10, 
-     47,  47,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  13,  10,  13,  10, 
-     47,  47,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  13,  10,  47,  47, 
-     32,  68,  97, 116,  97,  32, 
-    115, 116, 114, 117,  99, 116, 
-    117, 114, 101, 115,  13,  10, 
-     47,  47,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  13,  10,  13,  10, 
-     47,  47,  32,  85, 115, 101, 
-    100,  32, 116, 111,  32,  99, 
-    111, 109, 112, 117, 116, 101, 
-     32, 112, 114, 105, 109,  97, 
-    114, 121,  32, 101, 121, 101, 
-     32, 114,  97, 121, 115,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  67,  97, 109, 
-    101, 114,  97,  68,  97, 116, 
-     97,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52, 120,  52, 
-     32,  67,  97, 109, 101, 114, 
-     97,  87, 111, 114, 108, 100, 
-     84, 114,  97, 110, 115, 102, 
-    111, 114, 109,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32,  72, 
-     97, 108, 102,  86, 105, 101, 
-    119, 112, 111, 114, 116,  83, 
-    105, 122, 101,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  68, 105, 
-    115, 116,  84, 111,  80, 114, 
-    111, 106,  80, 108,  97, 110, 
-    101,  59,  13,  10, 125,  59, 
-     13,  10,  13,  10,  47,  47, 
-     32,  65,  32, 110, 111, 100, 
-    101,  32, 105, 110,  32, 116, 
-    104, 101,  32,  65,  65,  66, 
-     66,  32,  98, 111, 117, 110, 
-    100, 105, 110, 103,  32, 118, 
-    111, 108, 117, 109, 101,  32, 
-    104, 105, 101, 114,  97, 114, 
-     99, 104, 121,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     65,  97,  98,  98,  78, 111, 
-    100, 101,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     76, 101, 102, 116,  77, 105, 
-    110,  44,  32,  76, 101, 102, 
-    116,  77,  97, 120,  59,  32, 
-     32,  32,  32,  47,  47,  32, 
-     65,  65,  66,  66,  32, 111, 
-    102,  32, 108, 101, 102, 116, 
-     32,  99, 104, 105, 108, 100, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  82, 105, 103, 104, 116, 
-     77, 105, 110,  44,  32,  82, 
-    105, 103, 104, 116,  77,  97, 
-    120,  59,  32,  32,  47,  47, 
-     32,  65,  65,  66,  66,  32, 
-    111, 102,  32, 114, 105, 103, 
-    104, 116,  32,  99, 104, 105, 
-    108, 100,  13,  10,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  73, 110, 100, 101, 120, 
-     32, 111, 102,  32, 108, 101, 
-    102, 116,  32,  38,  32, 114, 
-    105, 103, 104, 116,  32,  99, 
-    104, 105, 108, 100,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  62,  61,  32,  48,  32, 
-    109, 101,  97, 110, 115,  32, 
-    110, 111, 100, 101,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  60,  32,  48,  32, 109, 
-    101,  97, 110, 115,  32, 111, 
-     98, 106, 101,  99, 116,  44, 
-     32,  99, 111, 109, 112, 117, 
-    116, 101,  32, 111,  98, 106, 
-    101,  99, 116,  32, 105, 110, 
-    100, 101, 120,  32,  98, 121, 
-     32,  45,  40, 105,  43,  49, 
-     41,  13,  10,  32,  32,  32, 
-     32, 105, 110, 116,  32,  76, 
-    101, 102, 116,  73, 110, 100, 
-    101, 120,  44,  32,  82, 105, 
-    103, 104, 116,  73, 110, 100, 
-    101, 120,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10,  47, 
-     47,  32,  84,  97, 115, 107, 
-     32, 110, 111, 100, 101,  32, 
-    105, 110,  32, 112, 101, 114, 
-     45, 112, 105, 120, 101, 108, 
-     32, 108, 105, 110, 107, 101, 
-    100,  32, 108, 105, 115, 116, 
-     13,  10, 115, 116, 114, 117, 
-     99, 116,  32,  84,  97, 115, 
-    107,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 105, 110, 
-    116,  32,  78, 111, 100, 101, 
-     59,  13,  10,  32,  32,  32, 
-     32, 105, 110, 116,  32,  78, 
-    101, 120, 116,  59,  13,  10, 
-    125,  59,  13,  10,  13,  10, 
-     47,  47,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  13,  10,  47,  47, 
-     32,  72, 101, 108, 112, 101, 
-    114,  32, 102, 117, 110,  99, 
-    116, 105, 111, 110, 115,  13, 
-     10,  47,  47,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  61,  61,  61, 
-     61,  61,  61,  13,  10,  13, 
-     10, 102, 108, 111,  97, 116, 
-     51,  32,  76, 111,  99,  97, 
-    108,  82,  97, 121,  70, 114, 
-    111, 109,  80, 105, 120, 101, 
-    108,  67, 111, 111, 114, 100, 
-     40, 117, 105, 110, 116,  50, 
-     32, 112, 105, 120, 101, 108, 
-     67, 111, 111, 114, 100,  44, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32, 104,  97, 108, 102, 
-     86, 105, 101, 119, 112, 111, 
-    114, 116,  83, 105, 122, 101, 
-     44,  32, 102, 108, 111,  97, 
-    116,  32, 100, 105, 115, 116, 
-     84, 111,  80, 114, 111, 106, 
-     80, 108,  97, 110, 101,  41, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  51,  40,  40, 
-    102, 108, 111,  97, 116,  41, 
-    112, 105, 120, 101, 108,  67, 
-    111, 111, 114, 100,  46, 120, 
-     32,  45,  32, 104,  97, 108, 
-    102,  86, 105, 101, 119, 112, 
-    111, 114, 116,  83, 105, 122, 
-    101,  46, 120,  44,  32, 104, 
-     97, 108, 102,  86, 105, 101, 
-    119, 112, 111, 114, 116,  83, 
-    105, 122, 101,  46, 121,  32, 
-     45,  32,  40, 102, 108, 111, 
-     97, 116,  41, 112, 105, 120, 
-    101, 108,  67, 111, 111, 114, 
-    100,  46, 121,  44,  32, 100, 
-    105, 115, 116,  84, 111,  80, 
-    114, 111, 106,  80, 108,  97, 
-    110, 101,  41,  59,  13,  10, 
-    125,  13,  10,  13,  10,  98, 
-    111, 111, 108,  32,  82,  97, 
-    121,  65,  97,  98,  98,  73, 
-    110, 116, 101, 114, 115, 101, 
-     99, 116,  40, 102, 108, 111, 
-     97, 116,  51,  32, 114,  97, 
-    121,  83, 116,  97, 114, 116, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  32, 114,  97, 121, 
-     68, 105, 114,  44,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     97,  97,  98,  98,  77, 105, 
-    110,  44,  32, 102, 108, 111, 
-     97, 116,  51,  32,  97,  97, 
-     98,  98,  77,  97, 120,  41, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 104,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    112,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  67, 104, 101,  99, 107, 
-     32, 120,  13,  10,  32,  32, 
-     32,  32, 105, 102,  32,  40, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,  46, 120,  32,  60, 
-     32,  97,  97,  98,  98,  77, 
-    105, 110,  46, 120,  32,  38, 
-     38,  32, 114,  97, 121,  68, 
-    105, 114,  46, 120,  32,  62, 
-     32,  48,  41,  13,  10,  32, 
-     32,  32,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 104,  32,  61,  32, 
-     40,  97,  97,  98,  98,  77, 
-    105, 110,  46, 120,  32,  45, 
-     32, 114,  97, 121,  83, 116, 
-     97, 114, 116,  46, 120,  41, 
-     32,  47,  32, 100, 111, 116, 
-     40, 102, 108, 111,  97, 116, 
-     51,  40,  49,  44,  32,  48, 
-     44,  32,  48,  41,  44,  32, 
-    114,  97, 121,  68, 105, 114, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    112,  32,  61,  32, 114,  97, 
-    121,  83, 116,  97, 114, 116, 
-     32,  43,  32, 114,  97, 121, 
-     68, 105, 114,  32,  42,  32, 
-    104,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    105, 102,  32,  40, 112,  46, 
-    121,  32,  62,  61,  32,  97, 
-     97,  98,  98,  77, 105, 110, 
-     46, 121,  32,  38,  38,  32, 
-    112,  46, 121,  32,  60,  61, 
-     32,  97,  97,  98,  98,  77, 
-     97, 120,  46, 121,  32,  38, 
-     38,  32, 112,  46, 122,  32, 
-     62,  61,  32,  97,  97,  98, 
-     98,  77, 105, 110,  46, 122, 
-     32,  38,  38,  32, 112,  46, 
-    122,  32,  60,  61,  32,  97, 
-     97,  98,  98,  77,  97, 120, 
-     46, 122,  41,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 116, 
-    114, 117, 101,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 125,  13,  10,  32, 
-     32,  32,  32, 125,  13,  10, 
-     32,  32,  32,  32, 101, 108, 
-    115, 101,  32, 105, 102,  32, 
-     40, 114,  97, 121,  83, 116, 
-     97, 114, 116,  46, 120,  32, 
-     62,  32,  97,  97,  98,  98, 
-     77,  97, 120,  46, 120,  32, 
-     38,  38,  32, 114,  97, 121, 
-     68, 105, 114,  46, 120,  32, 
-     60,  32,  48,  41,  13,  10, 
-     32,  32,  32,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 104,  32,  61, 
-     32,  40, 114,  97, 121,  83, 
-    116,  97, 114, 116,  46, 120, 
-     32,  45,  32,  97,  97,  98, 
-     98,  77,  97, 120,  46, 120, 
-     41,  32,  47,  32, 100, 111, 
-    116,  40, 102, 108, 111,  97, 
-    116,  51,  40,  45,  49,  44, 
-     32,  48,  44,  32,  48,  41, 
-     44,  32, 114,  97, 121,  68, 
-    105, 114,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 112,  32,  61,  32, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,  32,  43,  32, 114, 
-     97, 121,  68, 105, 114,  32, 
-     42,  32, 104,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 105, 102,  32,  40, 
-    112,  46, 121,  32,  62,  61, 
-     32,  97,  97,  98,  98,  77, 
-    105, 110,  46, 121,  32,  38, 
-     38,  32, 112,  46, 121,  32, 
-     60,  61,  32,  97,  97,  98, 
-     98,  77,  97, 120,  46, 121, 
-     32,  38,  38,  32, 112,  46, 
-    122,  32,  62,  61,  32,  97, 
-     97,  98,  98,  77, 105, 110, 
-     46, 122,  32,  38,  38,  32, 
-    112,  46, 122,  32,  60,  61, 
-     32,  97,  97,  98,  98,  77, 
-     97, 120,  46, 122,  41,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 116, 114, 117, 101,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 125,  13, 
-     10,  32,  32,  32,  32, 125, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32,  47,  47,  32,  67, 
-    104, 101,  99, 107,  32, 121, 
-     13,  10,  32,  32,  32,  32, 
-    105, 102,  32,  40, 114,  97, 
-    121,  83, 116,  97, 114, 116, 
-     46, 121,  32,  60,  32,  97, 
-     97,  98,  98,  77, 105, 110, 
-     46, 121,  32,  38,  38,  32, 
-    114,  97, 121,  68, 105, 114, 
-     46, 121,  32,  62,  32,  48, 
-     41,  13,  10,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    104,  32,  61,  32,  40,  97, 
-     97,  98,  98,  77, 105, 110, 
-     46, 121,  32,  45,  32, 114, 
-     97, 121,  83, 116,  97, 114, 
-    116,  46, 121,  41,  32,  47, 
-     32, 100, 111, 116,  40, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  44,  32,  49,  44,  32, 
-     48,  41,  44,  32, 114,  97, 
-    121,  68, 105, 114,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 112,  32, 
-     61,  32, 114,  97, 121,  83, 
-    116,  97, 114, 116,  32,  43, 
-     32, 114,  97, 121,  68, 105, 
-    114,  32,  42,  32, 104,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40, 112,  46, 120,  32, 
-     62,  61,  32,  97,  97,  98, 
-     98,  77, 105, 110,  46, 120, 
-     32,  38,  38,  32, 112,  46, 
-    120,  32,  60,  61,  32,  97, 
-     97,  98,  98,  77,  97, 120, 
-     46, 120,  32,  38,  38,  32, 
-    112,  46, 122,  32,  62,  61, 
-     32,  97,  97,  98,  98,  77, 
-    105, 110,  46, 122,  32,  38, 
-     38,  32, 112,  46, 122,  32, 
-     60,  61,  32,  97,  97,  98, 
-     98,  77,  97, 120,  46, 122, 
-     41,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 116, 114, 117, 
-    101,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    125,  13,  10,  32,  32,  32, 
-     32, 125,  13,  10,  32,  32, 
-     32,  32, 101, 108, 115, 101, 
-     32, 105, 102,  32,  40, 114, 
-     97, 121,  83, 116,  97, 114, 
-    116,  46, 121,  32,  62,  32, 
-     97,  97,  98,  98,  77,  97, 
-    120,  46, 121,  32,  38,  38, 
-     32, 114,  97, 121,  68, 105, 
-    114,  46, 121,  32,  60,  32, 
-     48,  41,  13,  10,  32,  32, 
-     32,  32, 123,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 104,  32,  61,  32,  40, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,  46, 121,  32,  45, 
-     32,  97,  97,  98,  98,  77, 
-     97, 120,  46, 121,  41,  32, 
-     47,  32, 100, 111, 116,  40, 
-    102, 108, 111,  97, 116,  51, 
-     40,  48,  44,  32,  45,  49, 
-     44,  32,  48,  41,  44,  32, 
-    114,  97, 121,  68, 105, 114, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    112,  32,  61,  32, 114,  97, 
-    121,  83, 116,  97, 114, 116, 
-     32,  43,  32, 114,  97, 121, 
-     68, 105, 114,  32,  42,  32, 
-    104,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    105, 102,  32,  40, 112,  46, 
-    120,  32,  62,  61,  32,  97, 
-     97,  98,  98,  77, 105, 110, 
-     46, 120,  32,  38,  38,  32, 
-    112,  46, 120,  32,  60,  61, 
-     32,  97,  97,  98,  98,  77, 
-     97, 120,  46, 120,  32,  38, 
-     38,  32, 112,  46, 122,  32, 
-     62,  61,  32,  97,  97,  98, 
-     98,  77, 105, 110,  46, 122, 
-     32,  38,  38,  32, 112,  46, 
-    122,  32,  60,  61,  32,  97, 
-     97,  98,  98,  77,  97, 120, 
-     46, 122,  41,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 116, 
-    114, 117, 101,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 125,  13,  10,  32, 
-     32,  32,  32, 125,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47,  32,  67, 104, 101, 
-     99, 107,  32, 122,  13,  10, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40, 114,  97, 121,  83, 
-    116,  97, 114, 116,  46, 122, 
-     32,  60,  32,  97,  97,  98, 
-     98,  77, 105, 110,  46, 122, 
-     32,  38,  38,  32, 114,  97, 
-    121,  68, 105, 114,  46, 122, 
-     32,  62,  32,  48,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 104,  32, 
-     61,  32,  40,  97,  97,  98, 
-     98,  77, 105, 110,  46, 122, 
-     32,  45,  32, 114,  97, 121, 
-     83, 116,  97, 114, 116,  46, 
-    122,  41,  32,  47,  32, 100, 
-    111, 116,  40, 102, 108, 111, 
-     97, 116,  51,  40,  48,  44, 
-     32,  48,  44,  32,  49,  41, 
-     44,  32, 114,  97, 121,  68, 
-    105, 114,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 112,  32,  61,  32, 
-    114,  97, 121,  83, 116,  97, 
-    114, 116,  32,  43,  32, 114, 
-     97, 121,  68, 105, 114,  32, 
-     42,  32, 104,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 105, 102,  32,  40, 
-    112,  46, 120,  32,  62,  61, 
-     32,  97,  97,  98,  98,  77, 
-    105, 110,  46, 120,  32,  38, 
-     38,  32, 112,  46, 120,  32, 
-     60,  61,  32,  97,  97,  98, 
-     98,  77,  97, 120,  46, 120, 
-     32,  38,  38,  32, 112,  46, 
-    121,  32,  62,  61,  32,  97, 
-     97,  98,  98,  77, 105, 110, 
-     46, 121,  32,  38,  38,  32, 
-    112,  46, 121,  32,  60,  61, 
-     32,  97,  97,  98,  98,  77, 
-     97, 120,  46, 121,  41,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 116, 114, 117, 101,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 125,  13, 
-     10,  32,  32,  32,  32, 125, 
-     13,  10,  32,  32,  32,  32, 
-    101, 108, 115, 101,  32, 105, 
-    102,  32,  40, 114,  97, 121, 
-     83, 116,  97, 114, 116,  46, 
-    122,  32,  62,  32,  97,  97, 
-     98,  98,  77,  97, 120,  46, 
-    122,  32,  38,  38,  32, 114, 
-     97, 121,  68, 105, 114,  46, 
-    122,  32,  60,  32,  48,  41, 
-     13,  10,  32,  32,  32,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 104, 
-     32,  61,  32,  40, 114,  97, 
-    121,  83, 116,  97, 114, 116, 
-     46, 122,  32,  45,  32,  97, 
-     97,  98,  98,  77,  97, 120, 
-     46, 122,  41,  32,  47,  32, 
-    100, 111, 116,  40, 102, 108, 
-    111,  97, 116,  51,  40,  48, 
-     44,  32,  48,  44,  32,  45, 
-     49,  41,  44,  32, 114,  97, 
-    121,  68, 105, 114,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 112,  32, 
-     61,  32, 114,  97, 121,  83, 
-    116,  97, 114, 116,  32,  43, 
-     32, 114,  97, 121,  68, 105, 
-    114,  32,  42,  32, 104,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40, 112,  46, 120,  32, 
-     62,  61,  32,  97,  97,  98, 
-     98,  77, 105, 110,  46, 120, 
-     32,  38,  38,  32, 112,  46, 
-    120,  32,  60,  61,  32,  97, 
-     97,  98,  98,  77,  97, 120, 
-     46, 120,  32,  38,  38,  32, 
-    112,  46, 121,  32,  62,  61, 
-     32,  97,  97,  98,  98,  77, 
-    105, 110,  46, 121,  32,  38, 
-     38,  32, 112,  46, 121,  32, 
-     60,  61,  32,  97,  97,  98, 
-     98,  77,  97, 120,  46, 121, 
-     41,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 116, 114, 117, 
-    101,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    125,  13,  10,  32,  32,  32, 
-     32, 125,  13,  10,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 102, 
-     97, 108, 115, 101,  59,  13, 
-     10, 125,  13,  10,   0,  11, 
-      0,   0,   0,   0,   0,   0, 
-      0,  65,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 129,   9,   0,   0,   0, 
-      0,   0,   0,  66,   0,   0, 
-      0, 130,   0,   0,   0,   1, 
-      0,   0,   0, 190,   0,   0, 
-      0, 250,   0,   0,   0,   7, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,   2,  16,   0,   0, 
-     68,   0,   0,   0,  12,   0, 
-    255, 255,   4,   0,   0,   0, 
-      3, 128,   0,   0,   0,   0, 
-      0,   0,   8,   0,   0,   0, 
-      8,   0,   0,   0,   8,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,  34,   0, 
-      1,  22,   0,   0,   0,   0, 
-     14,  16,   0,   0,  76, 111, 
-     99,  97, 108,  82,  97, 121, 
-     70, 114, 111, 109,  80, 105, 
-    120, 101, 108,  67, 111, 111, 
-    114, 100,   0, 241,  30,   0, 
-      1,  22,   0,   0,   0,   0, 
-     17,  16,   0,   0,  82,  97, 
-    121,  65,  97,  98,  98,  73, 
-    110, 116, 101, 114, 115, 101, 
-     99, 116,   0, 243, 242, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  68,  51, 
-     68,  83,  72,  68,  82,   0, 
-    128,  34,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,  96,   8,   0,   0,   0, 
-      8,   0,   0,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-     34,   0,   1,  22,   0,   0, 
-      0,   0,  14,  16,   0,   0, 
-     76, 111,  99,  97, 108,  82, 
-     97, 121,  70, 114, 111, 109, 
-     80, 105, 120, 101, 108,  67, 
-    111, 111, 114, 100,   0, 241, 
-     30,   0,   1,  22,   0,   0, 
-      0,   0,  17,  16,   0,   0, 
-     82,  97, 121,  65,  97,  98, 
-     98,  73, 110, 116, 101, 114, 
-    115, 101,  99, 116,   0, 243, 
-    242, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,  72,   0,   0,   0, 
-     40,   2,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-    201,   0,   0,   0,   1,   0, 
-      0,   0, 105,   0,   0,   0, 
-      1,   0,   0,   0, 141,   0, 
-      0,   0,   1,   0,   0,   0, 
-     65,   0,   0,   0,   1,   0, 
-      0,   0,  17,   1,   0,   0, 
-      1,   0,   0,   0, 229,   0, 
-      0,   0,   1,   0,   0,   0, 
-    169,   0,   0,   0,   1,   0, 
-      0,   0,  21,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,  32,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0, 128,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  12,   0,   0,   0, 
-     24,   0,   0,   0,  36,   0, 
-      0,   0,  48,   0,   0,   0, 
-     60,   0,   0,   0,  72,   0, 
-      0,   0,  84,   0,   0,   0, 
-     96,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  18,   0, 
-     37,  17,   0,   0,   0,   0, 
-    136,   0,   0,   0,   1,   0, 
-    109,  97, 105, 110,   0,   0, 
-     42,   0,  81,  17,  20,  16, 
-      0,   0,   8,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255,  67,  97, 109, 101, 
-    114,  97,  87, 111, 114, 108, 
-    100,  84, 114,  97, 110, 115, 
-    102, 111, 114, 109,   0,   0, 
-      0,   0,  38,   0,  81,  17, 
-     22,  16,   0,   0,   8,   0, 
-      0,   0,  64,   0, 255, 255, 
-    255, 255, 255, 255,  72,  97, 
-    108, 102,  86, 105, 101, 119, 
-    112, 111, 114, 116,  83, 105, 
-    122, 101,   0,   0,   0,   0, 
-     34,   0,  81,  17,  24,  16, 
-      0,   0,   8,   0,   0,   0, 
-     72,   0, 255, 255, 255, 255, 
-    255, 255,  68, 105, 115, 116, 
-     84, 111,  80, 114, 111, 106, 
-     80, 108,  97, 110, 101,   0, 
-     26,   0,  81,  17,  29,  16, 
-      0,   0,   7,   0, 255, 255, 
-    255, 255,   0,   0, 255, 255, 
-    255, 255,  78, 111, 100, 101, 
-    115,   0,   0,   0,  30,   0, 
-     81,  17,  31,  16,   0,   0, 
-     30,   0, 255, 255, 255, 255, 
-    255, 255, 255, 255,   0,   0, 
-     84,  97, 115, 107,  72, 101, 
-     97, 100,   0,   0,   0,   0, 
-     26,   0,  81,  17,  33,  16, 
-      0,   0,  30,   0, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-      1,   0,  84,  97, 115, 107, 
-    115,   0,   0,   0,  42,   0, 
-     82,  17,  10,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-     78,  85,  77,  95,  80,  73, 
-     88,  69,  76,  83,  95,  80, 
-     69,  82,  95,  71,  82,  79, 
-     85,  80,  95,  88,   0,   0, 
-     42,   0,  82,  17,  10,  16, 
-      0,   0,   0,   0,   0,   0, 
-      4,   0, 255, 255, 255, 255, 
-    255, 255,  78,  85,  77,  95, 
-     80,  73,  88,  69,  76,  83, 
-     95,  80,  69,  82,  95,  71, 
-     82,  79,  85,  80,  95,  89, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  26,   9,  47, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    119,   9,  49,   1,   1,   0, 
-      0,   0,  14,   0,   0, 139, 
-     15,   0, 183, 195,  16,   0, 
-      0,   0,  76,   0,   0,   0, 
-     32,   0,   0,   0,  44,   0, 
-      0,   0, 140,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,   0,   0, 
-     25,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-    128,  34,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,  10,   0, 
-    200,  25,   0,   0,   0,   0, 
-      0,   0,  28,  36,   0,   0, 
-      2,   0,   0,   0,  96,   9, 
-    129,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0, 109,  97, 
-    105, 110,   0, 110, 111, 110, 
-    101,   0,   0,   0,  45, 186, 
-     46, 241,   1,   0, 138,   1, 
-      0,   0,   0,   0, 128,  34, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0, 119,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   2,   0,   7,   0, 
-      0,   0,   0,   0,   1,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 128,  34,   0,   0, 
-      8,   2,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   2,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,  64,   0,   0,   0, 
-     67,  58,  92, 115, 114,  99, 
-     92, 100, 111, 119, 110, 108, 
-    111,  97, 100, 115,  92,  67, 
-     83,  82,  97, 121, 116, 114, 
-     97,  99, 101, 114,  92,  67, 
-     83,  82,  97, 121, 116, 114, 
-     97,  99, 101, 114,  92,  82, 
-     97, 121, 116, 114,  97,  99, 
-    101,  70, 105, 114, 115, 116, 
-     80,  97, 115, 115,  46, 104, 
-    108, 115, 108,   0,  67,  58, 
-     92, 115, 114,  99,  92, 100, 
-    111, 119, 110, 108, 111,  97, 
-    100, 115,  92,  67,  83,  82, 
-     97, 121, 116, 114,  97,  99, 
-    101, 114,  92,  67,  83,  82, 
-     97, 121, 116, 114,  97,  99, 
-    101, 114,  92,  83, 104,  97, 
-    100, 101, 114,  67, 111, 109, 
-    109, 111, 110,  46, 104, 108, 
-    115, 108, 105,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   1, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255,  13,   0, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1,  42, 205, 210,  85, 
-      1,   0,   0,   0,  42, 143, 
-    235, 186,  32, 167,   8,  65, 
-    170,  34, 168, 178, 150,  30, 
-      4,  35, 180,   0,   0,   0, 
-     47,  76, 105, 110, 107,  73, 
-    110, 102, 111,   0,  47, 110, 
-     97, 109, 101, 115,   0,  47, 
-    115, 114,  99,  47, 104, 101, 
-     97, 100, 101, 114,  98, 108, 
-    111,  99, 107,   0,  47, 115, 
-    114,  99,  47, 102, 105, 108, 
-    101, 115,  47,  99,  58,  92, 
-    115, 114,  99,  92, 100, 111, 
-    119, 110, 108, 111,  97, 100, 
-    115,  92,  99, 115, 114,  97, 
-    121, 116, 114,  97,  99, 101, 
-    114,  92,  99, 115, 114,  97, 
-    121, 116, 114,  97,  99, 101, 
-    114,  92, 114,  97, 121, 116, 
-    114,  97,  99, 101, 102, 105, 
-    114, 115, 116, 112,  97, 115, 
-    115,  46, 104, 108, 115, 108, 
-      0,  47, 115, 114,  99,  47, 
-    102, 105, 108, 101, 115,  47, 
-     99,  58,  92, 115, 114,  99, 
-     92, 100, 111, 119, 110, 108, 
-    111,  97, 100, 115,  92,  99, 
-    115, 114,  97, 121, 116, 114, 
-     97,  99, 101, 114,  92,  99, 
-    115, 114,  97, 121, 116, 114, 
-     97,  99, 101, 114,  92, 115, 
-    104,  97, 100, 101, 114,  99, 
-    111, 109, 109, 111, 110,  46, 
-    104, 108, 115, 108, 105,   0, 
-      5,   0,   0,   0,  10,   0, 
-      0,   0,   1,   0,   0,   0, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,  17,   0,   0,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   0,   5,   0,   0,   0, 
-    109,   0,   0,   0,   9,   0, 
-      0,   0,  34,   0,   0,   0, 
-      8,   0,   0,   0,  10,   0, 
-      0,   0,   6,   0,   0,   0, 
-      0,   0,   0,   0,  65, 145, 
-     50,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     17,   0,   0,   0,  32,   0, 
-      0,   0,  24,   1,   0,   0, 
-    120,   3,   0,   0, 147,   1, 
-      0,   0, 124,   0,   0,   0, 
-      0,   0,   0,   0,  83,  23, 
-      0,   0, 172,   0,   0,   0, 
-    134,   8,   0,   0, 145,  13, 
-      0,   0,  12,  62,   0,   0, 
-    144,   0,   0,   0,  16,   0, 
-      0,   0,  40,   0,   0,   0, 
-    128,   2,   0,   0,  44,   0, 
-      0,   0,  60,   1,   0,   0, 
-      3,   0,   0,   0,  74,   0, 
-      0,   0,  55,   0,   0,   0, 
-     54,   0,   0,   0,  73,   0, 
-      0,   0,  67,   0,   0,   0, 
-     20,   0,   0,   0,   6,   0, 
-      0,   0,  57,   0,   0,   0, 
-     58,   0,   0,   0,  59,   0, 
-      0,   0,  60,   0,   0,   0, 
-     61,   0,   0,   0,  62,   0, 
-      0,   0,  63,   0,   0,   0, 
-     64,   0,   0,   0,  65,   0, 
-      0,   0,  66,   0,   0,   0, 
-     21,   0,   0,   0,   8,   0, 
-      0,   0,   9,   0,   0,   0, 
-     10,   0,   0,   0,  11,   0, 
-      0,   0,  12,   0,   0,   0, 
-     13,   0,   0,   0,  14,   0, 
-      0,   0,  15,   0,   0,   0, 
-     16,   0,   0,   0,  17,   0, 
-      0,   0,  18,   0,   0,   0, 
-     19,   0,   0,   0,  22,   0, 
-      0,   0,  23,   0,   0,   0, 
-     24,   0,   0,   0,  25,   0, 
-      0,   0,  26,   0,   0,   0, 
-     27,   0,   0,   0,  28,   0, 
-      0,   0,  29,   0,   0,   0, 
-     30,   0,   0,   0,  31,   0, 
-      0,   0,  32,   0,   0,   0, 
-     33,   0,   0,   0,  34,   0, 
-      0,   0,  35,   0,   0,   0, 
-     36,   0,   0,   0,  37,   0, 
-      0,   0,  38,   0,   0,   0, 
-     39,   0,   0,   0,  40,   0, 
-      0,   0,  41,   0,   0,   0, 
-     42,   0,   0,   0,  43,   0, 
-      0,   0,  44,   0,   0,   0, 
-     45,   0,   0,   0,  46,   0, 
-      0,   0,  47,   0,   0,   0, 
-     48,   0,   0,   0,  49,   0, 
-      0,   0,  50,   0,   0,   0, 
-     51,   0,   0,   0,  52,   0, 
-      0,   0,  53,   0,   0,   0, 
-      7,   0,   0,   0,  56,   0, 
-      0,   0,  68,   0,   0,   0, 
-     69,   0,   0,   0,  70,   0, 
-      0,   0,  72,   0,   0,   0, 
-     71,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  75,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0
+      0,   0,   0,   0,   2,   0, 
+      0,   0,   6,   0,   0,   0
 };
@@ -39,7 +39,7 @@ void main(
     // If no hit, we're done.
     // If either side hits, append to Tasks list and update head index for this pixel
     AabbNode node = Nodes[0];
-    uint i = 0xffff;
+    int i = -1;
     if (RayAabbIntersect(rayStart, rayDir, node.LeftMin, node.LeftMax))
     {
         Task t;
@@ -55,7 +55,7 @@ void main(
         t.Node = node.RightIndex;
         t.Next = -1;
         uint j = Tasks.IncrementCounter();
-        if (i != 0xffff)
+        if (i >= 0)
         {
             t.Next = i;
         }
@@ -5,6 +5,9 @@
 
 D3D11CSRaytracer::D3D11CSRaytracer(HWND window)
     : Window(window)
+    , NumNodes(0)
+    , MaxTasks(0)
+    , NumTasks(0)
 {
 }
 
@@ -12,7 +15,7 @@ D3D11CSRaytracer::~D3D11CSRaytracer()
 {
 }
 
-bool D3D11CSRaytracer::Initialize()
+bool D3D11CSRaytracer::Initialize(const Aabb* objects, int numObjects)
 {
     ComPtr<IDXGIFactory1> factory;
     HRESULT hr = CreateDXGIFactory1(IID_PPV_ARGS(&factory));
@@ -81,13 +84,25 @@ bool D3D11CSRaytracer::Initialize()
         return false;
     }
 
-    Nodes.reset(new AabbNode[MaxNodes]);
-    Nodes[0].LeftIndex = -1;
-    Nodes[0].RightIndex = -1;
-    Nodes[0].LeftMin = XMFLOAT3(-1, -1, -1);
-    Nodes[0].LeftMax = XMFLOAT3(0, 0, 0);
-    Nodes[0].RightMin = XMFLOAT3(0, 0, 0);
-    Nodes[0].RightMax = XMFLOAT3(1, 1, 1);
+    std::vector<AabbNode> nodes;
+    std::unique_ptr<LbvhBuilder> builder(new LbvhBuilder((int)std::thread::hardware_concurrency()));
+    if (!builder->Build(objects, numObjects, false, &nodes))
+    {
+        OutputDebugString(L"Failed to build AABB tree.\n");
+        assert(false);
+        return false;
+    }
+
+    if (nodes.size() > MaxNodes)
+    {
+        OutputDebugString(L"AABB tree doesn't fit in the nodes buffer.\n");
+        assert(false);
+        return false;
+    }
+
+    NumNodes = (int)nodes.size();
+    Nodes.reset(new AabbNode[MaxNodes]{});
+    std::copy(nodes.begin(), nodes.end(), Nodes.get());
 
     D3D11_BUFFER_DESC bd{};
     bd.BindFlags = D3D11_BIND_SHADER_RESOURCE;
@@ -116,6 +131,16 @@ bool D3D11CSRaytracer::Initialize()
 
     Context->UpdateSubresource(NodesBuffer.Get(), 0, nullptr, Nodes.get(), sizeof(AabbNode) * MaxNodes, sizeof(AabbNode) * MaxNodes);
 
+    // Sized so that no pass can append past the end, as the counter doesn't stop at the end
+    uint64_t maxTasks = GetMaxTasks(Width, Height);
+    if (maxTasks * sizeof(Task) > D3D11_REQ_RESOURCE_SIZE_IN_MEGABYTES_EXPRESSION_C_TERM * 1024ull * 1024)
+    {
+        OutputDebugString(L"Window is too large for the tasks buffer.\n");
+        assert(false);
+        return false;
+    }
+    MaxTasks = (uint32_t)maxTasks;
+
     bd.BindFlags = D3D11_BIND_UNORDERED_ACCESS;
     bd.ByteWidth = MaxTasks * sizeof(Task);
     bd.StructureByteStride = sizeof(Task);
@@ -197,6 +222,11 @@ bool D3D11CSRaytracer::Initialize()
     return true;
 }
 
+uint64_t D3D11CSRaytracer::GetMaxTasks(uint32_t width, uint32_t height)
+{
+    return (uint64_t)(width / 4 * 4) * (height / 4 * 4) * 2 * (1 + NumTaskPasses);
+}
+
 bool D3D11CSRaytracer::Render(FXMMATRIX cameraWorld, float horizFovRadians)
 {
     static const uint32_t clearValue[] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
@@ -241,13 +271,15 @@ bool D3D11CSRaytracer::Render(FXMMATRIX cameraWorld, float horizFovRadians)
 
     ID3D11ShaderResourceView* taskPassSRVs[]{ NodesSRV.Get() };
     ID3D11UnorderedAccessView* taskPassUAVs[]{ RenderTargetUAV.Get(), TaskHeadsUAV.Get(), TasksUAV.Get() };
+    // Keep the Tasks counter where the first pass left it (-1), otherwise the task
+    // pass would append over the tasks that the first pass just wrote
+    uint32_t keepCounts[]{ (uint32_t)-1, (uint32_t)-1, (uint32_t)-1 };
     Context->CSSetShader(FirstPassCS.Get(), nullptr, 0);
     Context->CSSetShaderResources(0, _countof(taskPassSRVs), taskPassSRVs);
-    Context->CSSetUnorderedAccessViews(0, _countof(taskPassUAVs), taskPassUAVs, counts);
+    Context->CSSetUnorderedAccessViews(0, _countof(taskPassUAVs), taskPassUAVs, keepCounts);
     Context->CSSetShader(TaskPassCS.Get(), nullptr, 0);
 
-    // Do 10 iterations for now
-    for (int i = 0; i < 10; ++i)
+    for (int i = 0; i < NumTaskPasses; ++i)
     {
         Context->Dispatch(Width / 4, Height / 4, 1);
     }
@@ -1,15 +1,27 @@
 #pragma once
 
+#include "AabbTree.h"
+
 class D3D11CSRaytracer
 {
 public:
     D3D11CSRaytracer(HWND window);
     virtual ~D3D11CSRaytracer();
 
-    bool Initialize();
+    // Builds a tree over the objects with LbvhBuilder, which must fit in MaxNodes
+    bool Initialize(const Aabb* objects, int numObjects);
 
     bool Render(FXMMATRIX cameraWorld, float horizFovRadians);
 
+    static const uint32_t               MaxNodes = 0xffff;
+
+    // The first pass, then this many task passes, are dispatched each frame
+    static const int                    NumTaskPasses = 10;
+
+    // Every pass appends at most 2 tasks per pixel, and tasks aren't freed until the next
+    // frame, so this many always fit
+    static uint64_t GetMaxTasks(uint32_t width, uint32_t height);
+
 private:
     HWND                                Window;
     uint32_t                            Width;
@@ -41,22 +53,10 @@ private:
     };
     ComPtr<ID3D11Buffer>                ConstantBuffer;
 
-    struct AabbNode
-    {
-        XMFLOAT3 LeftMin, LeftMax;
-        XMFLOAT3 RightMin, RightMax;
-        int LeftIndex, RightIndex;
-    };
     std::unique_ptr<AabbNode[]>         Nodes;
-    static const uint32_t               MaxNodes = 0xffff;
     int                                 NumNodes;
 
-    struct Task
-    {
-        int Node;
-        int Next;
-    };
+    uint32_t                            MaxTasks;
     std::unique_ptr<Task[]>             Tasks;
-    static const uint32_t               MaxTasks = 0xffff;
     int                                 NumTasks;
 };
@@ -0,0 +1,72 @@
+#include "Precomp.h"
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(int numThreads)
+    : NumThreads(std::max(numThreads, 1))
+    , Job(nullptr)
+    , JobId(0)
+    , JobsRemaining(0)
+    , Quit(false)
+{
+    for (int i = 1; i < NumThreads; ++i)
+    {
+        Threads.push_back(std::thread(&WorkerPool::WorkerThread, this, i));
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Quit = true;
+    }
+    JobReady.notify_all();
+
+    for (auto& thread : Threads)
+    {
+        thread.join();
+    }
+}
+
+void WorkerPool::Run(const std::function<void(int thread)>& func)
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Job = &func;
+        ++JobId;
+        JobsRemaining = NumThreads - 1;
+    }
+    JobReady.notify_all();
+
+    func(0);
+
+    std::unique_lock<std::mutex> lock(Mutex);
+    JobDone.wait(lock, [&]() { return JobsRemaining == 0; });
+    Job = nullptr;
+}
+
+void WorkerPool::WorkerThread(int thread)
+{
+    int lastJobId = 0;
+    for (;;)
+    {
+        std::unique_lock<std::mutex> lock(Mutex);
+        JobReady.wait(lock, [&]() { return Quit || JobId != lastJobId; });
+        if (Quit)
+        {
+            return;
+        }
+
+        lastJobId = JobId;
+        const std::function<void(int thread)>* job = Job;
+        lock.unlock();
+
+        (*job)(thread);
+
+        lock.lock();
+        if (--JobsRemaining == 0)
+        {
+            JobDone.notify_one();
+        }
+    }
+}
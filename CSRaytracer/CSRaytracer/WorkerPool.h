@@ -0,0 +1,32 @@
+#pragma once
+
+// Threads that are started once and then run jobs together, so that a job costs a wakeup rather
+// than a thread creation. The thread that calls Run takes part as thread 0.
+class WorkerPool
+{
+public:
+    WorkerPool(int numThreads);
+    ~WorkerPool();
+
+    int GetNumThreads() const { return NumThreads; }
+
+    // Call func on every thread (the calling thread is thread 0), and wait for them all to finish
+    void Run(const std::function<void(int thread)>& func);
+
+private:
+    // Don't allow copy
+    WorkerPool(const WorkerPool&);
+    WorkerPool& operator= (const WorkerPool&);
+
+    void WorkerThread(int thread);
+
+    int                                         NumThreads;
+    std::vector<std::thread>                    Threads;
+    std::mutex                                  Mutex;
+    std::condition_variable                     JobReady;
+    std::condition_variable                     JobDone;
+    const std::function<void(int thread)>*      Job;
+    int                                         JobId;
+    int                                         JobsRemaining;
+    bool                                        Quit;
+};
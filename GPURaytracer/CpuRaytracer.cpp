@@ -0,0 +1,480 @@
+#include "Precomp.h"
+#include "CpuRaytracer.h"
+#include "Debug.h"
+
+// AVX2 (with FMA, which the AVX2 kernels use too) needs support from the CPU, and the OS has to
+// save the upper halves of the registers on context switches
+static bool CheckAvx2Support()
+{
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    __cpuid(info, 1);
+    bool osSavesRegisters = (info[2] & (1 << 27)) != 0;
+    bool hasAvx = (info[2] & (1 << 28)) != 0;
+    bool hasFma = (info[2] & (1 << 12)) != 0;
+    if (!osSavesRegisters || !hasAvx || !hasFma || (_xgetbv(0) & 6) != 6)
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+}
+
+std::unique_ptr<CpuRaytracer> CpuRaytracer::Create(int width, int height, int numThreads)
+{
+    std::unique_ptr<CpuRaytracer> raytracer(new CpuRaytracer(width, height, numThreads));
+    if (raytracer)
+    {
+        if (raytracer->Initialize())
+        {
+            return raytracer;
+        }
+    }
+
+    return nullptr;
+}
+
+CpuRaytracer::CpuRaytracer(int width, int height, int numThreads)
+    : Width(width)
+    , Height(height)
+    , NumThreads(max(numThreads, 1))
+    , DistToProjPlane(0.f)
+    , Job(nullptr)
+    , JobId(0)
+    , JobsRemaining(0)
+    , Quit(false)
+    , NextRow(0)
+{
+    Avx2Supported = CheckAvx2Support();
+    Avx2Enabled = Avx2Supported;
+
+    HalfWidth = Width * 0.5f;
+    HalfHeight = Height * 0.5f;
+
+    SphereData = SphereArrays();
+}
+
+CpuRaytracer::~CpuRaytracer()
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Quit = true;
+    }
+    JobReady.notify_all();
+
+    for (auto& thread : Threads)
+    {
+        thread.join();
+    }
+}
+
+bool CpuRaytracer::Initialize()
+{
+    if (Width <= 0 || Height <= 0)
+    {
+        LogError(L"Invalid render size.");
+        return false;
+    }
+
+    Pixels.reset(new uint32_t[Width * Height]);
+
+    if (!LoadEnvironment(L"Environment.dds"))
+    {
+        LogError(L"Failed to load environment map.");
+        return false;
+    }
+
+    std::vector<SphereObject> spheres;
+    std::vector<PointLight> lights;
+    CreateTestScene(&spheres, &lights);
+    SetScene(spheres, lights);
+
+    for (int i = 1; i < NumThreads; ++i)
+    {
+        Threads.push_back(std::thread(&CpuRaytracer::WorkerThread, this, i));
+    }
+
+    return true;
+}
+
+bool CpuRaytracer::LoadEnvironment(const wchar_t* filename)
+{
+    TexMetadata metadata;
+    std::unique_ptr<ScratchImage> image(new ScratchImage);
+    HRESULT hr = LoadFromDDSFile(filename, DDS_FLAGS_NONE, &metadata, *image);
+    if (FAILED(hr))
+    {
+        LogError(L"Failed to load environment map texture.");
+        return false;
+    }
+
+    if (metadata.dimension != TEX_DIMENSION_TEXTURE2D || !metadata.IsCubemap() || metadata.width != metadata.height)
+    {
+        LogError(L"Environment map must be a cube map.");
+        return false;
+    }
+
+    // Same mips as the GPU's copy
+    std::unique_ptr<ScratchImage> mipChain(new ScratchImage);
+    hr = GenerateMipMaps(image->GetImages(), image->GetImageCount(), metadata, TEX_FILTER_LINEAR | TEX_FILTER_FORCE_NON_WIC, 8, *mipChain);
+    if (FAILED(hr))
+    {
+        LogError(L"Failed to create mips for env texture.");
+        return false;
+    }
+
+    std::unique_ptr<ScratchImage> texels(new ScratchImage);
+    hr = Convert(mipChain->GetImages(), mipChain->GetImageCount(), mipChain->GetMetadata(), DXGI_FORMAT_R32G32B32A32_FLOAT,
+                 TEX_FILTER_DEFAULT, 0.5f, *texels);
+    if (FAILED(hr))
+    {
+        LogError(L"Failed to convert env texture to float.");
+        return false;
+    }
+
+    const TexMetadata& texelsMetadata = texels->GetMetadata();
+    EnvLevels.resize(texelsMetadata.mipLevels);
+    for (size_t level = 0; level < EnvLevels.size(); ++level)
+    {
+        EnvLevel& envLevel = EnvLevels[level];
+        envLevel.Size = (int)max(texelsMetadata.width >> level, (size_t)1);
+        envLevel.Texels.resize(6 * envLevel.Size * envLevel.Size);
+
+        for (int face = 0; face < 6; ++face)
+        {
+            const Image* faceImage = texels->GetImage(level, face, 0);
+            for (int y = 0; y < envLevel.Size; ++y)
+            {
+                memcpy(&envLevel.Texels[(face * envLevel.Size + y) * envLevel.Size], faceImage->pixels + y * faceImage->rowPitch,
+                       envLevel.Size * sizeof(XMFLOAT4));
+            }
+        }
+    }
+
+    return true;
+}
+
+void CpuRaytracer::SetScene(const std::vector<SphereObject>& spheres, const std::vector<PointLight>& lights)
+{
+    Spheres = spheres;
+    Lights = lights;
+
+    // Extra spheres have a negative radius, so they're never hit
+    size_t count = (spheres.size() + 7) & ~(size_t)7;
+    SphereCenterX.assign(count, 0.f);
+    SphereCenterY.assign(count, 0.f);
+    SphereCenterZ.assign(count, 0.f);
+    SphereRadius.assign(count, -1.f);
+
+    for (size_t i = 0; i < spheres.size(); ++i)
+    {
+        SphereCenterX[i] = spheres[i].Center.x;
+        SphereCenterY[i] = spheres[i].Center.y;
+        SphereCenterZ[i] = spheres[i].Center.z;
+        SphereRadius[i] = spheres[i].Radius;
+    }
+
+    SphereData.CenterX = SphereCenterX.data();
+    SphereData.CenterY = SphereCenterY.data();
+    SphereData.CenterZ = SphereCenterZ.data();
+    SphereData.Radius = SphereRadius.data();
+    SphereData.Count = (int)count;
+}
+
+void CpuRaytracer::SetFOV(float horizFovRadians)
+{
+    float denom = tanf(horizFovRadians * 0.5f);
+    assert(!isnan(denom) && fabsf(denom) > 0.00001f);
+    DistToProjPlane = (Width * 0.5f) / denom;
+}
+
+bool CpuRaytracer::Render(FXMMATRIX cameraWorldTransform)
+{
+    NextRow = 0;
+    Run([&](int)
+    {
+        for (int y = NextRow++; y < Height; y = NextRow++)
+        {
+            RenderRow(y, cameraWorldTransform);
+        }
+    });
+
+    return true;
+}
+
+void CpuRaytracer::Present(HWND window)
+{
+    BITMAPINFO info = {};
+    info.bmiHeader.biSize = sizeof(info.bmiHeader);
+    info.bmiHeader.biWidth = Width;
+    info.bmiHeader.biHeight = -Height;     // Top down
+    info.bmiHeader.biPlanes = 1;
+    info.bmiHeader.biBitCount = 32;
+    info.bmiHeader.biCompression = BI_RGB;
+
+    HDC dc = GetDC(window);
+    SetDIBitsToDevice(dc, 0, 0, Width, Height, 0, 0, 0, Height, Pixels.get(), &info, DIB_RGB_COLORS);
+    ReleaseDC(window, dc);
+}
+
+void CpuRaytracer::Run(const std::function<void(int thread)>& func)
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Job = &func;
+        ++JobId;
+        JobsRemaining = NumThreads - 1;
+    }
+    JobReady.notify_all();
+
+    func(0);
+
+    std::unique_lock<std::mutex> lock(Mutex);
+    JobDone.wait(lock, [&]() { return JobsRemaining == 0; });
+    Job = nullptr;
+}
+
+void CpuRaytracer::WorkerThread(int thread)
+{
+    int lastJobId = 0;
+    for (;;)
+    {
+        std::unique_lock<std::mutex> lock(Mutex);
+        JobReady.wait(lock, [&]() { return Quit || JobId != lastJobId; });
+        if (Quit)
+        {
+            return;
+        }
+
+        lastJobId = JobId;
+        const std::function<void(int thread)>* job = Job;
+        lock.unlock();
+
+        (*job)(thread);
+
+        lock.lock();
+        if (--JobsRemaining == 0)
+        {
+            JobDone.notify_one();
+        }
+    }
+}
+
+void CpuRaytracer::RenderRow(int y, FXMMATRIX cameraWorldTransform)
+{
+    XMVECTOR rayStart = cameraWorldTransform.r[3];
+    uint32_t* row = &Pixels[y * Width];
+
+    for (int x = 0; x < Width; ++x)
+    {
+        // Ray through this pixel, transformed to the camera's world orientation
+        XMVECTOR rayDir = XMVectorSet((float)x - HalfWidth, HalfHeight - (float)y, DistToProjPlane, 0.f);
+        rayDir = XMVector3TransformNormal(XMVector3Normalize(rayDir), cameraWorldTransform);
+
+        XMVECTOR color;
+        RayIntersection intersection;
+        if (RayTrace(rayStart, rayDir, &intersection))
+        {
+            color = XMVectorSetW(ComputeIrradiance(rayDir, intersection), 1.f);
+        }
+        else
+        {
+            color = SampleEnvironment(rayDir, 0.f);
+        }
+
+        // Stored as R8G8B8A8_UNORM would be, in BGRA order
+        XMFLOAT4 c;
+        XMStoreFloat4(&c, XMVectorSaturate(color) * 255.f + XMVectorReplicate(0.5f));
+        row[x] = (uint32_t)c.z | ((uint32_t)c.y << 8) | ((uint32_t)c.x << 16) | ((uint32_t)c.w << 24);
+    }
+}
+
+int CpuRaytracer::FindNearestSphere(FXMVECTOR start, FXMVECTOR dir) const
+{
+    XMFLOAT3 s, d;
+    XMStoreFloat3(&s, start);
+    XMStoreFloat3(&d, dir);
+    return Avx2Enabled ? FindNearestSphereAvx2(SphereData, &s.x, &d.x) : FindNearestSphereSse(SphereData, &s.x, &d.x);
+}
+
+bool CpuRaytracer::HitsAnySphere(FXMVECTOR start, FXMVECTOR dir) const
+{
+    XMFLOAT3 s, d;
+    XMStoreFloat3(&s, start);
+    XMStoreFloat3(&d, dir);
+    return Avx2Enabled ? HitsAnySphereAvx2(SphereData, &s.x, &d.x) : HitsAnySphereSse(SphereData, &s.x, &d.x);
+}
+
+bool CpuRaytracer::RayTrace(FXMVECTOR start, FXMVECTOR dir, RayIntersection* intersection) const
+{
+    int index = FindNearestSphere(start, dir);
+    if (index < 0)
+    {
+        return false;
+    }
+
+    // Work out the hit on the nearest sphere the same way as RaySphereIntersect
+    const SphereObject& sphere = Spheres[index];
+    XMVECTOR center = XMLoadFloat3(&sphere.Center);
+    XMVECTOR toCenter = center - start;
+    XMVECTOR axis = XMVector3Cross(dir, toCenter);
+
+    XMVECTOR position;
+    if (XMVectorGetX(XMVector3Length(axis)) < 0.01f)
+    {
+        position = center - dir * sphere.Radius;
+    }
+    else
+    {
+        XMVECTOR norm = XMVector3Normalize(XMVector3Cross(axis, dir));
+        float d = XMVectorGetX(XMVector3Dot(norm, toCenter));
+        float x = sqrtf(max(sphere.Radius * sphere.Radius - d * d, 0.f));
+        position = center - norm * d - dir * x;
+    }
+
+    XMStoreFloat3(&intersection->Position, position);
+    XMStoreFloat3(&intersection->Normal, XMVector3Normalize(position - center));
+    intersection->Dist = XMVectorGetX(XMVector3Length(position - start));
+    intersection->Sphere = index;
+    return true;
+}
+
+XMVECTOR CpuRaytracer::ComputeIrradiance(FXMVECTOR viewDir, const RayIntersection& intersection) const
+{
+    // Push position out slightly to avoid self-intersection
+    XMVECTOR normal = XMLoadFloat3(&intersection.Normal);
+    XMVECTOR position = XMLoadFloat3(&intersection.Position) + normal * 0.001f;
+
+    const SphereObject& sphere = Spheres[intersection.Sphere];
+    float reflectiveness = sphere.Reflectiveness;
+    XMVECTOR totalLight = XMVectorZero();
+
+    //
+    // Direct lighting
+    //
+    for (size_t i = 0; i < Lights.size(); ++i)
+    {
+        const PointLight& light = Lights[i];
+        XMVECTOR lightColor = XMLoadFloat3(&light.Color);
+        XMVECTOR lightDir = XMVector3Normalize(XMLoadFloat3(&light.Position) - position);
+
+        // Check for obstruction
+        if (!HitsAnySphere(position, lightDir))
+        {
+            // Diffuse
+            float nDotL = min(max(XMVectorGetX(XMVector3Dot(normal, lightDir)), 0.f), 1.f);
+            totalLight += lightColor * nDotL;
+
+            if (reflectiveness > 0.5f)
+            {
+                // Specular
+                XMVECTOR lightRefl = XMVector3Reflect(-lightDir, normal);
+                float vDotR = XMVectorGetX(XMVector3Dot(-viewDir, lightRefl));
+                if (vDotR > 0)
+                {
+                    totalLight += lightColor * (20 * reflectiveness * powf(vDotR, 20 * reflectiveness));
+                }
+            }
+        }
+    }
+
+    //
+    // Reflection
+    //
+    XMVECTOR reflection;
+    XMVECTOR reflDir = XMVector3Reflect(viewDir, normal);
+    int reflected = reflectiveness > 0.5f ? FindNearestSphere(position, reflDir) : -1;
+    if (reflected >= 0)
+    {
+        reflection = XMLoadFloat3(&Spheres[reflected].Color);
+    }
+    else
+    {
+        // Reflect env
+        reflection = SampleEnvironment(reflDir, 8 * (1.f - reflectiveness));
+    }
+
+    float reflDotN = XMVectorGetX(XMVector3Dot(reflDir, normal));
+    return XMLoadFloat3(&sphere.Color) * (0.125f * totalLight + 0.875f * reflDotN * reflection);
+}
+
+XMVECTOR CpuRaytracer::SampleEnvironment(FXMVECTOR dir, float lod) const
+{
+    // Pick the face the direction points at most, and the coordinates on it, as D3D does
+    XMFLOAT3 d;
+    XMStoreFloat3(&d, dir);
+    float ax = fabsf(d.x), ay = fabsf(d.y), az = fabsf(d.z);
+
+    int face;
+    float sc, tc, ma;
+    if (ax >= ay && ax >= az)
+    {
+        face = d.x >= 0 ? 0 : 1;
+        sc = d.x >= 0 ? -d.z : d.z;
+        tc = -d.y;
+        ma = ax;
+    }
+    else if (ay >= az)
+    {
+        face = d.y >= 0 ? 2 : 3;
+        sc = d.x;
+        tc = d.y >= 0 ? d.z : -d.z;
+        ma = ay;
+    }
+    else
+    {
+        face = d.z >= 0 ? 4 : 5;
+        sc = d.z >= 0 ? d.x : -d.x;
+        tc = -d.y;
+        ma = az;
+    }
+
+    if (ma <= 0.f)
+    {
+        return XMVectorZero();
+    }
+
+    float u = 0.5f * (sc / ma + 1.f);
+    float v = 0.5f * (tc / ma + 1.f);
+
+    // Bilinear filtering within the face, with texels clamped to its edges
+    auto sampleLevel = [&](int level) -> XMVECTOR
+    {
+        const EnvLevel& envLevel = EnvLevels[level];
+        int size = envLevel.Size;
+        const XMFLOAT4* texels = &envLevel.Texels[face * size * size];
+
+        float x = u * size - 0.5f;
+        float y = v * size - 0.5f;
+        float x0 = floorf(x);
+        float y0 = floorf(y);
+        float wx = x - x0;
+        float wy = y - y0;
+
+        int left = min(max((int)x0, 0), size - 1);
+        int right = min(max((int)x0 + 1, 0), size - 1);
+        int top = min(max((int)y0, 0), size - 1);
+        int bottom = min(max((int)y0 + 1, 0), size - 1);
+
+        XMVECTOR upper = XMVectorLerp(XMLoadFloat4(&texels[top * size + left]), XMLoadFloat4(&texels[top * size + right]), wx);
+        XMVECTOR lower = XMVectorLerp(XMLoadFloat4(&texels[bottom * size + left]), XMLoadFloat4(&texels[bottom * size + right]), wx);
+        return XMVectorLerp(upper, lower, wy);
+    };
+
+    // Blend between the two nearest mips
+    lod = min(max(lod, 0.f), (float)(EnvLevels.size() - 1));
+    int level = (int)lod;
+    float blend = lod - (float)level;
+    XMVECTOR color = sampleLevel(level);
+    if (blend > 0.f)
+    {
+        color = XMVectorLerp(color, sampleLevel(level + 1), blend);
+    }
+    return color;
+}
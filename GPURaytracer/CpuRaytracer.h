@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Scene.h"
+#include "SphereKernels.h"
+
+/// CPU based ray tracer, for the same scene & shading as the GPU one (see RaytraceCS.hlsl), so the
+/// scene can be rendered without a D3D11 GPU and the GPU has a baseline to be measured against.
+/// Spheres are kept as separate arrays of each component, and each ray is tested against 8 of
+/// them at a time with AVX2 (or 4 with SSE, on CPUs without it). Shading is done a pixel at a
+/// time, and rows of pixels are spread across the threads. The environment cube map is loaded
+/// with DirectXTex and sampled with the same trilinear filtering as the GPU's sampler.
+class CpuRaytracer
+{
+public:
+    static std::unique_ptr<CpuRaytracer> Create(int width, int height, int numThreads);
+    ~CpuRaytracer();
+
+    void SetFOV(float horizFovRadians);
+
+    // 8 spheres are tested at a time with AVX2 when the CPU supports it (the default), and 4 with SSE otherwise
+    bool IsAvx2Supported() const { return Avx2Supported; }
+    bool IsAvx2Enabled() const { return Avx2Enabled; }
+    void EnableAvx2(bool enable) { Avx2Enabled = enable && Avx2Supported; }
+
+    bool Render(FXMMATRIX cameraWorldTransform);
+
+    // Copy the last frame into a window's client area
+    void Present(HWND window);
+
+    // The last frame, Width x Height 32 bit pixels in BGRA order (as GDI wants them)
+    const uint32_t* GetPixels() const { return Pixels.get(); }
+
+private:
+    CpuRaytracer(int width, int height, int numThreads);
+
+    // Don't allow copy
+    CpuRaytracer(const CpuRaytracer&);
+    CpuRaytracer& operator= (const CpuRaytracer&);
+
+    bool Initialize();
+    bool LoadEnvironment(const wchar_t* filename);
+    void SetScene(const std::vector<SphereObject>& spheres, const std::vector<PointLight>& lights);
+
+    // Call func on every thread (the calling thread is thread 0), and wait for them all to finish
+    void Run(const std::function<void(int thread)>& func);
+    void WorkerThread(int thread);
+
+    void RenderRow(int y, FXMMATRIX cameraWorldTransform);
+
+    struct RayIntersection
+    {
+        XMFLOAT3 Position;
+        XMFLOAT3 Normal;
+        float Dist;
+        int Sphere;
+    };
+
+    // Find the nearest intersection along a ray (see RayTrace in the shader)
+    bool RayTrace(FXMVECTOR start, FXMVECTOR dir, RayIntersection* intersection) const;
+    int FindNearestSphere(FXMVECTOR start, FXMVECTOR dir) const;
+    bool HitsAnySphere(FXMVECTOR start, FXMVECTOR dir) const;
+
+    // Light exiting back along viewDir (see ComputeIrradiance in the shader)
+    XMVECTOR ComputeIrradiance(FXMVECTOR viewDir, const RayIntersection& intersection) const;
+
+    // Trilinear filtered sample of the environment in a direction, as with TextureCube.SampleLevel
+    XMVECTOR SampleEnvironment(FXMVECTOR dir, float lod) const;
+
+private:
+    int Width;
+    int Height;
+    int NumThreads;
+    bool Avx2Supported;
+    bool Avx2Enabled;
+    std::unique_ptr<uint32_t[]> Pixels;
+
+    // For computing eye rays
+    float HalfWidth;
+    float HalfHeight;
+    float DistToProjPlane;
+
+    // Spheres as arrays for testing (padded out to a multiple of 8), and as they are for shading
+    std::vector<float> SphereCenterX;
+    std::vector<float> SphereCenterY;
+    std::vector<float> SphereCenterZ;
+    std::vector<float> SphereRadius;
+    SphereArrays SphereData;
+    std::vector<SphereObject> Spheres;
+    std::vector<PointLight> Lights;
+
+    // Environment cube map, as RGBA float texels. Each level has the 6 faces one after another.
+    struct EnvLevel
+    {
+        int Size;
+        std::vector<XMFLOAT4> Texels;
+    };
+    std::vector<EnvLevel> EnvLevels;
+
+    // Worker threads, each rendering rows until there are none left
+    std::vector<std::thread> Threads;
+    std::mutex Mutex;
+    std::condition_variable JobReady;
+    std::condition_variable JobDone;
+    const std::function<void(int thread)>* Job;
+    int JobId;
+    int JobsRemaining;
+    bool Quit;
+    std::atomic<int> NextRow;
+};
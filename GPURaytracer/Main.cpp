@@ -1,6 +1,7 @@
 #include "Precomp.h"
 #include "Debug.h"
 #include "Raytracer.h"
+#include "CpuRaytracer.h"
 
 // Constants
 static const wchar_t ClassName[] = L"GPU Raytracer Test Application";
@@ -15,11 +16,21 @@ static HWND Window;
 // Local methods
 static bool Initialize();
 static void Shutdown();
+static int RunCpuBenchmark(int argc, char* argv[]);
+static void AttachToParentConsole();
 static LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
 
-// Entry point
-int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
+// Entry point. Pass -cpu to render on the CPU instead of the GPU, and -cpu -benchmark to
+// time the CPU renderer without a window.
+int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR commandLine, int)
 {
+    bool useCpu = strstr(commandLine, "-cpu") != nullptr;
+    if (useCpu && strstr(commandLine, "-benchmark"))
+    {
+        AttachToParentConsole();
+        return RunCpuBenchmark(__argc, __argv);
+    }
+
     Instance = instance;
     if (!Initialize())
     {
@@ -27,8 +38,18 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
         return -1;
     }
 
-    std::unique_ptr<Raytracer> raytracer(Raytracer::Create(Window));
-    if (!raytracer)
+    std::unique_ptr<Raytracer> raytracer;
+    std::unique_ptr<CpuRaytracer> cpuRaytracer;
+    if (useCpu)
+    {
+        cpuRaytracer = CpuRaytracer::Create(ScreenWidth, ScreenHeight, (int)std::thread::hardware_concurrency());
+    }
+    else
+    {
+        raytracer = Raytracer::Create(Window);
+    }
+
+    if (!raytracer && !cpuRaytracer)
     {
         assert(false);
         return -2;
@@ -43,7 +64,14 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
     LARGE_INTEGER frequency = {};
     QueryPerformanceFrequency(&frequency);
 
-    raytracer->SetFOV(XMConvertToRadians(60.f));
+    if (cpuRaytracer)
+    {
+        cpuRaytracer->SetFOV(XMConvertToRadians(60.f));
+    }
+    else
+    {
+        raytracer->SetFOV(XMConvertToRadians(60.f));
+    }
 
     // Camera at the origin, looking along Z
     XMMATRIX cameraWorldTransform = XMMatrixIdentity();
@@ -128,14 +156,24 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
                 cameraWorldTransform.r[3] = translate;
             }
 
-            raytracer->Render(cameraWorldTransform, VSyncEnabled);
+            if (cpuRaytracer)
+            {
+                cpuRaytracer->Render(cameraWorldTransform);
+                cpuRaytracer->Present(Window);
+            }
+            else
+            {
+                raytracer->Render(cameraWorldTransform, VSyncEnabled);
+            }
 
-            swprintf_s(caption, L"GPU Raytracer: Resolution: %dx%d, FPS: %3.2f", ScreenWidth, ScreenHeight, frameRate);
+            swprintf_s(caption, L"%s Raytracer: Resolution: %dx%d, FPS: %3.2f", cpuRaytracer ? L"CPU" : L"GPU",
+                ScreenWidth, ScreenHeight, frameRate);
             SetWindowText(Window, caption);
         }
     }
 
     raytracer.reset();
+    cpuRaytracer.reset();
     Shutdown();
     return 0;
 }
@@ -181,6 +219,86 @@ void Shutdown()
     Window = nullptr;
 }
 
+// Render frames on the CPU from the starting camera, with each sphere test width the CPU supports,
+// and print the frame rates.
+// Usage: GPURaytracer.exe -cpu -benchmark [-frames n] [-threads n] [-width w] [-height h]
+int RunCpuBenchmark(int argc, char* argv[])
+{
+    int numFrames = 100;
+    int numThreads = (int)std::thread::hardware_concurrency();
+    int width = ScreenWidth;
+    int height = ScreenHeight;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 < argc && !strcmp(argv[i], "-frames"))
+        {
+            numFrames = max(atoi(argv[++i]), 1);
+        }
+        else if (i + 1 < argc && !strcmp(argv[i], "-threads"))
+        {
+            numThreads = max(atoi(argv[++i]), 1);
+        }
+        else if (i + 1 < argc && !strcmp(argv[i], "-width"))
+        {
+            width = atoi(argv[++i]);
+        }
+        else if (i + 1 < argc && !strcmp(argv[i], "-height"))
+        {
+            height = atoi(argv[++i]);
+        }
+    }
+
+    std::unique_ptr<CpuRaytracer> raytracer(CpuRaytracer::Create(width, height, numThreads));
+    if (!raytracer)
+    {
+        printf("Failed to create the CPU ray tracer (is Environment.dds in the working directory?)\n");
+        return -1;
+    }
+
+    raytracer->SetFOV(XMConvertToRadians(60.f));
+
+    XMMATRIX cameraWorldTransform = XMMatrixIdentity();
+    cameraWorldTransform.r[3] = XMVectorSet(0.f, 0.f, -5.f, 1.f);
+
+    printf("%dx%d, %d threads, %d frames\n", width, height, numThreads, numFrames);
+
+    for (int avx2 = 0; avx2 < 2; ++avx2)
+    {
+        if (avx2 && !raytracer->IsAvx2Supported())
+        {
+            printf("AVX2 (8 spheres at a time): not supported by this CPU\n");
+            break;
+        }
+        raytracer->EnableAvx2(avx2 != 0);
+
+        // One frame to warm up
+        raytracer->Render(cameraWorldTransform);
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < numFrames; ++i)
+        {
+            raytracer->Render(cameraWorldTransform);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        printf("%-28s %8.2f fps  %8.2f ms/frame\n", avx2 ? "AVX2 (8 spheres at a time):" : "SSE (4 spheres at a time):",
+            numFrames / seconds, seconds * 1000.0 / numFrames);
+    }
+
+    return 0;
+}
+
+void AttachToParentConsole()
+{
+    if (AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* console = nullptr;
+        freopen_s(&console, "CONOUT$", "w", stdout);
+        freopen_s(&console, "CONOUT$", "w", stderr);
+    }
+}
+
 LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
     switch (msg)
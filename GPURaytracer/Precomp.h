@@ -10,9 +10,16 @@
 #include <assert.h>
 #include <math.h>
 #include <float.h>
+#include <intrin.h>
 
 #include <memory>
 #include <vector>
+#include <functional>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 // Fast vector math with SSE support
 #include <DirectXMath.h>
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Scene.h"
+
 /// GPU based ray tracer
 class Raytracer
 {
@@ -56,22 +58,7 @@ private:
     ComPtr<ID3D11ShaderResourceView> EnvMapSRV;
     ComPtr<ID3D11SamplerState> EnvMapSampler;
 
-    // Simple scene initially as spheres for testing
-    struct SphereObject
-    {
-        XMFLOAT3 Center;
-        float Radius;
-        XMFLOAT3 Color;
-        float Reflectiveness;
-    };
-
-    struct PointLight
-    {
-        XMFLOAT3 Position;
-        XMFLOAT3 Color;
-        float Radius;
-    };
-
+    // Simple scene initially as spheres for testing (see Scene.h)
     ComPtr<ID3D11Buffer> SphereObjects;
     ComPtr<ID3D11ShaderResourceView> SphereObjectsSRV;
 
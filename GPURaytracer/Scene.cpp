@@ -0,0 +1,62 @@
+#include "Precomp.h"
+#include "Scene.h"
+
+void CreateTestScene(std::vector<SphereObject>* spheres, std::vector<PointLight>* lights)
+{
+    spheres->clear();
+    lights->clear();
+
+    //
+    // Spheres
+    //
+    SphereObject obj;
+#if 1
+
+    // drop in 20 random spheres
+    for (int i = 0; i < 20; ++i)
+    {
+        obj.Center = XMFLOAT3(rand() / (float)RAND_MAX * 10.f - 5.f,
+                              rand() / (float)RAND_MAX * 10.f - 5.f,
+                              rand() / (float)RAND_MAX * 10.f - 5.f);
+        obj.Radius = rand() / (float)RAND_MAX * 1.f + 0.5f;
+        obj.Color = XMFLOAT3(rand() / (float)RAND_MAX * 0.75f + 0.25f,
+                             rand() / (float)RAND_MAX * 0.75f + 0.25f,
+                             rand() / (float)RAND_MAX * 0.75f + 0.25f);
+        obj.Reflectiveness = rand() / (float)RAND_MAX;
+        spheres->push_back(obj);
+    }
+
+#else
+    obj.Center = XMFLOAT3(0.f, 0.f, 0.f);
+    obj.Radius = 1.5f;
+    obj.Color = XMFLOAT3(0.4f, 0.4f, 0.4f);
+    obj.Reflectiveness = 2.f;
+    spheres->push_back(obj);
+
+    obj.Center = XMFLOAT3(-1.f, -1.f, -2.f);
+    obj.Radius = 0.25f;
+    obj.Color = XMFLOAT3(1.f, 0.f, 0.f);
+    obj.Reflectiveness = 0.f;
+    spheres->push_back(obj);
+
+    obj.Center = XMFLOAT3(1.f, 0.f, -2.f);
+    obj.Radius = 0.5f;
+    obj.Color = XMFLOAT3(0.f, 0.f, 1.f);
+    obj.Reflectiveness = 0.f;
+    spheres->push_back(obj);
+#endif
+
+    //
+    // Lights
+    //
+    PointLight light;
+    light.Position = XMFLOAT3(1.f, 3.f, -4.f);
+    light.Color = XMFLOAT3(0.6f, 0.6f, 0.6f);
+    light.Radius = 5.f;
+    lights->push_back(light);
+
+    //light.Position = XMFLOAT3(-3.f, 0.f, -3.f);
+    //light.Color = XMFLOAT3(0.6f, 0.6f, 0.6f);
+    //light.Radius = 5.f;
+    //lights->push_back(light);
+}
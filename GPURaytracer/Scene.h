@@ -0,0 +1,22 @@
+#pragma once
+
+// Scene description shared by the GPU and CPU ray tracers. The layouts match the
+// structured buffers in RaytraceCS.hlsl.
+
+struct SphereObject
+{
+    XMFLOAT3 Center;
+    float Radius;
+    XMFLOAT3 Color;
+    float Reflectiveness;
+};
+
+struct PointLight
+{
+    XMFLOAT3 Position;
+    XMFLOAT3 Color;
+    float Radius;
+};
+
+// Fill in the test scene. Spheres are placed with rand(), so call srand() first for a different scene.
+void CreateTestScene(std::vector<SphereObject>* spheres, std::vector<PointLight>* lights);
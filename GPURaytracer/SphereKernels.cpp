@@ -0,0 +1,100 @@
+#include "Precomp.h"
+#include "SphereKernels.h"
+
+// Test a ray against 4 spheres, starting at index i. Returns the mask of the spheres hit, and
+// the distances to them.
+//
+// The shader's test finds d, the distance from the sphere's center to the ray, and the ray hits
+// if that's less than the radius (or under 0.01, counting as dead on). Since the ray's unit
+// length, d is the length of dir x (center - start), and is compared squared to save a square
+// root. The hit is then x = sqrt(r^2 - d^2) back along the ray from the point nearest the center,
+// so its distance is |t - x|, with t the distance along the ray to that nearest point.
+static __m128 IntersectSpheres4(const SphereArrays& spheres, int i, __m128 start[3], __m128 dir[3], __m128* dist)
+{
+    __m128 ocx = _mm_sub_ps(_mm_loadu_ps(spheres.CenterX + i), start[0]);
+    __m128 ocy = _mm_sub_ps(_mm_loadu_ps(spheres.CenterY + i), start[1]);
+    __m128 ocz = _mm_sub_ps(_mm_loadu_ps(spheres.CenterZ + i), start[2]);
+    __m128 radius = _mm_loadu_ps(spheres.Radius + i);
+
+    __m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ocx, dir[0]), _mm_mul_ps(ocy, dir[1])), _mm_mul_ps(ocz, dir[2]));
+
+    __m128 ax = _mm_sub_ps(_mm_mul_ps(dir[1], ocz), _mm_mul_ps(dir[2], ocy));
+    __m128 ay = _mm_sub_ps(_mm_mul_ps(dir[2], ocx), _mm_mul_ps(dir[0], ocz));
+    __m128 az = _mm_sub_ps(_mm_mul_ps(dir[0], ocy), _mm_mul_ps(dir[1], ocx));
+    __m128 dSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, ax), _mm_mul_ps(ay, ay)), _mm_mul_ps(az, az));
+    __m128 radiusSq = _mm_mul_ps(radius, radius);
+
+    __m128 zero = _mm_setzero_ps();
+    __m128 hit = _mm_and_ps(_mm_cmpgt_ps(t, zero), _mm_cmpgt_ps(radius, zero));
+    hit = _mm_and_ps(hit, _mm_or_ps(_mm_cmplt_ps(dSq, _mm_set1_ps(0.0001f)), _mm_cmplt_ps(dSq, radiusSq)));
+
+    __m128 x = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(radiusSq, dSq), zero));
+    __m128 signBit = _mm_set1_ps(-0.0f);
+    *dist = _mm_andnot_ps(signBit, _mm_sub_ps(t, x));
+    return hit;
+}
+
+static void LoadRay(const float* start, const float* dir, __m128 starts[3], __m128 dirs[3])
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        starts[i] = _mm_set1_ps(start[i]);
+        dirs[i] = _mm_set1_ps(dir[i]);
+    }
+}
+
+int FindNearestSphereSse(const SphereArrays& spheres, const float* start, const float* dir)
+{
+    __m128 starts[3], dirs[3];
+    LoadRay(start, dir, starts, dirs);
+
+    // Nearest hit in each lane so far
+    __m128 nearest = _mm_set1_ps(FLT_MAX);
+    __m128i nearestIndex = _mm_set1_epi32(-1);
+    __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i four = _mm_set1_epi32(4);
+
+    for (int i = 0; i < spheres.Count; i += 4)
+    {
+        __m128 dist;
+        __m128 hit = IntersectSpheres4(spheres, i, starts, dirs, &dist);
+        hit = _mm_and_ps(hit, _mm_cmplt_ps(dist, nearest));
+        nearest = _mm_or_ps(_mm_and_ps(hit, dist), _mm_andnot_ps(hit, nearest));
+        nearestIndex = _mm_or_si128(_mm_and_si128(_mm_castps_si128(hit), index),
+            _mm_andnot_si128(_mm_castps_si128(hit), nearestIndex));
+        index = _mm_add_epi32(index, four);
+    }
+
+    // Nearest of the lanes, taking the first sphere if they're the same distance like the shader does
+    float dists[4];
+    int indices[4];
+    _mm_storeu_ps(dists, nearest);
+    _mm_storeu_si128((__m128i*)indices, nearestIndex);
+
+    int result = -1;
+    for (int lane = 0; lane < 4; ++lane)
+    {
+        if (indices[lane] >= 0 &&
+            (result < 0 || dists[lane] < dists[result] || (dists[lane] == dists[result] && indices[lane] < indices[result])))
+        {
+            result = lane;
+        }
+    }
+    return result < 0 ? -1 : indices[result];
+}
+
+bool HitsAnySphereSse(const SphereArrays& spheres, const float* start, const float* dir)
+{
+    __m128 starts[3], dirs[3];
+    LoadRay(start, dir, starts, dirs);
+
+    for (int i = 0; i < spheres.Count; i += 4)
+    {
+        __m128 dist;
+        if (_mm_movemask_ps(IntersectSpheres4(spheres, i, starts, dirs, &dist)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+// Ray vs. sphere tests over many spheres at once, for the CPU ray tracer. Each lane does the same
+// test as RaySphereIntersect in RaytraceCS.hlsl: spheres behind the start of the ray are missed,
+// and spheres are hit from the inside as well as the outside. Rays must be normalized.
+//
+// The AVX2 versions are built in their own file with AVX2 code generation, so nothing else is
+// compiled for AVX2 by accident, and they must only be called if the CPU supports it. This header
+// is included there too, so it can't rely on the precompiled header.
+
+// Spheres as separate arrays of each component. There can be extra spheres at the end to make up a
+// multiple of 8 (with a negative radius, so they're never hit).
+struct SphereArrays
+{
+    const float* CenterX;
+    const float* CenterY;
+    const float* CenterZ;
+    const float* Radius;
+    int Count;          // Multiple of 8
+};
+
+// Index of the sphere that a ray hits nearest to its start, or -1 if it doesn't hit any.
+// start & dir are x, y, z.
+int FindNearestSphereSse(const SphereArrays& spheres, const float* start, const float* dir);
+int FindNearestSphereAvx2(const SphereArrays& spheres, const float* start, const float* dir);
+
+// Whether a ray hits any sphere at all
+bool HitsAnySphereSse(const SphereArrays& spheres, const float* start, const float* dir);
+bool HitsAnySphereAvx2(const SphereArrays& spheres, const float* start, const float* dir);
@@ -0,0 +1,98 @@
+// Built with AVX2 code generation, and without the precompiled header (see SphereKernels.h).
+// Only intrinsics are used in here, since any inline function from another header could be
+// compiled for AVX2 here and then used by the rest of the program on CPUs without it.
+#include <immintrin.h>
+#include <float.h>
+#include "SphereKernels.h"
+
+// The same test as IntersectSpheres4 in SphereKernels.cpp, on 8 spheres
+static __m256 IntersectSpheres8(const SphereArrays& spheres, int i, __m256 start[3], __m256 dir[3], __m256* dist)
+{
+    __m256 ocx = _mm256_sub_ps(_mm256_loadu_ps(spheres.CenterX + i), start[0]);
+    __m256 ocy = _mm256_sub_ps(_mm256_loadu_ps(spheres.CenterY + i), start[1]);
+    __m256 ocz = _mm256_sub_ps(_mm256_loadu_ps(spheres.CenterZ + i), start[2]);
+    __m256 radius = _mm256_loadu_ps(spheres.Radius + i);
+
+    __m256 t = _mm256_fmadd_ps(ocz, dir[2], _mm256_fmadd_ps(ocy, dir[1], _mm256_mul_ps(ocx, dir[0])));
+
+    __m256 ax = _mm256_fmsub_ps(dir[1], ocz, _mm256_mul_ps(dir[2], ocy));
+    __m256 ay = _mm256_fmsub_ps(dir[2], ocx, _mm256_mul_ps(dir[0], ocz));
+    __m256 az = _mm256_fmsub_ps(dir[0], ocy, _mm256_mul_ps(dir[1], ocx));
+    __m256 dSq = _mm256_fmadd_ps(az, az, _mm256_fmadd_ps(ay, ay, _mm256_mul_ps(ax, ax)));
+    __m256 radiusSq = _mm256_mul_ps(radius, radius);
+
+    __m256 zero = _mm256_setzero_ps();
+    __m256 hit = _mm256_and_ps(_mm256_cmp_ps(t, zero, _CMP_GT_OQ), _mm256_cmp_ps(radius, zero, _CMP_GT_OQ));
+    hit = _mm256_and_ps(hit, _mm256_or_ps(_mm256_cmp_ps(dSq, _mm256_set1_ps(0.0001f), _CMP_LT_OQ),
+        _mm256_cmp_ps(dSq, radiusSq, _CMP_LT_OQ)));
+
+    __m256 x = _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(radiusSq, dSq), zero));
+    *dist = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_sub_ps(t, x));
+    return hit;
+}
+
+static void LoadRay(const float* start, const float* dir, __m256 starts[3], __m256 dirs[3])
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        starts[i] = _mm256_set1_ps(start[i]);
+        dirs[i] = _mm256_set1_ps(dir[i]);
+    }
+}
+
+int FindNearestSphereAvx2(const SphereArrays& spheres, const float* start, const float* dir)
+{
+    __m256 starts[3], dirs[3];
+    LoadRay(start, dir, starts, dirs);
+
+    __m256 nearest = _mm256_set1_ps(FLT_MAX);
+    __m256i nearestIndex = _mm256_set1_epi32(-1);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i eight = _mm256_set1_epi32(8);
+
+    for (int i = 0; i < spheres.Count; i += 8)
+    {
+        __m256 dist;
+        __m256 hit = IntersectSpheres8(spheres, i, starts, dirs, &dist);
+        hit = _mm256_and_ps(hit, _mm256_cmp_ps(dist, nearest, _CMP_LT_OQ));
+        nearest = _mm256_blendv_ps(nearest, dist, hit);
+        nearestIndex = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(nearestIndex),
+            _mm256_castsi256_ps(index), hit));
+        index = _mm256_add_epi32(index, eight);
+    }
+
+    float dists[8];
+    int indices[8];
+    _mm256_storeu_ps(dists, nearest);
+    _mm256_storeu_si256((__m256i*)indices, nearestIndex);
+
+    // Leave the upper halves of the registers clean before going back to SSE code
+    _mm256_zeroupper();
+
+    int result = -1;
+    for (int lane = 0; lane < 8; ++lane)
+    {
+        if (indices[lane] >= 0 &&
+            (result < 0 || dists[lane] < dists[result] || (dists[lane] == dists[result] && indices[lane] < indices[result])))
+        {
+            result = lane;
+        }
+    }
+    return result < 0 ? -1 : indices[result];
+}
+
+bool HitsAnySphereAvx2(const SphereArrays& spheres, const float* start, const float* dir)
+{
+    __m256 starts[3], dirs[3];
+    LoadRay(start, dir, starts, dirs);
+
+    bool hit = false;
+    for (int i = 0; i < spheres.Count && !hit; i += 8)
+    {
+        __m256 dist;
+        hit = _mm256_movemask_ps(IntersectSpheres8(spheres, i, starts, dirs, &dist)) != 0;
+    }
+
+    _mm256_zeroupper();
+    return hit;
+}
@@ -0,0 +1,342 @@
+#include "Precomp.h"
+#include "Debug.h"
+#include "CompressedLightField.h"
+
+// A point on a slab quad, from its texture coordinates. The quad is the unit square around the
+// origin, with texture coordinates (x + 0.5, 0.5 - y).
+static inline XMVECTOR GetQuadPoint(CXMMATRIX world, float s, float t)
+{
+    return XMVectorAdd(world.r[3], XMVectorAdd(XMVectorScale(world.r[0], s - 0.5f), XMVectorScale(world.r[1], 0.5f - t)));
+}
+
+// True if a rectangle of a slab quad can't be seen: all of its corners are behind the camera, or
+// outside the same side of the view. The near and far planes are left alone, since CpuRenderer
+// doesn't clip against them.
+static bool IsOutsideView(CXMMATRIX world, float s0, float t0, float s1, float t1, CXMMATRIX viewProjection)
+{
+    const float corners[4][2] = { { s0, t0 }, { s1, t0 }, { s0, t1 }, { s1, t1 } };
+
+    uint32_t outside = 0x1f;
+    for (int i = 0; i < 4; ++i)
+    {
+        XMFLOAT4 clip;
+        XMStoreFloat4(&clip, XMVector4Transform(GetQuadPoint(world, corners[i][0], corners[i][1]), viewProjection));
+
+        uint32_t flags = 0;
+        flags |= (clip.w <= 0.f) ? 0x01 : 0;
+        flags |= (clip.x < -clip.w) ? 0x02 : 0;
+        flags |= (clip.x > clip.w) ? 0x04 : 0;
+        flags |= (clip.y < -clip.w) ? 0x08 : 0;
+        flags |= (clip.y > clip.w) ? 0x10 : 0;
+        outside &= flags;
+    }
+
+    return outside != 0;
+}
+
+std::unique_ptr<CompressedLightField> CompressedLightField::Create(const wchar_t* filename)
+{
+    std::unique_ptr<CompressedLightField> lightField(new CompressedLightField());
+    if (lightField)
+    {
+        if (!lightField->Initialize(filename))
+        {
+            LogError(L"Failed to open compressed light field.");
+            return nullptr;
+        }
+
+        return lightField;
+    }
+    return nullptr;
+}
+
+CompressedLightField::CompressedLightField()
+    : File(INVALID_HANDLE_VALUE)
+    , Mapping(nullptr)
+    , Data(nullptr)
+    , Size(0)
+    , Header(nullptr)
+    , Slabs(nullptr)
+{
+}
+
+CompressedLightField::~CompressedLightField()
+{
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+    }
+
+    if (Mapping)
+    {
+        CloseHandle(Mapping);
+    }
+
+    if (File != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(File);
+    }
+}
+
+bool CompressedLightField::Initialize(const wchar_t* filename)
+{
+    File = CreateFile(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        LogError(L"Failed to open compressed light field file.");
+        return false;
+    }
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(File, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(CompressedLightFieldHeader))
+    {
+        LogError(L"Not a compressed light field file.");
+        return false;
+    }
+    Size = (uint64_t)fileSize.QuadPart;
+
+    Mapping = CreateFileMapping(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!Mapping)
+    {
+        LogError(L"Failed to create file mapping.");
+        return false;
+    }
+
+    Data = static_cast<const uint8_t*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!Data)
+    {
+        LogError(L"Failed to map compressed light field file.");
+        return false;
+    }
+
+    Header = reinterpret_cast<const CompressedLightFieldHeader*>(Data);
+    if (Header->Magic != CompressedLightFieldMagic || Header->Version != CompressedLightFieldVersion)
+    {
+        LogError(L"Not a compressed light field file.");
+        return false;
+    }
+
+    if ((Header->Format != DXGI_FORMAT_BC1_UNORM && Header->Format != DXGI_FORMAT_BC7_UNORM) ||
+        Header->AngularResolution < 1 || Header->SpatialResolution < 4 || (Header->SpatialResolution % 4) != 0 ||
+        Header->TileViews < 1 || Header->TileTexels < 4 || (Header->TileTexels % 4) != 0)
+    {
+        LogError(L"Invalid compressed light field header.");
+        return false;
+    }
+
+    // Make sure the slab table and tile indices are in the file, so lookups don't need checking later
+    uint64_t slabTableEnd = sizeof(CompressedLightFieldHeader) + (uint64_t)sizeof(CompressedLightFieldSlab) * Header->NumSlabs;
+    if (slabTableEnd > Size)
+    {
+        LogError(L"Compressed light field slab table is truncated.");
+        return false;
+    }
+
+    Slabs = reinterpret_cast<const CompressedLightFieldSlab*>(Data + sizeof(CompressedLightFieldHeader));
+
+    uint64_t tileIndexSize = (uint64_t)sizeof(CompressedLightFieldTile) * GetNumCompressedTiles(*Header);
+    for (uint32_t i = 0; i < Header->NumSlabs; ++i)
+    {
+        if (Slabs[i].TileIndexOffset > Size || tileIndexSize > Size - Slabs[i].TileIndexOffset ||
+            (Slabs[i].TileIndexOffset % sizeof(uint64_t)) != 0)
+        {
+            LogError(L"Compressed light field tile index is truncated.");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void CompressedLightField::GetTileDimensions(uint32_t tileU, uint32_t tileV, uint32_t tileS, uint32_t tileT,
+    uint32_t* viewsWide, uint32_t* viewsHigh, uint32_t* blocksWide, uint32_t* blocksHigh) const
+{
+    *viewsWide = min(Header->TileViews, Header->AngularResolution - tileU * Header->TileViews);
+    *viewsHigh = min(Header->TileViews, Header->AngularResolution - tileV * Header->TileViews);
+    *blocksWide = min(Header->TileTexels, Header->SpatialResolution - tileS * Header->TileTexels) / 4;
+    *blocksHigh = min(Header->TileTexels, Header->SpatialResolution - tileT * Header->TileTexels) / 4;
+}
+
+bool CompressedLightField::DecodeTile(uint32_t slab, uint32_t tileU, uint32_t tileV, uint32_t tileS, uint32_t tileT, uint8_t* blocks) const
+{
+    assert(slab < Header->NumSlabs);
+
+    const CompressedLightFieldTile* tileIndex = reinterpret_cast<const CompressedLightFieldTile*>(Data + Slabs[slab].TileIndexOffset);
+    const CompressedLightFieldTile& tile = tileIndex[GetCompressedTileIndex(*Header, tileU, tileV, tileS, tileT)];
+    if (tile.Offset > Size || tile.Size > Size - tile.Offset)
+    {
+        LogError(L"Compressed light field tile is out of range.");
+        return false;
+    }
+
+    uint32_t viewsWide, viewsHigh, blocksWide, blocksHigh;
+    GetTileDimensions(tileU, tileV, tileS, tileT, &viewsWide, &viewsHigh, &blocksWide, &blocksHigh);
+
+    uint32_t blockSize = GetCompressedBlockSize(*Header);
+    uint32_t numBlocks = blocksWide * blocksHigh;
+    uint32_t viewSize = numBlocks * blockSize;
+    uint32_t maskSize = (numBlocks + 7) / 8;
+
+    const uint8_t* data = Data + tile.Offset;
+    const uint8_t* end = data + tile.Size;
+
+    for (uint32_t y = 0; y < viewsHigh; ++y)
+    {
+        for (uint32_t x = 0; x < viewsWide; ++x)
+        {
+            uint8_t* view = blocks + (y * viewsWide + x) * viewSize;
+
+            // Views are predicted from the view to the left, or above for the first column
+            const uint8_t* reference = nullptr;
+            if (x > 0)
+            {
+                reference = view - viewSize;
+            }
+            else if (y > 0)
+            {
+                reference = view - viewsWide * viewSize;
+            }
+
+            if ((uint64_t)(end - data) < maskSize)
+            {
+                LogError(L"Compressed light field tile is truncated.");
+                return false;
+            }
+
+            const uint8_t* mask = data;
+            data += maskSize;
+
+            for (uint32_t i = 0; i < numBlocks; ++i)
+            {
+                if (mask[i / 8] & (1 << (i % 8)))
+                {
+                    if ((uint64_t)(end - data) < blockSize)
+                    {
+                        LogError(L"Compressed light field tile is truncated.");
+                        return false;
+                    }
+
+                    memcpy(view + i * blockSize, data, blockSize);
+                    data += blockSize;
+                }
+                else
+                {
+                    if (!reference)
+                    {
+                        LogError(L"Compressed light field tile predicts from a missing view.");
+                        return false;
+                    }
+
+                    memcpy(view + i * blockSize, reference + i * blockSize, blockSize);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void CompressedLightField::GetVisibleTiles(uint32_t slab, FXMMATRIX cameraView, CXMMATRIX cameraProjection, std::vector<uint32_t>* tiles) const
+{
+    assert(slab < Header->NumSlabs);
+
+    tiles->clear();
+
+    XMMATRIX uvWorld = XMLoadFloat4x4(&Slabs[slab].uvQuadWorld);
+    XMMATRIX stWorld = XMLoadFloat4x4(&Slabs[slab].stQuadWorld);
+    XMMATRIX viewProjection = cameraView * cameraProjection;
+    XMVECTOR eye = XMMatrixInverse(nullptr, cameraView).r[3];
+
+    // The quads are back face culled, so the slab is only seen from behind both planes
+    XMVECTOR forward = XMVector3Normalize(stWorld.r[2]);
+    float uvDistance = XMVectorGetX(XMVector3Dot(XMVectorSubtract(uvWorld.r[3], eye), forward));
+    float stDistance = XMVectorGetX(XMVector3Dot(XMVectorSubtract(stWorld.r[3], eye), forward));
+    if (uvDistance <= 0.f || stDistance <= 0.f)
+    {
+        return;
+    }
+
+    // For measuring st texture coordinates along the quad's scaled right and up axes
+    XMVECTOR stRight = XMVectorDivide(stWorld.r[0], XMVector3LengthSq(stWorld.r[0]));
+    XMVECTOR stUp = XMVectorDivide(stWorld.r[1], XMVector3LengthSq(stWorld.r[1]));
+
+    float angular = (float)Header->AngularResolution;
+    float spatial = (float)Header->SpatialResolution;
+    uint32_t numViewTiles = GetNumViewTiles(*Header);
+
+    for (uint32_t tileV = 0; tileV < numViewTiles; ++tileV)
+    {
+        for (uint32_t tileU = 0; tileU < numViewTiles; ++tileU)
+        {
+            // Views are filtered in pairs, floor(u * AngularResolution) and the one after it, so a
+            // tile's first view is also used by rays landing in the view before it
+            uint32_t firstViewU = tileU * Header->TileViews;
+            uint32_t firstViewV = tileV * Header->TileViews;
+            float u0 = max((float)firstViewU - 1.f, 0.f) / angular;
+            float v0 = max((float)firstViewV - 1.f, 0.f) / angular;
+            float u1 = min((float)(firstViewU + Header->TileViews), angular) / angular;
+            float v1 = min((float)(firstViewV + Header->TileViews), angular) / angular;
+
+            if (IsOutsideView(uvWorld, u0, v0, u1, v1, viewProjection))
+            {
+                continue;
+            }
+
+            // Follow the rays from the eye through the corners of that part of the uv plane on to
+            // the st plane. The planes are parallel, so the rays land in the bounds of the corners.
+            const float corners[4][2] = { { u0, v0 }, { u1, v0 }, { u0, v1 }, { u1, v1 } };
+            float s0 = FLT_MAX;
+            float t0 = FLT_MAX;
+            float s1 = -FLT_MAX;
+            float t1 = -FLT_MAX;
+            for (int i = 0; i < 4; ++i)
+            {
+                XMVECTOR dir = XMVectorSubtract(GetQuadPoint(uvWorld, corners[i][0], corners[i][1]), eye);
+                float h = stDistance / XMVectorGetX(XMVector3Dot(dir, forward));
+                XMVECTOR fromCenter = XMVectorSubtract(XMVectorMultiplyAdd(dir, XMVectorReplicate(h), eye), stWorld.r[3]);
+
+                float s = XMVectorGetX(XMVector3Dot(fromCenter, stRight)) + 0.5f;
+                float t = 0.5f - XMVectorGetX(XMVector3Dot(fromCenter, stUp));
+                s0 = min(s0, s);
+                t0 = min(t0, t);
+                s1 = max(s1, s);
+                t1 = max(t1, t);
+            }
+
+            // Widened by a texel for rounding, and clamped to the quad, which rays have to cross
+            s0 = max(s0 - 1.f / spatial, 0.f);
+            t0 = max(t0 - 1.f / spatial, 0.f);
+            s1 = min(s1 + 1.f / spatial, 1.f);
+            t1 = min(t1 + 1.f / spatial, 1.f);
+            if (s0 > s1 || t0 > t1)
+            {
+                continue;
+            }
+
+            // Texels are filtered bilinearly around centers at half coordinates
+            uint32_t lastTexel = Header->SpatialResolution - 1;
+            uint32_t firstS = (uint32_t)max(floorf(s0 * spatial - 0.5f), 0.f);
+            uint32_t firstT = (uint32_t)max(floorf(t0 * spatial - 0.5f), 0.f);
+            uint32_t lastS = min((uint32_t)max(floorf(s1 * spatial - 0.5f) + 1.f, 0.f), lastTexel);
+            uint32_t lastT = min((uint32_t)max(floorf(t1 * spatial - 0.5f) + 1.f, 0.f), lastTexel);
+
+            for (uint32_t tileT = firstT / Header->TileTexels; tileT <= lastT / Header->TileTexels; ++tileT)
+            {
+                for (uint32_t tileS = firstS / Header->TileTexels; tileS <= lastS / Header->TileTexels; ++tileS)
+                {
+                    // The part of the st plane that this tile's texels are filtered over, and that the rays reach
+                    float tileS0 = max(((float)(tileS * Header->TileTexels) - 0.5f) / spatial, s0);
+                    float tileT0 = max(((float)(tileT * Header->TileTexels) - 0.5f) / spatial, t0);
+                    float tileS1 = min(((float)((tileS + 1) * Header->TileTexels) + 0.5f) / spatial, s1);
+                    float tileT1 = min(((float)((tileT + 1) * Header->TileTexels) + 0.5f) / spatial, t1);
+
+                    if (!IsOutsideView(stWorld, tileS0, tileT0, tileS1, tileT1, viewProjection))
+                    {
+                        tiles->push_back(GetCompressedTileIndex(*Header, tileU, tileV, tileS, tileT));
+                    }
+                }
+            }
+        }
+    }
+}
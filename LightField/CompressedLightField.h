@@ -0,0 +1,53 @@
+#pragma once
+
+#include "LightFieldFile.h"
+
+// Read only access to a compressed light field file (see LightFieldFile.h).
+// The file is memory mapped, and only the header, slab table and tile indices are
+// looked at up front. The pages holding a tile's data are read from disk the first
+// time that tile is decoded, so a viewer only pulls in the tiles it samples (see
+// GetVisibleTiles).
+class CompressedLightField
+{
+public:
+    static std::unique_ptr<CompressedLightField> Create(const wchar_t* filename);
+    ~CompressedLightField();
+
+    const CompressedLightFieldHeader& GetHeader() const { return *Header; }
+    const CompressedLightFieldSlab& GetSlab(uint32_t slab) const { return Slabs[slab]; }
+
+    // Returns the number of views and blocks along each side of a tile. Tiles on the
+    // far edges of the uv and st planes can be smaller than the header's tile size.
+    void GetTileDimensions(uint32_t tileU, uint32_t tileV, uint32_t tileS, uint32_t tileT,
+        uint32_t* viewsWide, uint32_t* viewsHigh, uint32_t* blocksWide, uint32_t* blocksHigh) const;
+
+    // Decodes the BC blocks of every view in a tile, one view after another in row major
+    // order, each view's blocks in row major order too. The output must have room for the
+    // tile's views * blocks (see GetTileDimensions) * GetCompressedBlockSize bytes.
+    bool DecodeTile(uint32_t slab, uint32_t tileU, uint32_t tileV, uint32_t tileS, uint32_t tileT, uint8_t* blocks) const;
+
+    // Finds the tiles of a slab that a camera can sample, as tile indices (see GetCompressedTileIndex).
+    // For each tile of views, the rays from the eye through the part of the uv plane those views are
+    // filtered over are followed on to the st plane, and the tiles of texels they land in (widened by
+    // the bilinear footprint) are kept if they're in view. The result errs on the side of too many.
+    void GetVisibleTiles(uint32_t slab, FXMMATRIX cameraView, CXMMATRIX cameraProjection, std::vector<uint32_t>* tiles) const;
+
+private:
+    CompressedLightField();
+
+    // No copy
+    CompressedLightField(const CompressedLightField&);
+    CompressedLightField& operator= (const CompressedLightField&);
+
+    bool Initialize(const wchar_t* filename);
+
+private:
+    HANDLE File;
+    HANDLE Mapping;
+    const uint8_t* Data;
+    uint64_t Size;
+
+    // Point into the mapped file
+    const CompressedLightFieldHeader* Header;
+    const CompressedLightFieldSlab* Slabs;
+};
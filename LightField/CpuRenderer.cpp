@@ -0,0 +1,813 @@
+#include "Precomp.h"
+#include "Debug.h"
+#include "CpuRenderer.h"
+#include "LightFieldFile.h"
+#include "CompressedLightField.h"
+
+// Background, as cleared by Renderer::Clear
+static const uint32_t ClearColor = 0xff000000;
+
+// x offsets of the pixel centers in each lane
+static const XMVECTORF32 LaneOffsets = { 0.5f, 1.5f, 2.5f, 3.5f };
+
+// Multiplies the 3 color channels of 4 R8G8B8A8 texels (one per lane) by weight, and adds them in
+static inline void AccumulateTexels(__m128i texels, FXMVECTOR weight, XMVECTOR* red, XMVECTOR* green, XMVECTOR* blue)
+{
+    const __m128i channelMask = _mm_set1_epi32(0xff);
+    *red = XMVectorMultiplyAdd(_mm_cvtepi32_ps(_mm_and_si128(texels, channelMask)), weight, *red);
+    *green = XMVectorMultiplyAdd(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(texels, 8), channelMask)), weight, *green);
+    *blue = XMVectorMultiplyAdd(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(texels, 16), channelMask)), weight, *blue);
+}
+
+// Clamps to [0, max], with NaNs going to 0
+static inline XMVECTOR ClampCoordinate(FXMVECTOR v, FXMVECTOR maxValue)
+{
+    return XMVectorMin(XMVectorMax(v, XMVectorZero()), maxValue);
+}
+
+// Quadrilinear filtered sample of the slab at 4 pixels' (u, v, s, t), one per lane, the same as
+// RenderUVPlanePS with a linear, clamped sampler: the 2x2 slices nearest (u, v) are each sampled
+// bilinearly at (s, t), and blended by their distance from (u, v). Channels are returned in 0-255.
+static void SampleSlab(const CpuLightSlab& slab, FXMVECTOR u, FXMVECTOR v, FXMVECTOR s, GXMVECTOR t,
+    XMVECTOR* red, XMVECTOR* green, XMVECTOR* blue)
+{
+    XMVECTOR one = XMVectorSplatOne();
+    XMVECTOR angular = XMVectorReplicate((float)slab.AngularResolution);
+    XMVECTOR lastSlice = XMVectorReplicate((float)(slab.AngularResolution - 1));
+    XMVECTOR spatial = XMVectorReplicate((float)slab.SpatialResolution);
+    XMVECTOR lastTexel = XMVectorReplicate((float)(slab.SpatialResolution - 1));
+
+    // Slices on either side of (u, v)
+    XMVECTOR sliceX = XMVectorMultiply(ClampCoordinate(u, one), angular);
+    XMVECTOR sliceY = XMVectorMultiply(ClampCoordinate(v, one), angular);
+    XMVECTOR x0 = XMVectorMin(XMVectorTruncate(sliceX), lastSlice);
+    XMVECTOR y0 = XMVectorMin(XMVectorTruncate(sliceY), lastSlice);
+    XMVECTOR xLerp = XMVectorSubtract(sliceX, x0);
+    XMVECTOR yLerp = XMVectorSubtract(sliceY, y0);
+    XMVECTOR x1 = XMVectorMin(XMVectorAdd(x0, one), lastSlice);
+    XMVECTOR y1 = XMVectorMin(XMVectorAdd(y0, one), lastSlice);
+
+    // Texels on either side of (s, t), with texel centers at half coordinates
+    XMVECTOR texelX = XMVectorSubtract(XMVectorMultiply(ClampCoordinate(s, one), spatial), g_XMOneHalf);
+    XMVECTOR texelY = XMVectorSubtract(XMVectorMultiply(ClampCoordinate(t, one), spatial), g_XMOneHalf);
+    XMVECTOR s0 = XMVectorFloor(texelX);
+    XMVECTOR t0 = XMVectorFloor(texelY);
+    XMVECTOR sLerp = XMVectorSubtract(texelX, s0);
+    XMVECTOR tLerp = XMVectorSubtract(texelY, t0);
+    XMVECTOR s1 = ClampCoordinate(XMVectorAdd(s0, one), lastTexel);
+    XMVECTOR t1 = ClampCoordinate(XMVectorAdd(t0, one), lastTexel);
+    s0 = ClampCoordinate(s0, lastTexel);
+    t0 = ClampCoordinate(t0, lastTexel);
+
+    XMVECTOR sliceWeights[4] =
+    {
+        XMVectorMultiply(XMVectorSubtract(one, xLerp), XMVectorSubtract(one, yLerp)),
+        XMVectorMultiply(xLerp, XMVectorSubtract(one, yLerp)),
+        XMVectorMultiply(XMVectorSubtract(one, xLerp), yLerp),
+        XMVectorMultiply(xLerp, yLerp),
+    };
+
+    XMVECTOR texelWeights[4] =
+    {
+        XMVectorMultiply(XMVectorSubtract(one, sLerp), XMVectorSubtract(one, tLerp)),
+        XMVectorMultiply(sLerp, XMVectorSubtract(one, tLerp)),
+        XMVectorMultiply(XMVectorSubtract(one, sLerp), tLerp),
+        XMVectorMultiply(sLerp, tLerp),
+    };
+
+    // Tiles of the 4 slices & 2x2 texels in each lane, and where the slices and texels are in their
+    // tiles. Tiles are found with a multiply by the reciprocal of the tile size, which is safe on
+    // integers once they're moved half way between tile boundaries.
+    XMVECTOR tileViews = XMVectorReplicate((float)slab.TileViews);
+    XMVECTOR tileTexels = XMVectorReplicate((float)slab.TileTexels);
+    XMVECTOR invTileViews = XMVectorReciprocal(tileViews);
+    XMVECTOR invTileTexels = XMVectorReciprocal(tileTexels);
+    XMVECTOR numViewTiles = XMVectorReplicate((float)slab.NumViewTiles);
+    XMVECTOR numTexelTiles = XMVectorReplicate((float)slab.NumTexelTiles);
+    XMVECTOR texelTilesPerViewTile = XMVectorReplicate((float)(slab.NumTexelTiles * slab.NumTexelTiles));
+
+    XMVECTOR tileX0 = XMVectorFloor(XMVectorMultiply(XMVectorAdd(x0, g_XMOneHalf), invTileViews));
+    XMVECTOR tileX1 = XMVectorFloor(XMVectorMultiply(XMVectorAdd(x1, g_XMOneHalf), invTileViews));
+    XMVECTOR tileY0 = XMVectorFloor(XMVectorMultiply(XMVectorAdd(y0, g_XMOneHalf), invTileViews));
+    XMVECTOR tileY1 = XMVectorFloor(XMVectorMultiply(XMVectorAdd(y1, g_XMOneHalf), invTileViews));
+    XMVECTOR tileS0 = XMVectorFloor(XMVectorMultiply(XMVectorAdd(s0, g_XMOneHalf), invTileTexels));
+    XMVECTOR tileS1 = XMVectorFloor(XMVectorMultiply(XMVectorAdd(s1, g_XMOneHalf), invTileTexels));
+    XMVECTOR tileT0 = XMVectorFloor(XMVectorMultiply(XMVectorAdd(t0, g_XMOneHalf), invTileTexels));
+    XMVECTOR tileT1 = XMVectorFloor(XMVectorMultiply(XMVectorAdd(t1, g_XMOneHalf), invTileTexels));
+
+    XMVECTOR viewX0 = XMVectorNegativeMultiplySubtract(tileX0, tileViews, x0);
+    XMVECTOR viewX1 = XMVectorNegativeMultiplySubtract(tileX1, tileViews, x1);
+    XMVECTOR viewY0 = XMVectorNegativeMultiplySubtract(tileY0, tileViews, y0);
+    XMVECTOR viewY1 = XMVectorNegativeMultiplySubtract(tileY1, tileViews, y1);
+
+    // Offsets into the tile table, split into the tile of views and the tile of texels, which are added
+    // together a lane at a time when gathering. The offsets into the tiles are multiplied out in
+    // integers, since they can be past what a float holds exactly.
+    int32_t sliceTiles[4][4], sliceViews[4][4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sliceTiles[0]), _mm_cvttps_epi32(XMVectorMultiply(XMVectorMultiplyAdd(tileY0, numViewTiles, tileX0), texelTilesPerViewTile)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sliceTiles[1]), _mm_cvttps_epi32(XMVectorMultiply(XMVectorMultiplyAdd(tileY0, numViewTiles, tileX1), texelTilesPerViewTile)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sliceTiles[2]), _mm_cvttps_epi32(XMVectorMultiply(XMVectorMultiplyAdd(tileY1, numViewTiles, tileX0), texelTilesPerViewTile)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sliceTiles[3]), _mm_cvttps_epi32(XMVectorMultiply(XMVectorMultiplyAdd(tileY1, numViewTiles, tileX1), texelTilesPerViewTile)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sliceViews[0]), _mm_cvttps_epi32(XMVectorMultiplyAdd(viewY0, tileViews, viewX0)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sliceViews[1]), _mm_cvttps_epi32(XMVectorMultiplyAdd(viewY0, tileViews, viewX1)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sliceViews[2]), _mm_cvttps_epi32(XMVectorMultiplyAdd(viewY1, tileViews, viewX0)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sliceViews[3]), _mm_cvttps_epi32(XMVectorMultiplyAdd(viewY1, tileViews, viewX1)));
+
+    int32_t texelTiles[4][4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(texelTiles[0]), _mm_cvttps_epi32(XMVectorMultiplyAdd(tileT0, numTexelTiles, tileS0)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(texelTiles[1]), _mm_cvttps_epi32(XMVectorMultiplyAdd(tileT0, numTexelTiles, tileS1)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(texelTiles[2]), _mm_cvttps_epi32(XMVectorMultiplyAdd(tileT1, numTexelTiles, tileS0)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(texelTiles[3]), _mm_cvttps_epi32(XMVectorMultiplyAdd(tileT1, numTexelTiles, tileS1)));
+
+    int32_t columns[2][4], rows[2][4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(columns[0]), _mm_cvttps_epi32(XMVectorNegativeMultiplySubtract(tileS0, tileTexels, s0)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(columns[1]), _mm_cvttps_epi32(XMVectorNegativeMultiplySubtract(tileS1, tileTexels, s1)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(rows[0]), _mm_cvttps_epi32(XMVectorNegativeMultiplySubtract(tileT0, tileTexels, t0)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(rows[1]), _mm_cvttps_epi32(XMVectorNegativeMultiplySubtract(tileT1, tileTexels, t1)));
+
+    size_t texelOffsets[4][4];
+    for (int lane = 0; lane < 4; ++lane)
+    {
+        texelOffsets[0][lane] = (size_t)rows[0][lane] * slab.RowPitch + columns[0][lane];
+        texelOffsets[1][lane] = (size_t)rows[0][lane] * slab.RowPitch + columns[1][lane];
+        texelOffsets[2][lane] = (size_t)rows[1][lane] * slab.RowPitch + columns[0][lane];
+        texelOffsets[3][lane] = (size_t)rows[1][lane] * slab.RowPitch + columns[1][lane];
+    }
+
+    *red = XMVectorZero();
+    *green = XMVectorZero();
+    *blue = XMVectorZero();
+
+    for (int i = 0; i < 4; ++i)
+    {
+        uint32_t texels[4][4];
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const uint32_t* const* tiles = slab.Tiles + sliceTiles[i][lane];
+            size_t view = (size_t)sliceViews[i][lane] * slab.ViewPitch;
+            for (int j = 0; j < 4; ++j)
+            {
+                texels[j][lane] = tiles[texelTiles[j][lane]][view + texelOffsets[j][lane]];
+            }
+        }
+
+        for (int j = 0; j < 4; ++j)
+        {
+            AccumulateTexels(_mm_loadu_si128(reinterpret_cast<const __m128i*>(texels[j])), XMVectorMultiply(sliceWeights[i], texelWeights[j]),
+                red, green, blue);
+        }
+    }
+}
+
+std::unique_ptr<CpuRenderer> CpuRenderer::Create(uint32_t width, uint32_t height, uint32_t numThreads)
+{
+    std::unique_ptr<CpuRenderer> renderer(new CpuRenderer(width, height, numThreads));
+    if (renderer)
+    {
+        if (!renderer->Initialize())
+        {
+            LogError(L"Failed to initialize CPU renderer.");
+            return nullptr;
+        }
+
+        return renderer;
+    }
+    return nullptr;
+}
+
+CpuRenderer::CpuRenderer(uint32_t width, uint32_t height, uint32_t numThreads)
+    : Width(width)
+    , Height(height)
+    , NumThreads(max(numThreads, 1u))
+    , File(INVALID_HANDLE_VALUE)
+    , Mapping(nullptr)
+    , MappedData(nullptr)
+    , TileCacheSize(512ull << 20)
+    , CachedSize(0)
+    , FrameNumber(0)
+    , Job(nullptr)
+    , JobId(0)
+    , JobsRemaining(0)
+    , Quit(false)
+    , NextRow(0)
+{
+}
+
+CpuRenderer::~CpuRenderer()
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Quit = true;
+    }
+    JobReady.notify_all();
+
+    for (auto& thread : Threads)
+    {
+        thread.join();
+    }
+
+    UnloadLightField();
+}
+
+bool CpuRenderer::Initialize()
+{
+    // Rows are shaded 4 pixels at a time
+    if (Width == 0 || Height == 0 || (Width % 4) != 0)
+    {
+        LogError(L"Invalid render size, width must be a multiple of 4.");
+        return false;
+    }
+
+    Pixels.reset(new uint32_t[Width * Height]);
+
+    for (uint32_t i = 1; i < NumThreads; ++i)
+    {
+        Threads.push_back(std::thread(&CpuRenderer::WorkerThread, this, i));
+    }
+
+    return true;
+}
+
+bool CpuRenderer::LoadLightField(const wchar_t* filename)
+{
+    UnloadLightField();
+
+    FILE* file = nullptr;
+    if (_wfopen_s(&file, filename, L"rb") != 0 || !file)
+    {
+        LogError(L"Failed to open light field file.");
+        return false;
+    }
+
+    uint32_t magic = 0;
+    size_t read = fread(&magic, sizeof(magic), 1, file);
+    fclose(file);
+
+    if (read != 1)
+    {
+        LogError(L"Not a light field file.");
+        return false;
+    }
+
+    bool loaded = (magic == CompressedLightFieldMagic) ? OpenCompressedLightField(filename) : MapLightField(filename);
+    if (!loaded)
+    {
+        UnloadLightField();
+        return false;
+    }
+
+    return true;
+}
+
+bool CpuRenderer::MapLightField(const wchar_t* filename)
+{
+    File = CreateFile(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        LogError(L"Failed to open light field file.");
+        return false;
+    }
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(File, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(LightFieldFileHeader))
+    {
+        LogError(L"Not a light field file.");
+        return false;
+    }
+    uint64_t size = (uint64_t)fileSize.QuadPart;
+
+    Mapping = CreateFileMapping(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!Mapping)
+    {
+        LogError(L"Failed to create file mapping.");
+        return false;
+    }
+
+    MappedData = static_cast<const uint8_t*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!MappedData)
+    {
+        LogError(L"Failed to map light field file.");
+        return false;
+    }
+
+    const LightFieldFileHeader& header = *reinterpret_cast<const LightFieldFileHeader*>(MappedData);
+    if (header.Magic != LightFieldFileMagic || header.Version != LightFieldFileVersion)
+    {
+        LogError(L"Not a light field file.");
+        return false;
+    }
+
+    if (header.AngularResolution < 1 || header.SpatialResolution < 1 ||
+        sizeof(header) + (uint64_t)sizeof(LightFieldFileSlab) * header.NumSlabs > size)
+    {
+        LogError(L"Invalid light field header.");
+        return false;
+    }
+
+    // Each slice is a tile of its own, used where it's mapped
+    uint32_t numSlices = header.AngularResolution * header.AngularResolution;
+    uint64_t sliceSize = GetLightFieldSliceSize(header);
+    TileTables.resize(header.NumSlabs, std::vector<const uint32_t*>(numSlices));
+
+    const LightFieldFileSlab* fileSlabs = reinterpret_cast<const LightFieldFileSlab*>(MappedData + sizeof(header));
+    for (uint32_t i = 0; i < header.NumSlabs; ++i)
+    {
+        const LightFieldFileSlab& fileSlab = fileSlabs[i];
+        if (fileSlab.SliceDataOffset > size || GetLightFieldSlabSize(header) > size - fileSlab.SliceDataOffset ||
+            (fileSlab.SliceDataOffset % sizeof(uint32_t)) != 0)
+        {
+            LogError(L"Light field slices are truncated.");
+            return false;
+        }
+
+        CpuLightSlab slab;
+        slab.ID = fileSlab.ID;
+        slab.uvQuadWorld = fileSlab.uvQuadWorld;
+        slab.stQuadWorld = fileSlab.stQuadWorld;
+        slab.AngularResolution = header.AngularResolution;
+        slab.SpatialResolution = header.SpatialResolution;
+        slab.TileViews = 1;
+        slab.TileTexels = header.SpatialResolution;
+        slab.NumViewTiles = header.AngularResolution;
+        slab.NumTexelTiles = 1;
+        slab.ViewPitch = header.SpatialResolution * header.SpatialResolution;
+        slab.RowPitch = header.SpatialResolution;
+
+        for (uint32_t j = 0; j < numSlices; ++j)
+        {
+            TileTables[i][j] = reinterpret_cast<const uint32_t*>(MappedData + fileSlab.SliceDataOffset + j * sliceSize);
+        }
+        slab.Tiles = TileTables[i].data();
+
+        Slabs.push_back(slab);
+    }
+
+    return true;
+}
+
+bool CpuRenderer::OpenCompressedLightField(const wchar_t* filename)
+{
+    Compressed = CompressedLightField::Create(filename);
+    if (!Compressed)
+    {
+        LogError(L"Failed to open compressed light field file.");
+        return false;
+    }
+
+    // Decoded tiles are all full size, with padding past the edges of the smaller tiles on the far
+    // sides, so every tile has the same layout
+    const CompressedLightFieldHeader& header = Compressed->GetHeader();
+    uint32_t numTiles = GetNumCompressedTiles(header);
+    size_t tileTexels = (size_t)header.TileViews * header.TileViews * header.TileTexels * header.TileTexels;
+
+    EmptyTile.reset(new uint32_t[tileTexels]);
+    memset(EmptyTile.get(), 0, tileTexels * sizeof(uint32_t));
+
+    TileTables.resize(header.NumSlabs, std::vector<const uint32_t*>(numTiles, EmptyTile.get()));
+    DecodedTiles.resize(header.NumSlabs);
+    TileLastUsed.resize(header.NumSlabs, std::vector<uint32_t>(numTiles, 0));
+
+    for (uint32_t i = 0; i < header.NumSlabs; ++i)
+    {
+        const CompressedLightFieldSlab& fileSlab = Compressed->GetSlab(i);
+        DecodedTiles[i].resize(numTiles);
+
+        CpuLightSlab slab;
+        slab.ID = fileSlab.ID;
+        slab.uvQuadWorld = fileSlab.uvQuadWorld;
+        slab.stQuadWorld = fileSlab.stQuadWorld;
+        slab.AngularResolution = header.AngularResolution;
+        slab.SpatialResolution = header.SpatialResolution;
+        slab.TileViews = header.TileViews;
+        slab.TileTexels = header.TileTexels;
+        slab.NumViewTiles = GetNumViewTiles(header);
+        slab.NumTexelTiles = GetNumTexelTiles(header);
+        slab.ViewPitch = header.TileTexels * header.TileTexels;
+        slab.RowPitch = header.TileTexels;
+        slab.Tiles = TileTables[i].data();
+        Slabs.push_back(slab);
+    }
+
+    return true;
+}
+
+void CpuRenderer::UnloadLightField()
+{
+    Slabs.clear();
+    TileTables.clear();
+
+    Compressed.reset();
+    DecodedTiles.clear();
+    TileLastUsed.clear();
+    EmptyTile.reset();
+    CachedSize = 0;
+
+    if (MappedData)
+    {
+        UnmapViewOfFile(MappedData);
+        MappedData = nullptr;
+    }
+
+    if (Mapping)
+    {
+        CloseHandle(Mapping);
+        Mapping = nullptr;
+    }
+
+    if (File != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(File);
+        File = INVALID_HANDLE_VALUE;
+    }
+}
+
+bool CpuRenderer::UpdateTileCache(FXMMATRIX cameraView, CXMMATRIX cameraProjection)
+{
+    ++FrameNumber;
+
+    MissingTiles.clear();
+    for (auto& setup : FrameSlabs)
+    {
+        uint32_t slab = (uint32_t)(setup.Slab - Slabs.data());
+        Compressed->GetVisibleTiles(slab, cameraView, cameraProjection, &VisibleTiles);
+
+        for (auto tile : VisibleTiles)
+        {
+            TileLastUsed[slab][tile] = FrameNumber;
+            if (!DecodedTiles[slab][tile])
+            {
+                TileKey key = { slab, tile };
+                MissingTiles.push_back(key);
+            }
+        }
+    }
+
+    if (MissingTiles.empty())
+    {
+        return true;
+    }
+
+    const CompressedLightFieldHeader& header = Compressed->GetHeader();
+    uint32_t blockSize = GetCompressedBlockSize(header);
+    uint32_t maxTileSize = header.TileViews * header.TileViews * (header.TileTexels / 4) * (header.TileTexels / 4) * blockSize;
+    size_t tileTexels = (size_t)header.TileViews * header.TileViews * header.TileTexels * header.TileTexels;
+    size_t viewPitch = (size_t)header.TileTexels * header.TileTexels;
+
+    EvictTiles(MissingTiles.size() * tileTexels * sizeof(uint32_t));
+
+    // Each thread takes the next missing tile, decodes its blocks, and decompresses each view into
+    // its place in the decoded tile
+    std::atomic<uint32_t> nextTile(0);
+    std::atomic<uint32_t> numDecoded(0);
+    std::atomic<bool> failed(false);
+
+    Run([&](uint32_t)
+    {
+        std::unique_ptr<uint8_t[]> blocks;
+
+        for (uint32_t i = nextTile++; i < MissingTiles.size() && !failed; i = nextTile++)
+        {
+            if (!blocks)
+            {
+                blocks.reset(new uint8_t[maxTileSize]);
+            }
+
+            const TileKey& key = MissingTiles[i];
+            uint32_t tileU, tileV, tileS, tileT;
+            GetCompressedTileCoordinates(header, key.Tile, &tileU, &tileV, &tileS, &tileT);
+
+            if (!Compressed->DecodeTile(key.Slab, tileU, tileV, tileS, tileT, blocks.get()))
+            {
+                failed = true;
+                break;
+            }
+
+            uint32_t viewsWide, viewsHigh, blocksWide, blocksHigh;
+            Compressed->GetTileDimensions(tileU, tileV, tileS, tileT, &viewsWide, &viewsHigh, &blocksWide, &blocksHigh);
+
+            std::unique_ptr<uint32_t[]> decoded(new uint32_t[tileTexels]);
+
+            Image image = {};
+            image.width = blocksWide * 4;
+            image.height = blocksHigh * 4;
+            image.format = (DXGI_FORMAT)header.Format;
+            image.rowPitch = blocksWide * blockSize;
+            image.slicePitch = image.rowPitch * blocksHigh;
+
+            for (uint32_t y = 0; y < viewsHigh && !failed; ++y)
+            {
+                for (uint32_t x = 0; x < viewsWide; ++x)
+                {
+                    image.pixels = blocks.get() + (y * viewsWide + x) * image.slicePitch;
+
+                    ScratchImage decompressed;
+                    if (FAILED(Decompress(image, DXGI_FORMAT_R8G8B8A8_UNORM, decompressed)))
+                    {
+                        failed = true;
+                        break;
+                    }
+
+                    const Image* texels = decompressed.GetImage(0, 0, 0);
+                    uint32_t* dest = decoded.get() + (y * header.TileViews + x) * viewPitch;
+                    for (uint32_t row = 0; row < image.height; ++row)
+                    {
+                        memcpy(dest + row * header.TileTexels, texels->pixels + row * texels->rowPitch, image.width * sizeof(uint32_t));
+                    }
+                }
+            }
+
+            // Every thread works on different tiles, so they can each fill in their own entries
+            TileTables[key.Slab][key.Tile] = decoded.get();
+            DecodedTiles[key.Slab][key.Tile] = std::move(decoded);
+            ++numDecoded;
+        }
+    });
+
+    CachedSize += numDecoded * tileTexels * sizeof(uint32_t);
+
+    if (failed)
+    {
+        LogError(L"Failed to decode compressed light field tiles.");
+        return false;
+    }
+
+    return true;
+}
+
+void CpuRenderer::EvictTiles(uint64_t size)
+{
+    if (CachedSize + size <= TileCacheSize)
+    {
+        return;
+    }
+
+    // Tiles used this frame stay, even if that leaves the cache over its size
+    std::vector<TileKey> unused;
+    for (uint32_t slab = 0; slab < DecodedTiles.size(); ++slab)
+    {
+        for (uint32_t tile = 0; tile < DecodedTiles[slab].size(); ++tile)
+        {
+            if (DecodedTiles[slab][tile] && TileLastUsed[slab][tile] != FrameNumber)
+            {
+                TileKey key = { slab, tile };
+                unused.push_back(key);
+            }
+        }
+    }
+
+    std::sort(unused.begin(), unused.end(), [&](const TileKey& a, const TileKey& b)
+    {
+        return TileLastUsed[a.Slab][a.Tile] < TileLastUsed[b.Slab][b.Tile];
+    });
+
+    const CompressedLightFieldHeader& header = Compressed->GetHeader();
+    uint64_t tileSize = (uint64_t)header.TileViews * header.TileViews * header.TileTexels * header.TileTexels * sizeof(uint32_t);
+
+    for (auto& key : unused)
+    {
+        if (CachedSize + size <= TileCacheSize)
+        {
+            break;
+        }
+
+        TileTables[key.Slab][key.Tile] = EmptyTile.get();
+        DecodedTiles[key.Slab][key.Tile].reset();
+        CachedSize -= tileSize;
+    }
+}
+
+bool CpuRenderer::Render(FXMMATRIX cameraView, FXMMATRIX cameraProjection)
+{
+    XMVECTOR determinant;
+    XMMATRIX inverseViewProjection = XMMatrixInverse(&determinant, cameraView * cameraProjection);
+    if (XMVectorGetX(determinant) == 0.f)
+    {
+        LogError(L"Camera view projection can't be inverted.");
+        return false;
+    }
+
+    XMFLOAT3 eye;
+    XMStoreFloat3(&eye, XMMatrixInverse(nullptr, cameraView).r[3]);
+
+    // Unprojecting points on the far plane but leaving them homogeneous gives eye ray directions
+    // (scaled by w, which is fine for finding where they hit a plane) that are linear in pixel
+    // coordinates, so each slab's plane mappings are worked out once for the whole frame.
+    auto getRayDir = [&](float x, float y)
+    {
+        XMVECTOR position = XMVector4Transform(XMVectorSet(x * 2.f / (float)Width - 1.f, 1.f - y * 2.f / (float)Height, 1.f, 1.f),
+            inverseViewProjection);
+        return XMVectorSubtract(position, XMVectorMultiply(XMLoadFloat3(&eye), XMVectorSplatW(position)));
+    };
+
+    XMVECTOR rayDir0 = getRayDir(0.f, 0.f);
+    XMFLOAT3 rayDirs[3];
+    XMStoreFloat3(&rayDirs[0], rayDir0);
+    XMStoreFloat3(&rayDirs[1], XMVectorSubtract(getRayDir(1.f, 0.f), rayDir0));
+    XMStoreFloat3(&rayDirs[2], XMVectorSubtract(getRayDir(0.f, 1.f), rayDir0));
+
+    // The GPU culls the back of the slab quads, so slabs are only seen from behind both planes
+    FrameSlabs.clear();
+    for (auto& slab : Slabs)
+    {
+        SlabSetup setup;
+        SetupSlab(slab, eye, rayDirs, &setup);
+        if (setup.st.Distance > 0.f && setup.uv.Distance > 0.f)
+        {
+            FrameSlabs.push_back(setup);
+        }
+    }
+
+    if (Compressed && !UpdateTileCache(cameraView, cameraProjection))
+    {
+        return false;
+    }
+
+    NextRow = 0;
+    Run([&](uint32_t)
+    {
+        for (uint32_t y = NextRow++; y < Height; y = NextRow++)
+        {
+            RenderRow(y);
+        }
+    });
+
+    return true;
+}
+
+void CpuRenderer::Present(HWND window)
+{
+    BITMAPINFO info = {};
+    info.bmiHeader.biSize = sizeof(info.bmiHeader);
+    info.bmiHeader.biWidth = Width;
+    info.bmiHeader.biHeight = -(LONG)Height;   // Top down
+    info.bmiHeader.biPlanes = 1;
+    info.bmiHeader.biBitCount = 32;
+    info.bmiHeader.biCompression = BI_RGB;
+
+    HDC dc = GetDC(window);
+    SetDIBitsToDevice(dc, 0, 0, Width, Height, 0, 0, 0, Height, Pixels.get(), &info, DIB_RGB_COLORS);
+    ReleaseDC(window, dc);
+}
+
+void CpuRenderer::Run(const std::function<void(uint32_t thread)>& func)
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Job = &func;
+        ++JobId;
+        JobsRemaining = NumThreads - 1;
+    }
+    JobReady.notify_all();
+
+    func(0);
+
+    std::unique_lock<std::mutex> lock(Mutex);
+    JobDone.wait(lock, [&]() { return JobsRemaining == 0; });
+    Job = nullptr;
+}
+
+void CpuRenderer::WorkerThread(uint32_t thread)
+{
+    uint32_t lastJobId = 0;
+    for (;;)
+    {
+        std::unique_lock<std::mutex> lock(Mutex);
+        JobReady.wait(lock, [&]() { return Quit || JobId != lastJobId; });
+        if (Quit)
+        {
+            return;
+        }
+
+        lastJobId = JobId;
+        const std::function<void(uint32_t thread)>* job = Job;
+        lock.unlock();
+
+        (*job)(thread);
+
+        lock.lock();
+        if (--JobsRemaining == 0)
+        {
+            JobDone.notify_one();
+        }
+    }
+}
+
+void CpuRenderer::SetupSlab(const CpuLightSlab& slab, const XMFLOAT3& eye, const XMFLOAT3 rayDirs[3], SlabSetup* setup)
+{
+    XMFLOAT3 forward;
+    XMStoreFloat3(&forward, XMVector3Normalize(XMLoadFloat4x4(&slab.stQuadWorld).r[2]));
+
+    XMVECTOR f = XMLoadFloat3(&forward);
+    setup->Slab = &slab;
+    setup->Facing.Base = XMVectorGetX(XMVector3Dot(XMLoadFloat3(&rayDirs[0]), f));
+    setup->Facing.DX = XMVectorGetX(XMVector3Dot(XMLoadFloat3(&rayDirs[1]), f));
+    setup->Facing.DY = XMVectorGetX(XMVector3Dot(XMLoadFloat3(&rayDirs[2]), f));
+
+    SetupPlane(slab.stQuadWorld, forward, eye, rayDirs, &setup->st);
+    SetupPlane(slab.uvQuadWorld, forward, eye, rayDirs, &setup->uv);
+}
+
+void CpuRenderer::SetupPlane(const XMFLOAT4X4& quadWorld, const XMFLOAT3& forward, const XMFLOAT3& eye, const XMFLOAT3 rayDirs[3],
+    PlaneMapping* plane)
+{
+    // The quad is the unit square around the origin, with texture coordinates (x + 0.5, 0.5 - y),
+    // so in the world they're measured along the quad's scaled right and up axes from its center
+    XMMATRIX world = XMLoadFloat4x4(&quadWorld);
+    XMVECTOR right = XMVectorDivide(world.r[0], XMVector3LengthSq(world.r[0]));
+    XMVECTOR up = XMVectorDivide(world.r[1], XMVector3LengthSq(world.r[1]));
+    XMVECTOR fromCenter = XMVectorSubtract(XMLoadFloat3(&eye), world.r[3]);
+
+    plane->Distance = -XMVectorGetX(XMVector3Dot(fromCenter, XMLoadFloat3(&forward)));
+    plane->S0 = XMVectorGetX(XMVector3Dot(fromCenter, right)) + 0.5f;
+    plane->T0 = 0.5f - XMVectorGetX(XMVector3Dot(fromCenter, up));
+
+    XMVECTOR rayDir0 = XMLoadFloat3(&rayDirs[0]);
+    XMVECTOR rayDirDX = XMLoadFloat3(&rayDirs[1]);
+    XMVECTOR rayDirDY = XMLoadFloat3(&rayDirs[2]);
+
+    plane->S.Base = XMVectorGetX(XMVector3Dot(rayDir0, right));
+    plane->S.DX = XMVectorGetX(XMVector3Dot(rayDirDX, right));
+    plane->S.DY = XMVectorGetX(XMVector3Dot(rayDirDY, right));
+    plane->T.Base = -XMVectorGetX(XMVector3Dot(rayDir0, up));
+    plane->T.DX = -XMVectorGetX(XMVector3Dot(rayDirDX, up));
+    plane->T.DY = -XMVectorGetX(XMVector3Dot(rayDirDY, up));
+}
+
+void CpuRenderer::RenderRow(uint32_t y)
+{
+    uint32_t* row = &Pixels[y * Width];
+    for (uint32_t x = 0; x < Width; ++x)
+    {
+        row[x] = ClearColor;
+    }
+
+    float pixelY = (float)y + 0.5f;
+    XMVECTOR zero = XMVectorZero();
+    XMVECTOR one = XMVectorSplatOne();
+
+    // Slabs are drawn in order, and later ones cover earlier ones, like on the GPU
+    for (auto& setup : FrameSlabs)
+    {
+        // The pixel functions along this row, as a + b * x
+        XMVECTOR facingRow = XMVectorReplicate(setup.Facing.Base + setup.Facing.DY * pixelY);
+        XMVECTOR facingDX = XMVectorReplicate(setup.Facing.DX);
+        XMVECTOR stSRow = XMVectorReplicate(setup.st.S.Base + setup.st.S.DY * pixelY);
+        XMVECTOR stSDX = XMVectorReplicate(setup.st.S.DX);
+        XMVECTOR stTRow = XMVectorReplicate(setup.st.T.Base + setup.st.T.DY * pixelY);
+        XMVECTOR stTDX = XMVectorReplicate(setup.st.T.DX);
+        XMVECTOR uvSRow = XMVectorReplicate(setup.uv.S.Base + setup.uv.S.DY * pixelY);
+        XMVECTOR uvSDX = XMVectorReplicate(setup.uv.S.DX);
+        XMVECTOR uvTRow = XMVectorReplicate(setup.uv.T.Base + setup.uv.T.DY * pixelY);
+        XMVECTOR uvTDX = XMVectorReplicate(setup.uv.T.DX);
+
+        XMVECTOR stDistance = XMVectorReplicate(setup.st.Distance);
+        XMVECTOR stS0 = XMVectorReplicate(setup.st.S0);
+        XMVECTOR stT0 = XMVectorReplicate(setup.st.T0);
+        XMVECTOR uvDistance = XMVectorReplicate(setup.uv.Distance);
+        XMVECTOR uvS0 = XMVectorReplicate(setup.uv.S0);
+        XMVECTOR uvT0 = XMVectorReplicate(setup.uv.T0);
+
+        for (uint32_t x = 0; x < Width; x += 4)
+        {
+            XMVECTOR pixelX = XMVectorAdd(XMVectorReplicate((float)x), LaneOffsets);
+
+            // Rays pointing away from the planes never reach them
+            XMVECTOR facing = XMVectorMultiplyAdd(pixelX, facingDX, facingRow);
+            XMVECTOR hit = XMVectorGreater(facing, zero);
+            XMVECTOR invFacing = XMVectorReciprocal(facing);
+
+            XMVECTOR stDist = XMVectorMultiply(stDistance, invFacing);
+            XMVECTOR s = XMVectorMultiplyAdd(XMVectorMultiplyAdd(pixelX, stSDX, stSRow), stDist, stS0);
+            XMVECTOR t = XMVectorMultiplyAdd(XMVectorMultiplyAdd(pixelX, stTDX, stTRow), stDist, stT0);
+
+            XMVECTOR uvDist = XMVectorMultiply(uvDistance, invFacing);
+            XMVECTOR u = XMVectorMultiplyAdd(XMVectorMultiplyAdd(pixelX, uvSDX, uvSRow), uvDist, uvS0);
+            XMVECTOR v = XMVectorMultiplyAdd(XMVectorMultiplyAdd(pixelX, uvTDX, uvTRow), uvDist, uvT0);
+
+            // Both quads have to cover the pixel
+            hit = XMVectorAndInt(hit, XMVectorAndInt(XMVectorGreaterOrEqual(s, zero), XMVectorLessOrEqual(s, one)));
+            hit = XMVectorAndInt(hit, XMVectorAndInt(XMVectorGreaterOrEqual(t, zero), XMVectorLessOrEqual(t, one)));
+            hit = XMVectorAndInt(hit, XMVectorAndInt(XMVectorGreaterOrEqual(u, zero), XMVectorLessOrEqual(u, one)));
+            hit = XMVectorAndInt(hit, XMVectorAndInt(XMVectorGreaterOrEqual(v, zero), XMVectorLessOrEqual(v, one)));
+
+            if (_mm_movemask_ps(hit) == 0)
+            {
+                continue;
+            }
+
+            XMVECTOR red, green, blue;
+            SampleSlab(*setup.Slab, u, v, s, t, &red, &green, &blue);
+
+            // Rounded as when writing to R8G8B8A8_UNORM, in BGRA order
+            __m128i color = _mm_set1_epi32(0xff000000);
+            color = _mm_or_si128(color, _mm_slli_epi32(_mm_cvttps_epi32(XMVectorAdd(red, g_XMOneHalf)), 16));
+            color = _mm_or_si128(color, _mm_slli_epi32(_mm_cvttps_epi32(XMVectorAdd(green, g_XMOneHalf)), 8));
+            color = _mm_or_si128(color, _mm_cvttps_epi32(XMVectorAdd(blue, g_XMOneHalf)));
+
+            __m128i* dest = reinterpret_cast<__m128i*>(row + x);
+            __m128i mask = _mm_castps_si128(hit);
+            _mm_storeu_si128(dest, _mm_or_si128(_mm_and_si128(mask, color), _mm_andnot_si128(mask, _mm_loadu_si128(dest))));
+        }
+    }
+}
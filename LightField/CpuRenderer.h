@@ -0,0 +1,162 @@
+#pragma once
+
+class CompressedLightField;
+
+// A light slab with its slices in system memory, for rendering on the CPU
+struct CpuLightSlab
+{
+    uint32_t ID;
+    XMFLOAT4X4 uvQuadWorld;
+    XMFLOAT4X4 stQuadWorld;
+
+    // AngularResolution x AngularResolution slices, each SpatialResolution x SpatialResolution
+    // R8G8B8A8 texels, top down (see LightFieldFile.h)
+    uint32_t AngularResolution;
+    uint32_t SpatialResolution;
+
+    // The slices are split into tiles of TileViews x TileViews views by TileTexels x TileTexels
+    // texels, NumViewTiles x NumTexelTiles of them per side, in the order of GetCompressedTileIndex.
+    // Tiles holds a pointer to each tile's views, in row major order ViewPitch texels apart, with
+    // rows RowPitch texels apart. A light field file's slices are tiles of one whole slice each.
+    uint32_t TileViews;
+    uint32_t TileTexels;
+    uint32_t NumViewTiles;
+    uint32_t NumTexelTiles;
+    uint32_t ViewPitch;
+    uint32_t RowPitch;
+    const uint32_t* const* Tiles;
+};
+
+// CPU based light field renderer. Draws the same image as Renderer, without a GPU: each pixel's
+// eye ray is intersected with the uv and st planes of every slab, and the color is the same
+// quadrilinear (bilinear across 4 slices, bilinear within each) 16 tap filter as RenderUVPlanePS.
+// Pixels are shaded 4 at a time with SSE, each lane a pixel, and rows are spread across threads.
+//
+// Light field files are memory mapped, so only the slices the camera looks through are read from
+// disk. Compressed light field files stay mapped too, and each frame decodes the tiles its rays
+// land in that aren't already in a cache of decoded tiles (see UpdateTileCache).
+class CpuRenderer
+{
+public:
+    static std::unique_ptr<CpuRenderer> Create(uint32_t width, uint32_t height, uint32_t numThreads);
+    ~CpuRenderer();
+
+    // Loads a light field file or a compressed light field file, replacing the current one
+    bool LoadLightField(const wchar_t* filename);
+
+    // Render the light field with the camera view provided
+    bool Render(FXMMATRIX cameraView, FXMMATRIX cameraProjection);
+
+    // Sets how many bytes of decoded tiles are kept for compressed light fields. A frame that
+    // needs more than this keeps all of its tiles anyway.
+    void SetTileCacheSize(uint64_t size) { TileCacheSize = size; }
+
+    // Copy the last frame into a window's client area
+    void Present(HWND window);
+
+    // The last frame, Width x Height 32 bit pixels in BGRA order (as GDI wants them)
+    const uint32_t* GetPixels() const { return Pixels.get(); }
+
+private:
+    CpuRenderer(uint32_t width, uint32_t height, uint32_t numThreads);
+
+    // No copy
+    CpuRenderer(const CpuRenderer&);
+    CpuRenderer& operator= (const CpuRenderer&);
+
+    bool Initialize();
+
+    bool MapLightField(const wchar_t* filename);
+    bool OpenCompressedLightField(const wchar_t* filename);
+    void UnloadLightField();
+
+    // Decodes the tiles of the compressed light field that this frame's slabs can sample, first
+    // making room by dropping the tiles that have gone longest without being used
+    bool UpdateTileCache(FXMMATRIX cameraView, CXMMATRIX cameraProjection);
+    void EvictTiles(uint64_t size);
+
+    // Runs one job across the pool, with the caller as thread 0, and returns once every thread
+    // has finished it. Frames use it to render rows, and UpdateTileCache to decode tiles.
+    void Run(const std::function<void(uint32_t thread)>& func);
+    void WorkerThread(uint32_t thread);
+
+    // value = Base + DX * x + DY * y, for pixel coordinates x, y
+    struct PixelFunction
+    {
+        float Base;
+        float DX;
+        float DY;
+    };
+
+    // Where eye rays cross one of a slab's planes. The ray from the eye along D hits the plane
+    // at h = Distance / dot(D, forward) along D, where the plane's texture coordinates are
+    // (S0 + S * h, T0 + T * h).
+    struct PlaneMapping
+    {
+        float Distance;             // From the eye to the plane, along the slab's forward axis
+        float S0;
+        float T0;
+        PixelFunction S;
+        PixelFunction T;
+    };
+
+    struct SlabSetup
+    {
+        const CpuLightSlab* Slab;
+        PixelFunction Facing;       // dot(D, forward)
+        PlaneMapping st;
+        PlaneMapping uv;
+    };
+
+    // Eye rays are rayDirs[0] + rayDirs[1] * x + rayDirs[2] * y, for pixel coordinates x, y
+    static void SetupSlab(const CpuLightSlab& slab, const XMFLOAT3& eye, const XMFLOAT3 rayDirs[3], SlabSetup* setup);
+    static void SetupPlane(const XMFLOAT4X4& quadWorld, const XMFLOAT3& forward, const XMFLOAT3& eye, const XMFLOAT3 rayDirs[3],
+        PlaneMapping* plane);
+    void RenderRow(uint32_t y);
+
+private:
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t NumThreads;
+    std::unique_ptr<uint32_t[]> Pixels;
+
+    // The loaded light field, and the tile pointers of each slab
+    std::vector<CpuLightSlab> Slabs;
+    std::vector<std::vector<const uint32_t*>> TileTables;
+    HANDLE File;
+    HANDLE Mapping;
+    const uint8_t* MappedData;
+
+    // Decoded tiles of a compressed light field, by slab and tile index. Tiles that aren't
+    // decoded point at EmptyTile in the tile tables.
+    struct TileKey
+    {
+        uint32_t Slab;
+        uint32_t Tile;
+    };
+
+    std::unique_ptr<CompressedLightField> Compressed;
+    std::vector<std::vector<std::unique_ptr<uint32_t[]>>> DecodedTiles;
+    std::vector<std::vector<uint32_t>> TileLastUsed;
+    std::unique_ptr<uint32_t[]> EmptyTile;
+    std::vector<uint32_t> VisibleTiles;
+    std::vector<TileKey> MissingTiles;
+    uint64_t TileCacheSize;
+    uint64_t CachedSize;
+    uint32_t FrameNumber;
+
+    // Per frame setup of the slabs facing the camera, in drawing order
+    std::vector<SlabSetup> FrameSlabs;
+
+    // Worker threads, which wait for Run to hand them a job. NextRow is the next row for a
+    // frame's job to take.
+    std::vector<std::thread> Threads;
+    std::mutex Mutex;
+    std::condition_variable JobReady;
+    std::condition_variable JobDone;
+    const std::function<void(uint32_t thread)>* Job;
+    uint32_t JobId;
+    uint32_t JobsRemaining;
+    bool Quit;
+    std::atomic<uint32_t> NextRow;
+};
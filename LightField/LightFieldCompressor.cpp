@@ -0,0 +1,380 @@
+#include "Precomp.h"
+#include "Debug.h"
+#include "LightFieldCompressor.h"
+#include "LightFieldFile.h"
+
+// Alpha cutoff for BC1's 1 bit alpha. Baked slices are opaque, so this only matters for other sources.
+static const float AlphaReference = 0.5f;
+
+static bool ReadAt(HANDLE file, uint64_t offset, void* data, uint32_t size)
+{
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = (DWORD)offset;
+    overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+    DWORD bytesRead = 0;
+    if (!ReadFile(file, data, size, &bytesRead, &overlapped) || bytesRead != size)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static bool WriteAt(HANDLE file, uint64_t offset, const void* data, uint32_t size)
+{
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = (DWORD)offset;
+    overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+    DWORD bytesWritten = 0;
+    if (!WriteFile(file, data, size, &bytesWritten, &overlapped) || bytesWritten != size)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+// Runs worker on numThreads threads, including the calling one, and waits for them all to finish
+template <typename Worker>
+static void RunWorkers(uint32_t numThreads, const Worker& worker)
+{
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < numThreads; ++i)
+    {
+        threads.push_back(std::thread(worker));
+    }
+
+    worker();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// One view of the row of tiles being compressed
+struct BandView
+{
+    std::vector<uint32_t> Texels;       // Source texels, R8G8B8A8
+    std::vector<uint32_t> Decoded;      // Texels after block compression
+    std::vector<uint8_t> Blocks;        // Row major BC blocks
+};
+
+struct EncodedTile
+{
+    std::vector<uint8_t> Data;
+    uint32_t StoredBlocks;
+    uint32_t PredictedBlocks;
+};
+
+static bool CompressView(const CompressedLightFieldHeader& header, BandView* view)
+{
+    Image image = {};
+    image.width = header.SpatialResolution;
+    image.height = header.SpatialResolution;
+    image.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    image.rowPitch = header.SpatialResolution * sizeof(uint32_t);
+    image.slicePitch = image.rowPitch * header.SpatialResolution;
+    image.pixels = reinterpret_cast<uint8_t*>(view->Texels.data());
+
+    ScratchImage compressed;
+    if (FAILED(Compress(image, (DXGI_FORMAT)header.Format, TEX_COMPRESS_DEFAULT, AlphaReference, compressed)))
+    {
+        return false;
+    }
+
+    const Image* blocks = compressed.GetImage(0, 0, 0);
+    view->Blocks.assign(blocks->pixels, blocks->pixels + blocks->slicePitch);
+
+    // Predictions are made against what the renderer will actually see, so decode the blocks again
+    ScratchImage decompressed;
+    if (FAILED(Decompress(*blocks, DXGI_FORMAT_R8G8B8A8_UNORM, decompressed)))
+    {
+        return false;
+    }
+
+    const Image* decoded = decompressed.GetImage(0, 0, 0);
+    view->Decoded.resize(view->Texels.size());
+    for (uint32_t y = 0; y < header.SpatialResolution; ++y)
+    {
+        memcpy(&view->Decoded[y * header.SpatialResolution], decoded->pixels + y * decoded->rowPitch, image.rowPitch);
+    }
+
+    return true;
+}
+
+// Largest difference in any channel between the source texels of a block and the decoded texels of another view's block
+static uint32_t GetBlockError(const BandView& source, const BandView& reference, uint32_t blockX, uint32_t blockY, uint32_t resolution)
+{
+    uint32_t error = 0;
+    for (uint32_t y = blockY * 4; y < blockY * 4 + 4; ++y)
+    {
+        const uint8_t* a = reinterpret_cast<const uint8_t*>(&source.Texels[y * resolution + blockX * 4]);
+        const uint8_t* b = reinterpret_cast<const uint8_t*>(&reference.Decoded[y * resolution + blockX * 4]);
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            error = max(error, (uint32_t)abs((int)a[i] - (int)b[i]));
+        }
+    }
+    return error;
+}
+
+// Encodes one tile from the views of the current band. bandViews holds TileViews rows of
+// AngularResolution views, starting at the tile row's first view row.
+static void EncodeTile(const CompressedLightFieldHeader& header, const std::vector<BandView>& bandViews,
+    uint32_t tileU, uint32_t tileV, uint32_t tileS, uint32_t tileT, uint32_t maxError, EncodedTile* tile)
+{
+    uint32_t viewsWide = min(header.TileViews, header.AngularResolution - tileU * header.TileViews);
+    uint32_t viewsHigh = min(header.TileViews, header.AngularResolution - tileV * header.TileViews);
+    uint32_t blocksWide = min(header.TileTexels, header.SpatialResolution - tileS * header.TileTexels) / 4;
+    uint32_t blocksHigh = min(header.TileTexels, header.SpatialResolution - tileT * header.TileTexels) / 4;
+
+    uint32_t blockSize = GetCompressedBlockSize(header);
+    uint32_t viewBlocksWide = header.SpatialResolution / 4;
+    uint32_t numBlocks = blocksWide * blocksHigh;
+    uint32_t maskSize = (numBlocks + 7) / 8;
+
+    tile->Data.clear();
+    tile->StoredBlocks = 0;
+    tile->PredictedBlocks = 0;
+
+    // For each block of each view in the tile, the band view whose block ends up being used. Predicted
+    // blocks copy the reference's block, which may itself be a copy, so predictions are always checked
+    // against the block the decoder will really produce.
+    std::vector<uint32_t> owners(viewsWide * viewsHigh * numBlocks);
+
+    for (uint32_t y = 0; y < viewsHigh; ++y)
+    {
+        for (uint32_t x = 0; x < viewsWide; ++x)
+        {
+            uint32_t tileView = y * viewsWide + x;
+            uint32_t bandView = y * header.AngularResolution + tileU * header.TileViews + x;
+
+            const uint32_t* referenceOwners = nullptr;
+            if (x > 0)
+            {
+                referenceOwners = &owners[(tileView - 1) * numBlocks];
+            }
+            else if (y > 0)
+            {
+                referenceOwners = &owners[(tileView - viewsWide) * numBlocks];
+            }
+
+            size_t maskOffset = tile->Data.size();
+            tile->Data.resize(maskOffset + maskSize, 0);
+
+            for (uint32_t i = 0; i < numBlocks; ++i)
+            {
+                uint32_t blockX = tileS * header.TileTexels / 4 + i % blocksWide;
+                uint32_t blockY = tileT * header.TileTexels / 4 + i / blocksWide;
+
+                uint32_t& owner = owners[tileView * numBlocks + i];
+                if (referenceOwners &&
+                    GetBlockError(bandViews[bandView], bandViews[referenceOwners[i]], blockX, blockY, header.SpatialResolution) <= maxError)
+                {
+                    owner = referenceOwners[i];
+                    ++tile->PredictedBlocks;
+                }
+                else
+                {
+                    owner = bandView;
+                    tile->Data[maskOffset + i / 8] |= (uint8_t)(1 << (i % 8));
+
+                    const uint8_t* block = &bandViews[bandView].Blocks[(blockY * viewBlocksWide + blockX) * blockSize];
+                    tile->Data.insert(tile->Data.end(), block, block + blockSize);
+                    ++tile->StoredBlocks;
+                }
+            }
+        }
+    }
+}
+
+bool CompressLightField(const wchar_t* sourceFilename, const wchar_t* filename,
+    const LightFieldCompressSettings& settings, LightFieldCompressStats* stats)
+{
+    if ((settings.Format != DXGI_FORMAT_BC1_UNORM && settings.Format != DXGI_FORMAT_BC7_UNORM) ||
+        settings.TileViews < 1 || settings.TileTexels < 4 || (settings.TileTexels % 4) != 0 ||
+        settings.MaxPredictionError > 255 || settings.NumThreads < 1)
+    {
+        LogError(L"Invalid compression settings.");
+        return false;
+    }
+
+    HANDLE source = CreateFile(sourceFilename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (source == INVALID_HANDLE_VALUE)
+    {
+        LogError(L"Failed to open light field file.");
+        return false;
+    }
+
+    std::unique_ptr<void, decltype(&CloseHandle)> sourceCloser(source, &CloseHandle);
+
+    LightFieldFileHeader sourceHeader = {};
+    if (!ReadAt(source, 0, &sourceHeader, sizeof(sourceHeader)) ||
+        sourceHeader.Magic != LightFieldFileMagic || sourceHeader.Version != LightFieldFileVersion)
+    {
+        LogError(L"Not a light field file.");
+        return false;
+    }
+
+    if (sourceHeader.AngularResolution < 1 || sourceHeader.SpatialResolution < 4 || (sourceHeader.SpatialResolution % 4) != 0)
+    {
+        LogError(L"Light field slices must be a multiple of 4 texels for block compression.");
+        return false;
+    }
+
+    std::vector<LightFieldFileSlab> sourceSlabs(sourceHeader.NumSlabs);
+    if (!sourceSlabs.empty() &&
+        !ReadAt(source, sizeof(sourceHeader), sourceSlabs.data(), (uint32_t)(sizeof(LightFieldFileSlab) * sourceSlabs.size())))
+    {
+        LogError(L"Failed to read light field slabs.");
+        return false;
+    }
+
+    CompressedLightFieldHeader header = {};
+    header.Magic = CompressedLightFieldMagic;
+    header.Version = CompressedLightFieldVersion;
+    header.NumSlabs = sourceHeader.NumSlabs;
+    header.AngularResolution = sourceHeader.AngularResolution;
+    header.SpatialResolution = sourceHeader.SpatialResolution;
+    header.Format = settings.Format;
+    header.TileViews = settings.TileViews;
+    header.TileTexels = settings.TileTexels;
+
+    // Tile indices go right after the slab table, and the tile data after those
+    uint32_t numViewTiles = GetNumViewTiles(header);
+    uint32_t numTexelTiles = GetNumTexelTiles(header);
+    uint32_t numTiles = GetNumCompressedTiles(header);
+    uint32_t tileIndexSize = (uint32_t)(sizeof(CompressedLightFieldTile) * numTiles);
+
+    std::vector<CompressedLightFieldSlab> slabs(header.NumSlabs);
+    uint64_t offset = sizeof(header) + sizeof(CompressedLightFieldSlab) * header.NumSlabs;
+    for (uint32_t i = 0; i < header.NumSlabs; ++i)
+    {
+        CompressedLightFieldSlab& slab = slabs[i];
+        ZeroMemory(&slab, sizeof(slab));
+        slab.ID = sourceSlabs[i].ID;
+        slab.uvQuadWorld = sourceSlabs[i].uvQuadWorld;
+        slab.stQuadWorld = sourceSlabs[i].stQuadWorld;
+        slab.TileIndexOffset = offset;
+
+        offset += tileIndexSize;
+    }
+
+    HANDLE file = CreateFile(filename, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        LogError(L"Failed to create compressed light field file.");
+        return false;
+    }
+
+    std::unique_ptr<void, decltype(&CloseHandle)> fileCloser(file, &CloseHandle);
+
+    if (!WriteAt(file, 0, &header, sizeof(header)) ||
+        (!slabs.empty() && !WriteAt(file, sizeof(header), slabs.data(), (uint32_t)(sizeof(CompressedLightFieldSlab) * slabs.size()))))
+    {
+        LogError(L"Failed to write compressed light field header.");
+        return false;
+    }
+
+    ZeroMemory(stats, sizeof(*stats));
+
+    uint32_t sliceSize = (uint32_t)GetLightFieldSliceSize(sourceHeader);
+    std::vector<BandView> bandViews(header.TileViews * header.AngularResolution);
+    std::vector<EncodedTile> bandTiles(numViewTiles * numTexelTiles * numTexelTiles);
+    std::vector<CompressedLightFieldTile> tileIndex(numTiles);
+
+    for (uint32_t slab = 0; slab < header.NumSlabs; ++slab)
+    {
+        ZeroMemory(tileIndex.data(), tileIndexSize);
+
+        for (uint32_t tileV = 0; tileV < numViewTiles; ++tileV)
+        {
+            uint32_t firstRow = tileV * header.TileViews;
+            uint32_t numRows = min(header.TileViews, header.AngularResolution - firstRow);
+            uint32_t numBandViews = numRows * header.AngularResolution;
+            uint32_t numBandTiles = numViewTiles * numTexelTiles * numTexelTiles;
+
+            std::atomic<uint32_t> nextView(0);
+            std::atomic<uint32_t> nextTile(0);
+            std::atomic<bool> failed(false);
+
+            // Read & block compress every view in the band, then encode its tiles. The tiles are
+            // only started once all the views are done, since each one needs views from several workers.
+            auto compressWorker = [&]()
+            {
+                for (uint32_t i = nextView++; i < numBandViews && !failed; i = nextView++)
+                {
+                    BandView& view = bandViews[i];
+                    view.Texels.resize(sliceSize / sizeof(uint32_t));
+
+                    uint64_t slice = (uint64_t)(firstRow + i / header.AngularResolution) * header.AngularResolution + i % header.AngularResolution;
+                    if (!ReadAt(source, sourceSlabs[slab].SliceDataOffset + slice * sliceSize, view.Texels.data(), sliceSize) ||
+                        !CompressView(header, &view))
+                    {
+                        failed = true;
+                    }
+                }
+            };
+
+            auto encodeWorker = [&]()
+            {
+                for (uint32_t i = nextTile++; i < numBandTiles; i = nextTile++)
+                {
+                    uint32_t tileS = i % numTexelTiles;
+                    uint32_t tileT = (i / numTexelTiles) % numTexelTiles;
+                    uint32_t tileU = i / (numTexelTiles * numTexelTiles);
+                    EncodeTile(header, bandViews, tileU, tileV, tileS, tileT, settings.MaxPredictionError, &bandTiles[i]);
+                }
+            };
+
+            RunWorkers(settings.NumThreads, compressWorker);
+            if (!failed)
+            {
+                RunWorkers(settings.NumThreads, encodeWorker);
+            }
+
+            if (failed)
+            {
+                LogError(L"Failed to read and compress light field slices.");
+                return false;
+            }
+
+            // Append the band's tiles to the file, in tile index order
+            for (uint32_t i = 0; i < numBandTiles; ++i)
+            {
+                uint32_t tileS = i % numTexelTiles;
+                uint32_t tileT = (i / numTexelTiles) % numTexelTiles;
+                uint32_t tileU = i / (numTexelTiles * numTexelTiles);
+
+                EncodedTile& tile = bandTiles[i];
+                CompressedLightFieldTile& entry = tileIndex[GetCompressedTileIndex(header, tileU, tileV, tileS, tileT)];
+                entry.Offset = offset;
+                entry.Size = (uint32_t)tile.Data.size();
+
+                if (!WriteAt(file, offset, tile.Data.data(), entry.Size))
+                {
+                    LogError(L"Failed to write compressed light field tiles.");
+                    return false;
+                }
+
+                offset += entry.Size;
+                stats->StoredBlocks += tile.StoredBlocks;
+                stats->PredictedBlocks += tile.PredictedBlocks;
+            }
+        }
+
+        if (!WriteAt(file, slabs[slab].TileIndexOffset, tileIndex.data(), tileIndexSize))
+        {
+            LogError(L"Failed to write compressed light field tile index.");
+            return false;
+        }
+
+        stats->SourceSize += GetLightFieldSlabSize(sourceHeader);
+    }
+
+    stats->CompressedSize = offset;
+    return true;
+}
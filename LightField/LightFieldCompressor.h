@@ -0,0 +1,25 @@
+#pragma once
+
+struct LightFieldCompressSettings
+{
+    uint32_t Format;                // DXGI_FORMAT_BC1_UNORM or DXGI_FORMAT_BC7_UNORM
+    uint32_t TileViews;             // Views per side of a tile
+    uint32_t TileTexels;            // Texels per side of a tile, a multiple of 4
+    uint32_t MaxPredictionError;    // Largest difference in any channel (0-255) for a block to be predicted
+    uint32_t NumThreads;
+};
+
+struct LightFieldCompressStats
+{
+    uint64_t SourceSize;            // Bytes of slice data in the source file
+    uint64_t CompressedSize;        // Bytes of the whole compressed file
+    uint64_t StoredBlocks;
+    uint64_t PredictedBlocks;
+};
+
+// Converts a light field file (.lfs) into a compressed light field file (.lfc), see LightFieldFile.h.
+// Works through one row of tiles of each slab at a time, so only TileViews rows of views are in memory
+// at once. The views of a row are block compressed in parallel, then their tiles are predicted and
+// written out in order.
+bool CompressLightField(const wchar_t* sourceFilename, const wchar_t* filename,
+    const LightFieldCompressSettings& settings, LightFieldCompressStats* stats);
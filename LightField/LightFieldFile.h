@@ -0,0 +1,137 @@
+#pragma once
+
+// Light field file (.lfs) layout:
+//   - LightFieldFileHeader
+//   - LightFieldFileSlab for each of the NumSlabs slabs
+//   - The slices of each slab, starting at that slab's SliceDataOffset
+//
+// A slab's slices are stored in row major order of their (x, y) position on the
+// uv plane, AngularResolution x AngularResolution of them. Each slice is a top down,
+// SpatialResolution x SpatialResolution image of R8G8B8A8_UNORM texels, which is
+// what the renderer's slice arrays use, so slices can be uploaded as they are read.
+
+static const uint32_t LightFieldFileMagic = 0x3153464c;   // 'LFS1'
+static const uint32_t LightFieldFileVersion = 1;
+
+struct LightFieldFileHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t NumSlabs;
+    uint32_t AngularResolution;     // Slices per side of the uv (camera) plane
+    uint32_t SpatialResolution;     // Texels per side of each slice
+    uint32_t Reserved;
+};
+
+struct LightFieldFileSlab
+{
+    uint32_t ID;
+    uint32_t Reserved[3];
+    XMFLOAT4X4 uvQuadWorld;
+    XMFLOAT4X4 stQuadWorld;
+    uint64_t SliceDataOffset;       // From the start of the file
+    uint64_t Reserved2;
+};
+
+inline uint64_t GetLightFieldSliceSize(const LightFieldFileHeader& header)
+{
+    return (uint64_t)header.SpatialResolution * header.SpatialResolution * sizeof(uint32_t);
+}
+
+inline uint64_t GetLightFieldSlabSize(const LightFieldFileHeader& header)
+{
+    return GetLightFieldSliceSize(header) * header.AngularResolution * header.AngularResolution;
+}
+
+// Compressed light field file (.lfc) layout:
+//   - CompressedLightFieldHeader
+//   - CompressedLightFieldSlab for each of the NumSlabs slabs
+//   - The tile index of each slab, starting at that slab's TileIndexOffset
+//   - Tile data
+//
+// The 4D (u,v,s,t) array of each slab is split into tiles of TileViews x TileViews views by
+// TileTexels x TileTexels texels (tiles on the far edges may be smaller). A slab's tile index
+// holds one CompressedLightFieldTile per tile, in the order given by GetCompressedTileIndex,
+// so finding any tile takes a single lookup.
+//
+// Texels are stored as BC1 or BC7 blocks. Neighboring views of a light field are nearly
+// identical, so each view of a tile is predicted from the previous one: the view to its
+// left in the tile, or the one above it for the first column. Blocks that are close enough
+// to the reference view's block aren't stored, and are copied from the reference instead.
+// Each view of a tile is stored as one bit per block (set if the block is stored), padded
+// to a whole byte, followed by the stored blocks. Blocks and views are in row major order.
+
+static const uint32_t CompressedLightFieldMagic = 0x3143464c;   // 'LFC1'
+static const uint32_t CompressedLightFieldVersion = 1;
+
+struct CompressedLightFieldHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t NumSlabs;
+    uint32_t AngularResolution;     // Slices per side of the uv (camera) plane
+    uint32_t SpatialResolution;     // Texels per side of each slice, a multiple of 4
+    uint32_t Format;                // DXGI_FORMAT_BC1_UNORM or DXGI_FORMAT_BC7_UNORM
+    uint32_t TileViews;             // Views per side of a tile
+    uint32_t TileTexels;            // Texels per side of a tile, a multiple of 4
+};
+
+struct CompressedLightFieldSlab
+{
+    uint32_t ID;
+    uint32_t Reserved[3];
+    XMFLOAT4X4 uvQuadWorld;
+    XMFLOAT4X4 stQuadWorld;
+    uint64_t TileIndexOffset;       // From the start of the file
+    uint64_t Reserved2;
+};
+
+struct CompressedLightFieldTile
+{
+    uint64_t Offset;                // From the start of the file
+    uint32_t Size;
+    uint32_t Reserved;
+};
+
+// Tiles per side of the uv plane
+inline uint32_t GetNumViewTiles(const CompressedLightFieldHeader& header)
+{
+    return (header.AngularResolution + header.TileViews - 1) / header.TileViews;
+}
+
+// Tiles per side of the st plane
+inline uint32_t GetNumTexelTiles(const CompressedLightFieldHeader& header)
+{
+    return (header.SpatialResolution + header.TileTexels - 1) / header.TileTexels;
+}
+
+inline uint32_t GetNumCompressedTiles(const CompressedLightFieldHeader& header)
+{
+    uint32_t numViewTiles = GetNumViewTiles(header);
+    uint32_t numTexelTiles = GetNumTexelTiles(header);
+    return numViewTiles * numViewTiles * numTexelTiles * numTexelTiles;
+}
+
+inline uint32_t GetCompressedTileIndex(const CompressedLightFieldHeader& header, uint32_t tileU, uint32_t tileV,
+    uint32_t tileS, uint32_t tileT)
+{
+    uint32_t numTexelTiles = GetNumTexelTiles(header);
+    return ((tileV * GetNumViewTiles(header) + tileU) * numTexelTiles + tileT) * numTexelTiles + tileS;
+}
+
+// The inverse of GetCompressedTileIndex
+inline void GetCompressedTileCoordinates(const CompressedLightFieldHeader& header, uint32_t index, uint32_t* tileU, uint32_t* tileV,
+    uint32_t* tileS, uint32_t* tileT)
+{
+    uint32_t numViewTiles = GetNumViewTiles(header);
+    uint32_t numTexelTiles = GetNumTexelTiles(header);
+    *tileS = index % numTexelTiles;
+    *tileT = (index / numTexelTiles) % numTexelTiles;
+    *tileU = (index / (numTexelTiles * numTexelTiles)) % numViewTiles;
+    *tileV = index / (numTexelTiles * numTexelTiles * numViewTiles);
+}
+
+inline uint32_t GetCompressedBlockSize(const CompressedLightFieldHeader& header)
+{
+    return (header.Format == DXGI_FORMAT_BC1_UNORM) ? 8 : 16;
+}
@@ -1,6 +1,10 @@
 #include "Precomp.h"
 #include "Debug.h"
 #include "Renderer.h"
+#include "CpuRenderer.h"
+#include "SlabBaker.h"
+#include "LightFieldCompressor.h"
+#include "SlabLayout.h"
 
 // Constants
 static const wchar_t ClassName[] = L"Light Field Rendering Test Application";
@@ -15,11 +19,48 @@ static HWND Window;
 // Local methods
 static bool Initialize();
 static void Shutdown();
+static const char* GetArgument(int argc, char* argv[], const char* name);
+static bool HasArgument(int argc, char* argv[], const char* name);
+static int BakeLightField(int argc, char* argv[]);
+static int CompressLightFieldFile(int argc, char* argv[]);
+static int RunCpuBenchmark(int argc, char* argv[]);
+static void AttachToParentConsole();
 static LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
 
-// Entry point
+// Entry point. Pass -bake <file> to bake the light field on the CPU into a file without
+// opening a window, -compress <file> to convert a baked light field into a compressed one,
+// and -load <file> to view a baked or compressed light field instead of baking one on the
+// GPU at startup. Pass -cpu (with -load) to render on the CPU instead of the GPU, and
+// -cpu -benchmark to time the CPU renderer without a window.
 int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
 {
+    bool useCpu = HasArgument(__argc, __argv, "-cpu");
+    if (useCpu && HasArgument(__argc, __argv, "-benchmark"))
+    {
+        AttachToParentConsole();
+        return RunCpuBenchmark(__argc, __argv);
+    }
+
+    // The simple light field scene is baked on the GPU, so the CPU renderer needs a file
+    if (useCpu && !GetArgument(__argc, __argv, "-load"))
+    {
+        AttachToParentConsole();
+        printf("Usage: -cpu -load <file> [-benchmark [-frames n] [-threads n] [-width w] [-height h] [-cache MB]]\n");
+        return -1;
+    }
+
+    if (GetArgument(__argc, __argv, "-bake"))
+    {
+        AttachToParentConsole();
+        return BakeLightField(__argc, __argv);
+    }
+
+    if (GetArgument(__argc, __argv, "-compress"))
+    {
+        AttachToParentConsole();
+        return CompressLightFieldFile(__argc, __argv);
+    }
+
     Instance = instance;
     if (!Initialize())
     {
@@ -27,8 +68,18 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
         return -1;
     }
 
-    std::unique_ptr<Renderer> renderer(Renderer::Create(Window));
-    if (!renderer)
+    std::unique_ptr<Renderer> renderer;
+    std::unique_ptr<CpuRenderer> cpuRenderer;
+    if (useCpu)
+    {
+        cpuRenderer = CpuRenderer::Create(ScreenWidth, ScreenHeight, std::thread::hardware_concurrency());
+    }
+    else
+    {
+        renderer = Renderer::Create(Window);
+    }
+
+    if (!renderer && !cpuRenderer)
     {
         assert(false);
         return -2;
@@ -37,16 +88,43 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
     ShowWindow(Window, SW_SHOW);
     UpdateWindow(Window);
 
-    // Create a simple light field scene
-    LightField lightField;
-    if (!renderer->CreateSimpleOutsideInLightField(&lightField))
+    const char* lightFieldFile = GetArgument(__argc, __argv, "-load");
+    wchar_t filename[MAX_PATH] = {};
+    if (lightFieldFile)
     {
-        assert(false);
-        return -3;
+        swprintf_s(filename, L"%S", lightFieldFile);
     }
 
-    // Set the scene as the active scene to render
-    renderer->SetLightField(lightField);
+    if (cpuRenderer)
+    {
+        if (!cpuRenderer->LoadLightField(filename))
+        {
+            AttachToParentConsole();
+            printf("Failed to load %s\n", lightFieldFile);
+            return -3;
+        }
+    }
+    else
+    {
+        // Load a baked light field, or create a simple light field scene
+        LightField lightField;
+        if (lightFieldFile)
+        {
+            if (!renderer->LoadLightField(filename, &lightField))
+            {
+                assert(false);
+                return -3;
+            }
+        }
+        else if (!renderer->CreateSimpleOutsideInLightField(&lightField))
+        {
+            assert(false);
+            return -3;
+        }
+
+        // Set the scene as the active scene to render
+        renderer->SetLightField(lightField);
+    }
 
     // Timing info
     LARGE_INTEGER lastTime = {};
@@ -165,17 +243,28 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int)
             cameraForward = XMVector3Cross(right, cameraUp);
             cameraUp = XMVector3Cross(cameraForward, right);
 
-            if (!renderer->Render(XMMatrixLookToLH(cameraPosition, cameraForward, cameraUp), projection, VSyncEnabled))
+            XMMATRIX view = XMMatrixLookToLH(cameraPosition, cameraForward, cameraUp);
+            if (cpuRenderer)
+            {
+                if (!cpuRenderer->Render(view, projection))
+                {
+                    assert(false);
+                }
+                cpuRenderer->Present(Window);
+            }
+            else if (!renderer->Render(view, projection, VSyncEnabled))
             {
                 assert(false);
             }
 
-            swprintf_s(caption, L"Light Field Renderer: Resolution: %dx%d, FPS: %3.2f", ScreenWidth, ScreenHeight, frameRate);
+            swprintf_s(caption, L"Light Field Renderer (%s): Resolution: %dx%d, FPS: %3.2f", cpuRenderer ? L"CPU" : L"GPU",
+                ScreenWidth, ScreenHeight, frameRate);
             SetWindowText(Window, caption);
         }
     }
 
     renderer.reset();
+    cpuRenderer.reset();
     Shutdown();
     return 0;
 }
@@ -221,6 +310,273 @@ void Shutdown()
     Window = nullptr;
 }
 
+// Returns the value following the named argument, or nullptr if it wasn't passed
+const char* GetArgument(int argc, char* argv[], const char* name)
+{
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (!strcmp(argv[i], name))
+        {
+            return argv[i + 1];
+        }
+    }
+
+    return nullptr;
+}
+
+// Returns true if the named argument was passed
+bool HasArgument(int argc, char* argv[], const char* name)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], name))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Bakes the simple outside-in light field on the CPU and writes it to a light field file.
+// Usage: LightField.exe -bake <file> [-angular n] [-spatial n] [-threads n]
+int BakeLightField(int argc, char* argv[])
+{
+    SlabBakeSettings settings = {};
+    settings.AngularResolution = 16;
+    settings.SpatialResolution = 512;
+    settings.NumThreads = max(std::thread::hardware_concurrency(), 1u);
+
+    const char* value = GetArgument(argc, argv, "-angular");
+    if (value)
+    {
+        settings.AngularResolution = (uint32_t)max(atoi(value), 1);
+    }
+    value = GetArgument(argc, argv, "-spatial");
+    if (value)
+    {
+        settings.SpatialResolution = (uint32_t)max(atoi(value), 1);
+    }
+    value = GetArgument(argc, argv, "-threads");
+    if (value)
+    {
+        settings.NumThreads = (uint32_t)max(atoi(value), 1);
+    }
+
+    std::unique_ptr<SlabBaker> baker(SlabBaker::Create());
+    if (!baker)
+    {
+        printf("Failed to create the slab baker\n");
+        return -1;
+    }
+
+    wchar_t filename[MAX_PATH] = {};
+    swprintf_s(filename, L"%S", GetArgument(argc, argv, "-bake"));
+
+    printf("Baking %u slabs of %ux%u views at %ux%u, on %u threads\n", NumOutsideInSlabs, settings.AngularResolution,
+        settings.AngularResolution, settings.SpatialResolution, settings.SpatialResolution, settings.NumThreads);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    if (!baker->Bake(filename, settings))
+    {
+        printf("Failed to bake the light field\n");
+        return -2;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    uint32_t numViews = NumOutsideInSlabs * settings.AngularResolution * settings.AngularResolution;
+    printf("Baked %u views in %.2f s (%.1f views/s)\n", numViews, seconds, numViews / seconds);
+    return 0;
+}
+
+// Converts a light field file into a compressed light field file.
+// Usage: LightField.exe -compress <file> -output <file> [-format bc1|bc7] [-tileviews n] [-tiletexels n] [-maxerror n] [-threads n]
+int CompressLightFieldFile(int argc, char* argv[])
+{
+    LightFieldCompressSettings settings = {};
+    settings.Format = DXGI_FORMAT_BC1_UNORM;
+    settings.TileViews = 4;
+    settings.TileTexels = 32;
+    settings.MaxPredictionError = 4;
+    settings.NumThreads = max(std::thread::hardware_concurrency(), 1u);
+
+    const char* output = GetArgument(argc, argv, "-output");
+    if (!output)
+    {
+        printf("Usage: -compress <file> -output <file> [-format bc1|bc7] [-tileviews n] [-tiletexels n] [-maxerror n] [-threads n]\n");
+        return -1;
+    }
+
+    const char* value = GetArgument(argc, argv, "-format");
+    if (value)
+    {
+        if (!_stricmp(value, "bc7"))
+        {
+            settings.Format = DXGI_FORMAT_BC7_UNORM;
+        }
+        else if (_stricmp(value, "bc1"))
+        {
+            printf("Unknown format %s, expected bc1 or bc7\n", value);
+            return -1;
+        }
+    }
+    value = GetArgument(argc, argv, "-tileviews");
+    if (value)
+    {
+        settings.TileViews = (uint32_t)max(atoi(value), 1);
+    }
+    value = GetArgument(argc, argv, "-tiletexels");
+    if (value)
+    {
+        settings.TileTexels = (uint32_t)max(atoi(value), 4) & ~3u;
+    }
+    value = GetArgument(argc, argv, "-maxerror");
+    if (value)
+    {
+        settings.MaxPredictionError = (uint32_t)min(max(atoi(value), 0), 255);
+    }
+    value = GetArgument(argc, argv, "-threads");
+    if (value)
+    {
+        settings.NumThreads = (uint32_t)max(atoi(value), 1);
+    }
+
+    wchar_t sourceFilename[MAX_PATH] = {};
+    wchar_t filename[MAX_PATH] = {};
+    swprintf_s(sourceFilename, L"%S", GetArgument(argc, argv, "-compress"));
+    swprintf_s(filename, L"%S", output);
+
+    printf("Compressing to %s with %ux%u view, %ux%u texel tiles, max prediction error %u, on %u threads\n",
+        (settings.Format == DXGI_FORMAT_BC7_UNORM) ? "BC7" : "BC1", settings.TileViews, settings.TileViews,
+        settings.TileTexels, settings.TileTexels, settings.MaxPredictionError, settings.NumThreads);
+
+    LightFieldCompressStats stats = {};
+    auto startTime = std::chrono::high_resolution_clock::now();
+    if (!CompressLightField(sourceFilename, filename, settings, &stats))
+    {
+        printf("Failed to compress the light field\n");
+        return -2;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    uint64_t numBlocks = stats.StoredBlocks + stats.PredictedBlocks;
+    printf("Compressed %.1f MB to %.1f MB (%.1f:1) in %.2f s, %.1f%% of blocks predicted\n",
+        stats.SourceSize / (1024.0 * 1024.0), stats.CompressedSize / (1024.0 * 1024.0),
+        (double)stats.SourceSize / (double)max(stats.CompressedSize, 1ull), seconds,
+        numBlocks ? 100.0 * stats.PredictedBlocks / numBlocks : 0.0);
+    return 0;
+}
+
+// Renders frames on the CPU from a camera circling the light field, so every slab gets drawn,
+// and prints the frame rate.
+// Usage: LightField.exe -cpu -benchmark -load <file> [-frames n] [-threads n] [-width w] [-height h]
+//        [-cache <MB of decoded tiles, for compressed light fields>]
+int RunCpuBenchmark(int argc, char* argv[])
+{
+    uint32_t numFrames = 100;
+    uint32_t numThreads = max(std::thread::hardware_concurrency(), 1u);
+    uint32_t width = ScreenWidth;
+    uint32_t height = ScreenHeight;
+
+    const char* lightFieldFile = GetArgument(argc, argv, "-load");
+    if (!lightFieldFile)
+    {
+        printf("Usage: -cpu -benchmark -load <file> [-frames n] [-threads n] [-width w] [-height h] [-cache MB]\n");
+        return -1;
+    }
+
+    const char* value = GetArgument(argc, argv, "-frames");
+    if (value)
+    {
+        numFrames = (uint32_t)max(atoi(value), 1);
+    }
+    value = GetArgument(argc, argv, "-threads");
+    if (value)
+    {
+        numThreads = (uint32_t)max(atoi(value), 1);
+    }
+    value = GetArgument(argc, argv, "-width");
+    if (value)
+    {
+        width = (uint32_t)max(atoi(value), 0);
+    }
+    value = GetArgument(argc, argv, "-height");
+    if (value)
+    {
+        height = (uint32_t)max(atoi(value), 0);
+    }
+
+    std::unique_ptr<CpuRenderer> renderer(CpuRenderer::Create(width, height, numThreads));
+    if (!renderer)
+    {
+        printf("Failed to create the CPU renderer (the width must be a multiple of 4)\n");
+        return -1;
+    }
+
+    value = GetArgument(argc, argv, "-cache");
+    if (value)
+    {
+        renderer->SetTileCacheSize((uint64_t)max(atoi(value), 0) << 20);
+    }
+
+    wchar_t filename[MAX_PATH] = {};
+    swprintf_s(filename, L"%S", lightFieldFile);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    if (!renderer->LoadLightField(filename))
+    {
+        printf("Failed to load the light field\n");
+        return -2;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    printf("Loaded %s in %.2f s\n", lightFieldFile, seconds);
+    printf("%ux%u, %u threads, %u frames\n", width, height, numThreads, numFrames);
+
+    XMMATRIX projection = XMMatrixPerspectiveFovLH(XMConvertToRadians(90.f), width / (float)height, 0.05f, 100.f);
+    XMVECTOR up = XMVectorSet(0.f, 1.f, 0.f, 0.f);
+
+    // Starts where the interactive camera does, and goes once around the center
+    auto getView = [&](uint32_t frame)
+    {
+        float angle = XM_2PI * frame / (float)numFrames;
+        XMVECTOR forward = XMVectorSet(-sinf(angle), 0.f, cosf(angle), 0.f);
+        XMVECTOR position = XMVectorSetY(forward * -5.f, 1.f);
+        return XMMatrixLookToLH(position, forward, up);
+    };
+
+    // One frame to warm up
+    if (!renderer->Render(getView(0), projection))
+    {
+        printf("Failed to render frame 0\n");
+        return -3;
+    }
+
+    startTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < numFrames; ++i)
+    {
+        if (!renderer->Render(getView(i), projection))
+        {
+            printf("Failed to render frame %u\n", i);
+            return -3;
+        }
+    }
+    seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    printf("%8.2f fps  %8.2f ms/frame\n", numFrames / seconds, seconds * 1000.0 / numFrames);
+    return 0;
+}
+
+void AttachToParentConsole()
+{
+    if (AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* console = nullptr;
+        freopen_s(&console, "CONOUT$", "w", stdout);
+        freopen_s(&console, "CONOUT$", "w", stderr);
+    }
+}
+
 LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
     switch (msg)
@@ -5,12 +5,21 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <math.h>
 #include <float.h>
 
 #include <memory>
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 
 #include <d3d11.h>
 #include <dxgi.h>
@@ -22,6 +31,9 @@
 #include <Effects.h>
 #include <Model.h>
 
+// DirectXTex, for block compressing light field slices
+#include "DirectXTex\DirectXTex.h"
+
 // Fast vector math with SSE support
 #include <DirectXMath.h>
 using namespace DirectX;
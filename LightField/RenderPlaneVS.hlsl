@@ -3,6 +3,7 @@ cbuffer Constants
     float4x4 World;
     float4x4 ViewProjection;
     uint SlabID;
+    uint AngularResolution;
 };
 
 struct Vertex
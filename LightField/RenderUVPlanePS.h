@@ -3,6 +3,19 @@
 // Generated by Microsoft (R) HLSL Shader Compiler 6.3.9600.16384
 //
 //
+// Buffer Definitions: 
+//
+// cbuffer Constants
+// {
+//
+//   float4x4 World;                    // Offset:    0 Size:    64 [unused]
+//   float4x4 ViewProjection;           // Offset:   64 Size:    64 [unused]
+//   uint SlabID;                       // Offset:  128 Size:     4 [unused]
+//   uint AngularResolution;            // Offset:  132 Size:     4
+//
+// }
+//
+//
 // Resource Bindings:
 //
 // Name                                 Type  Format         Dim Slot Elements
@@ -10,6 +23,7 @@
 // LinearSampler                     sampler      NA          NA    0        1
 // stPlane                           texture  float4          2d    0        1
 // Slices                            texture  float4     2darray    1        1
+// Constants                         cbuffer      NA          NA    0        1
 //
 //
 //
@@ -30,6 +44,7 @@
 //
 ps_5_0
 dcl_globalFlags refactoringAllowed | skipOptimization
+dcl_constantbuffer cb0[9], immediateIndexed
 dcl_sampler s0, mode_default
 dcl_resource_texture2d (float,float,float,float) t0
 dcl_resource_texture2darray (float,float,float,float) t1
@@ -37,22 +52,14 @@ dcl_input_ps_siv linear noperspective v0.xy, position
 dcl_input_ps linear v1.xy
 dcl_output o0.xyzw
 dcl_temps 6
-//
-// Initial variable locations:
-//   v0.x <- input.Position.x; v0.y <- input.Position.y; v0.z <- input.Position.z; v0.w <- input.Position.w; 
-//   v1.x <- input.TexCoord.x; v1.y <- input.TexCoord.y; 
-//   v2.x <- input.SlabID; 
-//   o0.x <- <main return value>.x; o0.y <- <main return value>.y; o0.z <- <main return value>.z; o0.w <- <main return value>.w
-//
-#line 17 "C:\Src\Public\downloads\LightField\RenderUVPlanePS.hlsl"
 resinfo_indexable(texture2d)(float,float,float,float)_uint r0.xy, l(0), t0.xyzw
-mov r0.x, r0.x  // r0.x <- width
-mov r0.y, r0.y  // r0.y <- height
+mov r0.x, r0.x
+mov r0.y, r0.y
 utof r1.x, r0.x
 utof r1.y, r0.y
 div r0.xy, v0.xyxx, r1.xyxx
 sample_indexable(texture2d)(float,float,float,float) r0.xyz, r0.xyxx, t0.xyzw, s0
-mov r0.xyz, r0.xyzx  // r0.x <- stSample.x; r0.y <- stSample.y; r0.z <- stSample.z
+mov r0.xyz, r0.xyzx
 itof r1.x, l(0)
 eq r1.x, r0.z, r1.x
 if_nz r1.x
@@ -61,44 +68,35 @@ if_nz r1.x
   and r1.x, r1.x, l(-1)
   discard_nz r1.x
 endif 
-
-#line 35
-itof r1.x, l(16)
+utof r1.x, cb0[8].y
 mul r1.x, r1.x, v1.y
-ftou r1.x, r1.x  // r1.x <- y0
+ftou r1.x, r1.x
 mov r1.y, l(1)
-iadd r1.y, r1.y, r1.x  // r1.y <- y1
-mov r1.z, l(16)
-uge r1.z, r1.y, r1.z
+iadd r1.y, r1.y, r1.x
+uge r1.z, r1.y, cb0[8].y
 if_nz r1.z
-  mov r1.y, l(15)
+  iadd r1.y, cb0[8].y, l(-1)
 endif 
-itof r1.z, l(16)
+utof r1.z, cb0[8].y
 mul r1.z, r1.z, v1.x
-ftou r1.z, r1.z  // r1.z <- x0
+ftou r1.z, r1.z
 mov r1.w, l(1)
-iadd r1.w, r1.w, r1.z  // r1.w <- x1
-mov r2.x, l(16)
-uge r2.x, r1.w, r2.x
+iadd r1.w, r1.w, r1.z
+uge r2.x, r1.w, cb0[8].y
 if_nz r2.x
-
-#line 46
-  mov r1.w, l(15)
+  iadd r1.w, cb0[8].y, l(-1)
 endif 
-itof r2.x, l(16)
+utof r2.x, cb0[8].y
 mul r2.x, r2.x, v1.y
 utof r2.y, r1.x
 mov r2.y, -r2.y
-add r2.x, r2.y, r2.x  // r2.x <- yLerp
-itof r2.y, l(16)
+add r2.x, r2.y, r2.x
+utof r2.y, cb0[8].y
 mul r2.y, r2.y, v1.x
 utof r2.z, r1.z
 mov r2.z, -r2.z
-add r2.y, r2.z, r2.y  // r2.y <- xLerp
-
-#line 53
-mov r2.z, l(16)
-imul null, r2.z, r1.x, r2.z
+add r2.y, r2.z, r2.y
+imul null, r2.z, r1.x, cb0[8].y
 iadd r2.z, r1.z, r2.z
 utof r0.w, r2.z
 itof r2.z, l(1)
@@ -107,17 +105,15 @@ add r2.z, r2.w, r2.z
 itof r2.w, l(4)
 mul r2.z, r2.w, r2.z
 sample_l_indexable(texture2darray)(float,float,float,float) r3.xyz, r0.xywx, t1.xyzw, s0, r2.z
-mov r3.xyz, r3.xyzx  // r3.x <- sample0.x; r3.y <- sample0.y; r3.z <- sample0.z
-mov r2.z, l(16)
-imul null, r1.x, r1.x, r2.z
+mov r3.xyz, r3.xyzx
+imul null, r1.x, r1.x, cb0[8].y
 iadd r1.x, r1.w, r1.x
 utof r0.z, r1.x
 itof r1.x, l(4)
 mul r1.x, r1.x, r2.y
 sample_l_indexable(texture2darray)(float,float,float,float) r4.xyz, r0.xyzx, t1.xyzw, s0, r1.x
-mov r4.xyz, r4.xyzx  // r4.x <- sample1.x; r4.y <- sample1.y; r4.z <- sample1.z
-mov r1.x, l(16)
-imul null, r1.x, r1.x, r1.y
+mov r4.xyz, r4.xyzx
+imul null, r1.x, cb0[8].y, r1.y
 iadd r1.x, r1.z, r1.x
 utof r0.w, r1.x
 itof r1.x, l(1)
@@ -126,115 +122,176 @@ add r1.x, r1.z, r1.x
 itof r1.z, l(4)
 mul r1.x, r1.z, r1.x
 sample_l_indexable(texture2darray)(float,float,float,float) r5.xyz, r0.xywx, t1.xyzw, s0, r1.x
-mov r5.xyz, r5.xyzx  // r5.x <- sample2.x; r5.y <- sample2.y; r5.z <- sample2.z
-mov r0.w, l(16)
-imul null, r0.w, r0.w, r1.y
+mov r5.xyz, r5.xyzx
+imul null, r0.w, cb0[8].y, r1.y
 iadd r0.w, r1.w, r0.w
 utof r0.z, r0.w
 itof r0.w, l(4)
 mul r0.w, r0.w, r2.y
 sample_l_indexable(texture2darray)(float,float,float,float) r0.xyz, r0.xyzx, t1.xyzw, s0, r0.w
-mov r0.xyz, r0.xyzx  // r0.x <- sample3.x; r0.y <- sample3.y; r0.z <- sample3.z
+mov r0.xyz, r0.xyzx
 mov r1.xyz, -r3.xyzx
 add r1.xyz, r1.xyzx, r4.xyzx
 mul r1.xyz, r1.xyzx, r2.yyyy
-add r1.xyz, r1.xyzx, r3.xyzx  // r1.x <- sample01.x; r1.y <- sample01.y; r1.z <- sample01.z
+add r1.xyz, r1.xyzx, r3.xyzx
 mov r3.xyz, -r5.xyzx
 add r0.xyz, r0.xyzx, r3.xyzx
 mul r0.xyz, r0.xyzx, r2.yyyy
-add r0.xyz, r0.xyzx, r5.xyzx  // r0.x <- sample23.x; r0.y <- sample23.y; r0.z <- sample23.z
+add r0.xyz, r0.xyzx, r5.xyzx
 mov r2.yzw, -r1.xxyz
 add r0.xyz, r0.xyzx, r2.yzwy
 mul r0.xyz, r0.xyzx, r2.xxxx
 add o0.xyz, r0.xyzx, r1.xyzx
 mov o0.w, l(1.000000)
 ret 
-// Approximately 98 instruction slots used
+// Approximately 92 instruction slots used
 #endif
 
 const BYTE RenderUVPlanePS[] =
 {
-     68,  88,  66,  67, 149, 109, 
-      8, 209,  59, 193, 208, 117, 
-     93, 135,   0, 145, 206, 161, 
-    233,  35,   1,   0,   0,   0, 
-     40,  90,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-     44,   1,   0,   0, 156,   1, 
-      0,   0, 208,   1,   0,   0, 
-    132,  11,   0,   0,  32,  12, 
-      0,   0,  82,  68,  69,  70, 
-    236,   0,   0,   0,   0,   0, 
+     68,  88,  66,  67, 211,  55, 
+     14, 204,  88,   0,  71, 228, 
+    104, 249,  22,  80, 253,  99, 
+    157, 141,   1,   0,   0,   0, 
+     92,  13,   0,   0,   5,   0, 
+      0,   0,  52,   0,   0,   0, 
+    144,   2,   0,   0,   0,   3, 
+      0,   0,  52,   3,   0,   0, 
+    192,  12,   0,   0,  82,  68, 
+     69,  70,  84,   2,   0,   0, 
+      1,   0,   0,   0, 228,   0, 
+      0,   0,   4,   0,   0,   0, 
+     60,   0,   0,   0,   0,   5, 
+    255, 255,   5,   1,   0,   0, 
+     34,   2,   0,   0,  82,  68, 
+     49,  49,  60,   0,   0,   0, 
+     24,   0,   0,   0,  32,   0, 
+      0,   0,  40,   0,   0,   0, 
+     36,   0,   0,   0,  12,   0, 
       0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,  60,   0, 
-      0,   0,   0,   5, 255, 255, 
-      5,   1,   0,   0, 185,   0, 
-      0,   0,  82,  68,  49,  49, 
-     60,   0,   0,   0,  24,   0, 
-      0,   0,  32,   0,   0,   0, 
-     40,   0,   0,   0,  36,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 156,   0, 
-      0,   0,   3,   0,   0,   0, 
+    188,   0,   0,   0,   3,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
       0,   0,   0,   0,   0,   0, 
-    170,   0,   0,   0,   2,   0, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      1,   0,   0,   0,  12,   0, 
-      0,   0, 178,   0,   0,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0, 202,   0,   0,   0, 
       2,   0,   0,   0,   5,   0, 
-      0,   0,   5,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
+      0,   0,   4,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
       0,   0,   1,   0,   0,   0, 
-     12,   0,   0,   0,  76, 105, 
-    110, 101,  97, 114,  83,  97, 
-    109, 112, 108, 101, 114,   0, 
-    115, 116,  80, 108,  97, 110, 
-    101,   0,  83, 108, 105,  99, 
-    101, 115,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  54,  46,  51,  46, 
-     57,  54,  48,  48,  46,  49, 
-     54,  51,  56,  52,   0, 171, 
-     73,  83,  71,  78, 104,   0, 
-      0,   0,   3,   0,   0,   0, 
-      8,   0,   0,   0,  80,   0, 
+     12,   0,   0,   0, 210,   0, 
+      0,   0,   2,   0,   0,   0, 
+      5,   0,   0,   0,   5,   0, 
+      0,   0, 255, 255, 255, 255, 
+      1,   0,   0,   0,   1,   0, 
+      0,   0,  12,   0,   0,   0, 
+    217,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   3,   0, 
       0,   0,   0,   0,   0,   0, 
-     15,   3,   0,   0,  92,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0,  76, 105, 110, 101, 
+     97, 114,  83,  97, 109, 112, 
+    108, 101, 114,   0, 115, 116, 
+     80, 108,  97, 110, 101,   0, 
+     83, 108, 105,  99, 101, 115, 
+      0,  67, 111, 110, 115, 116, 
+     97, 110, 116, 115,   0, 171, 
+    217,   0,   0,   0,   4,   0, 
+      0,   0, 252,   0,   0,   0, 
+    144,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+    156,   1,   0,   0,   0,   0, 
+      0,   0,  64,   0,   0,   0, 
+      0,   0,   0,   0, 172,   1, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0, 208,   1, 
+      0,   0,  64,   0,   0,   0, 
+     64,   0,   0,   0,   0,   0, 
+      0,   0, 172,   1,   0,   0, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0, 223,   1,   0,   0, 
+    128,   0,   0,   0,   4,   0, 
+      0,   0,   0,   0,   0,   0, 
+    236,   1,   0,   0,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0, 255, 255, 
+    255, 255,   0,   0,   0,   0, 
+     16,   2,   0,   0, 132,   0, 
+      0,   0,   4,   0,   0,   0, 
+      2,   0,   0,   0, 236,   1, 
+      0,   0,   0,   0,   0,   0, 
+    255, 255, 255, 255,   0,   0, 
+      0,   0, 255, 255, 255, 255, 
+      0,   0,   0,   0,  87, 111, 
+    114, 108, 100,   0, 102, 108, 
+    111,  97, 116,  52, 120,  52, 
+      0, 171,   3,   0,   3,   0, 
+      4,   0,   4,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0, 162,   1, 
+      0,   0,  86, 105, 101, 119, 
+     80, 114, 111, 106, 101,  99, 
+    116, 105, 111, 110,   0,  83, 
+    108,  97,  98,  73,  68,   0, 
+    100, 119, 111, 114, 100,   0, 
+      0,   0,  19,   0,   1,   0, 
+      1,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      0,   0, 230,   1,   0,   0, 
+     65, 110, 103, 117, 108,  97, 
+    114,  82, 101, 115, 111, 108, 
+    117, 116, 105, 111, 110,   0, 
+     77, 105,  99, 114, 111, 115, 
+    111, 102, 116,  32,  40,  82, 
+     41,  32,  72,  76,  83,  76, 
+     32,  83, 104,  97, 100, 101, 
+    114,  32,  67, 111, 109, 112, 
+    105, 108, 101, 114,  32,  54, 
+     46,  51,  46,  57,  54,  48, 
+     48,  46,  49,  54,  51,  56, 
+     52,   0,  73,  83,  71,  78, 
+    104,   0,   0,   0,   3,   0, 
+      0,   0,   8,   0,   0,   0, 
+     80,   0,   0,   0,   0,   0, 
+      0,   0,   1,   0,   0,   0, 
+      3,   0,   0,   0,   0,   0, 
+      0,   0,  15,   3,   0,   0, 
+     92,   0,   0,   0,   0,   0, 
+      0,   0,   0,   0,   0,   0, 
+      3,   0,   0,   0,   1,   0, 
+      0,   0,   3,   3,   0,   0, 
+     92,   0,   0,   0,   1,   0, 
+      0,   0,   0,   0,   0,   0, 
+      1,   0,   0,   0,   2,   0, 
       0,   0,   1,   0,   0,   0, 
-      3,   3,   0,   0,  92,   0, 
+     83,  86,  95,  80,  79,  83, 
+     73,  84,  73,  79,  78,   0, 
+     84,  69,  88,  67,  79,  79, 
+     82,  68,   0, 171, 171, 171, 
+     79,  83,  71,  78,  44,   0, 
       0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  83,  86, 
-     95,  80,  79,  83,  73,  84, 
-     73,  79,  78,   0,  84,  69, 
-     88,  67,  79,  79,  82,  68, 
-      0, 171, 171, 171,  79,  83, 
-     71,  78,  44,   0,   0,   0, 
-      1,   0,   0,   0,   8,   0, 
-      0,   0,  32,   0,   0,   0, 
+      8,   0,   0,   0,  32,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,  15,   0, 
-      0,   0,  83,  86,  95,  84, 
-     65,  82,  71,  69,  84,   0, 
-    171, 171,  83,  72,  69,  88, 
-    172,   9,   0,   0,  80,   0, 
-      0,   0, 107,   2,   0,   0, 
-    106, 136,   0,   1,  90,   0, 
+      0,   0,   0,   0,   3,   0, 
+      0,   0,   0,   0,   0,   0, 
+     15,   0,   0,   0,  83,  86, 
+     95,  84,  65,  82,  71,  69, 
+     84,   0, 171, 171,  83,  72, 
+     69,  88, 132,   9,   0,   0, 
+     80,   0,   0,   0,  97,   2, 
+      0,   0, 106, 136,   0,   1, 
+     89,   0,   0,   4,  70, 142, 
+     32,   0,   0,   0,   0,   0, 
+      9,   0,   0,   0,  90,   0, 
       0,   3,   0,  96,  16,   0, 
       0,   0,   0,   0,  88,  24, 
       0,   4,   0, 112,  16,   0, 
@@ -310,170 +367,166 @@ const BYTE RenderUVPlanePS[] =
     255, 255,  13,   0,   4,   3, 
      10,   0,  16,   0,   1,   0, 
       0,   0,  21,   0,   0,   1, 
-     43,   0,   0,   5,  18,   0, 
-     16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,  16,   0, 
-      0,   0,  56,   0,   0,   7, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  26,  16, 
+     86,   0,   0,   6,  18,   0, 
      16,   0,   1,   0,   0,   0, 
-     28,   0,   0,   5,  18,   0, 
+     26, 128,  32,   0,   0,   0, 
+      0,   0,   8,   0,   0,   0, 
+     56,   0,   0,   7,  18,   0, 
      16,   0,   1,   0,   0,   0, 
      10,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
+      0,   0,  26,  16,  16,   0, 
+      1,   0,   0,   0,  28,   0, 
+      0,   5,  18,   0,  16,   0, 
+      1,   0,   0,   0,  10,   0, 
+     16,   0,   1,   0,   0,   0, 
+     54,   0,   0,   5,  34,   0, 
+     16,   0,   1,   0,   0,   0, 
+      1,  64,   0,   0,   1,   0, 
+      0,   0,  30,   0,   0,   7, 
      34,   0,  16,   0,   1,   0, 
-      0,   0,   1,  64,   0,   0, 
-      1,   0,   0,   0,  30,   0, 
-      0,   7,  34,   0,  16,   0, 
-      1,   0,   0,   0,  26,   0, 
+      0,   0,  26,   0,  16,   0, 
+      1,   0,   0,   0,  10,   0, 
      16,   0,   1,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-     66,   0,  16,   0,   1,   0, 
-      0,   0,   1,  64,   0,   0, 
-     16,   0,   0,   0,  80,   0, 
-      0,   7,  66,   0,  16,   0, 
-      1,   0,   0,   0,  26,   0, 
+     80,   0,   0,   8,  66,   0, 
      16,   0,   1,   0,   0,   0, 
-     42,   0,  16,   0,   1,   0, 
+     26,   0,  16,   0,   1,   0, 
+      0,   0,  26, 128,  32,   0, 
+      0,   0,   0,   0,   8,   0, 
       0,   0,  31,   0,   4,   3, 
      42,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
+      0,   0,  30,   0,   0,   8, 
      34,   0,  16,   0,   1,   0, 
+      0,   0,  26, 128,  32,   0, 
+      0,   0,   0,   0,   8,   0, 
       0,   0,   1,  64,   0,   0, 
-     15,   0,   0,   0,  21,   0, 
-      0,   1,  43,   0,   0,   5, 
+    255, 255, 255, 255,  21,   0, 
+      0,   1,  86,   0,   0,   6, 
      66,   0,  16,   0,   1,   0, 
-      0,   0,   1,  64,   0,   0, 
-     16,   0,   0,   0,  56,   0, 
-      0,   7,  66,   0,  16,   0, 
-      1,   0,   0,   0,  42,   0, 
-     16,   0,   1,   0,   0,   0, 
-     10,  16,  16,   0,   1,   0, 
-      0,   0,  28,   0,   0,   5, 
+      0,   0,  26, 128,  32,   0, 
+      0,   0,   0,   0,   8,   0, 
+      0,   0,  56,   0,   0,   7, 
      66,   0,  16,   0,   1,   0, 
       0,   0,  42,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     30,   0,   0,   7, 130,   0, 
+      1,   0,   0,   0,  10,  16, 
      16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  42,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,  16,   0,   0,   0, 
-     80,   0,   0,   7,  18,   0, 
-     16,   0,   2,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  10,   0,  16,   0, 
-      2,   0,   0,   0,  31,   0, 
+     28,   0,   0,   5,  66,   0, 
+     16,   0,   1,   0,   0,   0, 
+     42,   0,  16,   0,   1,   0, 
+      0,   0,  54,   0,   0,   5, 
+    130,   0,  16,   0,   1,   0, 
+      0,   0,   1,  64,   0,   0, 
+      1,   0,   0,   0,  30,   0, 
+      0,   7, 130,   0,  16,   0, 
+      1,   0,   0,   0,  58,   0, 
+     16,   0,   1,   0,   0,   0, 
+     42,   0,  16,   0,   1,   0, 
+      0,   0,  80,   0,   0,   8, 
+     18,   0,  16,   0,   2,   0, 
+      0,   0,  58,   0,  16,   0, 
+      1,   0,   0,   0,  26, 128, 
+     32,   0,   0,   0,   0,   0, 
+      8,   0,   0,   0,  31,   0, 
       4,   3,  10,   0,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,  15,   0,   0,   0, 
-     21,   0,   0,   1,  43,   0, 
-      0,   5,  18,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,  16,   0,   0,   0, 
-     56,   0,   0,   7,  18,   0, 
-     16,   0,   2,   0,   0,   0, 
-     10,   0,  16,   0,   2,   0, 
-      0,   0,  26,  16,  16,   0, 
-      1,   0,   0,   0,  86,   0, 
-      0,   5,  34,   0,  16,   0, 
+      2,   0,   0,   0,  30,   0, 
+      0,   8, 130,   0,  16,   0, 
+      1,   0,   0,   0,  26, 128, 
+     32,   0,   0,   0,   0,   0, 
+      8,   0,   0,   0,   1,  64, 
+      0,   0, 255, 255, 255, 255, 
+     21,   0,   0,   1,  86,   0, 
+      0,   6,  18,   0,  16,   0, 
+      2,   0,   0,   0,  26, 128, 
+     32,   0,   0,   0,   0,   0, 
+      8,   0,   0,   0,  56,   0, 
+      0,   7,  18,   0,  16,   0, 
       2,   0,   0,   0,  10,   0, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   6,  34,   0, 
-     16,   0,   2,   0,   0,   0, 
-     26,   0,  16, 128,  65,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,   0,   7,  18,   0, 
      16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   2,   0, 
+     26,  16,  16,   0,   1,   0, 
+      0,   0,  86,   0,   0,   5, 
+     34,   0,  16,   0,   2,   0, 
       0,   0,  10,   0,  16,   0, 
-      2,   0,   0,   0,  43,   0, 
-      0,   5,  34,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,  16,   0,   0,   0, 
-     56,   0,   0,   7,  34,   0, 
+      1,   0,   0,   0,  54,   0, 
+      0,   6,  34,   0,  16,   0, 
+      2,   0,   0,   0,  26,   0, 
+     16, 128,  65,   0,   0,   0, 
+      2,   0,   0,   0,   0,   0, 
+      0,   7,  18,   0,  16,   0, 
+      2,   0,   0,   0,  26,   0, 
      16,   0,   2,   0,   0,   0, 
-     26,   0,  16,   0,   2,   0, 
-      0,   0,  10,  16,  16,   0, 
-      1,   0,   0,   0,  86,   0, 
-      0,   5,  66,   0,  16,   0, 
-      2,   0,   0,   0,  42,   0, 
+     10,   0,  16,   0,   2,   0, 
+      0,   0,  86,   0,   0,   6, 
+     34,   0,  16,   0,   2,   0, 
+      0,   0,  26, 128,  32,   0, 
+      0,   0,   0,   0,   8,   0, 
+      0,   0,  56,   0,   0,   7, 
+     34,   0,  16,   0,   2,   0, 
+      0,   0,  26,   0,  16,   0, 
+      2,   0,   0,   0,  10,  16, 
      16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   6,  66,   0, 
+     86,   0,   0,   5,  66,   0, 
      16,   0,   2,   0,   0,   0, 
-     42,   0,  16, 128,  65,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,   0,   7,  34,   0, 
+     42,   0,  16,   0,   1,   0, 
+      0,   0,  54,   0,   0,   6, 
+     66,   0,  16,   0,   2,   0, 
+      0,   0,  42,   0,  16, 128, 
+     65,   0,   0,   0,   2,   0, 
+      0,   0,   0,   0,   0,   7, 
+     34,   0,  16,   0,   2,   0, 
+      0,   0,  42,   0,  16,   0, 
+      2,   0,   0,   0,  26,   0, 
      16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,  16,   0,   0,   0, 
-     38,   0,   0,   8,   0, 208, 
+     38,   0,   0,   9,   0, 208, 
       0,   0,  66,   0,  16,   0, 
       2,   0,   0,   0,  10,   0, 
      16,   0,   1,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
-      0,   0,  30,   0,   0,   7, 
-     66,   0,  16,   0,   2,   0, 
+     26, 128,  32,   0,   0,   0, 
+      0,   0,   8,   0,   0,   0, 
+     30,   0,   0,   7,  66,   0, 
+     16,   0,   2,   0,   0,   0, 
+     42,   0,  16,   0,   1,   0, 
       0,   0,  42,   0,  16,   0, 
-      1,   0,   0,   0,  42,   0, 
+      2,   0,   0,   0,  86,   0, 
+      0,   5, 130,   0,  16,   0, 
+      0,   0,   0,   0,  42,   0, 
      16,   0,   2,   0,   0,   0, 
-     86,   0,   0,   5, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
-      0,   0,  43,   0,   0,   5, 
-     66,   0,  16,   0,   2,   0, 
-      0,   0,   1,  64,   0,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   6, 130,   0,  16,   0, 
-      2,   0,   0,   0,  26,   0, 
-     16, 128,  65,   0,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   7,  66,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
+     43,   0,   0,   5,  66,   0, 
      16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
-      0,   0,  43,   0,   0,   5, 
+      1,  64,   0,   0,   1,   0, 
+      0,   0,  54,   0,   0,   6, 
     130,   0,  16,   0,   2,   0, 
-      0,   0,   1,  64,   0,   0, 
-      4,   0,   0,   0,  56,   0, 
-      0,   7,  66,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
+      0,   0,  26,   0,  16, 128, 
+     65,   0,   0,   0,   2,   0, 
+      0,   0,   0,   0,   0,   7, 
+     66,   0,  16,   0,   2,   0, 
+      0,   0,  58,   0,  16,   0, 
+      2,   0,   0,   0,  42,   0, 
      16,   0,   2,   0,   0,   0, 
-     42,   0,  16,   0,   2,   0, 
-      0,   0,  72,   0,   0, 141, 
-      2,   2,   0, 128,  67,  85, 
-     21,   0, 114,   0,  16,   0, 
-      3,   0,   0,   0,  70,   3, 
-     16,   0,   0,   0,   0,   0, 
-     70, 126,  16,   0,   1,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  42,   0, 
+     43,   0,   0,   5, 130,   0, 
      16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
+      1,  64,   0,   0,   4,   0, 
+      0,   0,  56,   0,   0,   7, 
      66,   0,  16,   0,   2,   0, 
-      0,   0,   1,  64,   0,   0, 
-     16,   0,   0,   0,  38,   0, 
-      0,   8,   0, 208,   0,   0, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  42,   0, 
+      0,   0,  58,   0,  16,   0, 
+      2,   0,   0,   0,  42,   0, 
      16,   0,   2,   0,   0,   0, 
+     72,   0,   0, 141,   2,   2, 
+      0, 128,  67,  85,  21,   0, 
+    114,   0,  16,   0,   3,   0, 
+      0,   0,  70,   3,  16,   0, 
+      0,   0,   0,   0,  70, 126, 
+     16,   0,   1,   0,   0,   0, 
+      0,  96,  16,   0,   0,   0, 
+      0,   0,  42,   0,  16,   0, 
+      2,   0,   0,   0,  54,   0, 
+      0,   5, 114,   0,  16,   0, 
+      3,   0,   0,   0,  70,   2, 
+     16,   0,   3,   0,   0,   0, 
+     38,   0,   0,   9,   0, 208, 
+      0,   0,  18,   0,  16,   0, 
+      1,   0,   0,   0,  10,   0, 
+     16,   0,   1,   0,   0,   0, 
+     26, 128,  32,   0,   0,   0, 
+      0,   0,   8,   0,   0,   0, 
      30,   0,   0,   7,  18,   0, 
      16,   0,   1,   0,   0,   0, 
      58,   0,  16,   0,   1,   0, 
@@ -502,3495 +555,160 @@ const BYTE RenderUVPlanePS[] =
       0,   5, 114,   0,  16,   0, 
       4,   0,   0,   0,  70,   2, 
      16,   0,   4,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,  16,   0, 
-      0,   0,  38,   0,   0,   8, 
-      0, 208,   0,   0,  18,   0, 
+     38,   0,   0,   9,   0, 208, 
+      0,   0,  18,   0,  16,   0, 
+      1,   0,   0,   0,  26, 128, 
+     32,   0,   0,   0,   0,   0, 
+      8,   0,   0,   0,  26,   0, 
      16,   0,   1,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  26,   0,  16,   0, 
-      1,   0,   0,   0,  30,   0, 
-      0,   7,  18,   0,  16,   0, 
-      1,   0,   0,   0,  42,   0, 
+     30,   0,   0,   7,  18,   0, 
      16,   0,   1,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  86,   0,   0,   5, 
-    130,   0,  16,   0,   0,   0, 
+     42,   0,  16,   0,   1,   0, 
       0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  43,   0, 
-      0,   5,  18,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     54,   0,   0,   6,  66,   0, 
+      1,   0,   0,   0,  86,   0, 
+      0,   5, 130,   0,  16,   0, 
+      0,   0,   0,   0,  10,   0, 
      16,   0,   1,   0,   0,   0, 
-     26,   0,  16, 128,  65,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,   0,   7,  18,   0, 
+     43,   0,   0,   5,  18,   0, 
      16,   0,   1,   0,   0,   0, 
-     42,   0,  16,   0,   1,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  43,   0, 
-      0,   5,  66,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   4,   0,   0,   0, 
-     56,   0,   0,   7,  18,   0, 
+      1,  64,   0,   0,   1,   0, 
+      0,   0,  54,   0,   0,   6, 
+     66,   0,  16,   0,   1,   0, 
+      0,   0,  26,   0,  16, 128, 
+     65,   0,   0,   0,   2,   0, 
+      0,   0,   0,   0,   0,   7, 
+     18,   0,  16,   0,   1,   0, 
+      0,   0,  42,   0,  16,   0, 
+      1,   0,   0,   0,  10,   0, 
      16,   0,   1,   0,   0,   0, 
-     42,   0,  16,   0,   1,   0, 
+     43,   0,   0,   5,  66,   0, 
+     16,   0,   1,   0,   0,   0, 
+      1,  64,   0,   0,   4,   0, 
+      0,   0,  56,   0,   0,   7, 
+     18,   0,  16,   0,   1,   0, 
+      0,   0,  42,   0,  16,   0, 
+      1,   0,   0,   0,  10,   0, 
+     16,   0,   1,   0,   0,   0, 
+     72,   0,   0, 141,   2,   2, 
+      0, 128,  67,  85,  21,   0, 
+    114,   0,  16,   0,   5,   0, 
+      0,   0,  70,   3,  16,   0, 
+      0,   0,   0,   0,  70, 126, 
+     16,   0,   1,   0,   0,   0, 
+      0,  96,  16,   0,   0,   0, 
       0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  72,   0, 
-      0, 141,   2,   2,   0, 128, 
-     67,  85,  21,   0, 114,   0, 
+      1,   0,   0,   0,  54,   0, 
+      0,   5, 114,   0,  16,   0, 
+      5,   0,   0,   0,  70,   2, 
      16,   0,   5,   0,   0,   0, 
-     70,   3,  16,   0,   0,   0, 
-      0,   0,  70, 126,  16,   0, 
-      1,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-      5,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,  16,   0,   0,   0, 
-     38,   0,   0,   8,   0, 208, 
+     38,   0,   0,   9,   0, 208, 
       0,   0, 130,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
+      0,   0,   0,   0,  26, 128, 
+     32,   0,   0,   0,   0,   0, 
+      8,   0,   0,   0,  26,   0, 
+     16,   0,   1,   0,   0,   0, 
+     30,   0,   0,   7, 130,   0, 
      16,   0,   0,   0,   0,   0, 
-     26,   0,  16,   0,   1,   0, 
-      0,   0,  30,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
+     58,   0,  16,   0,   1,   0, 
       0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
+      0,   0,   0,   0,  86,   0, 
+      0,   5,  66,   0,  16,   0, 
+      0,   0,   0,   0,  58,   0, 
      16,   0,   0,   0,   0,   0, 
-     86,   0,   0,   5,  66,   0, 
+     43,   0,   0,   5, 130,   0, 
      16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  43,   0,   0,   5, 
+      1,  64,   0,   0,   4,   0, 
+      0,   0,  56,   0,   0,   7, 
     130,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      4,   0,   0,   0,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     26,   0,  16,   0,   2,   0, 
-      0,   0,  72,   0,   0, 141, 
-      2,   2,   0, 128,  67,  85, 
-     21,   0, 114,   0,  16,   0, 
+      0,   0,  58,   0,  16,   0, 
+      0,   0,   0,   0,  26,   0, 
+     16,   0,   2,   0,   0,   0, 
+     72,   0,   0, 141,   2,   2, 
+      0, 128,  67,  85,  21,   0, 
+    114,   0,  16,   0,   0,   0, 
+      0,   0,  70,   2,  16,   0, 
+      0,   0,   0,   0,  70, 126, 
+     16,   0,   1,   0,   0,   0, 
+      0,  96,  16,   0,   0,   0, 
+      0,   0,  58,   0,  16,   0, 
+      0,   0,   0,   0,  54,   0, 
+      0,   5, 114,   0,  16,   0, 
       0,   0,   0,   0,  70,   2, 
      16,   0,   0,   0,   0,   0, 
-     70, 126,  16,   0,   1,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16, 128, 
-     65,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
+     54,   0,   0,   6, 114,   0, 
+     16,   0,   1,   0,   0,   0, 
+     70,   2,  16, 128,  65,   0, 
+      0,   0,   3,   0,   0,   0, 
+      0,   0,   0,   7, 114,   0, 
      16,   0,   1,   0,   0,   0, 
      70,   2,  16,   0,   1,   0, 
-      0,   0,  86,   5,  16,   0, 
-      2,   0,   0,   0,   0,   0, 
+      0,   0,  70,   2,  16,   0, 
+      4,   0,   0,   0,  56,   0, 
       0,   7, 114,   0,  16,   0, 
       1,   0,   0,   0,  70,   2, 
      16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16, 128, 
-     65,   0,   0,   0,   5,   0, 
+     86,   5,  16,   0,   2,   0, 
       0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   0,   0, 
+    114,   0,  16,   0,   1,   0, 
       0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
+      1,   0,   0,   0,  70,   2, 
+     16,   0,   3,   0,   0,   0, 
+     54,   0,   0,   6, 114,   0, 
      16,   0,   3,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
+     70,   2,  16, 128,  65,   0, 
+      0,   0,   5,   0,   0,   0, 
+      0,   0,   0,   7, 114,   0, 
      16,   0,   0,   0,   0,   0, 
      70,   2,  16,   0,   0,   0, 
-      0,   0,  86,   5,  16,   0, 
-      2,   0,   0,   0,   0,   0, 
+      0,   0,  70,   2,  16,   0, 
+      3,   0,   0,   0,  56,   0, 
       0,   7, 114,   0,  16,   0, 
       0,   0,   0,   0,  70,   2, 
      16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  54,   0,   0,   6, 
-    226,   0,  16,   0,   2,   0, 
-      0,   0,   6,   9,  16, 128, 
-     65,   0,   0,   0,   1,   0, 
+     86,   5,  16,   0,   2,   0, 
       0,   0,   0,   0,   0,   7, 
     114,   0,  16,   0,   0,   0, 
       0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0, 150,   7, 
+      0,   0,   0,   0,  70,   2, 
+     16,   0,   5,   0,   0,   0, 
+     54,   0,   0,   6, 226,   0, 
      16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
+      6,   9,  16, 128,  65,   0, 
+      0,   0,   1,   0,   0,   0, 
+      0,   0,   0,   7, 114,   0, 
      16,   0,   0,   0,   0,   0, 
      70,   2,  16,   0,   0,   0, 
-      0,   0,   6,   0,  16,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   7, 114,  32,  16,   0, 
+      0,   0, 150,   7,  16,   0, 
+      2,   0,   0,   0,  56,   0, 
+      0,   7, 114,   0,  16,   0, 
       0,   0,   0,   0,  70,   2, 
      16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,  32,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  62,   0, 
-      0,   1,  83,  84,  65,  84, 
-    148,   0,   0,   0,  98,   0, 
-      0,   0,   6,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,  31,   0,   0,   0, 
-     10,   0,   0,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  18,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  83,  80,  68,  66, 
-      0,  78,   0,   0,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  67,  47,  67,  43, 
-     43,  32,  77,  83,  70,  32, 
-     55,  46,  48,  48,  13,  10, 
-     26,  68,  83,   0,   0,   0, 
-      0,   2,   0,   0,   2,   0, 
-      0,   0,  39,   0,   0,   0, 
-    188,   0,   0,   0,   0,   0, 
-      0,   0,  36,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    192, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255,  56,   0,   0,   0, 
-    224, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,   5,   0, 
-      0,   0,  32,   0,   0,   0, 
-     60,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   6,   0, 
-      0,   0,   5,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,  46,  49,   1, 
-    152,  62,  26,  85,   1,   0, 
-      0,   0, 133, 196, 233, 227, 
-    248, 136, 191,  70, 164,  17, 
-    254, 242, 239, 101,  44,  73, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  65, 145, 
-     50,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 101,  97, 
-    114,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32,  40, 105, 
-    110, 112, 117, 116,  46,  80, 
-    111, 115, 105, 116, 105, 111, 
-    110,  46, 120, 121,  32,  47, 
-     32, 102, 108, 111,  97, 116, 
-     50,  40, 119, 105, 100, 116, 
-    104,  44,  32, 104, 101, 105, 
-    103, 104, 116,  41,  41,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40, 115, 116,  83,  97, 109, 
-    112, 108, 101,  46, 122,  32, 
-     61,  61,  32,  48,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  99, 108, 
-    105, 112,  40,  45,  49,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 125,  13,  10,  13,  10, 
-     35, 105, 102,  32,  48,  32, 
-     47,  47,  32,  78, 101,  97, 
-    114, 101, 115, 116,  32,  78, 
-    101, 105, 103, 104,  98, 111, 
-    114,  32,  40, 110, 111,  32, 
-    102, 105, 108, 116, 101, 114, 
-    105, 110, 103,  32, 111, 110, 
-     32, 116, 104, 101,  32, 117, 
-    118,  32, 112, 108,  97, 110, 
-    101,  44,  32, 111, 110, 108, 
-    121,  32, 115, 116,  32, 112, 
-    108,  97, 110, 101,  41,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    120,  32,  61,  32,  40, 117, 
-    105, 110, 116,  41,  40, 105, 
-    110, 112, 117, 116,  46,  84, 
-    101, 120,  67, 111, 111, 114, 
-    100,  46, 120,  32,  42,  32, 
-     49,  54,  41,  59,  13,  10, 
-     32,  32,  32,  32, 117, 105, 
-    110, 116,  32, 121,  32,  61, 
-     32,  40, 117, 105, 110, 116, 
-     41,  40, 105, 110, 112, 117, 
-    116,  46,  84, 101, 120,  67, 
-    111, 111, 114, 100,  46, 121, 
-     32,  42,  32,  49,  54,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  52,  40,  83, 
-    108, 105,  99, 101, 115,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40,  76, 105, 110, 101,  97, 
-    114,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40, 115, 
-    116,  83,  97, 109, 112, 108, 
-    101,  46, 120, 121,  44,  32, 
-     40, 102, 108, 111,  97, 116, 
-     41,  40, 121,  32,  42,  32, 
-     49,  54,  32,  43,  32, 120, 
-     41,  41,  41,  46, 120, 121, 
-    122,  44,  32,  49,  41,  59, 
-     13,  10,  13,  10,  35, 101, 
-    108, 115, 101,  32,  47,  47, 
-     32,  81, 117,  97, 100, 114, 
-    105, 108, 105, 110, 101,  97, 
-    114,  32, 102, 105, 108, 116, 
-    101, 114, 105, 110, 103,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    121,  48,  32,  61,  32,  40, 
-    117, 105, 110, 116,  41,  40, 
-    105, 110, 112, 117, 116,  46, 
-     84, 101, 120,  67, 111, 111, 
-    114, 100,  46, 121,  32,  42, 
-     32,  49,  54,  41,  59,  13, 
-     10,  32,  32,  32,  32, 117, 
-    105, 110, 116,  32, 121,  49, 
-     32,  61,  32, 121,  48,  32, 
-     43,  32,  49,  59,  13,  10, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40, 121,  49,  32,  62, 
-     61,  32,  49,  54,  41,  13, 
-    119, 115,   0,   0,  47,  44, 
-      0,   0, 181, 115,   0,   0, 
-    114,  61,   0,   0, 210,  65, 
-      0,   0, 138, 110,   0,   0, 
-    173,  34,   0,   0, 243,  37, 
-      0,   0, 240,  49,   0,   0, 
-     44,  16,   0,   0, 120,  81, 
-      0,   0, 173,  90,   0,   0, 
-    225,  47,   0,   0,  77, 117, 
-      0,   0,  35,  17,   0,   0, 
-    255, 120,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 115, 116, 114, 117, 
-     99, 116,  32,  79, 117, 116, 
-     86, 101, 114, 116, 101, 120, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32,  80, 111, 
-    115, 105, 116, 105, 111, 110, 
-     32,  58,  32,  83,  86,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  50,  32,  84, 101, 
-    120,  67, 111, 111, 114, 100, 
-     32,  58,  32,  84,  69,  88, 
-     67,  79,  79,  82,  68,  48, 
-     59,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-     83, 108,  97,  98,  73,  68, 
-     32,  58,  32,  84,  69,  88, 
-     67,  79,  79,  82,  68,  49, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10,  84, 101, 120, 
-    116, 117, 114, 101,  50,  68, 
-     32, 115, 116,  80, 108,  97, 
-    110, 101,  59,  13,  10,  13, 
-     10,  84, 101, 120, 116, 117, 
-    114, 101,  50,  68,  65, 114, 
-    114,  97, 121,  32,  83, 108, 
-    105,  99, 101, 115,  59,  13, 
-     10,  13,  10,  83,  97, 109, 
-    112, 108, 101, 114,  83, 116, 
-     97, 116, 101,  32,  76, 105, 
-    110, 101,  97, 114,  83,  97, 
-    109, 112, 108, 101, 114,  59, 
-     13,  10,  13,  10, 102, 108, 
-    111,  97, 116,  52,  32, 109, 
-     97, 105, 110,  40,  79, 117, 
-    116,  86, 101, 114, 116, 101, 
-    120,  32, 105, 110, 112, 117, 
-    116,  41,  32,  58,  32,  83, 
-     86,  95,  84,  65,  82,  71, 
-     69,  84,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 117, 
-    105, 110, 116,  32, 119, 105, 
-    100, 116, 104,  44,  32, 104, 
-    101, 105, 103, 104, 116,  44, 
-     32, 110, 117, 109,  76, 101, 
-    118, 101, 108, 115,  59,  13, 
-     10,  32,  32,  32,  32, 115, 
-    116,  80, 108,  97, 110, 101, 
-     46,  71, 101, 116,  68, 105, 
-    109, 101, 110, 115, 105, 111, 
-    110, 115,  40,  48,  44,  32, 
-    119, 105, 100, 116, 104,  44, 
-     32, 104, 101, 105, 103, 104, 
-    116,  44,  32, 110, 117, 109, 
-     76, 101, 118, 101, 108, 115, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32, 115, 
-    116,  83,  97, 109, 112, 108, 
-    101,  32,  61,  32, 115, 116, 
-     80, 108,  97, 110, 101,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40,  76, 105, 110, 101,  97, 
-    114,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32,  40, 105, 
-    110, 112, 117, 116,  46,  80, 
-    111, 115, 105, 116, 105, 111, 
-    110,  46, 120, 121,  32,  47, 
-     32, 102, 108, 111,  97, 116, 
-     50,  40, 119, 105, 100, 116, 
-    104,  44,  32, 104, 101, 105, 
-    103, 104, 116,  41,  41,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40, 115, 116,  83,  97, 109, 
-    112, 108, 101,  46, 122,  32, 
-     61,  61,  32,  48,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  99, 108, 
-    105, 112,  40,  45,  49,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 125,  13,  10,  13,  10, 
-     35, 105, 102,  32,  48,  32, 
-     47,  47,  32,  78, 101,  97, 
-    114, 101, 115, 116,  32,  78, 
-    101, 105, 103, 104,  98, 111, 
-    114,  32,  40, 110, 111,  32, 
-    102, 105, 108, 116, 101, 114, 
-    105, 110, 103,  32, 111, 110, 
-     32, 116, 104, 101,  32, 117, 
-    118,  32, 112, 108,  97, 110, 
-    101,  44,  32, 111, 110, 108, 
-    121,  32, 115, 116,  32, 112, 
-    108,  97, 110, 101,  41,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    120,  32,  61,  32,  40, 117, 
-    105, 110, 116,  41,  40, 105, 
-    110, 112, 117, 116,  46,  84, 
-    101, 120,  67, 111, 111, 114, 
-    100,  46, 120,  32,  42,  32, 
-     49,  54,  41,  59,  13,  10, 
-     32,  32,  32,  32, 117, 105, 
-    110, 116,  32, 121,  32,  61, 
-     32,  40, 117, 105, 110, 116, 
-     41,  40, 105, 110, 112, 117, 
-    116,  46,  84, 101, 120,  67, 
-    111, 111, 114, 100,  46, 121, 
-     32,  42,  32,  49,  54,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  52,  40,  83, 
-    108, 105,  99, 101, 115,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40,  76, 105, 110, 101,  97, 
-    114,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40, 115, 
-    116,  83,  97, 109, 112, 108, 
-    101,  46, 120, 121,  44,  32, 
-     40, 102, 108, 111,  97, 116, 
-     41,  40, 121,  32,  42,  32, 
-     49,  54,  32,  43,  32, 120, 
-     41,  41,  41,  46, 120, 121, 
-    122,  44,  32,  49,  41,  59, 
-     13,  10,  13,  10,  35, 101, 
-    108, 115, 101,  32,  47,  47, 
-     32,  81, 117,  97, 100, 114, 
-    105, 108, 105, 110, 101,  97, 
-    114,  32, 102, 105, 108, 116, 
-    101, 114, 105, 110, 103,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    121,  48,  32,  61,  32,  40, 
-    117, 105, 110, 116,  41,  40, 
-    105, 110, 112, 117, 116,  46, 
-     84, 101, 120,  67, 111, 111, 
-    114, 100,  46, 121,  32,  42, 
-     32,  49,  54,  41,  59,  13, 
-     10,  32,  32,  32,  32, 117, 
-    105, 110, 116,  32, 121,  49, 
-     32,  61,  32, 121,  48,  32, 
-     43,  32,  49,  59,  13,  10, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40, 121,  49,  32,  62, 
-     61,  32,  49,  54,  41,  13, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 121,  49, 
-     32,  61,  32,  49,  53,  59, 
-     13,  10,  32,  32,  32,  32, 
-    125,  13,  10,  13,  10,  32, 
-     32,  32,  32, 117, 105, 110, 
-    116,  32, 120,  48,  32,  61, 
-     32,  40, 117, 105, 110, 116, 
-     41,  40, 105, 110, 112, 117, 
-    116,  46,  84, 101, 120,  67, 
-    111, 111, 114, 100,  46, 120, 
-     32,  42,  32,  49,  54,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    120,  49,  32,  61,  32, 120, 
-     48,  32,  43,  32,  49,  59, 
-     13,  10,  32,  32,  32,  32, 
-    105, 102,  32,  40, 120,  49, 
-     32,  62,  61,  32,  49,  54, 
-     41,  13,  10,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    120,  49,  32,  61,  32,  49, 
-     53,  59,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 121, 
-     76, 101, 114, 112,  32,  61, 
-     32,  40, 105, 110, 112, 117, 
-    116,  46,  84, 101, 120,  67, 
-    111, 111, 114, 100,  46, 121, 
-     32,  42,  32,  49,  54,  41, 
-     32,  45,  32,  40, 102, 108, 
-    111,  97, 116,  41, 121,  48, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 120,  76, 101, 114, 112, 
-     32,  61,  32,  40, 105, 110, 
-    112, 117, 116,  46,  84, 101, 
-    120,  67, 111, 111, 114, 100, 
-     46, 120,  32,  42,  32,  49, 
-     54,  41,  32,  45,  32,  40, 
-    102, 108, 111,  97, 116,  41, 
-    120,  48,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  84, 104, 101,  32, 
-     76,  79,  68,  32, 116, 101, 
-    114, 109,  32,  97, 116,  32, 
-    116, 104, 101,  32, 101, 110, 
-    100,  32, 105, 115,  32, 105, 
-    103, 110, 111, 114, 101, 100, 
-     32, 117, 110, 108, 101, 115, 
-    115,  32,  85,  83,  69,  95, 
-     77,  73,  80,  83,  32, 105, 
-    115,  32, 100, 101, 102, 105, 
-    110, 101, 100,  32, 105, 110, 
-     32,  82, 101, 110, 100, 101, 
-    114, 101, 114,  46,  99, 112, 
-    112,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 115,  97, 109, 112, 
-    108, 101,  48,  32,  61,  32, 
-     83, 108, 105,  99, 101, 115, 
-     46,  83,  97, 109, 112, 108, 
-    101,  76, 101, 118, 101, 108, 
-     40,  76, 105, 110, 101,  97, 
-    114,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40, 115, 
-    116,  83,  97, 109, 112, 108, 
-    101,  46, 120, 121,  44,  32, 
-     40, 102, 108, 111,  97, 116, 
-     41,  40, 121,  48,  32,  42, 
-     32,  49,  54,  32,  43,  32, 
-    120,  48,  41,  41,  44,  32, 
-     40,  49,  32,  45,  32, 120, 
-     76, 101, 114, 112,  41,  32, 
-     42,  32,  52,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32, 115,  97, 
-    109, 112, 108, 101,  49,  32, 
-     61,  32,  83, 108, 105,  99, 
-    101, 115,  46,  83,  97, 109, 
-    112, 108, 101,  76, 101, 118, 
-    101, 108,  40,  76, 105, 110, 
-    101,  97, 114,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40, 115, 116,  83,  97, 109, 
-    112, 108, 101,  46, 120, 121, 
-     44,  32,  40, 102, 108, 111, 
-     97, 116,  41,  40, 121,  48, 
-     32,  42,  32,  49,  54,  32, 
-     43,  32, 120,  49,  41,  41, 
-     44,  32,  40, 120,  76, 101, 
-    114, 112,  41,  42,  32,  52, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32, 115,  97, 109, 112, 108, 
-    101,  50,  32,  61,  32,  83, 
-    108, 105,  99, 101, 115,  46, 
-     83,  97, 109, 112, 108, 101, 
-     76, 101, 118, 101, 108,  40, 
-     76, 105, 110, 101,  97, 114, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  51,  40, 115, 116, 
-     83,  97, 109, 112, 108, 101, 
-     46, 120, 121,  44,  32,  40, 
-    102, 108, 111,  97, 116,  41, 
-     40, 121,  49,  32,  42,  32, 
-     49,  54,  32,  43,  32, 120, 
-     48,  41,  41,  44,  32,  40, 
-     49,  32,  45,  32, 120,  76, 
-    101, 114, 112,  41,  32,  42, 
-     32,  52,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32, 115,  97, 109, 
-    112, 108, 101,  51,  32,  61, 
-     32,  83, 108, 105,  99, 101, 
-    115,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40,  76, 105, 110, 101, 
-     97, 114,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-    115, 116,  83,  97, 109, 112, 
-    108, 101,  46, 120, 121,  44, 
-     32,  40, 102, 108, 111,  97, 
-    116,  41,  40, 121,  49,  32, 
-     42,  32,  49,  54,  32,  43, 
-     32, 120,  49,  41,  41,  44, 
-     32,  40, 120,  76, 101, 114, 
-    112,  41,  42,  32,  52,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 115,  97, 109, 112, 
-    108, 101,  48,  49,  32,  61, 
-     32, 108, 101, 114, 112,  40, 
-    115,  97, 109, 112, 108, 101, 
-     48,  44,  32, 115,  97, 109, 
-    112, 108, 101,  49,  44,  32, 
-    120,  76, 101, 114, 112,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    115,  97, 109, 112, 108, 101, 
-     50,  51,  32,  61,  32, 108, 
-    101, 114, 112,  40, 115,  97, 
-    109, 112, 108, 101,  50,  44, 
-     32, 115,  97, 109, 112, 108, 
-    101,  51,  44,  32, 120,  76, 
-    101, 114, 112,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  52,  40, 108, 
-    101, 114, 112,  40, 115,  97, 
-    109, 112, 108, 101,  48,  49, 
-     44,  32, 115,  97, 109, 112, 
-    108, 101,  50,  51,  44,  32, 
-    121,  76, 101, 114, 112,  41, 
-     46, 120, 121, 122,  44,  32, 
-     49,  46, 102,  41,  59,  13, 
-     10,  13,  10,  35, 101, 110, 
-    100, 105, 102,  13,  10, 125, 
-     13,  10,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-    249,   7,   0,   0,   0,  67, 
-     58,  92,  83, 114,  99,  92, 
-     80, 117,  98, 108, 105,  99, 
-     92, 100, 111, 119, 110, 108, 
-    111,  97, 100, 115,  92,  76, 
-    105, 103, 104, 116,  70, 105, 
-    101, 108, 100,  92,  82, 101, 
-    110, 100, 101, 114,  85,  86, 
-     80, 108,  97, 110, 101,  80, 
-     83,  46, 104, 108, 115, 108, 
-      0,   0,  99,  58,  92, 115, 
-    114,  99,  92, 112, 117,  98, 
-    108, 105,  99,  92, 100, 111, 
-    119, 110, 108, 111,  97, 100, 
-    115,  92, 108, 105, 103, 104, 
-    116, 102, 105, 101, 108, 100, 
-     92, 114, 101, 110, 100, 101, 
-    114, 117, 118, 112, 108,  97, 
-    110, 101, 112, 115,  46, 104, 
-    108, 115, 108,   0, 115, 116, 
-    114, 117,  99, 116,  32,  79, 
-    117, 116,  86, 101, 114, 116, 
-    101, 120,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-     80, 111, 115, 105, 116, 105, 
-    111, 110,  32,  58,  32,  83, 
-     86,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  50,  32, 
-     84, 101, 120,  67, 111, 111, 
-    114, 100,  32,  58,  32,  84, 
-     69,  88,  67,  79,  79,  82, 
-     68,  48,  59,  13,  10,  32, 
-     32,  32,  32, 117, 105, 110, 
-    116,  32,  83, 108,  97,  98, 
-     73,  68,  32,  58,  32,  84, 
-     69,  88,  67,  79,  79,  82, 
-     68,  49,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10,  84, 
-    101, 120, 116, 117, 114, 101, 
-     50,  68,  32, 115, 116,  80, 
-    108,  97, 110, 101,  59,  13, 
-     10,  13,  10,  84, 101, 120, 
-    116, 117, 114, 101,  50,  68, 
-     65, 114, 114,  97, 121,  32, 
-     83, 108, 105,  99, 101, 115, 
-     59,  13,  10,  13,  10,  83, 
-     97, 109, 112, 108, 101, 114, 
-     83, 116,  97, 116, 101,  32, 
-     76, 105, 110, 101,  97, 114, 
-     83,  97, 109, 112, 108, 101, 
-    114,  59,  13,  10,  13,  10, 
-    102, 108, 111,  97, 116,  52, 
-     32, 109,  97, 105, 110,  40, 
-     79, 117, 116,  86, 101, 114, 
-    116, 101, 120,  32, 105, 110, 
-    112, 117, 116,  41,  32,  58, 
-     32,  83,  86,  95,  84,  65, 
-     82,  71,  69,  84,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    119, 105, 100, 116, 104,  44, 
-     32, 104, 101, 105, 103, 104, 
-    116,  44,  32, 110, 117, 109, 
-     76, 101, 118, 101, 108, 115, 
-     59,  13,  10,  32,  32,  32, 
-     32, 115, 116,  80, 108,  97, 
-    110, 101,  46,  71, 101, 116, 
-     68, 105, 109, 101, 110, 115, 
-    105, 111, 110, 115,  40,  48, 
-     44,  32, 119, 105, 100, 116, 
-    104,  44,  32, 104, 101, 105, 
-    103, 104, 116,  44,  32, 110, 
-    117, 109,  76, 101, 118, 101, 
-    108, 115,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32, 115, 116,  83,  97, 109, 
-    112, 108, 101,  32,  61,  32, 
-    115, 116,  80, 108,  97, 110, 
-    101,  46,  83,  97, 109, 112, 
-    108, 101,  40,  76, 105, 110, 
-     27, 226,  48,   1, 128,   0, 
-      0,   0, 177,  69,  94, 237, 
-    123, 107, 208,   1,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
+      6,   0,  16,   0,   2,   0, 
+      0,   0,   0,   0,   0,   7, 
+    114,  32,  16,   0,   0,   0, 
+      0,   0,  70,   2,  16,   0, 
+      0,   0,   0,   0,  70,   2, 
+     16,   0,   1,   0,   0,   0, 
+     54,   0,   0,   5, 130,  32, 
+     16,   0,   0,   0,   0,   0, 
+      1,  64,   0,   0,   0,   0, 
+    128,  63,  62,   0,   0,   1, 
+     83,  84,  65,  84, 148,   0, 
+      0,   0,  92,   0,   0,   0, 
+      6,   0,   0,   0,   0,   0, 
+      0,   0,   3,   0,   0,   0, 
+     31,   0,   0,   0,  12,   0, 
+      0,   0,   3,   0,   0,   0, 
+      1,   0,   0,   0,   3,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   1,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     58,   0,   0,   0,  40,   0, 
-      0,   0,  27, 226,  48,   1, 
-    207, 230, 162, 135, 134,   7, 
-      0,   0,   1,   0,   0,   0, 
-     57,   0,   0,   0,  58,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
       0,   0,   4,   0,   0,   0, 
-     74,   0,  60,  17,  16,   1, 
-      0,   0,   0,   1,   6,   0, 
-      3,   0,   0,  64, 128,  37, 
-      6,   0,   3,   0,   0,  64, 
-    128,  37,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  54,  46,  51,  46,  57, 
-     54,  48,  48,  46,  49,  54, 
-     51,  56,  52,   0,  54,   0, 
-     61,  17,   1, 104, 108, 115, 
-    108,  70, 108,  97, 103, 115, 
-      0,  48, 120,  53,   0, 104, 
-    108, 115, 108,  84,  97, 114, 
-    103, 101, 116,   0, 112, 115, 
-     95,  53,  95,  48,   0, 104, 
-    108, 115, 108,  69, 110, 116, 
-    114, 121,   0, 109,  97, 105, 
-    110,   0,   0,   0,   0,   0, 
-     42,   0,  16,  17,   0,   0, 
-      0,   0, 160,   7,   0,   0, 
-      0,   0,   0,   0,  68,   9, 
-      0,   0,   0,   0,   0,   0, 
-     68,   9,   0,   0,   6,  16, 
-      0,   0, 104,   0,   0,   0, 
-      1,   0, 160, 109,  97, 105, 
-    110,   0,  46,   0,  62,  17, 
-      3,  16,   0,   0,   9,   0, 
-    105, 110, 112, 117, 116,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   0,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   4,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   8,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  12,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,  12,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  16,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  20,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  24,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,  32,   0, 
-      0,   0,  58,   0,  62,  17, 
-      5,  16,   0,   0, 136,   0, 
-     60, 109,  97, 105, 110,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   0,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   4,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,   8,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      2,   0,   5,   0,  12,   0, 
-      4,   0, 104,   0,   0,   0, 
-      1,   0,  68,   9,  12,   0, 
-      0,   0,  46,   0,  62,  17, 
-    117,   0,   0,   0,   0,   0, 
-    119, 105, 100, 116, 104,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 160,   0,   0,   0, 
-      1,   0, 152,   0,   0,   0, 
-      0,   0,  46,   0,  62,  17, 
-    117,   0,   0,   0,   0,   0, 
-    104, 101, 105, 103, 104, 116, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 180,   0,   0,   0, 
-      1,   0, 132,   0,   4,   0, 
-      0,   0,  46,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    115, 116,  83,  97, 109, 112, 
-    108, 101,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  56,   1,   0,   0, 
-      1,   0,  24,   7,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  56,   1,   0,   0, 
-      1,   0,  24,   7,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  56,   1,   0,   0, 
-      1,   0,  24,   7,   8,   0, 
-      0,   0,  42,   0,  62,  17, 
-    117,   0,   0,   0,   0,   0, 
-    121,  48,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  20,   2, 
-      0,   0,   1,   0, 148,   3, 
-     16,   0,   0,   0,  42,   0, 
-     62,  17, 117,   0,   0,   0, 
-      0,   0, 121,  49,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     68,   2,   0,   0,   1,   0, 
-     36,   6,  20,   0,   0,   0, 
-     42,   0,  62,  17, 117,   0, 
-      0,   0,   0,   0, 120,  48, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 220,   2,   0,   0, 
-      1,   0,   4,   4,  24,   0, 
-      0,   0,  42,   0,  62,  17, 
-    117,   0,   0,   0,   0,   0, 
-    120,  49,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  12,   3, 
-      0,   0,   1,   0, 160,   6, 
-     28,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 121,  76, 101, 114, 
-    112,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 216,   3, 
-      0,   0,   1,   0, 212,   5, 
-     32,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 120,  76, 101, 114, 
-    112,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  80,   4, 
-      0,   0,   1,   0, 240,   4, 
-     36,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 115,  97, 109, 112, 
-    108, 101,  48,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 116,   5, 
-      0,   0,   1,   0,  56,   4, 
-     48,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 116,   5, 
-      0,   0,   1,   0,  56,   4, 
-     52,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 116,   5, 
-      0,   0,   1,   0,  56,   4, 
-     56,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 115,  97, 109, 112, 
-    108, 101,  49,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  80,   6, 
-      0,   0,   1,   0,  92,   3, 
-     64,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  80,   6, 
-      0,   0,   1,   0,  92,   3, 
-     68,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  80,   6, 
-      0,   0,   1,   0,  92,   3, 
-     72,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 115,  97, 109, 112, 
-    108, 101,  50,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 116,   7, 
-      0,   0,   1,   0,  56,   2, 
-     80,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 116,   7, 
-      0,   0,   1,   0,  56,   2, 
-     84,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 116,   7, 
-      0,   0,   1,   0,  56,   2, 
-     88,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 115,  97, 109, 112, 
-    108, 101,  51,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  80,   8, 
-      0,   0,   1,   0, 216,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  80,   8, 
-      0,   0,   1,   0, 216,   0, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  80,   8, 
-      0,   0,   1,   0, 216,   0, 
-      8,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 115,  97, 109, 112, 
-    108, 101,  48,  49,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 188,   8, 
-      0,   0,   1,   0, 240,   0, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 188,   8, 
-      0,   0,   1,   0, 240,   0, 
-     20,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 188,   8, 
-      0,   0,   1,   0, 240,   0, 
-     24,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 115,  97, 109, 112, 
-    108, 101,  50,  51,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  40,   9, 
-      0,   0,   1,   0,  52,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  40,   9, 
-      0,   0,   1,   0,  52,   0, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  40,   9, 
-      0,   0,   1,   0,  52,   0, 
-      8,   0,   0,   0,   2,   0, 
-      6,   0, 244,   0,   0,   0, 
-     24,   0,   0,   0,   1,   0, 
-      0,   0,  16,   1,  24, 180, 
-    142,  82, 185,  22, 115, 137, 
-     54, 164,   1, 176,  48, 136, 
-    199,  39,   0,   0, 242,   0, 
-      0,   0,  72,   9,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      1,   0, 172,   9,   0,   0, 
-      0,   0,   0,   0, 196,   0, 
-      0,   0,  60,   9,   0,   0, 
-    104,   0,   0,   0,  17,   0, 
-      0, 128, 104,   0,   0,   0, 
-     17,   0,   0,   0, 140,   0, 
-      0,   0,  17,   0,   0, 128, 
-    140,   0,   0,   0,  17,   0, 
-      0,   0, 160,   0,   0,   0, 
-     17,   0,   0, 128, 160,   0, 
-      0,   0,  17,   0,   0,   0, 
-    180,   0,   0,   0,  19,   0, 
-      0, 128, 180,   0,   0,   0, 
-     19,   0,   0,   0, 200,   0, 
-      0,   0,  19,   0,   0, 128, 
-    200,   0,   0,   0,  19,   0, 
-      0,   0, 220,   0,   0,   0, 
-     19,   0,   0, 128, 220,   0, 
-      0,   0,  19,   0,   0,   0, 
-    248,   0,   0,   0,  19,   0, 
-      0, 128, 248,   0,   0,   0, 
-     19,   0,   0,   0,  36,   1, 
-      0,   0,  19,   0,   0, 128, 
-     36,   1,   0,   0,  19,   0, 
-      0,   0,  56,   1,   0,   0, 
-     21,   0,   0, 128,  56,   1, 
-      0,   0,  21,   0,   0,   0, 
-     76,   1,   0,   0,  21,   0, 
-      0, 128,  76,   1,   0,   0, 
-     21,   0,   0,   0, 104,   1, 
-      0,   0,  21,   0,   0, 128, 
-    104,   1,   0,   0,  21,   0, 
-      0,   0, 116,   1,   0,   0, 
-     23,   0,   0, 128, 116,   1, 
-      0,   0,  23,   0,   0,   0, 
-    136,   1,   0,   0,  23,   0, 
-      0, 128, 136,   1,   0,   0, 
-     23,   0,   0,   0, 164,   1, 
-      0,   0,  23,   0,   0, 128, 
-    164,   1,   0,   0,  23,   0, 
-      0,   0, 192,   1,   0,   0, 
-     23,   0,   0, 128, 192,   1, 
-      0,   0,  23,   0,   0,   0, 
-    204,   1,   0,   0,  24,   0, 
-      0, 128, 204,   1,   0,   0, 
-     24,   0,   0,   0, 208,   1, 
-      0,   0,  35,   0,   0, 128, 
-    208,   1,   0,   0,  35,   0, 
-      0,   0, 228,   1,   0,   0, 
-     35,   0,   0, 128, 228,   1, 
-      0,   0,  35,   0,   0,   0, 
-      0,   2,   0,   0,  35,   0, 
-      0, 128,   0,   2,   0,   0, 
-     35,   0,   0,   0,  20,   2, 
-      0,   0,  36,   0,   0, 128, 
-     20,   2,   0,   0,  36,   0, 
-      0,   0,  40,   2,   0,   0, 
-     36,   0,   0, 128,  40,   2, 
-      0,   0,  36,   0,   0,   0, 
-     68,   2,   0,   0,  37,   0, 
-      0, 128,  68,   2,   0,   0, 
-     37,   0,   0,   0,  88,   2, 
-      0,   0,  37,   0,   0, 128, 
-     88,   2,   0,   0,  37,   0, 
-      0,   0, 116,   2,   0,   0, 
-     37,   0,   0, 128, 116,   2, 
-      0,   0,  37,   0,   0,   0, 
-    128,   2,   0,   0,  39,   0, 
-      0, 128, 128,   2,   0,   0, 
-     39,   0,   0,   0, 148,   2, 
-      0,   0,  40,   0,   0, 128, 
-    148,   2,   0,   0,  40,   0, 
-      0,   0, 152,   2,   0,   0, 
-     42,   0,   0, 128, 152,   2, 
-      0,   0,  42,   0,   0,   0, 
-    172,   2,   0,   0,  42,   0, 
-      0, 128, 172,   2,   0,   0, 
-     42,   0,   0,   0, 200,   2, 
-      0,   0,  42,   0,   0, 128, 
-    200,   2,   0,   0,  42,   0, 
-      0,   0, 220,   2,   0,   0, 
-     43,   0,   0, 128, 220,   2, 
-      0,   0,  43,   0,   0,   0, 
-    240,   2,   0,   0,  43,   0, 
-      0, 128, 240,   2,   0,   0, 
-     43,   0,   0,   0,  12,   3, 
-      0,   0,  44,   0,   0, 128, 
-     12,   3,   0,   0,  44,   0, 
-      0,   0,  32,   3,   0,   0, 
-     44,   0,   0, 128,  32,   3, 
-      0,   0,  44,   0,   0,   0, 
-     60,   3,   0,   0,  44,   0, 
-      0, 128,  60,   3,   0,   0, 
-     44,   0,   0,   0,  72,   3, 
-      0,   0,  46,   0,   0, 128, 
-     72,   3,   0,   0,  46,   0, 
-      0,   0,  92,   3,   0,   0, 
-     47,   0,   0, 128,  92,   3, 
-      0,   0,  47,   0,   0,   0, 
-     96,   3,   0,   0,  49,   0, 
-      0, 128,  96,   3,   0,   0, 
-     49,   0,   0,   0, 116,   3, 
-      0,   0,  49,   0,   0, 128, 
-    116,   3,   0,   0,  49,   0, 
-      0,   0, 144,   3,   0,   0, 
-     49,   0,   0, 128, 144,   3, 
-      0,   0,  49,   0,   0,   0, 
-    164,   3,   0,   0,  49,   0, 
-      0, 128, 164,   3,   0,   0, 
-     49,   0,   0,   0, 188,   3, 
-      0,   0,  49,   0,   0, 128, 
-    188,   3,   0,   0,  49,   0, 
-      0,   0, 216,   3,   0,   0, 
-     50,   0,   0, 128, 216,   3, 
-      0,   0,  50,   0,   0,   0, 
-    236,   3,   0,   0,  50,   0, 
-      0, 128, 236,   3,   0,   0, 
-     50,   0,   0,   0,   8,   4, 
-      0,   0,  50,   0,   0, 128, 
-      8,   4,   0,   0,  50,   0, 
-      0,   0,  28,   4,   0,   0, 
-     50,   0,   0, 128,  28,   4, 
-      0,   0,  50,   0,   0,   0, 
-     52,   4,   0,   0,  50,   0, 
-      0, 128,  52,   4,   0,   0, 
-     50,   0,   0,   0,  80,   4, 
-      0,   0,  53,   0,   0, 128, 
-     80,   4,   0,   0,  53,   0, 
-      0,   0, 100,   4,   0,   0, 
-     53,   0,   0, 128, 100,   4, 
-      0,   0,  53,   0,   0,   0, 
-    132,   4,   0,   0,  53,   0, 
-      0, 128, 132,   4,   0,   0, 
-     53,   0,   0,   0, 160,   4, 
-      0,   0,  53,   0,   0, 128, 
-    160,   4,   0,   0,  53,   0, 
-      0,   0, 180,   4,   0,   0, 
-     53,   0,   0, 128, 180,   4, 
-      0,   0,  53,   0,   0,   0, 
-    200,   4,   0,   0,  53,   0, 
-      0, 128, 200,   4,   0,   0, 
-     53,   0,   0,   0, 224,   4, 
-      0,   0,  53,   0,   0, 128, 
-    224,   4,   0,   0,  53,   0, 
-      0,   0, 252,   4,   0,   0, 
-     53,   0,   0, 128, 252,   4, 
-      0,   0,  53,   0,   0,   0, 
-     16,   5,   0,   0,  53,   0, 
-      0, 128,  16,   5,   0,   0, 
-     53,   0,   0,   0,  44,   5, 
-      0,   0,  53,   0,   0, 128, 
-     44,   5,   0,   0,  53,   0, 
-      0,   0,  96,   5,   0,   0, 
-     53,   0,   0, 128,  96,   5, 
-      0,   0,  53,   0,   0,   0, 
-    116,   5,   0,   0,  54,   0, 
-      0, 128, 116,   5,   0,   0, 
-     54,   0,   0,   0, 136,   5, 
-      0,   0,  54,   0,   0, 128, 
-    136,   5,   0,   0,  54,   0, 
-      0,   0, 168,   5,   0,   0, 
-     54,   0,   0, 128, 168,   5, 
-      0,   0,  54,   0,   0,   0, 
-    196,   5,   0,   0,  54,   0, 
-      0, 128, 196,   5,   0,   0, 
-     54,   0,   0,   0, 216,   5, 
-      0,   0,  54,   0,   0, 128, 
-    216,   5,   0,   0,  54,   0, 
-      0,   0, 236,   5,   0,   0, 
-     54,   0,   0, 128, 236,   5, 
-      0,   0,  54,   0,   0,   0, 
-      8,   6,   0,   0,  54,   0, 
-      0, 128,   8,   6,   0,   0, 
-     54,   0,   0,   0,  60,   6, 
-      0,   0,  54,   0,   0, 128, 
-     60,   6,   0,   0,  54,   0, 
-      0,   0,  80,   6,   0,   0, 
-     55,   0,   0, 128,  80,   6, 
-      0,   0,  55,   0,   0,   0, 
-    100,   6,   0,   0,  55,   0, 
-      0, 128, 100,   6,   0,   0, 
-     55,   0,   0,   0, 132,   6, 
-      0,   0,  55,   0,   0, 128, 
-    132,   6,   0,   0,  55,   0, 
-      0,   0, 160,   6,   0,   0, 
-     55,   0,   0, 128, 160,   6, 
-      0,   0,  55,   0,   0,   0, 
-    180,   6,   0,   0,  55,   0, 
-      0, 128, 180,   6,   0,   0, 
-     55,   0,   0,   0, 200,   6, 
-      0,   0,  55,   0,   0, 128, 
-    200,   6,   0,   0,  55,   0, 
-      0,   0, 224,   6,   0,   0, 
-     55,   0,   0, 128, 224,   6, 
-      0,   0,  55,   0,   0,   0, 
-    252,   6,   0,   0,  55,   0, 
-      0, 128, 252,   6,   0,   0, 
-     55,   0,   0,   0,  16,   7, 
-      0,   0,  55,   0,   0, 128, 
-     16,   7,   0,   0,  55,   0, 
-      0,   0,  44,   7,   0,   0, 
-     55,   0,   0, 128,  44,   7, 
-      0,   0,  55,   0,   0,   0, 
-     96,   7,   0,   0,  55,   0, 
-      0, 128,  96,   7,   0,   0, 
-     55,   0,   0,   0, 116,   7, 
-      0,   0,  56,   0,   0, 128, 
-    116,   7,   0,   0,  56,   0, 
-      0,   0, 136,   7,   0,   0, 
-     56,   0,   0, 128, 136,   7, 
-      0,   0,  56,   0,   0,   0, 
-    168,   7,   0,   0,  56,   0, 
-      0, 128, 168,   7,   0,   0, 
-     56,   0,   0,   0, 196,   7, 
-      0,   0,  56,   0,   0, 128, 
-    196,   7,   0,   0,  56,   0, 
-      0,   0, 216,   7,   0,   0, 
-     56,   0,   0, 128, 216,   7, 
-      0,   0,  56,   0,   0,   0, 
-    236,   7,   0,   0,  56,   0, 
-      0, 128, 236,   7,   0,   0, 
-     56,   0,   0,   0,   8,   8, 
-      0,   0,  56,   0,   0, 128, 
-      8,   8,   0,   0,  56,   0, 
-      0,   0,  60,   8,   0,   0, 
-     56,   0,   0, 128,  60,   8, 
-      0,   0,  56,   0,   0,   0, 
-     80,   8,   0,   0,  58,   0, 
-      0, 128,  80,   8,   0,   0, 
-     58,   0,   0,   0, 104,   8, 
-      0,   0,  58,   0,   0, 128, 
-    104,   8,   0,   0,  58,   0, 
-      0,   0, 132,   8,   0,   0, 
-     58,   0,   0, 128, 132,   8, 
-      0,   0,  58,   0,   0,   0, 
-    160,   8,   0,   0,  58,   0, 
-      0, 128, 160,   8,   0,   0, 
-     58,   0,   0,   0, 188,   8, 
-      0,   0,  59,   0,   0, 128, 
-    188,   8,   0,   0,  59,   0, 
-      0,   0, 212,   8,   0,   0, 
-     59,   0,   0, 128, 212,   8, 
-      0,   0,  59,   0,   0,   0, 
-    240,   8,   0,   0,  59,   0, 
-      0, 128, 240,   8,   0,   0, 
-     59,   0,   0,   0,  12,   9, 
-      0,   0,  59,   0,   0, 128, 
-     12,   9,   0,   0,  59,   0, 
-      0,   0,  40,   9,   0,   0, 
-     60,   0,   0, 128,  40,   9, 
-      0,   0,  60,   0,   0,   0, 
-     64,   9,   0,   0,  60,   0, 
-      0, 128,  64,   9,   0,   0, 
-     60,   0,   0,   0,  92,   9, 
-      0,   0,  60,   0,   0, 128, 
-     92,   9,   0,   0,  60,   0, 
-      0,   0, 120,   9,   0,   0, 
-     60,   0,   0, 128, 120,   9, 
-      0,   0,  60,   0,   0,   0, 
-    148,   9,   0,   0,  60,   0, 
-      0, 128, 148,   9,   0,   0, 
-     60,   0,   0,   0, 168,   9, 
-      0,   0,  60,   0,   0, 128, 
-    168,   9,   0,   0,  60,   0, 
-      0,   0,   5,   0,  55,   0, 
-      5,   0,  54,   0,   5,   0, 
-     55,   0,   5,   0,  54,   0, 
-      5,   0,  55,   0,   5,   0, 
-     54,   0,   5,   0,  97,   0, 
-     74,   0,  94,   0,   5,   0, 
-     97,   0,  74,   0,  94,   0, 
-      5,   0,  97,   0,  54,   0, 
-     94,   0,   5,   0,  97,   0, 
-     23,   0,  96,   0,   5,   0, 
-     97,   0,  12,   0,  96,   0, 
-      5,   0,  24,   0,   9,   0, 
-     23,   0,   5,   0,  24,   0, 
-      9,   0,  23,   0,   5,   0, 
-     24,   0,   5,   0,  24,   0, 
-      9,   0,  17,   0,   9,   0, 
-     16,   0,   9,   0,  17,   0, 
-      9,   0,  16,   0,   9,   0, 
-     17,   0,   9,   0,  16,   0, 
-      9,   0,  17,   0,   9,   0, 
-     16,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-     44,   0,  22,   0,  42,   0, 
-      5,   0,  44,   0,  22,   0, 
-     42,   0,   5,   0,  44,   0, 
-     15,   0,  43,   0,   5,   0, 
-     21,   0,  15,   0,  20,   0, 
-      5,   0,  21,   0,  15,   0, 
-     20,   0,   5,   0,  17,   0, 
-      9,   0,  16,   0,   5,   0, 
-     17,   0,   9,   0,  16,   0, 
-      5,   0,  17,   0,   5,   0, 
-     17,   0,   9,   0,  16,   0, 
-      9,   0,  15,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,  44,   0,  22,   0, 
-     42,   0,   5,   0,  44,   0, 
-     22,   0,  42,   0,   5,   0, 
-     44,   0,  15,   0,  43,   0, 
-      5,   0,  21,   0,  15,   0, 
-     20,   0,   5,   0,  21,   0, 
-     15,   0,  20,   0,   5,   0, 
-     17,   0,   9,   0,  16,   0, 
-      5,   0,  17,   0,   9,   0, 
-     16,   0,   5,   0,  17,   0, 
-      5,   0,  17,   0,   9,   0, 
-     16,   0,   9,   0,  15,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,  54,   0, 
-     20,   0,  40,   0,   5,   0, 
-     54,   0,  20,   0,  40,   0, 
-      5,   0,  54,   0,  45,   0, 
-     53,   0,   5,   0,  54,   0, 
-     19,   0,  53,   0,   5,   0, 
-     54,   0,  19,   0,  53,   0, 
-      5,   0,  54,   0,  20,   0, 
-     40,   0,   5,   0,  54,   0, 
-     20,   0,  40,   0,   5,   0, 
-     54,   0,  45,   0,  53,   0, 
-      5,   0,  54,   0,  19,   0, 
-     53,   0,   5,   0,  54,   0, 
-     19,   0,  53,   0,   5,   0, 
-    116,   0,  84,   0,  90,   0, 
-      5,   0, 116,   0,  84,   0, 
-     90,   0,   5,   0, 116,   0, 
-     84,   0,  95,   0,   5,   0, 
-    116,   0,  76,   0,  96,   0, 
-      5,   0, 116,   0, 101,   0, 
-    109,   0,   5,   0, 116,   0, 
-    101,   0, 109,   0,   5,   0, 
-    116,   0, 101,   0, 109,   0, 
-      5,   0, 116,   0, 100,   0, 
-    114,   0,   5,   0, 116,   0, 
-    100,   0, 114,   0,   5,   0, 
-    116,   0,  22,   0, 115,   0, 
-      5,   0, 116,   0,  12,   0, 
-    115,   0,   9,   0, 115,   0, 
-     88,   0,  94,   0,   9,   0, 
-    115,   0,  88,   0,  94,   0, 
-      9,   0, 115,   0,  88,   0, 
-     99,   0,   9,   0, 115,   0, 
-     80,   0, 100,   0,   9,   0, 
-    115,   0, 104,   0, 113,   0, 
-      9,   0, 115,   0, 104,   0, 
-    113,   0,   9,   0, 115,   0, 
-     26,   0, 114,   0,   9,   0, 
-    115,   0,  16,   0, 114,   0, 
-      9,   0, 120,   0,  88,   0, 
-     94,   0,   9,   0, 120,   0, 
-     88,   0,  94,   0,   9,   0, 
-    120,   0,  88,   0,  99,   0, 
-      9,   0, 120,   0,  80,   0, 
-    100,   0,   9,   0, 120,   0, 
-    105,   0, 113,   0,   9,   0, 
-    120,   0, 105,   0, 113,   0, 
-      9,   0, 120,   0, 105,   0, 
-    113,   0,   9,   0, 120,   0, 
-    104,   0, 118,   0,   9,   0, 
-    120,   0, 104,   0, 118,   0, 
-      9,   0, 120,   0,  26,   0, 
-    119,   0,   9,   0, 120,   0, 
-     16,   0, 119,   0,   9,   0, 
-    115,   0,  88,   0,  94,   0, 
-      9,   0, 115,   0,  88,   0, 
-     94,   0,   9,   0, 115,   0, 
-     88,   0,  99,   0,   9,   0, 
-    115,   0,  80,   0, 100,   0, 
-      9,   0, 115,   0, 104,   0, 
-    113,   0,   9,   0, 115,   0, 
-    104,   0, 113,   0,   9,   0, 
-    115,   0,  26,   0, 114,   0, 
-      9,   0, 115,   0,  16,   0, 
-    114,   0,   9,   0,  56,   0, 
-     27,   0,  55,   0,   9,   0, 
-     56,   0,  27,   0,  55,   0, 
-      9,   0,  56,   0,  27,   0, 
-     55,   0,   9,   0,  56,   0, 
-     27,   0,  55,   0,   9,   0, 
-     56,   0,  27,   0,  55,   0, 
-      9,   0,  56,   0,  27,   0, 
-     55,   0,   9,   0,  56,   0, 
-     27,   0,  55,   0,   9,   0, 
-     56,   0,  27,   0,  55,   0, 
-      9,   0,  64,   0,  23,   0, 
-     53,   0,   9,   0,  64,   0, 
-     23,   0,  53,   0,   9,   0, 
-     64,   0,  23,   0,  53,   0, 
-      9,   0,  64,   0,  23,   0, 
-     53,   0,   9,   0,  64,   0, 
-      9,   0,  64,   0,   9,   0, 
-     64,   0,   9,   0,  64,   0, 
-    246,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,  20,   0,   0,   0, 
-     48,   0,   0,   0,  76,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,  16,  16,   0,   0, 
-     48,   1,   0,   0,  10,   0, 
-    255, 255,   4,   0,   0,   0, 
-      3, 128,   0,   0,   0,   0, 
-      0,   0,  64,   0,   0,   0, 
-     64,   0,   0,   0,   8,   0, 
-      0,   0,  72,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-    102, 108, 111,  97, 116,  52, 
-      0, 243, 242, 241,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      2,   0,   0,   0,   8,   0, 
-    102, 108, 111,  97, 116,  50, 
-      0, 243, 242, 241,  62,   0, 
-      3,  18,  13,  21,   3,   0, 
-      0,  16,   0,   0,   0,   0, 
-     80, 111, 115, 105, 116, 105, 
-    111, 110,   0, 241,  13,  21, 
-      3,   0,   1,  16,   0,   0, 
-     16,   0,  84, 101, 120,  67, 
-    111, 111, 114, 100,   0, 241, 
-     13,  21,   3,   0, 117,   0, 
-      0,   0,  24,   0,  83, 108, 
-     97,  98,  73,  68,   0, 243, 
-    242, 241,  30,   0,   5,  21, 
-      3,   0,   0,   0,   2,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  28,   0, 
-     79, 117, 116,  86, 101, 114, 
-    116, 101, 120,   0,  10,   0, 
-      1,  18,   1,   0,   0,   0, 
-      3,  16,   0,   0,  10,   0, 
-     24,  21,   0,  16,   0,   0, 
-      1,   0,   1,   0,  14,   0, 
-      8,  16,   5,  16,   0,   0, 
-     23,   0,   1,   0,   4,  16, 
-      0,   0,  14,   0,  23,  21, 
-      0,  16,   0,   0,   3,   2, 
-    144,   0,   0,   0, 242, 241, 
-     10,   0,  24,  21,   7,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,   8,  16, 
-      0,   0,   1,   0,   0,   2, 
-     14,   0,  23,  21,   0,  16, 
-      0,   0,   4,   2, 144,   0, 
-      0,   0, 242, 241,  10,   0, 
-     24,  21,  10,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  11,  16,   0,   0, 
-      1,   0,   0,   2,  14,   0, 
-     23,  21,   0,   0,   0,   0, 
-     10,   2,   0,   0,   0,   0, 
-    242, 241,  10,   0,  24,  21, 
-     13,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     14,  16,   0,   0,   1,   0, 
-      0,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  11, 202, 
-     49,   1,  56,   0,   0,   0, 
-      0,  16,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-     11,   0, 255, 255,   4,   0, 
-      0,   0,   3, 128,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     10,  32,  32,  32,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 121,  49, 
-     32,  61,  32,  49,  53,  59, 
-     13,  10,  32,  32,  32,  32, 
-    125,  13,  10,  13,  10,  32, 
-     32,  32,  32, 117, 105, 110, 
-    116,  32, 120,  48,  32,  61, 
-     32,  40, 117, 105, 110, 116, 
-     41,  40, 105, 110, 112, 117, 
-    116,  46,  84, 101, 120,  67, 
-    111, 111, 114, 100,  46, 120, 
-     32,  42,  32,  49,  54,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 117, 105, 110, 116,  32, 
-    120,  49,  32,  61,  32, 120, 
-     48,  32,  43,  32,  49,  59, 
-     13,  10,  32,  32,  32,  32, 
-    105, 102,  32,  40, 120,  49, 
-     32,  62,  61,  32,  49,  54, 
-     41,  13,  10,  32,  32,  32, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    120,  49,  32,  61,  32,  49, 
-     53,  59,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 121, 
-     76, 101, 114, 112,  32,  61, 
-     32,  40, 105, 110, 112, 117, 
-    116,  46,  84, 101, 120,  67, 
-    111, 111, 114, 100,  46, 121, 
-     32,  42,  32,  49,  54,  41, 
-     32,  45,  32,  40, 102, 108, 
-    111,  97, 116,  41, 121,  48, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 120,  76, 101, 114, 112, 
-     32,  61,  32,  40, 105, 110, 
-    112, 117, 116,  46,  84, 101, 
-    120,  67, 111, 111, 114, 100, 
-     46, 120,  32,  42,  32,  49, 
-     54,  41,  32,  45,  32,  40, 
-    102, 108, 111,  97, 116,  41, 
-    120,  48,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  84, 104, 101,  32, 
-     76,  79,  68,  32, 116, 101, 
-    114, 109,  32,  97, 116,  32, 
-    116, 104, 101,  32, 101, 110, 
-    100,  32, 105, 115,  32, 105, 
-    103, 110, 111, 114, 101, 100, 
-     32, 117, 110, 108, 101, 115, 
-    115,  32,  85,  83,  69,  95, 
-     77,  73,  80,  83,  32, 105, 
-    115,  32, 100, 101, 102, 105, 
-    110, 101, 100,  32, 105, 110, 
-     32,  82, 101, 110, 100, 101, 
-    114, 101, 114,  46,  99, 112, 
-    112,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 115,  97, 109, 112, 
-    108, 101,  48,  32,  61,  32, 
-     83, 108, 105,  99, 101, 115, 
-     46,  83,  97, 109, 112, 108, 
-    101,  76, 101, 118, 101, 108, 
-     40,  76, 105, 110, 101,  97, 
-    114,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40, 115, 
-    116,  83,  97, 109, 112, 108, 
-    101,  46, 120, 121,  44,  32, 
-     40, 102, 108, 111,  97, 116, 
-     41,  40, 121,  48,  32,  42, 
-     32,  49,  54,  32,  43,  32, 
-    120,  48,  41,  41,  44,  32, 
-     40,  49,  32,  45,  32, 120, 
-     76, 101, 114, 112,  41,  32, 
-     42,  32,  52,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32, 115,  97, 
-    109, 112, 108, 101,  49,  32, 
-     61,  32,  83, 108, 105,  99, 
-    101, 115,  46,  83,  97, 109, 
-    112, 108, 101,  76, 101, 118, 
-    101, 108,  40,  76, 105, 110, 
-    101,  97, 114,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40, 115, 116,  83,  97, 109, 
-    112, 108, 101,  46, 120, 121, 
-     44,  32,  40, 102, 108, 111, 
-     97, 116,  41,  40, 121,  48, 
-     32,  42,  32,  49,  54,  32, 
-     43,  32, 120,  49,  41,  41, 
-     44,  32,  40, 120,  76, 101, 
-    114, 112,  41,  42,  32,  52, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32, 115,  97, 109, 112, 108, 
-    101,  50,  32,  61,  32,  83, 
-    108, 105,  99, 101, 115,  46, 
-     83,  97, 109, 112, 108, 101, 
-     76, 101, 118, 101, 108,  40, 
-     76, 105, 110, 101,  97, 114, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  51,  40, 115, 116, 
-     83,  97, 109, 112, 108, 101, 
-     46, 120, 121,  44,  32,  40, 
-    102, 108, 111,  97, 116,  41, 
-     40, 121,  49,  32,  42,  32, 
-     49,  54,  32,  43,  32, 120, 
-     48,  41,  41,  44,  32,  40, 
-     49,  32,  45,  32, 120,  76, 
-    101, 114, 112,  41,  32,  42, 
-     32,  52,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32, 115,  97, 109, 
-    112, 108, 101,  51,  32,  61, 
-     32,  83, 108, 105,  99, 101, 
-    115,  46,  83,  97, 109, 112, 
-    108, 101,  76, 101, 118, 101, 
-    108,  40,  76, 105, 110, 101, 
-     97, 114,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-    115, 116,  83,  97, 109, 112, 
-    108, 101,  46, 120, 121,  44, 
-     32,  40, 102, 108, 111,  97, 
-    116,  41,  40, 121,  49,  32, 
-     42,  32,  49,  54,  32,  43, 
-     32, 120,  49,  41,  41,  44, 
-     32,  40, 120,  76, 101, 114, 
-    112,  41,  42,  32,  52,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 115,  97, 109, 112, 
-    108, 101,  48,  49,  32,  61, 
-     32, 108, 101, 114, 112,  40, 
-    115,  97, 109, 112, 108, 101, 
-     48,  44,  32, 115,  97, 109, 
-    112, 108, 101,  49,  44,  32, 
-    120,  76, 101, 114, 112,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    115,  97, 109, 112, 108, 101, 
-     50,  51,  32,  61,  32, 108, 
-    101, 114, 112,  40, 115,  97, 
-    109, 112, 108, 101,  50,  44, 
-     32, 115,  97, 109, 112, 108, 
-    101,  51,  44,  32, 120,  76, 
-    101, 114, 112,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  52,  40, 108, 
-    101, 114, 112,  40, 115,  97, 
-    109, 112, 108, 101,  48,  49, 
-     44,  32, 115,  97, 109, 112, 
-    108, 101,  50,  51,  44,  32, 
-    121,  76, 101, 114, 112,  41, 
-     46, 120, 121, 122,  44,  32, 
-     49,  46, 102,  41,  59,  13, 
-     10,  13,  10,  35, 101, 110, 
-    100, 105, 102,  13,  10, 125, 
-     13,  10,   0,   7,   0,   0, 
-      0,   0,   0,   0,   0,  57, 
-      0,   0,   0,   1,   0,   0, 
-      0,  58,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 114,   0,   0,   0,   4, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     68,  51,  68,  83,  72,  68, 
-     82,   0, 172,   9,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     26,   9,  47, 241,  32,   0, 
-      0,   0,  20,   2,   0,   0, 
-     49,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,  77,   0, 
-      0,   0,   1,   0,   0,   0, 
-     21,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,  32,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0,   0,   0,  24,   0, 
-      0,   0,  36,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     18,   0,  37,  17,   0,   0, 
-      0,   0, 136,   0,   0,   0, 
-      1,   0, 109,  97, 105, 110, 
-      0,   0,  26,   0,  81,  17, 
-      9,  16,   0,   0,   7,   0, 
-    255, 255, 255, 255,   0,   0, 
-    255, 255, 255, 255, 115, 116, 
-     80, 108,  97, 110, 101,   0, 
-     26,   0,  81,  17,  12,  16, 
-      0,   0,   7,   0, 255, 255, 
-    255, 255,   1,   0, 255, 255, 
-    255, 255,  83, 108, 105,  99, 
-    101, 115,   0,   0,  34,   0, 
-     81,  17,  15,  16,   0,   0, 
-      6,   0, 255, 255, 255, 255, 
-    255, 255,   0,   0, 255, 255, 
-     76, 105, 110, 101,  97, 114, 
-     83,  97, 109, 112, 108, 101, 
-    114,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255, 119,   9,  49,   1, 
-      1,   0,   0,   0,  13,   0, 
-      0, 139,  14,   0, 183, 195, 
-     15,   0,   0,   0,  76,   0, 
-      0,   0,  32,   0,   0,   0, 
-     44,   0,   0,   0,  68,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-      0,   0,  25,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0, 172,   9,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      9,   0, 164,   7,   0,   0, 
-      0,   0,   0,   0, 124,   9, 
-      0,   0,   1,   0,   0,   0, 
-     96, 135, 190,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    109,  97, 105, 110,   0, 110, 
-    111, 110, 101,   0,   0,   0, 
-     45, 186,  46, 241,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-    172,   9,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   2,   0, 
-      7,   0,   0,   0,   0,   0, 
-      1,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 172,   9, 
-      0,   0,   8,   2,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,  67,  58, 
-     92,  83, 114,  99,  92,  80, 
-    117,  98, 108, 105,  99,  92, 
-    100, 111, 119, 110, 108, 111, 
-     97, 100, 115,  92,  76, 105, 
-    103, 104, 116,  70, 105, 101, 
-    108, 100,  92,  82, 101, 110, 
-    100, 101, 114,  85,  86,  80, 
-    108,  97, 110, 101,  80,  83, 
-     46, 104, 108, 115, 108,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,  12, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    148,  46,  49,   1, 152,  62, 
-     26,  85,   1,   0,   0,   0, 
-    133, 196, 233, 227, 248, 136, 
-    191,  70, 164,  17, 254, 242, 
-    239, 101,  44,  73, 101,   0, 
-      0,   0,  47,  76, 105, 110, 
-    107,  73, 110, 102, 111,   0, 
-     47, 110,  97, 109, 101, 115, 
-      0,  47, 115, 114,  99,  47, 
-    104, 101,  97, 100, 101, 114, 
-     98, 108, 111,  99, 107,   0, 
-     47, 115, 114,  99,  47, 102, 
-    105, 108, 101, 115,  47,  99, 
-     58,  92, 115, 114,  99,  92, 
-    112, 117,  98, 108, 105,  99, 
-     92, 100, 111, 119, 110, 108, 
-    111,  97, 100, 115,  92, 108, 
-    105, 103, 104, 116, 102, 105, 
-    101, 108, 100,  92, 114, 101, 
-    110, 100, 101, 114, 117, 118, 
-    112, 108,  97, 110, 101, 112, 
-    115,  46, 104, 108, 115, 108, 
-      0,   4,   0,   0,   0,   6, 
-      0,   0,   0,   1,   0,   0, 
-      0,  58,   0,   0,   0,   0, 
-      0,   0,   0,  17,   0,   0, 
-      0,   7,   0,   0,   0,  10, 
-      0,   0,   0,   6,   0,   0, 
-      0,   0,   0,   0,   0,   5, 
-      0,   0,   0,  34,   0,   0, 
-      0,   8,   0,   0,   0,   0, 
-      0,   0,   0,  65, 145,  50, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-     32,   0,   0,   0, 193,   0, 
-      0,   0, 104,   1,   0,   0, 
-     75,   1,   0,   0,  56,   0, 
-      0,   0,   0,   0,   0,   0, 
-     41,   8,   0,   0, 128,   0, 
-      0,   0, 134,   7,   0,   0, 
-     52,  17,   0,   0,  72,   0, 
-      0,   0,   0,   0,   0,   0, 
-     40,   0,   0,   0,  68,   2, 
-      0,   0,  44,   0,   0,   0, 
-    112,   0,   0,   0,   3,   0, 
-      0,   0,  34,   0,   0,   0, 
-     23,   0,   0,   0,  33,   0, 
-      0,   0,  24,   0,   0,   0, 
-     12,   0,   0,   0,   6,   0, 
-      0,   0,  25,   0,   0,   0, 
-     26,   0,   0,   0,  27,   0, 
-      0,   0,  13,   0,   0,   0, 
-      8,   0,   0,   0,   9,   0, 
-      0,   0,  10,   0,   0,   0, 
-     11,   0,   0,   0,  14,   0, 
-      0,   0,  15,   0,   0,   0, 
-     16,   0,   0,   0,  17,   0, 
-      0,   0,  18,   0,   0,   0, 
-     19,   0,   0,   0,  20,   0, 
-      0,   0,  21,   0,   0,   0, 
-     22,   0,   0,   0,   7,   0, 
-      0,   0,  28,   0,   0,   0, 
-     29,   0,   0,   0,  30,   0, 
-      0,   0,  32,   0,   0,   0, 
-     31,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  35,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
+     10,   0,   0,   0,   0,   0, 
+      0,   0,  22,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
@@ -4000,5 +718,5 @@ const BYTE RenderUVPlanePS[] =
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
       0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0
+      0,   0,   0,   0,   0,   0
 };
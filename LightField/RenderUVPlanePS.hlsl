@@ -1,3 +1,11 @@
+cbuffer Constants
+{
+    float4x4 World;
+    float4x4 ViewProjection;
+    uint SlabID;
+    uint AngularResolution;     // Slices per side of the uv plane
+};
+
 struct OutVertex
 {
     float4 Position : SV_POSITION;
@@ -25,35 +33,35 @@ float4 main(OutVertex input) : SV_TARGET
 
 #if 0 // Nearest Neighbor (no filtering on the uv plane, only st plane)
 
-    uint x = (uint)(input.TexCoord.x * 16);
-    uint y = (uint)(input.TexCoord.y * 16);
+    uint x = (uint)(input.TexCoord.x * AngularResolution);
+    uint y = (uint)(input.TexCoord.y * AngularResolution);
 
-    return float4(Slices.Sample(LinearSampler, float3(stSample.xy, (float)(y * 16 + x))).xyz, 1);
+    return float4(Slices.Sample(LinearSampler, float3(stSample.xy, (float)(y * AngularResolution + x))).xyz, 1);
 
 #else // Quadrilinear filtering
 
-    uint y0 = (uint)(input.TexCoord.y * 16);
+    uint y0 = (uint)(input.TexCoord.y * AngularResolution);
     uint y1 = y0 + 1;
-    if (y1 >= 16)
+    if (y1 >= AngularResolution)
     {
-        y1 = 15;
+        y1 = AngularResolution - 1;
     }
 
-    uint x0 = (uint)(input.TexCoord.x * 16);
+    uint x0 = (uint)(input.TexCoord.x * AngularResolution);
     uint x1 = x0 + 1;
-    if (x1 >= 16)
+    if (x1 >= AngularResolution)
     {
-        x1 = 15;
+        x1 = AngularResolution - 1;
     }
 
-    float yLerp = (input.TexCoord.y * 16) - (float)y0;
-    float xLerp = (input.TexCoord.x * 16) - (float)x0;
+    float yLerp = (input.TexCoord.y * AngularResolution) - (float)y0;
+    float xLerp = (input.TexCoord.x * AngularResolution) - (float)x0;
 
     // The LOD term at the end is ignored unless USE_MIPS is defined in Renderer.cpp
-    float4 sample0 = Slices.SampleLevel(LinearSampler, float3(stSample.xy, (float)(y0 * 16 + x0)), (1 - xLerp) * 4);
-        float4 sample1 = Slices.SampleLevel(LinearSampler, float3(stSample.xy, (float)(y0 * 16 + x1)), (xLerp)* 4);
-        float4 sample2 = Slices.SampleLevel(LinearSampler, float3(stSample.xy, (float)(y1 * 16 + x0)), (1 - xLerp) * 4);
-        float4 sample3 = Slices.SampleLevel(LinearSampler, float3(stSample.xy, (float)(y1 * 16 + x1)), (xLerp)* 4);
+    float4 sample0 = Slices.SampleLevel(LinearSampler, float3(stSample.xy, (float)(y0 * AngularResolution + x0)), (1 - xLerp) * 4);
+        float4 sample1 = Slices.SampleLevel(LinearSampler, float3(stSample.xy, (float)(y0 * AngularResolution + x1)), (xLerp)* 4);
+        float4 sample2 = Slices.SampleLevel(LinearSampler, float3(stSample.xy, (float)(y1 * AngularResolution + x0)), (1 - xLerp) * 4);
+        float4 sample3 = Slices.SampleLevel(LinearSampler, float3(stSample.xy, (float)(y1 * AngularResolution + x1)), (xLerp)* 4);
 
         float4 sample01 = lerp(sample0, sample1, xLerp);
         float4 sample23 = lerp(sample2, sample3, xLerp);
@@ -1,6 +1,9 @@
 #include "Precomp.h"
 #include "Debug.h"
 #include "Renderer.h"
+#include "SlabLayout.h"
+#include "LightFieldFile.h"
+#include "CompressedLightField.h"
 #include "RenderPlaneVS.h"
 #include "RenderSTPlanePS.h"
 #include "RenderUVPlanePS.h"
@@ -38,13 +41,22 @@ void Renderer::SetLightField(const LightField& lightField)
 {
     // Copy scene over
     Scene = lightField;
+
+    // Nothing of a compressed light field is on the GPU until the camera looks at it
+    ResidentTiles.clear();
+    TileBlocks.reset();
+    if (Scene.Compressed)
+    {
+        const CompressedLightFieldHeader& header = Scene.Compressed->GetHeader();
+        ResidentTiles.resize(Scene.LightSlabs.size(), std::vector<bool>(GetNumCompressedTiles(header), false));
+
+        uint32_t tileBlocks = header.TileTexels / 4;
+        TileBlocks.reset(new uint8_t[header.TileViews * header.TileViews * tileBlocks * tileBlocks * GetCompressedBlockSize(header)]);
+    }
 }
 
 bool Renderer::Render(FXMMATRIX cameraView, FXMMATRIX cameraProjection, bool vsync)
 {
-    UNREFERENCED_PARAMETER(cameraView);
-    UNREFERENCED_PARAMETER(cameraProjection);
-
     Clear();
 
     Context->RSSetViewports(1, &RenderVP);
@@ -58,13 +70,21 @@ bool Renderer::Render(FXMMATRIX cameraView, FXMMATRIX cameraProjection, bool vsy
 
     Context->VSSetShader(RenderQuadVS.Get(), nullptr, 0);
     Context->VSSetConstantBuffers(0, 1, RenderQuadCB.GetAddressOf());
+    Context->PSSetConstantBuffers(0, 1, RenderQuadCB.GetAddressOf());
 
     Constants constants;
     XMStoreFloat4x4(&constants.ViewProjection, cameraView * cameraProjection);
 
-    for (auto slab : Scene.LightSlabs)
+    for (uint32_t i = 0; i < Scene.LightSlabs.size(); ++i)
     {
+        const LightSlab& slab = Scene.LightSlabs[i];
+        if (Scene.Compressed && !UploadVisibleTiles(i, cameraView, cameraProjection))
+        {
+            return false;
+        }
+
         constants.LightSlabID = slab.ID;
+        constants.AngularResolution = slab.AngularResolution;
         XMStoreFloat4x4(&constants.World, XMLoadFloat4x4(&slab.stQuadWorld));
 
         Context->PSSetShader(RenderSTPS.Get(), nullptr, 0);
@@ -396,40 +416,20 @@ bool Renderer::CreateSimpleOutsideInLightField(LightField* lightField)
     vp.MaxDepth = 1.f;
     Context->RSSetViewports(1, &vp);
 
-    // Create 4 light slabs, one from each direction pointing in
-    XMFLOAT3 directions[] = 
-    {
-        XMFLOAT3(0.f, 0.f, 1.f),
-        XMFLOAT3(0.f, 0.f, -1.f),
-        XMFLOAT3(1.f, 0.f, 0.f),
-        XMFLOAT3(-1.f, 0.f, 0.f),
-    };
+    // Create 4 light slabs, one from each direction pointing in (see SlabLayout.h)
+    static const uint32_t angularResolution = 16;
 
     uint32_t id = 1;
-    for (int i = 0; i < _countof(directions); ++i)
+    for (uint32_t i = 0; i < NumOutsideInSlabs; ++i)
     {
         LightSlab slab;
         slab.ID = id++;
+        slab.AngularResolution = angularResolution;
 
-        // focal plane is inside of object, and small. (-0.5 -> 0.5) on plane tangent to the view direction, placed at origin
-        // camera plane is same orientation as the focal plane, but placed out at 1.f unit along -direction, and is (-2.f -> 2.f)
-
-        // We take 5x5 samples on the uv (camera) plane, and render from each of those perspectives. We need to define a skew projection matrix
-        // such that it maps the st (focal) plane fully onto the camera location
-
-        float zDist = 3.f;
-        float nearZ = 1.f;
-        float farZ = 4.f;
-        float uvStart = -3.f;
-        float uvEnd = 3.f;
-        float stStart = -2.f;
-        float stEnd = 2.f;
-
-        float zRatio = nearZ / zDist;
-
-        float uvStep = (uvEnd - uvStart) / 15.f;
+        // We take angularResolution x angularResolution samples on the uv (camera) plane, and render from each of those perspectives,
+        // with a skew projection matrix that maps the st (focal) plane fully onto the camera location
 
-        td.ArraySize = 16 * 16;
+        td.ArraySize = angularResolution * angularResolution;
         td.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
         td.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
 
@@ -450,37 +450,23 @@ bool Renderer::CreateSimpleOutsideInLightField(LightField* lightField)
             return false;
         }
 
-        XMVECTOR forward = XMLoadFloat3(&directions[i]);
-        XMVECTOR up = XMVectorSet(0.f, 1.f, 0.f, 0.f);
-        XMVECTOR right = XMVector3Cross(up, forward);
+        XMVECTOR forward = GetOutsideInSlabDirection(i);
 
         bool wireframe = false;
 #if defined(WIREFRAME_SCENE)
         wireframe = true;
 #endif
 
-        for (int y = 0; y < 16; ++y)
+        for (uint32_t y = 0; y < angularResolution; ++y)
         {
-            float uvy = uvEnd - (uvStep * y);
-
-            for (int x = 0; x < 16; ++x)
+            for (uint32_t x = 0; x < angularResolution; ++x)
             {
                 static const float clearColor[] = { 0.f, 0.f, 0.f, 1.f };
                 Context->ClearRenderTargetView(rtv.Get(), clearColor);
                 Context->ClearDepthStencilView(dsv.Get(), D3D11_CLEAR_DEPTH, 1.f, 0);
 
-                float uvx = uvStart + (uvStep * x);
-
-                XMMATRIX projection = XMMatrixPerspectiveOffCenterLH(
-                    zRatio * (stStart - uvx), zRatio * (stEnd - uvx),
-                    zRatio * (stStart - uvy), zRatio * (stEnd - uvy),
-                    nearZ,
-                    farZ);
-
-                XMMATRIX view = XMMatrixLookToLH(
-                    right * uvx + up * uvy + forward * -zDist,
-                    forward,
-                    up);
+                XMMATRIX view, projection;
+                GetSliceViewProjection(forward, x, y, angularResolution, &view, &projection);
 
                 basicEffect->SetView(view);
                 basicEffect->SetProjection(projection);
@@ -488,7 +474,7 @@ bool Renderer::CreateSimpleOutsideInLightField(LightField* lightField)
                 obj->Draw(basicEffect.get(), inputLayout.Get(), false, wireframe);
 
                 // Copy output to the appropriate slice
-                Context->CopySubresourceRegion(sliceArray.Get(), D3D11CalcSubresource(0, y * 16 + x, numMips), 0, 0, 0, scratch.Get(), 0, nullptr);
+                Context->CopySubresourceRegion(sliceArray.Get(), D3D11CalcSubresource(0, y * angularResolution + x, numMips), 0, 0, 0, scratch.Get(), 0, nullptr);
             }
         }
 
@@ -502,22 +488,250 @@ bool Renderer::CreateSimpleOutsideInLightField(LightField* lightField)
         Context->GenerateMips(slab.Slices.Get());
 
         // Store the 2 world matrices of the slab planes
-        XMMATRIX worldMatrix;
-        worldMatrix.r[0] = right * (stEnd - stStart);
-        worldMatrix.r[1] = up * (stEnd - stStart);
-        worldMatrix.r[2] = forward;
-        worldMatrix.r[3] = XMVectorSetW(XMVectorZero(), 1.f);
-        XMStoreFloat4x4(&slab.stQuadWorld, worldMatrix);
-
-        // For uv, move position back & scale right * up by 4
-        XMVECTOR position = forward * -zDist;
-        worldMatrix.r[0] = right * (uvEnd - uvStart);
-        worldMatrix.r[1] = up * (uvEnd - uvStart);
-        worldMatrix.r[3] = XMVectorSetW(position, 1.f);
-        XMStoreFloat4x4(&slab.uvQuadWorld, worldMatrix);
+        GetSlabQuadWorlds(forward, &slab.uvQuadWorld, &slab.stQuadWorld);
+
+        lightField->LightSlabs.push_back(slab);
+    }
+
+    return true;
+}
+
+bool Renderer::LoadLightField(const wchar_t* filename, LightField* lightField)
+{
+    lightField->LightSlabs.clear();
+    lightField->Compressed.reset();
+
+    FILE* file = nullptr;
+    if (_wfopen_s(&file, filename, L"rb") != 0 || !file)
+    {
+        LogError(L"Failed to open light field file.");
+        return false;
+    }
+
+    std::unique_ptr<FILE, int (__cdecl *)(FILE*)> fileCloser(file, fclose);
+
+    LightFieldFileHeader header = {};
+    if (fread(&header, sizeof(header), 1, file) != 1)
+    {
+        LogError(L"Not a light field file.");
+        return false;
+    }
+
+    // Compressed light fields start with their own magic, and are read through a mapping instead
+    if (header.Magic == CompressedLightFieldMagic)
+    {
+        fileCloser.reset();
+        return LoadCompressedLightField(filename, lightField);
+    }
+
+    if (header.Magic != LightFieldFileMagic || header.Version != LightFieldFileVersion)
+    {
+        LogError(L"Not a light field file.");
+        return false;
+    }
+
+    if (header.AngularResolution < 1 || header.SpatialResolution < 1 ||
+        header.AngularResolution * header.AngularResolution > D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION ||
+        header.SpatialResolution > D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION)
+    {
+        LogError(L"Light field resolution not supported.");
+        return false;
+    }
+
+    std::vector<LightFieldFileSlab> slabs(header.NumSlabs);
+    if (header.NumSlabs > 0 && fread(slabs.data(), sizeof(LightFieldFileSlab), slabs.size(), file) != slabs.size())
+    {
+        LogError(L"Failed to read light field slabs.");
+        return false;
+    }
+
+    D3D11_TEXTURE2D_DESC td = {};
+    td.ArraySize = header.AngularResolution * header.AngularResolution;
+    td.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+    td.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    td.Width = header.SpatialResolution;
+    td.Height = header.SpatialResolution;
+    td.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+    td.SampleDesc.Count = 1;
+    td.Usage = D3D11_USAGE_DEFAULT;
+
+    int numMips = 1;
+    int w = td.Width;
+    while (w != 1)
+    {
+        ++numMips;
+        w >>= 1;
+    }
+    td.MipLevels = numMips;
+
+    uint32_t sliceSize = (uint32_t)GetLightFieldSliceSize(header);
+    std::unique_ptr<uint8_t[]> slice(new uint8_t[sliceSize]);
+
+    for (auto& fileSlab : slabs)
+    {
+        LightSlab slab;
+        slab.ID = fileSlab.ID;
+        slab.AngularResolution = header.AngularResolution;
+        slab.uvQuadWorld = fileSlab.uvQuadWorld;
+        slab.stQuadWorld = fileSlab.stQuadWorld;
+
+        ComPtr<ID3D11Texture2D> sliceArray;
+        HRESULT hr = Device->CreateTexture2D(&td, nullptr, &sliceArray);
+        if (FAILED(hr))
+        {
+            LogError(L"Failed to create slice array.");
+            return false;
+        }
+
+        if (_fseeki64(file, (int64_t)fileSlab.SliceDataOffset, SEEK_SET) != 0)
+        {
+            LogError(L"Failed to seek to light field slices.");
+            return false;
+        }
+
+        for (uint32_t i = 0; i < td.ArraySize; ++i)
+        {
+            if (fread(slice.get(), sliceSize, 1, file) != 1)
+            {
+                LogError(L"Failed to read light field slice.");
+                return false;
+            }
+
+            Context->UpdateSubresource(sliceArray.Get(), D3D11CalcSubresource(0, i, numMips), nullptr, slice.get(),
+                header.SpatialResolution * sizeof(uint32_t), sliceSize);
+        }
+
+        hr = Device->CreateShaderResourceView(sliceArray.Get(), nullptr, &slab.Slices);
+        if (FAILED(hr))
+        {
+            LogError(L"Failed to create light slab srv.");
+            return false;
+        }
+
+        Context->GenerateMips(slab.Slices.Get());
 
         lightField->LightSlabs.push_back(slab);
     }
 
     return true;
 }
+
+bool Renderer::LoadCompressedLightField(const wchar_t* filename, LightField* lightField)
+{
+    std::shared_ptr<CompressedLightField> compressed(CompressedLightField::Create(filename));
+    if (!compressed)
+    {
+        LogError(L"Failed to open compressed light field file.");
+        return false;
+    }
+
+    const CompressedLightFieldHeader& header = compressed->GetHeader();
+    if (header.AngularResolution * header.AngularResolution > D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION ||
+        header.SpatialResolution > D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION)
+    {
+        LogError(L"Light field resolution not supported.");
+        return false;
+    }
+
+    // The slices stay block compressed on the GPU. Block compressed textures can't be render
+    // targets, so there's no GenerateMips, and the slices only have the top level. They start
+    // out empty, and tiles are filled in as the camera needs them (see UploadVisibleTiles).
+    D3D11_TEXTURE2D_DESC td = {};
+    td.ArraySize = header.AngularResolution * header.AngularResolution;
+    td.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    td.Format = (DXGI_FORMAT)header.Format;
+    td.Width = header.SpatialResolution;
+    td.Height = header.SpatialResolution;
+    td.MipLevels = 1;
+    td.SampleDesc.Count = 1;
+    td.Usage = D3D11_USAGE_DEFAULT;
+
+    for (uint32_t i = 0; i < header.NumSlabs; ++i)
+    {
+        const CompressedLightFieldSlab& fileSlab = compressed->GetSlab(i);
+
+        LightSlab slab;
+        slab.ID = fileSlab.ID;
+        slab.AngularResolution = header.AngularResolution;
+        slab.uvQuadWorld = fileSlab.uvQuadWorld;
+        slab.stQuadWorld = fileSlab.stQuadWorld;
+
+        ComPtr<ID3D11Texture2D> sliceArray;
+        HRESULT hr = Device->CreateTexture2D(&td, nullptr, &sliceArray);
+        if (FAILED(hr))
+        {
+            LogError(L"Failed to create slice array.");
+            return false;
+        }
+
+        hr = Device->CreateShaderResourceView(sliceArray.Get(), nullptr, &slab.Slices);
+        if (FAILED(hr))
+        {
+            LogError(L"Failed to create light slab srv.");
+            return false;
+        }
+
+        lightField->LightSlabs.push_back(slab);
+    }
+
+    lightField->Compressed = compressed;
+    return true;
+}
+
+bool Renderer::UploadVisibleTiles(uint32_t slab, FXMMATRIX cameraView, CXMMATRIX cameraProjection)
+{
+    const CompressedLightField& compressed = *Scene.Compressed;
+    const CompressedLightFieldHeader& header = compressed.GetHeader();
+    uint32_t blockSize = GetCompressedBlockSize(header);
+
+    compressed.GetVisibleTiles(slab, cameraView, cameraProjection, &VisibleTiles);
+
+    ComPtr<ID3D11Resource> sliceArray;
+    for (auto tile : VisibleTiles)
+    {
+        if (ResidentTiles[slab][tile])
+        {
+            continue;
+        }
+
+        if (!sliceArray)
+        {
+            Scene.LightSlabs[slab].Slices->GetResource(&sliceArray);
+        }
+
+        uint32_t tileU, tileV, tileS, tileT;
+        GetCompressedTileCoordinates(header, tile, &tileU, &tileV, &tileS, &tileT);
+
+        if (!compressed.DecodeTile(slab, tileU, tileV, tileS, tileT, TileBlocks.get()))
+        {
+            LogError(L"Failed to decode light field tile.");
+            return false;
+        }
+
+        uint32_t viewsWide, viewsHigh, blocksWide, blocksHigh;
+        compressed.GetTileDimensions(tileU, tileV, tileS, tileT, &viewsWide, &viewsHigh, &blocksWide, &blocksHigh);
+
+        D3D11_BOX box = {};
+        box.left = tileS * header.TileTexels;
+        box.top = tileT * header.TileTexels;
+        box.right = box.left + blocksWide * 4;
+        box.bottom = box.top + blocksHigh * 4;
+        box.back = 1;
+
+        // Each of the tile's views goes into its own part of a slice
+        uint32_t viewSize = blocksWide * blocksHigh * blockSize;
+        for (uint32_t y = 0; y < viewsHigh; ++y)
+        {
+            for (uint32_t x = 0; x < viewsWide; ++x)
+            {
+                uint32_t slice = (tileV * header.TileViews + y) * header.AngularResolution + tileU * header.TileViews + x;
+                Context->UpdateSubresource(sliceArray.Get(), D3D11CalcSubresource(0, slice, 1), &box,
+                    TileBlocks.get() + (y * viewsWide + x) * viewSize, blocksWide * blockSize, viewSize);
+            }
+        }
+
+        ResidentTiles[slab][tile] = true;
+    }
+
+    return true;
+}
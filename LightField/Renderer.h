@@ -1,5 +1,7 @@
 #pragma once
 
+class CompressedLightField;
+
 // A single light slab, which consists of a camera and focal plane.
 // At uniform sampling frequency along the camera plane, skewed perspective
 // renders of the focal plane are rendered and stored in a 2D array of 'slices'.
@@ -20,7 +22,9 @@ struct LightSlab
     XMFLOAT4X4 uvQuadWorld;
     XMFLOAT4X4 stQuadWorld;
 
-    // 2D array of light field slices on uvPlane.
+    // 2D array of light field slices on uvPlane, AngularResolution x AngularResolution
+    // of them, stored in row major order.
+    uint32_t AngularResolution;
     ComPtr<ID3D11ShaderResourceView> Slices;
 };
 
@@ -30,6 +34,10 @@ struct LightSlab
 struct LightField
 {
     std::vector<LightSlab> LightSlabs;
+
+    // Set for light fields loaded from a compressed light field file. The file stays open, and
+    // each tile is uploaded into its slab's Slices the first time the camera can see it.
+    std::shared_ptr<CompressedLightField> Compressed;
 };
 
 // Light Field Renderer
@@ -43,6 +51,10 @@ public:
     // 4 slab outside-in lightfield around it.
     bool CreateSimpleOutsideInLightField(LightField* lightField);
 
+    // Loads a light field baked offline (see SlabBaker) from a light field file, or from
+    // a compressed light field file (see LightFieldCompressor).
+    bool LoadLightField(const wchar_t* filename, LightField* lightField);
+
     // Set the active light field scene
     void SetLightField(const LightField& lightField);
 
@@ -58,6 +70,12 @@ private:
 
     bool Initialize();
 
+    bool LoadCompressedLightField(const wchar_t* filename, LightField* lightField);
+
+    // Decodes and uploads the tiles of a compressed slab in the scene that the camera can see,
+    // and that aren't on the GPU yet
+    bool UploadVisibleTiles(uint32_t slab, FXMMATRIX cameraView, CXMMATRIX cameraProjection);
+
     void Clear();
     bool Present(bool vsync);
 
@@ -73,6 +91,12 @@ private:
     // Current scene
     LightField Scene;
 
+    // For compressed scenes, which tiles of each slab have been uploaded, by tile index
+    // (see GetCompressedTileIndex)
+    std::vector<std::vector<bool>> ResidentTiles;
+    std::vector<uint32_t> VisibleTiles;
+    std::unique_ptr<uint8_t[]> TileBlocks;
+
     // For rendering the light field
     struct SlabVertex
     {
@@ -95,6 +119,7 @@ private:
         XMFLOAT4X4 World;
         XMFLOAT4X4 ViewProjection;
         uint32_t LightSlabID;
-        XMFLOAT3 Padding;
+        uint32_t AngularResolution;
+        XMFLOAT2 Padding;
     };
 };
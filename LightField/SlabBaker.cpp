@@ -0,0 +1,423 @@
+#include "Precomp.h"
+#include "Debug.h"
+#include "SlabBaker.h"
+#include "SlabLayout.h"
+#include "LightFieldFile.h"
+
+// The teapot patches and bezier tessellation from DirectXTK, so the baked teapot
+// matches GeometricPrimitive::CreateTeapot exactly
+#include <Bezier.h>
+
+namespace
+{
+#include <TeapotData.inc>
+}
+
+// Same size & tessellation as the teapot in Renderer::CreateSimpleOutsideInLightField
+static const float TeapotSize = 2.f;
+static const size_t TeapotTessellation = 8;
+
+// BasicEffect lighting parameters (see Renderer::CreateSimpleOutsideInLightField)
+static const float SpecularPower = 15.f;
+
+// Barycentrics of a triangle's corners, as weights of the 2nd and 3rd corner
+static const XMFLOAT2 CornerBarycentrics[3] = { XMFLOAT2(0.f, 0.f), XMFLOAT2(1.f, 0.f), XMFLOAT2(0.f, 1.f) };
+
+// Writes data at the given offset of the file. The offset is passed with each write,
+// so the workers can all write through the same handle without locking.
+static bool WriteAt(HANDLE file, uint64_t offset, const void* data, uint32_t size)
+{
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = (DWORD)offset;
+    overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+    DWORD bytesWritten = 0;
+    if (!WriteFile(file, data, size, &bytesWritten, &overlapped) || bytesWritten != size)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+std::unique_ptr<SlabBaker> SlabBaker::Create()
+{
+    std::unique_ptr<SlabBaker> baker(new SlabBaker());
+    if (baker)
+    {
+        if (!baker->Initialize())
+        {
+            LogError(L"Failed to initialize slab baker.");
+            return nullptr;
+        }
+
+        return baker;
+    }
+    return nullptr;
+}
+
+SlabBaker::SlabBaker()
+{
+}
+
+SlabBaker::~SlabBaker()
+{
+}
+
+bool SlabBaker::Initialize()
+{
+    // Tessellate the teapot the same way GeometricPrimitive::CreateTeapot does
+    XMVECTOR scaleVector = XMVectorReplicate(TeapotSize);
+    XMVECTOR scaleNegateX = scaleVector * g_XMNegateX;
+    XMVECTOR scaleNegateZ = scaleVector * g_XMNegateZ;
+    XMVECTOR scaleNegateXZ = scaleVector * g_XMNegateX * g_XMNegateZ;
+
+    auto tessellatePatch = [&](const TeapotPatch& patch, FXMVECTOR scale, bool isMirrored)
+    {
+        XMVECTOR controlPoints[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            controlPoints[i] = TeapotControlPoints[patch.indices[i]] * scale;
+        }
+
+        uint32_t base = (uint32_t)Vertices.size();
+        Bezier::CreatePatchIndices(TeapotTessellation, isMirrored, [&](size_t index)
+        {
+            Indices.push_back(base + (uint32_t)index);
+        });
+
+        Bezier::CreatePatchVertices(controlPoints, TeapotTessellation, isMirrored, [&](FXMVECTOR position, FXMVECTOR normal, FXMVECTOR)
+        {
+            MeshVertex vertex;
+            XMStoreFloat3(&vertex.Position, position);
+            XMStoreFloat3(&vertex.Normal, normal);
+            Vertices.push_back(vertex);
+        });
+    };
+
+    for (size_t i = 0; i < _countof(TeapotPatches); ++i)
+    {
+        const TeapotPatch& patch = TeapotPatches[i];
+
+        tessellatePatch(patch, scaleVector, false);
+        tessellatePatch(patch, scaleNegateX, true);
+
+        if (patch.mirrorZ)
+        {
+            tessellatePatch(patch, scaleNegateZ, true);
+            tessellatePatch(patch, scaleNegateXZ, false);
+        }
+    }
+
+    // The GPU baker creates the teapot with left handed coordinates, which reverses the winding
+    for (size_t i = 0; i < Indices.size(); i += 3)
+    {
+        std::swap(Indices[i], Indices[i + 2]);
+    }
+
+    XMStoreFloat3(&LightDirections[0], XMVector3Normalize(XMVectorSet(-0.25f, 0.5f, 1.f, 0.f)));
+    XMStoreFloat3(&LightDirections[1], XMVector3Normalize(XMVectorSet(1.f, -1.f, -1.f, 0.f)));
+
+    return true;
+}
+
+bool SlabBaker::Bake(const wchar_t* filename, const SlabBakeSettings& settings)
+{
+    if (settings.AngularResolution < 1 || settings.SpatialResolution < 1 || settings.NumThreads < 1)
+    {
+        LogError(L"Invalid bake settings.");
+        return false;
+    }
+
+    LightFieldFileHeader header = {};
+    header.Magic = LightFieldFileMagic;
+    header.Version = LightFieldFileVersion;
+    header.NumSlabs = NumOutsideInSlabs;
+    header.AngularResolution = settings.AngularResolution;
+    header.SpatialResolution = settings.SpatialResolution;
+
+    std::vector<LightFieldFileSlab> slabs(header.NumSlabs);
+    uint64_t sliceDataOffset = sizeof(header) + sizeof(LightFieldFileSlab) * header.NumSlabs;
+    for (uint32_t i = 0; i < header.NumSlabs; ++i)
+    {
+        LightFieldFileSlab& slab = slabs[i];
+        ZeroMemory(&slab, sizeof(slab));
+        slab.ID = i + 1;
+        slab.SliceDataOffset = sliceDataOffset;
+        GetSlabQuadWorlds(GetOutsideInSlabDirection(i), &slab.uvQuadWorld, &slab.stQuadWorld);
+
+        sliceDataOffset += GetLightFieldSlabSize(header);
+    }
+
+    HANDLE file = CreateFile(filename, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        LogError(L"Failed to create light field file.");
+        return false;
+    }
+
+    if (!WriteAt(file, 0, &header, sizeof(header)) ||
+        !WriteAt(file, sizeof(header), slabs.data(), (uint32_t)(sizeof(LightFieldFileSlab) * slabs.size())))
+    {
+        LogError(L"Failed to write light field header.");
+        CloseHandle(file);
+        return false;
+    }
+
+    // Each worker takes the next view that hasn't been rendered yet, across all the slabs,
+    // renders it into its own target, and writes it to its place in the file
+    uint32_t slicesPerSlab = settings.AngularResolution * settings.AngularResolution;
+    uint32_t numViews = header.NumSlabs * slicesPerSlab;
+    uint32_t sliceSize = (uint32_t)GetLightFieldSliceSize(header);
+
+    std::atomic<uint32_t> nextView(0);
+    std::atomic<bool> failed(false);
+
+    auto worker = [&]()
+    {
+        SliceTarget target;
+
+        for (uint32_t i = nextView++; i < numViews && !failed; i = nextView++)
+        {
+            uint32_t slab = i / slicesPerSlab;
+            uint32_t slice = i % slicesPerSlab;
+
+            XMMATRIX view, projection;
+            GetSliceViewProjection(GetOutsideInSlabDirection(slab), slice % settings.AngularResolution,
+                slice / settings.AngularResolution, settings.AngularResolution, &view, &projection);
+
+            RenderSlice(view, projection, settings.SpatialResolution, &target);
+
+            if (!WriteAt(file, slabs[slab].SliceDataOffset + (uint64_t)slice * sliceSize, target.Pixels.data(), sliceSize))
+            {
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < settings.NumThreads; ++i)
+    {
+        threads.push_back(std::thread(worker));
+    }
+
+    worker();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CloseHandle(file);
+
+    if (failed)
+    {
+        LogError(L"Failed to write light field slices.");
+        return false;
+    }
+
+    return true;
+}
+
+void SlabBaker::RenderSlice(FXMMATRIX view, CXMMATRIX projection, uint32_t resolution, SliceTarget* target)
+{
+    uint32_t numPixels = resolution * resolution;
+    target->Depth.assign(numPixels, 1.f);
+    target->Triangle.assign(numPixels, ~0u);
+    target->Barycentrics.resize(numPixels);
+    target->Pixels.resize(numPixels);
+    target->ClipPositions.resize(Vertices.size());
+
+    XMMATRIX viewProjection = view * projection;
+    for (size_t i = 0; i < Vertices.size(); ++i)
+    {
+        XMStoreFloat4(&target->ClipPositions[i], XMVector3Transform(XMLoadFloat3(&Vertices[i].Position), viewProjection));
+    }
+
+    uint32_t numTriangles = (uint32_t)Indices.size() / 3;
+    for (uint32_t triangle = 0; triangle < numTriangles; ++triangle)
+    {
+        XMFLOAT4 clip[3];
+        int numInside = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            clip[i] = target->ClipPositions[Indices[triangle * 3 + i]];
+            numInside += (clip[i].z >= 0.f) ? 1 : 0;
+        }
+
+        if (numInside == 3)
+        {
+            RasterizeTriangle(triangle, clip, CornerBarycentrics, resolution, target);
+        }
+        else if (numInside > 0)
+        {
+            // Clip to the near plane (z >= 0), which leaves a triangle or a quad. The new corners
+            // carry their barycentrics in the original triangle, for looking up attributes later.
+            XMFLOAT4 polygon[4];
+            XMFLOAT2 polygonBarycentrics[4];
+            int numCorners = 0;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                int j = (i + 1) % 3;
+                const XMFLOAT4& a = clip[i];
+                const XMFLOAT4& b = clip[j];
+
+                if (a.z >= 0.f)
+                {
+                    polygon[numCorners] = a;
+                    polygonBarycentrics[numCorners] = CornerBarycentrics[i];
+                    ++numCorners;
+                }
+
+                if ((a.z >= 0.f) != (b.z >= 0.f))
+                {
+                    float t = a.z / (a.z - b.z);
+                    XMStoreFloat4(&polygon[numCorners], XMVectorLerp(XMLoadFloat4(&a), XMLoadFloat4(&b), t));
+                    polygon[numCorners].z = 0.f;
+                    XMStoreFloat2(&polygonBarycentrics[numCorners], XMVectorLerp(XMLoadFloat2(&CornerBarycentrics[i]),
+                        XMLoadFloat2(&CornerBarycentrics[j]), t));
+                    ++numCorners;
+                }
+            }
+
+            for (int i = 1; i + 1 < numCorners; ++i)
+            {
+                XMFLOAT4 fanClip[3] = { polygon[0], polygon[i], polygon[i + 1] };
+                XMFLOAT2 fanBarycentrics[3] = { polygonBarycentrics[0], polygonBarycentrics[i], polygonBarycentrics[i + 1] };
+                RasterizeTriangle(triangle, fanClip, fanBarycentrics, resolution, target);
+            }
+        }
+    }
+
+    // Shade only the visible surface, once per pixel. Empty space is cleared to black, like the GPU baker.
+    XMVECTOR eyePosition = XMMatrixInverse(nullptr, view).r[3];
+    for (uint32_t i = 0; i < numPixels; ++i)
+    {
+        target->Pixels[i] = (target->Triangle[i] != ~0u) ? ShadePixel(target->Triangle[i], target->Barycentrics[i], eyePosition) : 0xff000000;
+    }
+}
+
+void SlabBaker::RasterizeTriangle(uint32_t triangle, const XMFLOAT4 clip[3], const XMFLOAT2 barycentrics[3],
+    uint32_t resolution, SliceTarget* target)
+{
+    float size = (float)resolution;
+
+    // Project to pixel coordinates, with y down
+    float x[3], y[3], z[3], invW[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        invW[i] = 1.f / clip[i].w;
+        x[i] = (clip[i].x * invW[i] * 0.5f + 0.5f) * size;
+        y[i] = (0.5f - clip[i].y * invW[i] * 0.5f) * size;
+        z[i] = clip[i].z * invW[i];
+    }
+
+    // Front faces wind clockwise on screen (the D3D default), which is a positive area with y down
+    float area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    if (area <= 0.f)
+    {
+        return;
+    }
+
+    float minX = max(min(min(x[0], x[1]), x[2]), 0.f);
+    float maxX = min(max(max(x[0], x[1]), x[2]), size - 1.f);
+    float minY = max(min(min(y[0], y[1]), y[2]), 0.f);
+    float maxY = min(max(max(y[0], y[1]), y[2]), size - 1.f);
+    if (minX > maxX || minY > maxY)
+    {
+        return;
+    }
+
+    float invArea = 1.f / area;
+
+    for (int py = (int)minY; py <= (int)maxY; ++py)
+    {
+        float cy = (float)py + 0.5f;
+
+        for (int px = (int)minX; px <= (int)maxX; ++px)
+        {
+            float cx = (float)px + 0.5f;
+
+            float w0 = (x[2] - x[1]) * (cy - y[1]) - (y[2] - y[1]) * (cx - x[1]);
+            float w1 = (x[0] - x[2]) * (cy - y[2]) - (y[0] - y[2]) * (cx - x[2]);
+            float w2 = (x[1] - x[0]) * (cy - y[0]) - (y[1] - y[0]) * (cx - x[0]);
+            if (w0 < 0.f || w1 < 0.f || w2 < 0.f)
+            {
+                continue;
+            }
+
+            w0 *= invArea;
+            w1 *= invArea;
+            w2 *= invArea;
+
+            uint32_t pixel = py * resolution + px;
+            float depth = w0 * z[0] + w1 * z[1] + w2 * z[2];
+            if (depth >= target->Depth[pixel])
+            {
+                continue;
+            }
+
+            // Perspective correct weights of the 3 corners
+            float p0 = w0 * invW[0];
+            float p1 = w1 * invW[1];
+            float p2 = w2 * invW[2];
+            float invSum = 1.f / (p0 + p1 + p2);
+            p0 *= invSum;
+            p1 *= invSum;
+            p2 *= invSum;
+
+            target->Depth[pixel] = depth;
+            target->Triangle[pixel] = triangle;
+            target->Barycentrics[pixel].x = p0 * barycentrics[0].x + p1 * barycentrics[1].x + p2 * barycentrics[2].x;
+            target->Barycentrics[pixel].y = p0 * barycentrics[0].y + p1 * barycentrics[1].y + p2 * barycentrics[2].y;
+        }
+    }
+}
+
+// Per pixel BasicEffect lighting (see ComputeLights in DirectXTK's Lighting.fxh), with a
+// white diffuse material and no ambient, emissive or fog
+uint32_t SlabBaker::ShadePixel(uint32_t triangle, const XMFLOAT2& barycentrics, FXMVECTOR eyePosition)
+{
+    const MeshVertex& v0 = Vertices[Indices[triangle * 3]];
+    const MeshVertex& v1 = Vertices[Indices[triangle * 3 + 1]];
+    const MeshVertex& v2 = Vertices[Indices[triangle * 3 + 2]];
+
+    float b0 = 1.f - barycentrics.x - barycentrics.y;
+
+    XMVECTOR position = XMLoadFloat3(&v0.Position) * b0 +
+        XMLoadFloat3(&v1.Position) * barycentrics.x +
+        XMLoadFloat3(&v2.Position) * barycentrics.y;
+
+    XMVECTOR normal = XMVector3Normalize(XMLoadFloat3(&v0.Normal) * b0 +
+        XMLoadFloat3(&v1.Normal) * barycentrics.x +
+        XMLoadFloat3(&v2.Normal) * barycentrics.y);
+
+    XMVECTOR eyeVector = XMVector3Normalize(eyePosition - position);
+
+    float diffuse = 0.f;
+    float specular = 0.f;
+    for (size_t i = 0; i < _countof(LightDirections); ++i)
+    {
+        XMVECTOR lightDirection = XMLoadFloat3(&LightDirections[i]);
+
+        float dotL = XMVectorGetX(XMVector3Dot(-lightDirection, normal));
+        if (dotL < 0.f)
+        {
+            continue;
+        }
+
+        diffuse += dotL;
+
+        if (i == 0)
+        {
+            XMVECTOR halfVector = XMVector3Normalize(eyeVector - lightDirection);
+            float dotH = XMVectorGetX(XMVector3Dot(halfVector, normal));
+            specular += powf(max(dotH, 0.f), SpecularPower);
+        }
+    }
+
+    uint32_t rg = (uint32_t)(min(specular, 1.f) * 255.f + 0.5f);
+    uint32_t b = (uint32_t)(min(diffuse + specular, 1.f) * 255.f + 0.5f);
+    return 0xff000000 | (b << 16) | (rg << 8) | rg;
+}
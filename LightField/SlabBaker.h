@@ -0,0 +1,60 @@
+#pragma once
+
+struct SlabBakeSettings
+{
+    uint32_t AngularResolution;     // Views per side of the uv (camera) plane
+    uint32_t SpatialResolution;     // Texels per side of each slice
+    uint32_t NumThreads;
+};
+
+// Headless light field baker. Bakes the same teapot scene and slabs as
+// Renderer::CreateSimpleOutsideInLightField, but renders the views with a small
+// software rasterizer on worker threads instead of on the GPU, and streams each
+// slice straight into a light field file (see LightFieldFile.h) once it's done.
+class SlabBaker
+{
+public:
+    static std::unique_ptr<SlabBaker> Create();
+    ~SlabBaker();
+
+    bool Bake(const wchar_t* filename, const SlabBakeSettings& settings);
+
+private:
+    SlabBaker();
+
+    // No copy
+    SlabBaker(const SlabBaker&);
+    SlabBaker& operator= (const SlabBaker&);
+
+    bool Initialize();
+
+    // Per thread render target
+    struct SliceTarget
+    {
+        std::vector<XMFLOAT4> ClipPositions;    // Mesh vertices in clip space
+        std::vector<float> Depth;
+        std::vector<uint32_t> Triangle;         // Nearest triangle, or ~0 for none
+        std::vector<XMFLOAT2> Barycentrics;     // Weights of the nearest triangle's 2nd and 3rd vertex
+        std::vector<uint32_t> Pixels;           // R8G8B8A8
+    };
+
+    void RenderSlice(FXMMATRIX view, CXMMATRIX projection, uint32_t resolution, SliceTarget* target);
+    void RasterizeTriangle(uint32_t triangle, const XMFLOAT4 clip[3], const XMFLOAT2 barycentrics[3],
+        uint32_t resolution, SliceTarget* target);
+    uint32_t ShadePixel(uint32_t triangle, const XMFLOAT2& barycentrics, FXMVECTOR eyePosition);
+
+private:
+    // The scene, which is tessellated once up front
+    struct MeshVertex
+    {
+        XMFLOAT3 Position;
+        XMFLOAT3 Normal;
+    };
+
+    std::vector<MeshVertex> Vertices;
+    std::vector<uint32_t> Indices;
+
+    // The 2 lights of the BasicEffect used by the GPU baker. Both are blue, and only
+    // the first has a specular color (white).
+    XMFLOAT3 LightDirections[2];
+};
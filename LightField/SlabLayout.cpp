@@ -0,0 +1,72 @@
+#include "Precomp.h"
+#include "SlabLayout.h"
+
+// camera plane is same orientation as the focal plane, but placed out at zDist units along -direction
+static const float zDist = 3.f;
+static const float nearZ = 1.f;
+static const float farZ = 4.f;
+static const float uvStart = -3.f;
+static const float uvEnd = 3.f;
+static const float stStart = -2.f;
+static const float stEnd = 2.f;
+
+// One slab from each direction pointing in
+static const XMFLOAT3 SlabDirections[NumOutsideInSlabs] =
+{
+    XMFLOAT3(0.f, 0.f, 1.f),
+    XMFLOAT3(0.f, 0.f, -1.f),
+    XMFLOAT3(1.f, 0.f, 0.f),
+    XMFLOAT3(-1.f, 0.f, 0.f),
+};
+
+XMVECTOR GetOutsideInSlabDirection(uint32_t slab)
+{
+    assert(slab < NumOutsideInSlabs);
+    return XMLoadFloat3(&SlabDirections[slab]);
+}
+
+void GetSliceViewProjection(FXMVECTOR forward, uint32_t x, uint32_t y, uint32_t angularResolution,
+    XMMATRIX* view, XMMATRIX* projection)
+{
+    XMVECTOR up = XMVectorSet(0.f, 1.f, 0.f, 0.f);
+    XMVECTOR right = XMVector3Cross(up, forward);
+
+    float zRatio = nearZ / zDist;
+
+    // The first and last samples sit on the edges of the uv plane
+    float uvStep = (angularResolution > 1) ? (uvEnd - uvStart) / (float)(angularResolution - 1) : 0.f;
+
+    float uvx = uvStart + (uvStep * x);
+    float uvy = uvEnd - (uvStep * y);
+
+    *projection = XMMatrixPerspectiveOffCenterLH(
+        zRatio * (stStart - uvx), zRatio * (stEnd - uvx),
+        zRatio * (stStart - uvy), zRatio * (stEnd - uvy),
+        nearZ,
+        farZ);
+
+    *view = XMMatrixLookToLH(
+        right * uvx + up * uvy + forward * -zDist,
+        forward,
+        up);
+}
+
+void GetSlabQuadWorlds(FXMVECTOR forward, XMFLOAT4X4* uvQuadWorld, XMFLOAT4X4* stQuadWorld)
+{
+    XMVECTOR up = XMVectorSet(0.f, 1.f, 0.f, 0.f);
+    XMVECTOR right = XMVector3Cross(up, forward);
+
+    XMMATRIX worldMatrix;
+    worldMatrix.r[0] = right * (stEnd - stStart);
+    worldMatrix.r[1] = up * (stEnd - stStart);
+    worldMatrix.r[2] = forward;
+    worldMatrix.r[3] = XMVectorSetW(XMVectorZero(), 1.f);
+    XMStoreFloat4x4(stQuadWorld, worldMatrix);
+
+    // For uv, move position back & scale right * up by the size of the uv plane
+    XMVECTOR position = forward * -zDist;
+    worldMatrix.r[0] = right * (uvEnd - uvStart);
+    worldMatrix.r[1] = up * (uvEnd - uvStart);
+    worldMatrix.r[3] = XMVectorSetW(position, 1.f);
+    XMStoreFloat4x4(uvQuadWorld, worldMatrix);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+// Layout of the simple outside-in light field: 4 slabs looking in at the origin from
+// -z, +z, -x and +x. The focal (st) plane of each slab passes through the origin, and
+// the camera (uv) plane sits parallel to it, further out along -direction. Both the GPU
+// baker in Renderer and the offline SlabBaker place their views with these helpers.
+static const uint32_t NumOutsideInSlabs = 4;
+
+// Direction the given slab looks along
+XMVECTOR GetOutsideInSlabDirection(uint32_t slab);
+
+// Returns the view and skewed perspective projection for the camera at grid position
+// (x, y) of an angularResolution x angularResolution grid on the uv plane. The
+// projection maps the whole st plane onto the view.
+void GetSliceViewProjection(FXMVECTOR forward, uint32_t x, uint32_t y, uint32_t angularResolution,
+    XMMATRIX* view, XMMATRIX* projection);
+
+// Returns the world matrices of the unit quads that are drawn for the uv and st planes
+void GetSlabQuadWorlds(FXMVECTOR forward, XMFLOAT4X4* uvQuadWorld, XMFLOAT4X4* stQuadWorld);